@@ -16,6 +16,7 @@
 #include "nsEventShell.h"
 #include "nsIIOService.h"
 #include "nsLayoutUtils.h"
+#include "nsPrintfCString.h"
 #include "nsTextEquivUtils.h"
 #include "mozilla/a11y/Role.h"
 #include "TreeWalker.h"
@@ -1710,7 +1711,12 @@ void DocAccessible::DoInitialUpdate() {
   UpdateRootElIfNeeded();
 
   // Build initial tree.
+  TimeStamp treeStart = TimeStamp::Now();
   CacheChildrenInSubtree(this);
+  PROFILER_MARKER_TEXT(
+      "DocAccessible initial tree", A11Y,
+      MarkerTiming::IntervalUntilNowFrom(treeStart),
+      nsPrintfCString("%u accessibles", mAccessibleCache.Count()));
 #ifdef A11Y_LOG
   if (logging::IsEnabled(logging::eVerbose)) {
     logging::Tree("TREE", "Initial subtree", this);
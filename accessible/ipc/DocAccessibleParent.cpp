@@ -12,6 +12,7 @@
 #include "mozilla/dom/BrowserBridgeParent.h"
 #include "mozilla/dom/BrowserParent.h"
 #include "mozilla/dom/CanonicalBrowsingContext.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "nsAccessibilityService.h"
 #include "xpcAccessibleDocument.h"
 #include "xpcAccEvents.h"
@@ -599,6 +600,11 @@ mozilla::ipc::IPCResult DocAccessibleParent::RecvCache(
     return IPC_OK();
   }
 
+  // The counterpart of DocAccessible::ProcessQueuedCacheUpdates in the
+  // content process, to see how long applying a batch stalls this thread.
+  AUTO_PROFILER_MARKER_TEXT("DocAccessibleParent::RecvCache", A11Y, {},
+                            nsPrintfCString("%zu accessibles", aData.Length()));
+
   for (auto& entry : aData) {
     RemoteAccessible* remote = GetAccessible(entry.ID());
     if (!remote) {
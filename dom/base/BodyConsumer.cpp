@@ -22,6 +22,7 @@
 #include "mozilla/dom/WorkerRunnable.h"
 #include "mozilla/dom/WorkerScope.h"
 #include "mozilla/ipc/PBackgroundSharedTypes.h"
+#include "mozilla/InputStreamLengthHelper.h"
 #include "mozilla/ScopeExit.h"
 #include "mozilla/TaskQueue.h"
 #include "nsComponentManagerUtils.h"
@@ -511,6 +512,14 @@ void BodyConsumer::BeginConsumeBodyMainThread(ThreadSafeWorkerRef* aWorkerRef) {
     }
   }
 
+  // The pump isn't a channel, so the stream loader can't get the length from
+  // it. Blob streams know theirs, which lets the loader read e.g. a blob made
+  // of many slices into a single allocation.
+  int64_t length = -1;
+  if (mConsumeType != ConsumeType::Blob) {
+    InputStreamLengthHelper::GetSyncLength(mBodyStream, &length);
+  }
+
   nsCOMPtr<nsIInputStreamPump> pump;
   nsresult rv =
       NS_NewInputStreamPump(getter_AddRefs(pump), mBodyStream.forget(), 0, 0,
@@ -533,6 +542,10 @@ void BodyConsumer::BeginConsumeBodyMainThread(ThreadSafeWorkerRef* aWorkerRef) {
       return;
     }
 
+    if (length >= 0) {
+      loader->SetExpectedLength(length);
+    }
+
     listener = loader;
   }
 
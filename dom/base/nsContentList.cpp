@@ -1088,6 +1088,22 @@ JSObject* nsCacheableFuncStringHTMLCollection::WrapObject(
   return HTMLCollection_Binding::Wrap(cx, this, aGivenProto);
 }
 
+void nsCacheableFuncStringHTMLCollection::AttributeChanged(
+    Element* aElement, int32_t aNameSpaceID, nsAtom* aAttribute,
+    int32_t aModType, const nsAttrValue* aOldValue) {
+  // No need to match aElement again if the changed attribute is not the class
+  // attribute. Besides the call to the match function, that would look for
+  // aElement in the whole list when it doesn't match, for every change of
+  // e.g. a style or data attribute.
+  if (aAttribute != nsGkAtoms::_class || aNameSpaceID != kNameSpaceID_None) {
+    InvalidateNamedItemsCacheForAttributeChange(aNameSpaceID, aAttribute);
+    return;
+  }
+
+  nsCacheableFuncStringContentList::AttributeChanged(
+      aElement, aNameSpaceID, aAttribute, aModType, aOldValue);
+}
+
 //-----------------------------------------------------
 // nsLabelsNodeList
 
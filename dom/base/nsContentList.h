@@ -609,6 +609,9 @@ class nsCacheableFuncStringHTMLCollection
                                          aDataAllocator, aString,
                                          eHTMLCollection) {}
 
+  // Only used by getElementsByClassName, so only the class attribute matters.
+  NS_DECL_NSIMUTATIONOBSERVER_ATTRIBUTECHANGED
+
   JSObject* WrapObject(JSContext* cx,
                        JS::Handle<JSObject*> aGivenProto) override;
 
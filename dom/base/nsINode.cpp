@@ -2898,6 +2898,12 @@ nsINode* nsINode::ReplaceOrInsertBefore(bool aReplace, nsINode* aNewChild,
       return result;
     }
 
+    // When appending, observers get a single ContentAppended for the whole
+    // range of inserted children, which also lets the frame constructor build
+    // their frames in one go. nsIMutationObserver has no ranged counterpart of
+    // ContentInserted, so insertions before an existing child are notified one
+    // by one, but MutationObserver still gets a single record through the
+    // mutation batch.
     bool appending = !IsDocument() && !nodeToInsertBefore;
     nsIContent* firstInsertedContent = fragChildren->ElementAt(0);
 
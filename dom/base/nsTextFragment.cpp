@@ -158,7 +158,7 @@ static inline int32_t FirstNon8BitUnvectorized(const char16_t* str,
   return -1;
 }
 
-#if defined(MOZILLA_MAY_SUPPORT_SSE2)
+#if defined(MOZILLA_MAY_SUPPORT_SSE2) || defined(__aarch64__)
 #  include "nsTextFragmentGenericFwd.h"
 #endif
 
@@ -182,6 +182,8 @@ static inline int32_t FirstNon8Bit(const char16_t* str, const char16_t* end) {
   if (mozilla::supports_sse2()) {
     return mozilla::FirstNon8Bit<xsimd::sse2>(str, end);
   }
+#elif defined(__aarch64__)
+  return mozilla::FirstNon8Bit<xsimd::neon>(str, end);
 #elif defined(__powerpc__)
   if (mozilla::supports_vmx()) {
     return mozilla::VMX::FirstNon8Bit(str, end);
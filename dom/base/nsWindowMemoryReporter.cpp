@@ -451,6 +451,11 @@ static void CollectWindowReports(nsGlobalWindowInner* aWindow,
 #include "nsPresArenaObjectList.h"
 #undef PRES_ARENA_OBJECT
 
+  REPORT_SIZE("/layout/pres-arena/free-entries",
+              mLayoutPresArenaFreeEntriesSize,
+              "Memory used by objects freed from the pres arena, kept to be "
+              "reused for new objects of the same type, within a window.");
+
   if (presArenaSundriesSize > 0) {
     REPORT_SUM_SIZE(
         "/layout/pres-arena/sundries", presArenaSundriesSize,
@@ -657,6 +662,7 @@ nsWindowMemoryReporter::CollectReports(nsIHandleReportCallback* aHandleReport,
   presArenaTotal += windowTotalSizes.mArenaSizes.NS_ARENA_SIZES_FIELD(name_);
 #include "nsPresArenaObjectList.h"
 #undef PRES_ARENA_OBJECT
+  presArenaTotal += windowTotalSizes.mLayoutPresArenaFreeEntriesSize;
 
   REPORT("window-objects/layout/pres-arena", presArenaTotal,
          "Memory used for the pres arena within windows. "
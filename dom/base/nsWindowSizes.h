@@ -171,6 +171,7 @@ class nsWindowSizes {
   MACRO(Style, mLayoutShadowDomStyleSheetsSize)              \
   MACRO(Style, mLayoutShadowDomAuthorStyles)                 \
   MACRO(Other, mLayoutPresShellSize)                         \
+  MACRO(Other, mLayoutPresArenaFreeEntriesSize)              \
   MACRO(Other, mLayoutRetainedDisplayListSize)               \
   MACRO(Style, mLayoutStyleSetsStylistRuleTree)              \
   MACRO(Style, mLayoutStyleSetsStylistElementAndPseudosMaps) \
@@ -29,6 +29,7 @@
 #include "mozilla/layers/TextureClientSharedSurface.h"
 #include "mozilla/layers/WebRenderUserData.h"
 #include "mozilla/layers/WebRenderCanvasRenderer.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/ResultVariant.h"
 #include "mozilla/ScopeExit.h"
 #include "mozilla/StaticPrefs_webgl.h"
@@ -520,6 +521,15 @@ void ClientWebGLContext::Present(WebGLFramebufferJS* const xrFb,
   webgl::SwapChainOptions asyncOptions =
       PrepareAsyncSwapChainOptions(xrFb, webvr, options);
   Run<RPROC(Present)>(xrFb ? xrFb->mId : 0, type, webvr, asyncOptions);
+
+  if (!IsContextLost() && mNotLost->outOfProcess) {
+    auto& info = mNotLost->outOfProcess->GetFlushedCmdInfo();
+    if (info.syncIpcs) {
+      PROFILER_MARKER_TEXT("WebGL sync IPCs", GRAPHICS, {},
+                           nsPrintfCString("%zu this frame", info.syncIpcs));
+      info.syncIpcs = 0;
+    }
+  }
 }
 
 void ClientWebGLContext::CopyToSwapChain(
@@ -573,9 +583,11 @@ Maybe<layers::SurfaceDescriptor> ClientWebGLContext::GetFrontBuffer(
     }
   }
 
-  if (needsSync &&
-      !child->SendGetFrontBuffer(fb ? fb->mId : 0, vr, &syncDesc)) {
-    return {};
+  if (needsSync) {
+    info.syncIpcs += 1;
+    if (!child->SendGetFrontBuffer(fb ? fb->mId : 0, vr, &syncDesc)) {
+      return {};
+    }
   }
 
   // Reset flushesSinceLastCongestionCheck
@@ -1018,7 +1030,7 @@ uvec2 ClientWebGLContext::DrawingBufferSize() {
       size = Some(inProcess->DrawingBufferSize());
     } else {
       const auto& child = mNotLost->outOfProcess;
-      child->FlushPendingCmds();
+      child->FlushPendingCmdsForSync();
       uvec2 actual = {};
       if (!child->SendDrawingBufferSize(&actual)) return {};
       size = Some(actual);
@@ -1201,7 +1213,7 @@ RefPtr<gfx::SourceSurface> ClientWebGLContext::GetFrontBufferSnapshot(
     return surf;
   }
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   webgl::FrontBufferSnapshotIpc res;
   if (!child->SendGetFrontBufferSnapshot(&res)) {
     res = {};
@@ -1412,7 +1424,7 @@ ClientWebGLContext::CreateOpaqueFramebuffer(
       return ret.forget();
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     bool ok = false;
     if (!child->SendCreateOpaqueFramebuffer(ret->mId, options, &ok))
       return nullptr;
@@ -1985,7 +1997,7 @@ void ClientWebGLContext::GetInternalformatParameter(
                                                          pname);
   } else {
     const auto& child = notLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     if (!child->SendGetInternalformatParameter(target, internalformat, pname,
                                                &maybe)) {
       return;
@@ -2029,7 +2041,7 @@ Maybe<double> ClientWebGLContext::GetNumber(const GLenum pname) {
   }
 
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
 
   Maybe<double> ret;
   if (!child->SendGetNumber(pname, &ret)) {
@@ -2046,13 +2058,34 @@ Maybe<std::string> ClientWebGLContext::GetString(const GLenum pname) {
     return inProcess->GetString(pname);
   }
 
+  // These don't change for the lifetime of the context, so only ask the host
+  // once.
+  bool isConstant = false;
+  switch (pname) {
+    case LOCAL_GL_EXTENSIONS:
+    case LOCAL_GL_RENDERER:
+    case LOCAL_GL_VENDOR:
+    case LOCAL_GL_VERSION:
+      isConstant = true;
+      break;
+  }
+  auto& hostStrings = mNotLost->state.mHostStrings;
+  if (isConstant) {
+    if (const auto* const cached = MaybeFind(hostStrings, pname)) {
+      return Some(*cached);
+    }
+  }
+
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
 
   Maybe<std::string> ret;
   if (!child->SendGetString(pname, &ret)) {
     ret.reset();
   }
+  if (ret && isConstant) {
+    hostStrings[pname] = *ret;
+  }
   return ret;
 }
 
@@ -2217,6 +2250,12 @@ void ClientWebGLContext::GetParameter(JSContext* cx, GLenum pname,
       return;
   }
 
+  // Capabilities are shadowed for isEnabled(), so don't ask the host for them.
+  if (const auto* const isEnabled = MaybeFind(state.mIsEnabledMap, pname)) {
+    retval.set(JS::BooleanValue(*isEnabled));
+    return;
+  }
+
   if (mIsWebGL2) {
     switch (pname) {
       case LOCAL_GL_COPY_READ_BUFFER_BINDING:
@@ -2519,7 +2558,7 @@ void ClientWebGLContext::GetBufferParameter(
       return inProcess->GetBufferParameter(target, pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetBufferParameter(target, pname, &ret)) {
       ret.reset();
@@ -2573,7 +2612,7 @@ void ClientWebGLContext::GetFramebufferAttachmentParameter(
                                                           pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetFramebufferAttachmentParameter(fbId, attachment, pname,
                                                       &ret)) {
@@ -2648,7 +2687,7 @@ void ClientWebGLContext::GetRenderbufferParameter(
       return inProcess->GetRenderbufferParameter(rbId, pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetRenderbufferParameter(rbId, pname, &ret)) {
       ret.reset();
@@ -2700,7 +2739,7 @@ void ClientWebGLContext::GetIndexedParameter(
       return inProcess->GetIndexedParameter(target, index);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetIndexedParameter(target, index, &ret)) {
       ret.reset();
@@ -2756,7 +2795,7 @@ void ClientWebGLContext::GetUniform(JSContext* const cx,
       return inProcess->GetUniform(prog.mId, loc.mLocation);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     webgl::GetUniformData ret;
     if (!child->SendGetUniform(prog.mId, loc.mLocation, &ret)) {
       ret = {};
@@ -2878,7 +2917,7 @@ ClientWebGLContext::GetShaderPrecisionFormat(const GLenum shadertype,
       return inProcess->GetShaderPrecisionFormat(shadertype, precisiontype);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<webgl::ShaderPrecisionFormat> ret;
     if (!child->SendGetShaderPrecisionFormat(shadertype, precisiontype, &ret)) {
       ret.reset();
@@ -2935,7 +2974,7 @@ GLenum ClientWebGLContext::CheckFramebufferStatus(GLenum target) {
     return inProcess->CheckFramebufferStatus(target);
   }
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   GLenum ret = 0;
   if (!child->SendCheckFramebufferStatus(target, &ret)) {
     ret = 0;
@@ -3077,7 +3116,7 @@ void ClientWebGLContext::Finish() {
     return;
   }
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   (void)child->SendFinish();
 }
 
@@ -3097,7 +3136,7 @@ GLenum ClientWebGLContext::GetError() {
     return inProcess->GetError();
   }
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   GLenum ret = 0;
   if (!child->SendGetError(&ret)) {
     ret = 0;
@@ -3475,7 +3514,7 @@ void ClientWebGLContext::GetBufferSubData(GLenum target, GLintptr srcByteOffset,
     }
 
     const auto& child = notLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     mozilla::ipc::Shmem rawShmem;
     if (!child->SendGetBufferSubData(target, srcByteOffset, destView->size(),
                                      &rawShmem)) {
@@ -4052,7 +4091,7 @@ void ClientWebGLContext::GetTexParameter(
       return inProcess->GetTexParameter(tex->mId, pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetTexParameter(tex->mId, pname, &ret)) {
       ret.reset();
@@ -4538,6 +4577,10 @@ void ClientWebGLContext::TexImage(uint8_t funcDims, GLenum imageTarget,
           // WARNING: OSX can lose our MakeCurrent here.
           desc->dataSurf = surf->GetDataSurface();
         }
+        if (desc->dataSurf && desc->sdSubrect) {
+          desc->dataSurf =
+              webgl::CropDataSurface(desc->dataSurf, *desc->sdSubrect);
+        }
       }
       if (!desc->dataSurf) {
         EnqueueError(LOCAL_GL_OUT_OF_MEMORY,
@@ -4545,6 +4588,7 @@ void ClientWebGLContext::TexImage(uint8_t funcDims, GLenum imageTarget,
         return;
       }
       desc->sd = Nothing();
+      desc->sdSubrect = Nothing();
     }
   }
   desc->image = nullptr;
@@ -4743,7 +4787,7 @@ void ClientWebGLContext::ValidateProgram(WebGLProgramJS& prog) const {
       return inProcess->ValidateProgram(prog.mId);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     bool ret = {};
     if (!child->SendValidateProgram(prog.mId, &ret)) {
       ret = {};
@@ -4761,7 +4805,7 @@ Maybe<double> ClientWebGLContext::GetVertexAttribPriv(const GLuint index,
     return inProcess->GetVertexAttrib(index, pname);
   }
   const auto& child = mNotLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   Maybe<double> ret;
   if (!child->SendGetVertexAttrib(index, pname, &ret)) {
     ret.reset();
@@ -5176,7 +5220,7 @@ bool ClientWebGLContext::DoReadPixels(const webgl::ReadPixelsDesc& desc,
     return true;
   }
   const auto& child = notLost->outOfProcess;
-  child->FlushPendingCmds();
+  child->FlushPendingCmdsForSync();
   webgl::ReadPixelsResultIpc res = {};
   if (!child->SendReadPixels(desc, dest.size(), &res)) {
     res = {};
@@ -5303,7 +5347,7 @@ void ClientWebGLContext::GetQueryParameter(
       return inProcess->GetQueryParameter(query.mId, pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetQueryParameter(query.mId, pname, &ret)) {
       ret.reset();
@@ -5436,7 +5480,7 @@ void ClientWebGLContext::GetSamplerParameter(
       return inProcess->GetSamplerParameter(sampler.mId, pname);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     Maybe<double> ret;
     if (!child->SendGetSamplerParameter(sampler.mId, pname, &ret)) {
       ret.reset();
@@ -5593,7 +5637,7 @@ GLenum ClientWebGLContext::ClientWaitSync(WebGLSyncJS& sync,
       return inProcess->ClientWaitSync(sync.mId, flags, timeout);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     GLenum ret = {};
     if (!child->SendClientWaitSync(sync.mId, flags, timeout, &ret)) {
       ret = {};
@@ -6288,7 +6332,7 @@ GLint ClientWebGLContext::GetFragDataLocation(const WebGLProgramJS& prog,
       return inProcess->GetFragDataLocation(prog.mId, nameU8);
     }
     const auto& child = mNotLost->outOfProcess;
-    child->FlushPendingCmds();
+    child->FlushPendingCmdsForSync();
     GLint ret = {};
     if (!child->SendGetFragDataLocation(prog.mId, nameU8, &ret)) {
       ret = {};
@@ -6623,7 +6667,7 @@ const webgl::CompileResult& ClientWebGLContext::GetCompileResult(
         return inProcess->GetCompileResult(shader.mId);
       }
       const auto& child = mNotLost->outOfProcess;
-      child->FlushPendingCmds();
+      child->FlushPendingCmdsForSync();
       webgl::CompileResult ret = {};
       if (!child->SendGetCompileResult(shader.mId, &ret)) {
         ret = {};
@@ -6647,7 +6691,7 @@ const webgl::LinkResult& ClientWebGLContext::GetLinkResult(
         return inProcess->GetLinkResult(prog.mId);
       }
       const auto& child = mNotLost->outOfProcess;
-      child->FlushPendingCmds();
+      child->FlushPendingCmdsForSync();
       webgl::LinkResult ret;
       if (!child->SendGetLinkResult(prog.mId, &ret)) {
         ret = {};
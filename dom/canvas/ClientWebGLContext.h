@@ -178,6 +178,9 @@ class ContextGenerationInfo final {
   webgl::ProvokingVertex mProvokingVertex = webgl::ProvokingVertex::LastVertex;
 
   mutable std::unordered_map<GLenum, bool> mIsEnabledMap;
+
+  // Results of GetString for the strings which can't change.
+  std::unordered_map<GLenum, std::string> mHostStrings;
 };
 
 // -
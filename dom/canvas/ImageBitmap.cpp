@@ -290,22 +290,12 @@ static already_AddRefed<DataSourceSurface> CropAndCopyDataSourceSurface(
 }
 
 /*
- * This helper function scales the data of the given DataSourceSurface,
- *  _aSurface_, in the given area, _aCropRect_, into a new DataSourceSurface.
- * This might return null if it can not create a new SourceSurface or it cannot
- * read data from the given _aSurface_.
- *
+ * This helper function computes the size _aSrcSize_ is resized to by the
+ * resizeWidth and resizeHeight of _aOptions_, keeping the aspect ratio when
+ * only one of them is passed.
  */
-static already_AddRefed<DataSourceSurface> ScaleDataSourceSurface(
-    DataSourceSurface* aSurface, const ImageBitmapOptions& aOptions) {
-  if (NS_WARN_IF(!aSurface)) {
-    return nullptr;
-  }
-
-  const SurfaceFormat format = aSurface->GetFormat();
-  const int bytesPerPixel = BytesPerPixel(format);
-
-  const IntSize srcSize = aSurface->GetSize();
+static Maybe<IntSize> GetResizedSize(const IntSize& aSrcSize,
+                                     const ImageBitmapOptions& aOptions) {
   int32_t tmp;
 
   CheckedInt<int32_t> checked;
@@ -315,28 +305,53 @@ static already_AddRefed<DataSourceSurface> ScaleDataSourceSurface(
       aOptions.mResizeHeight.WasPassed() ? aOptions.mResizeHeight.Value() : 0);
 
   if (!dstWidth.isValid() || !dstHeight.isValid()) {
-    return nullptr;
+    return Nothing();
   }
 
   if (!dstWidth.value()) {
-    checked = srcSize.width * dstHeight;
+    checked = aSrcSize.width * dstHeight;
     if (!checked.isValid()) {
-      return nullptr;
+      return Nothing();
     }
 
-    tmp = ceil(checked.value() / double(srcSize.height));
+    tmp = ceil(checked.value() / double(aSrcSize.height));
     dstWidth = tmp;
   } else if (!dstHeight.value()) {
-    checked = srcSize.height * dstWidth;
+    checked = aSrcSize.height * dstWidth;
     if (!checked.isValid()) {
-      return nullptr;
+      return Nothing();
     }
 
-    tmp = ceil(checked.value() / double(srcSize.width));
+    tmp = ceil(checked.value() / double(aSrcSize.width));
     dstHeight = tmp;
   }
 
-  const IntSize dstSize(dstWidth.value(), dstHeight.value());
+  return Some(IntSize(dstWidth.value(), dstHeight.value()));
+}
+
+/*
+ * This helper function scales the data of the given DataSourceSurface,
+ *  _aSurface_, in the given area, _aCropRect_, into a new DataSourceSurface.
+ * This might return null if it can not create a new SourceSurface or it cannot
+ * read data from the given _aSurface_.
+ *
+ */
+static already_AddRefed<DataSourceSurface> ScaleDataSourceSurface(
+    DataSourceSurface* aSurface, const ImageBitmapOptions& aOptions) {
+  if (NS_WARN_IF(!aSurface)) {
+    return nullptr;
+  }
+
+  const SurfaceFormat format = aSurface->GetFormat();
+  const int bytesPerPixel = BytesPerPixel(format);
+
+  const IntSize srcSize = aSurface->GetSize();
+  const Maybe<IntSize> resizedSize = GetResizedSize(srcSize, aOptions);
+  if (!resizedSize) {
+    return nullptr;
+  }
+
+  const IntSize dstSize = *resizedSize;
   const int32_t dstStride = dstSize.width * bytesPerPixel;
 
   // Create a new SourceSurface.
@@ -2198,8 +2213,30 @@ CreateImageBitmapFromBlob::OnImageReady(imgIContainer* aImgContainer,
     frameFlags |= imgIContainer::FLAG_DECODE_NO_COLORSPACE_CONVERSION;
   }
 
+  // When the whole image is only going to be made smaller, let the decoder
+  // write it at the size asked for, downscaling (and converting the color
+  // space) row by row as it decodes, rather than decoding it at full size and
+  // scaling that. If the decoder can't, we get the full size frame and scale
+  // it below.
+  IntSize frameSize;
+  if (NS_FAILED(aImgContainer->GetWidth(&frameSize.width)) ||
+      NS_FAILED(aImgContainer->GetHeight(&frameSize.height))) {
+    MimeTypeAndDecodeAndCropBlobCompletedMainThread(
+        nullptr, NS_ERROR_DOM_INVALID_STATE_ERR);
+    return NS_OK;
+  }
+  if (mCropRect.isNothing() && (mOptions.mResizeWidth.WasPassed() ||
+                                mOptions.mResizeHeight.WasPassed())) {
+    const Maybe<IntSize> resizedSize = GetResizedSize(frameSize, mOptions);
+    if (resizedSize && !resizedSize->IsEmpty() &&
+        resizedSize->width <= frameSize.width &&
+        resizedSize->height <= frameSize.height) {
+      frameSize = *resizedSize;
+    }
+  }
+
   RefPtr<SourceSurface> surface =
-      aImgContainer->GetFrame(whichFrame, frameFlags);
+      aImgContainer->GetFrameAtSize(frameSize, whichFrame, frameFlags);
 
   if (NS_WARN_IF(!surface)) {
     MimeTypeAndDecodeAndCropBlobCompletedMainThread(
@@ -2252,7 +2289,12 @@ CreateImageBitmapFromBlob::OnImageReady(imgIContainer* aImgContainer,
     croppedSurface = FlipYDataSourceSurface(dataSurface);
   }
 
-  if (mOptions.mResizeWidth.WasPassed() || mOptions.mResizeHeight.WasPassed()) {
+  // The frame may already have been decoded at the requested size above.
+  if (croppedSurface &&
+      (mOptions.mResizeWidth.WasPassed() ||
+       mOptions.mResizeHeight.WasPassed()) &&
+      GetResizedSize(croppedSurface->GetSize(), mOptions) !=
+          Some(croppedSurface->GetSize())) {
     dataSurface = croppedSurface->GetDataSurface();
     croppedSurface = ScaleDataSourceSurface(dataSurface, mOptions);
     if (NS_WARN_IF(!croppedSurface)) {
@@ -313,6 +313,7 @@ void OffscreenCanvas::QueueCommitToCompositor() {
       "OffscreenCanvas::QueueCommitToCompositor",
       [self = RefPtr{this}] { self->DequeueCommitToCompositor(); });
   NS_DispatchToCurrentThread(mPendingCommit);
+  mDisplay->NoteCommitQueued();
 }
 
 void OffscreenCanvas::DequeueCommitToCompositor() {
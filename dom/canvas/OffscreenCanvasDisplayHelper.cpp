@@ -103,6 +103,8 @@ void OffscreenCanvasDisplayHelper::UpdateContext(
   mType = aType;
   mContextChildId = aChildId;
   mImageContainer = std::move(imageContainer);
+  mHasCommittedFrame = false;
+  mCommitQueued = false;
 
   if (aChildId) {
     mContextManagerId = Some(gfx::CanvasManagerChild::Get()->Id());
@@ -129,8 +131,19 @@ void OffscreenCanvasDisplayHelper::FlushForDisplay() {
   // the main thread.
   if (!mWorkerRef) {
     // We queue to ensure that we have the same asynchronous update behaviour
-    // for a main thread and a worker based OffscreenCanvas.
-    mOffscreenCanvas->QueueCommitToCompositor();
+    // for a main thread and a worker based OffscreenCanvas. The lock must not
+    // be held, as the OffscreenCanvas calls back into NoteCommitQueued.
+    RefPtr<OffscreenCanvas> canvas = mOffscreenCanvas;
+    MutexAutoUnlock unlock(mMutex);
+    canvas->QueueCommitToCompositor();
+    return;
+  }
+
+  // The worker commits its frames straight to the compositor, so the main
+  // thread painting does not need to ask it again unless it hasn't committed
+  // anything yet. This keeps main thread paints from making the worker present
+  // the same frame over again.
+  if (mHasCommittedFrame || mCommitQueued || mPendingWorkerFlush) {
     return;
   }
 
@@ -149,6 +162,7 @@ void OffscreenCanvasDisplayHelper::FlushForDisplay() {
       RefPtr<OffscreenCanvas> canvas;
       {
         MutexAutoLock lock(mDisplayHelper->mMutex);
+        mDisplayHelper->mPendingWorkerFlush = false;
         canvas = mDisplayHelper->mOffscreenCanvas;
       }
 
@@ -165,7 +179,12 @@ void OffscreenCanvasDisplayHelper::FlushForDisplay() {
   // Otherwise we are calling from the main thread during painting to a canvas
   // on a worker thread.
   auto task = MakeRefPtr<FlushWorkerRunnable>(this);
-  task->Dispatch(mWorkerRef->Private());
+  mPendingWorkerFlush = task->Dispatch(mWorkerRef->Private());
+}
+
+void OffscreenCanvasDisplayHelper::NoteCommitQueued() {
+  MutexAutoLock lock(mMutex);
+  mCommitQueued = true;
 }
 
 bool OffscreenCanvasDisplayHelper::CommitFrameToCompositor(
@@ -179,6 +198,9 @@ bool OffscreenCanvasDisplayHelper::CommitFrameToCompositor(
 
   MutexAutoLock lock(mMutex);
 
+  mHasCommittedFrame = true;
+  mCommitQueued = false;
+
   gfx::SurfaceFormat format = gfx::SurfaceFormat::B8G8R8A8;
   layers::TextureFlags flags = layers::TextureFlags::IMMUTABLE;
 
@@ -50,6 +50,9 @@ class OffscreenCanvasDisplayHelper final {
 
   void FlushForDisplay();
 
+  // Called by the OffscreenCanvas when it has queued a commit of its own.
+  void NoteCommitQueued();
+
   bool CommitFrameToCompositor(nsICanvasRenderingContextInternal* aContext,
                                const Maybe<OffscreenCanvasDisplayData>& aData);
 
@@ -89,6 +92,12 @@ class OffscreenCanvasDisplayHelper final {
   mozilla::layers::ImageContainer::FrameID mLastFrameID MOZ_GUARDED_BY(mMutex) =
       0;
   bool mPendingInvalidate MOZ_GUARDED_BY(mMutex) = false;
+  // Whether a worker context has committed a frame, or has queued a commit,
+  // since it was bound. Every change to its content queues a commit, so when
+  // either is true, FlushForDisplay has nothing to ask the worker for.
+  bool mHasCommittedFrame MOZ_GUARDED_BY(mMutex) = false;
+  bool mCommitQueued MOZ_GUARDED_BY(mMutex) = false;
+  bool mPendingWorkerFlush MOZ_GUARDED_BY(mMutex) = false;
 };
 
 }  // namespace mozilla::dom
@@ -383,6 +383,7 @@ struct QueueParamTraits<webgl::TexUnpackBlobDesc> {
   static bool Write(ProducerView<U>& view, const ParamType& in) {
     MOZ_RELEASE_ASSERT(!in.image);
     MOZ_RELEASE_ASSERT(!in.sd);
+    MOZ_RELEASE_ASSERT(!in.sdSubrect);
     const bool isDataSurf = bool(in.dataSurf);
     if (!view.WriteParam(in.imageTarget) || !view.WriteParam(in.size) ||
         !view.WriteParam(in.srcAlphaType) || !view.WriteParam(in.unpacking) ||
@@ -809,6 +809,53 @@ Maybe<std::string> BlitPreventReason(
   return {};
 }
 
+// Blits the whole of `sd` to a scratch texture, then only `subrect` of it to
+// `destFB`, so that cropping stays on the GPU.
+static bool BlitSdSubrectToFramebuffer(gl::GLContext* const gl,
+                                       const layers::SurfaceDescriptor& sd,
+                                       const gfx::IntSize& sdSize,
+                                       const gfx::IntRect& subrect,
+                                       const gfx::IntSize& destSize,
+                                       const gl::OriginPos destOrigin,
+                                       const GLuint destFB) {
+  if (!gl->IsSupported(gl::GLFeature::framebuffer_blit) ||
+      !gfx::IntRect(gfx::IntPoint(), sdSize).Contains(subrect)) {
+    return false;
+  }
+
+  const gl::ScopedTexture scratchTex(gl);
+  {
+    const gl::ScopedBindTexture bindTex(gl, scratchTex.Texture());
+    gl->fTexParameteri(LOCAL_GL_TEXTURE_2D, LOCAL_GL_TEXTURE_MIN_FILTER,
+                       LOCAL_GL_LINEAR);
+    gl->fTexParameteri(LOCAL_GL_TEXTURE_2D, LOCAL_GL_TEXTURE_MAG_FILTER,
+                       LOCAL_GL_LINEAR);
+    gl->fTexImage2D(LOCAL_GL_TEXTURE_2D, 0, LOCAL_GL_RGBA, sdSize.width,
+                    sdSize.height, 0, LOCAL_GL_RGBA, LOCAL_GL_UNSIGNED_BYTE,
+                    nullptr);
+  }
+  const gl::ScopedFramebufferForTexture scratchFB(gl, scratchTex.Texture());
+  if (!scratchFB.IsComplete()) {
+    return false;
+  }
+  {
+    const gl::ScopedBindFramebuffer bindFB(gl, scratchFB.FB());
+    if (!gl->BlitHelper()->BlitSdToFramebuffer(sd, sdSize, destOrigin)) {
+      return false;
+    }
+  }
+
+  // With a top-left origin, the rows of the scratch texture are reversed.
+  auto srcRect = subrect;
+  if (destOrigin == gl::OriginPos::TopLeft) {
+    srcRect.y = sdSize.height - subrect.YMost();
+  }
+  gl->BlitHelper()->BlitFramebufferToFramebuffer(
+      scratchFB.FB(), destFB, srcRect,
+      gfx::IntRect(gfx::IntPoint(), destSize), LOCAL_GL_LINEAR);
+  return true;
+}
+
 bool TexUnpackImage::TexOrSubImage(bool isSubImage, bool needsRespec,
                                    WebGLTexture* tex, GLint level,
                                    const webgl::DriverUnpackInfo* dui,
@@ -874,8 +921,14 @@ bool TexUnpackImage::TexOrSubImage(bool isSubImage, bool needsRespec,
 
     const auto dstOrigin =
         (unpacking.flipY ? gl::OriginPos::TopLeft : gl::OriginPos::BottomLeft);
-    if (!gl->BlitHelper()->BlitSdToFramebuffer(sd, {size.x, size.y},
-                                               dstOrigin)) {
+    const gfx::IntSize destSize(size.x, size.y);
+    const bool blitted =
+        mDesc.sdSubrect
+            ? BlitSdSubrectToFramebuffer(gl, sd, mDesc.sdSize,
+                                         *mDesc.sdSubrect, destSize, dstOrigin,
+                                         scopedFB.FB())
+            : gl->BlitHelper()->BlitSdToFramebuffer(sd, destSize, dstOrigin);
+    if (!blitted) {
       gfxCriticalNote << "BlitSdToFramebuffer failed for type "
                       << int(sd.type());
       // Maybe the resource isn't valid anymore?
@@ -1045,6 +1098,17 @@ bool TexUnpackSurface::TexOrSubImage(bool isSubImage, bool needsRespec,
     return false;
   }
 
+  // Surface descriptors are sent uncropped, with the visible rect in
+  // sdSubrect. Read only that rect, keeping the stride of the full surface.
+  auto srcRect = gfx::IntRect({}, surf->GetSize());
+  if (mDesc.sd && mDesc.sdSubrect) {
+    if (!srcRect.Contains(*mDesc.sdSubrect)) {
+      gfxCriticalError() << "TexUnpackSurface sdSubrect out of bounds.";
+      return false;
+    }
+    srcRect = *mDesc.sdSubrect;
+  }
+
   gfx::DataSourceSurface::ScopedMap map(surf,
                                         gfx::DataSourceSurface::MapType::READ);
   if (!map.IsMapped()) {
@@ -1052,14 +1116,16 @@ bool TexUnpackSurface::TexOrSubImage(bool isSubImage, bool needsRespec,
     return false;
   }
 
-  const auto& srcBegin = map.GetData();
   const auto srcStride = static_cast<size_t>(map.GetStride());
+  const uint8_t* const srcBegin = map.GetData() +
+                                  size_t(srcRect.y) * srcStride +
+                                  size_t(srcRect.x) * srcBPP;
 
   // -
 
   const auto dstFormat = FormatForPackingInfo(dstPI);
   const auto dstBpp = BytesPerPixel(dstPI);
-  const size_t dstUsedBytesPerRow = dstBpp * surf->GetSize().width;
+  const size_t dstUsedBytesPerRow = dstBpp * srcRect.width;
   auto dstStride = dstUsedBytesPerRow;
   if (dstFormat == srcFormat) {
     dstStride = srcStride;  // Try to match.
@@ -1092,7 +1158,7 @@ bool TexUnpackSurface::TexOrSubImage(bool isSubImage, bool needsRespec,
   const uint8_t* dstBegin = srcBegin;
   UniqueBuffer tempBuffer;
   // clang-format off
-  if (!ConvertIfNeeded(webgl, surf->GetSize().width, surf->GetSize().height,
+  if (!ConvertIfNeeded(webgl, srcRect.width, srcRect.height,
                        srcFormat, srcBegin, AutoAssertCast(srcStride),
                        dstFormat, AutoAssertCast(dstUnpacking.metrics.bytesPerRowStride), &dstBegin,
                        &tempBuffer)) {
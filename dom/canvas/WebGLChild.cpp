@@ -146,6 +146,11 @@ void WebGLChild::FlushPendingCmds() {
   }
 }
 
+void WebGLChild::FlushPendingCmdsForSync() {
+  FlushPendingCmds();
+  mFlushedCmdInfo.syncIpcs += 1;
+}
+
 // -
 
 mozilla::ipc::IPCResult WebGLChild::RecvJsWarning(
@@ -28,6 +28,9 @@ struct FlushedCmdInfo final {
   size_t congestionCheckGeneration = 0;
   size_t flushedCmdBytes = 0;
   size_t overhead = 0;
+  // Sync messages sent since the last present, reported in a profiler marker
+  // for each frame.
+  size_t syncIpcs = 0;
 };
 
 class WebGLChild final : public PWebGLChild, public SupportsWeakPtr {
@@ -46,6 +49,9 @@ class WebGLChild final : public PWebGLChild, public SupportsWeakPtr {
   Maybe<Range<uint8_t>> AllocPendingCmdBytes(size_t,
                                              size_t fyiAlignmentOverhead);
   void FlushPendingCmds();
+  // For sync messages, which wait for the host to run all the commands sent
+  // before them.
+  void FlushPendingCmdsForSync();
   void Destroy();
   void ActorDestroy(ActorDestroyReason why) override;
 
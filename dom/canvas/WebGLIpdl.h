@@ -177,6 +177,8 @@ struct IPDLParamTraits<mozilla::webgl::TexUnpackBlobDesc> final {
     MOZ_RELEASE_ASSERT(!in.dataSurf);
     WriteParam(writer, in.unpacking);
     WriteParam(writer, in.applyUnpackTransforms);
+    WriteParam(writer, in.sdSubrect);
+    WriteParam(writer, in.sdSize);
   }
 
   static bool Read(IPC::MessageReader* const reader, IProtocol* actor,
@@ -187,7 +189,9 @@ struct IPDLParamTraits<mozilla::webgl::TexUnpackBlobDesc> final {
            ReadParam(reader, &out->structuredSrcSize) &&
            ReadIPDLParam(reader, actor, &out->sd) &&
            ReadParam(reader, &out->unpacking) &&
-           ReadParam(reader, &out->applyUnpackTransforms);
+           ReadParam(reader, &out->applyUnpackTransforms) &&
+           ReadParam(reader, &out->sdSubrect) &&
+           ReadParam(reader, &out->sdSize);
   }
 };
 
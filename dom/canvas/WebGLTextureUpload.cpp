@@ -15,6 +15,7 @@
 #include "GLContext.h"
 #include "mozilla/Casting.h"
 #include "mozilla/gfx/2D.h"
+#include "mozilla/gfx/DataSurfaceHelpers.h"
 #include "mozilla/gfx/Logging.h"
 #include "mozilla/dom/HTMLCanvasElement.h"
 #include "mozilla/dom/HTMLVideoElement.h"
@@ -146,9 +147,21 @@ Maybe<webgl::TexUnpackBlobDesc> FromOffscreenCanvas(
 Maybe<webgl::TexUnpackBlobDesc> FromVideoFrame(
     const ClientWebGLContext& webgl, const GLenum target, Maybe<uvec3> size,
     const dom::VideoFrame& videoFrame, ErrorResult* const out_error) {
-  auto sfer = nsLayoutUtils::SurfaceFromVideoFrame(
-      const_cast<dom::VideoFrame*>(&videoFrame),
-      kDefaultSurfaceFromElementFlags);
+  auto* const frame = const_cast<dom::VideoFrame*>(&videoFrame);
+  // Hardware decoders commonly pad the coded size (e.g. 1920x1088 for 1080p
+  // video), so take the whole image and let the upload crop it to the visible
+  // rect, rather than having it drawn and read back here.  Cropping on the
+  // GPU blits framebuffers, which WebGL 2 always supports.
+  uint32_t flags = kDefaultSurfaceFromElementFlags;
+  if (webgl.mIsWebGL2) {
+    flags |= nsLayoutUtils::SFE_ALLOW_UNCROPPED_UNSCALED;
+  }
+  auto sfer = nsLayoutUtils::SurfaceFromVideoFrame(frame, flags);
+  if (sfer.mCropRect && sfer.mCropRect->Size() != sfer.mIntrinsicSize) {
+    // Scaling to the display size is still done by SurfaceFromVideoFrame.
+    sfer = nsLayoutUtils::SurfaceFromVideoFrame(
+        frame, kDefaultSurfaceFromElementFlags);
+  }
   return FromSurfaceFromElementResult(webgl, target, size, sfer, out_error);
 }
 
@@ -197,6 +210,14 @@ Maybe<webgl::TexUnpackBlobDesc> FromSurfaceFromElementResult(
     }
   }
 
+  Maybe<gfx::IntRect> sdSubrect;
+  gfx::IntSize sdSize;
+  if (sd && sfer.mCropRect) {
+    sdSubrect = sfer.mCropRect;
+    sdSize = layersImage->GetSize();
+    elemSize = *uvec2::FromSize(sfer.mCropRect->Size());
+  }
+
   RefPtr<gfx::DataSourceSurface> dataSurf;
   if (!sd && sfer.GetSourceSurface()) {
     const auto surf = sfer.GetSourceSurface();
@@ -204,6 +225,10 @@ Maybe<webgl::TexUnpackBlobDesc> FromSurfaceFromElementResult(
 
     // WARNING: OSX can lose our MakeCurrent here.
     dataSurf = surf->GetDataSurface();
+    if (dataSurf && sfer.mCropRect) {
+      dataSurf = CropDataSurface(dataSurf, *sfer.mCropRect);
+      elemSize = *uvec2::FromSize(sfer.mCropRect->Size());
+    }
   }
 
   if (!sd) {
@@ -256,7 +281,7 @@ Maybe<webgl::TexUnpackBlobDesc> FromSurfaceFromElementResult(
   //////
   // Ok, we're good!
 
-  return Some(TexUnpackBlobDesc{target,
+  auto desc = TexUnpackBlobDesc{target,
                                 size.value(),
                                 sfer.mAlphaType,
                                 {},
@@ -264,7 +289,20 @@ Maybe<webgl::TexUnpackBlobDesc> FromSurfaceFromElementResult(
                                 Some(elemSize),
                                 layersImage,
                                 sd,
-                                dataSurf});
+                                dataSurf};
+  desc.sdSubrect = sdSubrect;
+  desc.sdSize = sdSize;
+  return Some(desc);
+}
+
+RefPtr<gfx::DataSourceSurface> CropDataSurface(
+    gfx::DataSourceSurface* const surf, const gfx::IntRect& rect) {
+  const RefPtr<gfx::DataSourceSurface> cropped =
+      gfx::Factory::CreateDataSourceSurface(rect.Size(), surf->GetFormat());
+  if (!cropped || !gfx::CopyRect(surf, cropped, rect, {0, 0})) {
+    return nullptr;
+  }
+  return cropped;
 }
 
 }  // namespace webgl
@@ -41,6 +41,10 @@ Maybe<TexUnpackBlobDesc> FromSurfaceFromElementResult(
     const ClientWebGLContext& webgl, GLenum target, Maybe<uvec3> size,
     SurfaceFromElementResult& sfer, ErrorResult* const out_error);
 
+// Copies `rect` of `surf` into a new surface, for CPU uploads of a subrect.
+RefPtr<gfx::DataSourceSurface> CropDataSurface(gfx::DataSourceSurface* surf,
+                                               const gfx::IntRect& rect);
+
 }  // namespace webgl
 }  // namespace mozilla
 
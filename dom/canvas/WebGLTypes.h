@@ -1162,6 +1162,11 @@ struct TexUnpackBlobDesc final {
   webgl::PixelUnpackStateWebgl unpacking;
   bool applyUnpackTransforms = true;
 
+  // When set, only this rect of `sd`, of size `sdSize`, is uploaded, e.g. the
+  // visible rect of a VideoFrame whose coded size is padded.
+  Maybe<gfx::IntRect> sdSubrect;
+  gfx::IntSize sdSize;
+
   // -
 
   auto ExplicitUnpacking(const webgl::PackingInfo& pi,
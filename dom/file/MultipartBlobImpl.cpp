@@ -105,6 +105,22 @@ void MultipartBlobImpl::CreateInputStream(nsIInputStream** aStream,
   CallQueryInterface(stream, aStream);
 }
 
+// Appends the sub-blobs of aBlobImpl instead of aBlobImpl itself if it's a
+// MultipartBlobImpl, like BlobSet does, so that slicing a blob doesn't nest
+// multipart blobs, which every read would then have to go through.
+static void AppendFlattenedBlobImpl(nsTArray<RefPtr<BlobImpl>>& aBlobImpls,
+                                    BlobImpl* aBlobImpl) {
+  if (const nsTArray<RefPtr<BlobImpl>>* subBlobs =
+          aBlobImpl->GetSubBlobImpls()) {
+    for (BlobImpl* subBlob : *subBlobs) {
+      AppendFlattenedBlobImpl(aBlobImpls, subBlob);
+    }
+    return;
+  }
+
+  aBlobImpls.AppendElement(aBlobImpl);
+}
+
 already_AddRefed<BlobImpl> MultipartBlobImpl::CreateSlice(
     uint64_t aStart, uint64_t aLength, const nsAString& aContentType,
     ErrorResult& aRv) const {
@@ -138,7 +154,7 @@ already_AddRefed<BlobImpl> MultipartBlobImpl::CreateSlice(
         return firstBlobImpl.forget();
       }
 
-      blobImpls.AppendElement(firstBlobImpl);
+      AppendFlattenedBlobImpl(blobImpls, firstBlobImpl);
       length -= upperBound;
       i++;
       break;
@@ -162,9 +178,9 @@ already_AddRefed<BlobImpl> MultipartBlobImpl::CreateSlice(
         return nullptr;
       }
 
-      blobImpls.AppendElement(lastBlobImpl);
+      AppendFlattenedBlobImpl(blobImpls, lastBlobImpl);
     } else {
-      blobImpls.AppendElement(blobImpl);
+      AppendFlattenedBlobImpl(blobImpls, blobImpl);
     }
     length -= std::min<uint64_t>(l, length);
   }
@@ -90,6 +90,11 @@ class WritableFileStreamUnderlyingSinkAlgorithms final
       JSContext* aCx, JS::Handle<JS::Value> aChunk,
       WritableStreamDefaultController& aController, ErrorResult& aRv) override;
 
+  bool CanWriteInputStream() override { return true; }
+
+  already_AddRefed<Promise> WriteInputStreamCallback(
+      JSContext* aCx, nsIInputStream* aInputStream, ErrorResult& aRv) override;
+
   already_AddRefed<Promise> CloseCallbackImpl(JSContext* aCx,
                                               ErrorResult& aRv) override;
 
@@ -531,33 +536,65 @@ already_AddRefed<Promise> FileSystemWritableFileStream::Write(
 
         CopyableErrorResult err = aValue.RejectValue();
 
-        if (self->IsOpen()) {
-          self->BeginAbort()->Then(
-              GetCurrentSerialEventTarget(), __func__,
-              [promise, err = std::move(err)](
-                  const BoolPromise::ResolveOrRejectValue&) mutable {
-                // Do not capture command to this context:
-                // close cannot proceed
-                promise->MaybeReject(std::move(err));
-              });
-        } else if (self->IsFinishing()) {
-          self->OnDone()->Then(
-              GetCurrentSerialEventTarget(), __func__,
-              [promise, err = std::move(err)](
-                  const BoolPromise::ResolveOrRejectValue&) mutable {
-                // Do not capture command to this context:
-                // close cannot proceed
-                promise->MaybeReject(std::move(err));
-              });
-
-        } else {
-          promise->MaybeReject(std::move(err));
-        }
+        self->RejectFailedWrite(*promise, std::move(err));
       });
 
   return promise.forget();
 }
 
+already_AddRefed<Promise> FileSystemWritableFileStream::WriteInputStream(
+    nsIInputStream* aInputStream) {
+  RefPtr<Promise> promise = Promise::CreateInfallible(GetParentObject());
+
+  if (!IsOpen()) {
+    promise->MaybeRejectWithTypeError("WritableFileStream closed");
+    return promise.forget();
+  }
+
+  RefPtr<Command> command = CreateCommand();
+
+  WriteImpl(aInputStream, Nothing())
+      ->Then(GetCurrentSerialEventTarget(), __func__,
+             [self = RefPtr{this}, command,
+              promise](const Int64Promise::ResolveOrRejectValue& aValue) {
+               if (aValue.IsResolve()) {
+                 promise->MaybeResolve(aValue.ResolveValue());
+                 return;
+               }
+
+               self->RejectFailedWrite(
+                   *promise, RejectWithConvertedErrors(aValue.RejectValue()));
+             });
+
+  return promise.forget();
+}
+
+void FileSystemWritableFileStream::RejectFailedWrite(
+    Promise& aPromise, CopyableErrorResult&& aError) {
+  if (IsOpen()) {
+    BeginAbort()->Then(
+        GetCurrentSerialEventTarget(), __func__,
+        [promise = RefPtr{&aPromise}, err = std::move(aError)](
+            const BoolPromise::ResolveOrRejectValue&) mutable {
+          // Do not capture command to this context:
+          // close cannot proceed
+          promise->MaybeReject(std::move(err));
+        });
+  } else if (IsFinishing()) {
+    OnDone()->Then(
+        GetCurrentSerialEventTarget(), __func__,
+        [promise = RefPtr{&aPromise}, err = std::move(aError)](
+            const BoolPromise::ResolveOrRejectValue&) mutable {
+          // Do not capture command to this context:
+          // close cannot proceed
+          promise->MaybeReject(std::move(err));
+        });
+
+  } else {
+    aPromise.MaybeReject(std::move(aError));
+  }
+}
+
 RefPtr<FileSystemWritableFileStream::WriteDataPromise>
 FileSystemWritableFileStream::Write(
     ArrayBufferViewOrArrayBufferOrBlobOrUTF8StringOrWriteParams& aData) {
@@ -984,6 +1021,12 @@ WritableFileStreamUnderlyingSinkAlgorithms::WriteCallbackImpl(
   return mStream->Write(aCx, aChunk, aRv);
 }
 
+already_AddRefed<Promise>
+WritableFileStreamUnderlyingSinkAlgorithms::WriteInputStreamCallback(
+    JSContext* aCx, nsIInputStream* aInputStream, ErrorResult& aRv) {
+  return mStream->WriteInputStream(aInputStream);
+}
+
 // Step 4 of
 // https://fs.spec.whatwg.org/#create-a-new-filesystemwritablefilestream
 already_AddRefed<Promise>
@@ -15,6 +15,7 @@
 #include "mozilla/dom/quota/ForwardDecls.h"
 
 class nsIGlobalObject;
+class nsIInputStream;
 class nsIRandomAccessStream;
 
 namespace mozilla {
@@ -82,6 +83,9 @@ class FileSystemWritableFileStream final : public WritableStream {
   already_AddRefed<Promise> Write(JSContext* aCx, JS::Handle<JS::Value> aChunk,
                                   ErrorResult& aError);
 
+  // Writes aInputStream as a whole, for pipeTo() from a native source.
+  already_AddRefed<Promise> WriteInputStream(nsIInputStream* aInputStream);
+
   // WebIDL Boilerplate
   JSObject* WrapObject(JSContext* aCx,
                        JS::Handle<JSObject*> aGivenProto) override;
@@ -121,6 +125,8 @@ class FileSystemWritableFileStream final : public WritableStream {
   RefPtr<Int64Promise> WriteImpl(nsCOMPtr<nsIInputStream> aInputStream,
                                  const Maybe<uint64_t> aPosition);
 
+  void RejectFailedWrite(Promise& aPromise, CopyableErrorResult&& aError);
+
   RefPtr<BoolPromise> Seek(uint64_t aPosition);
 
   RefPtr<BoolPromise> Truncate(uint64_t aSize);
@@ -18862,14 +18862,6 @@ nsresult ObjectStoreAddOrPutRequestOp::DoDatabaseWork(
 
   AUTO_PROFILER_LABEL("ObjectStoreAddOrPutRequestOp::DoDatabaseWork", DOM);
 
-  DatabaseConnection::AutoSavepoint autoSave;
-  QM_TRY(MOZ_TO_RESULT(autoSave.Start(Transaction()))
-#ifdef MOZ_DIAGNOSTIC_ASSERT_ENABLED
-             ,
-         QM_PROPAGATE, MakeAutoSavepointCleanupHandler(*aConnection)
-#endif
-  );
-
   QM_TRY_INSPECT(const bool& objectStoreHasIndexes,
                  ObjectStoreHasIndexes(*aConnection, mParams.objectStoreId(),
                                        mObjectStoreMayHaveIndexes));
@@ -18881,6 +18873,32 @@ nsresult ObjectStoreAddOrPutRequestOp::DoDatabaseWork(
   const bool keyUnset = key.IsUnset();
   const IndexOrObjectStoreId osid = mParams.objectStoreId();
 
+  // Adding a row without files to an object store without indexes is a single
+  // INSERT, which SQLite already undoes by itself when it fails, and which
+  // doesn't run the refcount triggers. Skipping the savepoint saves two of the
+  // three statements run for each such request, which adds up when a page
+  // stores many small records. Overwriting may delete a row with files, whose
+  // refcount changes only a savepoint rollback can undo.
+  const bool needsSavepoint = objectStoreHasIndexes ||
+                              !mStoredFileInfos.IsEmpty() ||
+                              (mOverwrite && !keyUnset);
+
+  DatabaseConnection::AutoSavepoint autoSave;
+  if (needsSavepoint) {
+    QM_TRY(MOZ_TO_RESULT(autoSave.Start(Transaction()))
+#ifdef MOZ_DIAGNOSTIC_ASSERT_ENABLED
+               ,
+           QM_PROPAGATE, MakeAutoSavepointCleanupHandler(*aConnection)
+#endif
+    );
+  } else if (!aConnection->GetUpdateRefcountFunction()) {
+    // See AutoSavepoint::Start.
+    NS_WARNING(
+        "The connection was closed because the previous operation "
+        "failed!");
+    return NS_ERROR_DOM_INDEXEDDB_ABORT_ERR;
+  }
+
   // First delete old index_data_values if we're overwriting something and we
   // have indexes.
   if (mOverwrite && !keyUnset && objectStoreHasIndexes) {
@@ -19125,7 +19143,9 @@ nsresult ObjectStoreAddOrPutRequestOp::DoDatabaseWork(
         InsertIndexTableRows(aConnection, osid, key, indexValues)));
   }
 
-  QM_TRY(MOZ_TO_RESULT(autoSave.Commit()));
+  if (needsSavepoint) {
+    QM_TRY(MOZ_TO_RESULT(autoSave.Commit()));
+  }
 
   if (autoIncrementNum) {
     {
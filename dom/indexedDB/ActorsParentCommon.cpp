@@ -356,22 +356,26 @@ GetStructuredCloneReadInfoFromBlob(const uint8_t* aBlobData,
                                             &uncompressedLength)),
          Err(NS_ERROR_FILE_CORRUPTED));
 
-  // `data` (JSStructuredCloneData) currently uses 4k buffer internally.
-  // For performance reasons, it's better to align `uncompressed` with that.
-  AutoTArray<uint8_t, 4096> uncompressed;
-  QM_TRY(OkIf(uncompressed.SetLength(uncompressedLength, fallible)),
-         Err(NS_ERROR_OUT_OF_MEMORY));
-
-  char* const uncompressedBuffer =
-      reinterpret_cast<char*>(uncompressed.Elements());
-
-  QM_TRY(OkIf(snappy::RawUncompress(compressed, compressedLength,
-                                    uncompressedBuffer)),
-         Err(NS_ERROR_FILE_CORRUPTED));
-
+  // Uncompress straight into a single segment of `data` rather than into a
+  // temporary buffer which is then copied, so that reading a large value
+  // doesn't need twice its size in memory.
   JSStructuredCloneData data(JS::StructuredCloneScope::DifferentProcess);
-  QM_TRY(OkIf(data.AppendBytes(uncompressedBuffer, uncompressed.Length())),
-         Err(NS_ERROR_OUT_OF_MEMORY));
+  if (uncompressedLength) {
+    constexpr size_t alignment =
+        JSStructuredCloneData::BufferList::kSegmentAlignment;
+    const size_t capacity =
+        (uncompressedLength + alignment - 1) & ~(alignment - 1);
+    QM_TRY(OkIf(data.Init(capacity)), Err(NS_ERROR_OUT_OF_MEMORY));
+
+    size_t allocated;
+    char* const uncompressedBuffer =
+        data.AllocateBytes(uncompressedLength, &allocated);
+    MOZ_ASSERT(uncompressedBuffer && allocated == uncompressedLength);
+
+    QM_TRY(OkIf(snappy::RawUncompress(compressed, compressedLength,
+                                      uncompressedBuffer)),
+           Err(NS_ERROR_FILE_CORRUPTED));
+  }
 
   nsTArray<StructuredCloneFileParent> files;
   if (!aFileIds.IsVoid()) {
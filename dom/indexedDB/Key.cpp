@@ -630,17 +630,21 @@ Result<Ok, nsresult> Key::EncodeAsString(const Span<const T> aInput,
   const auto inputRange = mozilla::detail::IteratorRange(
       aInput.Elements(), aInput.Elements() + aInput.Length());
 
-  size_t payloadSize = aInput.Length();
-  bool anyMultibyte = false;
+  // Count the extra bytes without branching on each value, so that the
+  // compiler can vectorize the loop. This is where most of the time goes for
+  // (the common) ASCII keys, which need no extra bytes. 64 bits can't overflow
+  // here, unlike size_t on 32-bit platforms.
+  uint64_t extraBytes = 0;
   for (const T val : inputRange) {
-    if (val > ONE_BYTE_LIMIT) {
-      anyMultibyte = true;
-      payloadSize += char16_t(val) > TWO_BYTE_LIMIT ? 2 : 1;
-      if (payloadSize > KEY_MAXIMUM_BUFFER_LENGTH) {
-        return Err(NS_ERROR_DOM_INDEXEDDB_KEY_ERR);
-      }
-    }
+    extraBytes += uint64_t(val > ONE_BYTE_LIMIT) +
+                  uint64_t(char16_t(val) > TWO_BYTE_LIMIT);
+  }
+
+  const bool anyMultibyte = extraBytes != 0;
+  if (aInput.Length() + extraBytes > KEY_MAXIMUM_BUFFER_LENGTH) {
+    return Err(NS_ERROR_DOM_INDEXEDDB_KEY_ERR);
   }
+  size_t payloadSize = aInput.Length() + size_t(extraBytes);
 
   size += payloadSize;
 
@@ -772,6 +776,19 @@ void Key::DecodeAsStringy(const EncodedDataType* const aEncodedSectionBegin,
                           const uint32_t aDecodedLength, T* const aOut) {
   static_assert(sizeof(T) <= 2,
                 "Only implemented for 1 and 2 byte decoded types");
+
+  // Every multi-byte encoded value takes more than one byte, so when there are
+  // as many bytes as decoded values, they are all single byte ones. Decode
+  // those (e.g. ASCII strings) with a loop the compiler can vectorize.
+  if (static_cast<uint32_t>(aEncodedSectionEnd - aEncodedSectionBegin) ==
+      aDecodedLength) {
+    std::transform(aEncodedSectionBegin, aEncodedSectionEnd, aOut,
+                   [](const EncodedDataType value) {
+                     return static_cast<T>(value - ONE_BYTE_ADJUST);
+                   });
+    return;
+  }
+
   T* decodedPos = aOut;
   for (const EncodedDataType* iter = aEncodedSectionBegin;
        iter < aEncodedSectionEnd;) {
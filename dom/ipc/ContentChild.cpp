@@ -2858,6 +2858,11 @@ mozilla::ipc::IPCResult ContentChild::RecvNotifyProcessPriorityChanged(
 #if defined(MOZ_MEMORY)
       if (StaticPrefs::dom_memory_memory_pressure_on_background() == 1) {
         jemalloc_free_dirty_pages();
+      } else {
+        // Arenas only apply the smaller page cache on their next free, which
+        // may not come for a while in a background process, so trim them to
+        // it now.
+        jemalloc_free_excess_dirty_pages();
       }
 #endif
       if (StaticPrefs::dom_memory_memory_pressure_on_background() == 2) {
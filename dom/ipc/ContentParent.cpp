@@ -249,6 +249,7 @@
 #include "prio.h"
 #include "private/pprio.h"
 #include "xpcpublic.h"
+#include "XPCSharedStencilShmem.h"
 #include "nsOpenWindowInfo.h"
 #include "nsFrameLoaderOwner.h"
 
@@ -2453,6 +2454,11 @@ bool ContentParent::BeginSubprocessLaunch(ProcessPriority aPriority) {
   // processes.
   ::mozilla::ipc::ExportSharedJSInit(*mSubprocess, extraArgs);
 
+  // Scripts encoded by other processes of the same remote type are shared
+  // with the new process, such that it can decode them instead of compiling.
+  ::mozilla::ipc::ExportSharedStencils(*mSubprocess, GetRemoteType(),
+                                       extraArgs);
+
   // Register ContentParent as an observer for changes to any pref
   // whose prefix matches the empty string, i.e. all of them.  The
   // observation starts here in order to capture pref updates that
@@ -5807,6 +5813,27 @@ mozilla::ipc::IPCResult ContentParent::RecvNotifyBenchmarkResult(
   return IPC_OK();
 }
 
+mozilla::ipc::IPCResult ContentParent::RecvAddSharedStencil(
+    nsTArray<uint8_t>&& aKey, mozilla::ipc::BigBuffer&& aXdr) {
+  if (aKey.Length() != xpc::SharedStencilShmem::KeyLength) {
+    return IPC_FAIL(this, "Invalid shared stencil key");
+  }
+
+  // Uploads from remote types which do not take part in sharing are ignored,
+  // which also covers content processes that raced a pref change.
+  if (!xpc::SharedStencilShmem::IsEnabledForRemoteType(GetRemoteType())) {
+    return IPC_OK();
+  }
+
+  xpc::SharedStencilShmem::Key key;
+  std::copy(aKey.begin(), aKey.end(), key.begin());
+
+  // Entries beyond the limits of the remote type are silently dropped.
+  (void)xpc::SharedStencilShmem::GetSingleton().AddFromChild(
+      GetRemoteType(), key, aXdr.AsSpan());
+  return IPC_OK();
+}
+
 mozilla::ipc::IPCResult ContentParent::RecvNotifyPushObservers(
     const nsACString& aScope, nsIPrincipal* aPrincipal,
     const nsAString& aMessageId) {
@@ -1158,6 +1158,9 @@ class ContentParent final : public PContentParent,
   mozilla::ipc::IPCResult RecvNotifyBenchmarkResult(const nsAString& aCodecName,
                                                     const uint32_t& aDecodeFPS);
 
+  mozilla::ipc::IPCResult RecvAddSharedStencil(nsTArray<uint8_t>&& aKey,
+                                               mozilla::ipc::BigBuffer&& aXdr);
+
   mozilla::ipc::IPCResult RecvNotifyPushObservers(const nsACString& aScope,
                                                   nsIPrincipal* aPrincipal,
                                                   const nsAString& aMessageId);
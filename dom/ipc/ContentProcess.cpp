@@ -81,6 +81,11 @@ void ContentProcess::InfallibleInit(int aArgc, char* aArgv[]) {
       geckoargs::sJsInitHandle.Get(aArgc, aArgv);
   Maybe<uint64_t> jsInitLen = geckoargs::sJsInitLen.Get(aArgc, aArgv);
 
+  // command line: -jsStencilsHandle handle -jsStencilsLen length
+  Maybe<mozilla::ipc::SharedMemoryHandle> jsStencilsHandle =
+      geckoargs::sJsStencilsHandle.Get(aArgc, aArgv);
+  Maybe<uint64_t> jsStencilsLen = geckoargs::sJsStencilsLen.Get(aArgc, aArgv);
+
   nsCOMPtr<nsIFile> appDirArg;
   Maybe<const char*> appDir = geckoargs::sAppDir.Get(aArgc, aArgv);
   if (appDir.isSome()) {
@@ -140,6 +145,12 @@ void ContentProcess::InfallibleInit(int aArgc, char* aArgv[]) {
     MOZ_CRASH("ImportSharedJSInit failed");
   }
 
+  // The shared stencils are only an optimization, keep going without them.
+  if (jsStencilsHandle && jsStencilsLen) {
+    (void)::mozilla::ipc::ImportSharedStencils(jsStencilsHandle.extract(),
+                                               *jsStencilsLen);
+  }
+
   mContent.Init(TakeInitialEndpoint(), *parentBuildID, *isForBrowser);
 
   nsCOMPtr<nsIFile> greDir;
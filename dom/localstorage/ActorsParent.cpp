@@ -310,6 +310,13 @@ const char kSnapshotPrefillPref[] = "dom.storage.snapshot_prefill";
  */
 const char kSnapshotGradualPrefillPref[] =
     "dom.storage.snapshot_gradual_prefill";
+/**
+ * Each time gradual prefill runs out of its byte budget, the budget for the
+ * next request of the same snapshot is doubled, up to this many bytes. A page
+ * which reads all the items of a large datastore then only needs a few
+ * synchronous round trips instead of one per gradual prefill budget.
+ */
+const int64_t kMaxSnapshotGradualPrefill = 1024 * 1024;
 
 const char kClientValidationPref[] = "dom.storage.client_validation";
 
@@ -1932,6 +1939,11 @@ class Snapshot final : public PBackgroundLSSnapshotParent {
   uint32_t mTotalLength;
   int64_t mUsage;
   int64_t mPeakUsage;
+  /**
+   * The gradual prefill budget is gSnapshotGradualPrefill shifted left by this
+   * amount, see kMaxSnapshotGradualPrefill.
+   */
+  uint32_t mGradualPrefillShift;
   /**
    * True if SaveItem has saved mDatastore's keys into mKeys because a SaveItem
    * notification with aAffectsOrder=true was received.
@@ -5646,6 +5658,7 @@ Snapshot::Snapshot(Database* aDatabase, const nsAString& aDocumentURI)
       mTotalLength(0),
       mUsage(-1),
       mPeakUsage(-1),
+      mGradualPrefillShift(0),
       mSavedKeys(false),
       mActorDestroyed(false),
       mFinishReceived(false),
@@ -5971,6 +5984,9 @@ mozilla::ipc::IPCResult Snapshot::RecvLoadValueAndMoreItems(
   // byte budget allows).
 
   if (gSnapshotGradualPrefill > 0) {
+    const int64_t gradualPrefill = static_cast<int64_t>(gSnapshotGradualPrefill)
+                                   << mGradualPrefillShift;
+
     const nsTArray<LSItemInfo>& orderedItems = mDatastore->GetOrderedItems();
 
     uint32_t length;
@@ -6031,9 +6047,13 @@ mozilla::ipc::IPCResult Snapshot::RecvLoadValueAndMoreItems(
         size += static_cast<int64_t>(key.Length()) +
                 static_cast<int64_t>(value.Length());
 
-        if (size > gSnapshotGradualPrefill) {
+        if (size > gradualPrefill) {
           mLoadedItems.RemoveEntry(loadedItemEntry);
 
+          if (gradualPrefill < kMaxSnapshotGradualPrefill) {
+            mGradualPrefillShift++;
+          }
+
           // mNextLoadIndex is not incremented, so we will resume at the same
           // position next time.
           break;
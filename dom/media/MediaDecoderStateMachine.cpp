@@ -38,7 +38,10 @@
 #include "mozilla/StaticPrefs_media.h"
 #include "mozilla/TaskQueue.h"
 #include "mozilla/Telemetry.h"
+#include "mozilla/Services.h"
 #include "nsIMemoryReporter.h"
+#include "nsIObserver.h"
+#include "nsIObserverService.h"
 #include "nsPrintfCString.h"
 #include "nsTArray.h"
 
@@ -149,11 +152,64 @@ static uint32_t sVideoQueueHWAccelSize = HW_VIDEO_QUEUE_SIZE;
 static uint32_t sVideoQueueSendToCompositorSize =
     VIDEO_QUEUE_SEND_TO_COMPOSITOR_SIZE;
 
+// The decoded frames of all the video elements of the process which are
+// paused or whose video decoding is suspended share this budget, so that many
+// background elements playing high resolution videos do not queue gigabytes
+// of frames.  Elements playing in the foreground are not limited by it.
+static const size_t BACKGROUND_VIDEO_QUEUE_BUDGET = 256 * 1024 * 1024;
+
+// Number of state machines whose video queue is sized from the budget above.
+static Atomic<uint32_t> sBackgroundVideoDecoders(0);
+
+// Set while the system is low on memory, during which every video queue is
+// kept to its minimum size. Only "low-memory" notifications set it, because
+// they are the ones AvailableMemoryWatcher follows with a
+// "memory-pressure-stop" once memory is available again.
+static Atomic<bool> sVideoQueueMemoryPressure(false);
+
+// Bumped by one-shot memory pressure notifications such as "heap-minimize",
+// which are never followed by a stop. Each state machine then refills its
+// video queue only up to the minimum until it has drained there once, see
+// GetAmpleVideoFrames().
+static Atomic<uint32_t> sVideoQueueTrimGeneration(0);
+
+class VideoQueueMemoryPressureObserver final : public nsIObserver {
+ public:
+  NS_DECL_ISUPPORTS
+
+  NS_IMETHOD Observe(nsISupports* aSubject, const char* aTopic,
+                     const char16_t* aData) override {
+    if (strcmp(aTopic, "memory-pressure") == 0) {
+      nsDependentString data(aData ? aData : u"");
+      if (data.EqualsLiteral("low-memory")) {
+        sVideoQueueMemoryPressure = true;
+      } else if (!data.EqualsLiteral("low-memory-ongoing")) {
+        ++sVideoQueueTrimGeneration;
+      }
+    } else if (strcmp(aTopic, "memory-pressure-stop") == 0) {
+      sVideoQueueMemoryPressure = false;
+    }
+    return NS_OK;
+  }
+
+ private:
+  ~VideoQueueMemoryPressureObserver() = default;
+};
+
+NS_IMPL_ISUPPORTS(VideoQueueMemoryPressureObserver, nsIObserver)
+
 static void InitVideoQueuePrefs() {
   MOZ_ASSERT(NS_IsMainThread());
   static bool sPrefInit = false;
   if (!sPrefInit) {
     sPrefInit = true;
+    if (nsCOMPtr<nsIObserverService> observerService =
+            services::GetObserverService()) {
+      RefPtr<VideoQueueMemoryPressureObserver> observer =
+          new VideoQueueMemoryPressureObserver();
+      observerService->AddObserver(observer, "memory-pressure", false);
+      observerService->AddObserver(observer, "memory-pressure-stop", false);
+    }
     sVideoQueueDefaultSize = Preferences::GetUint(
         "media.video-queue.default-size", MAX_VIDEO_QUEUE_SIZE);
     sVideoQueueHWAccelSize = Preferences::GetUint(
@@ -2935,6 +2991,7 @@ void MediaDecoderStateMachine::DecodeMetadataState::OnMetadataRead(
 
   AUTO_PROFILER_LABEL("DecodeMetadataState::OnMetadataRead", MEDIA_PLAYBACK);
   mMaster->mInfo.emplace(*aMetadata.mInfo);
+  mMaster->UpdateVideoQueueBudget();
   mMaster->mMediaSeekable = Info().mMediaSeekable;
   mMaster->mMediaSeekableOnlyInBufferedRanges =
       Info().mMediaSeekableOnlyInBufferedRanges;
@@ -3774,6 +3831,7 @@ RefPtr<ShutdownPromise> MediaDecoderStateMachine::Shutdown() {
   PROFILER_MARKER_UNTYPED("MDSM::Shutdown", MEDIA_PLAYBACK);
   MOZ_ASSERT(OnTaskQueue());
   mShuttingDown = true;
+  UpdateVideoQueueBudget();
   return mStateObj->HandleShutdown();
 }
 
@@ -3794,6 +3852,7 @@ void MediaDecoderStateMachine::PlayStateChanged() {
     mMinimizePreroll = false;
   }
 
+  UpdateVideoQueueBudget();
   mStateObj->HandlePlayStateChanged(mPlayState);
 }
 
@@ -3831,6 +3890,7 @@ void MediaDecoderStateMachine::SetVideoDecodeModeInternal(
 
   // Set new video decode mode.
   mVideoDecodeMode = aMode;
+  UpdateVideoQueueBudget();
 
   // Start timer to trigger suspended video decoding.
   if (mVideoDecodeMode == VideoDecodeMode::Suspend) {
@@ -4645,9 +4705,54 @@ void MediaDecoderStateMachine::OnMediaSinkAudioError(nsresult aResult) {
 
 uint32_t MediaDecoderStateMachine::GetAmpleVideoFrames() const {
   MOZ_ASSERT(OnTaskQueue());
-  return mReader->VideoIsHardwareAccelerated()
-             ? std::max<uint32_t>(sVideoQueueHWAccelSize, MIN_VIDEO_QUEUE_SIZE)
-             : std::max<uint32_t>(sVideoQueueDefaultSize, MIN_VIDEO_QUEUE_SIZE);
+  uint32_t ampleFrames =
+      mReader->VideoIsHardwareAccelerated()
+          ? std::max<uint32_t>(sVideoQueueHWAccelSize, MIN_VIDEO_QUEUE_SIZE)
+          : std::max<uint32_t>(sVideoQueueDefaultSize, MIN_VIDEO_QUEUE_SIZE);
+  if (sVideoQueueMemoryPressure) {
+    return MIN_VIDEO_QUEUE_SIZE;
+  }
+  uint32_t trimGeneration = sVideoQueueTrimGeneration;
+  if (mVideoQueueTrimGeneration != trimGeneration) {
+    if (VideoQueue().GetSize() > MIN_VIDEO_QUEUE_SIZE) {
+      return MIN_VIDEO_QUEUE_SIZE;
+    }
+    mVideoQueueTrimGeneration = trimGeneration;
+  }
+  if (!mUsesBackgroundVideoBudget) {
+    return ampleFrames;
+  }
+
+  // Assume 8-bit 4:2:0 frames, and account for HaveEnoughDecodedVideo()
+  // queueing more frames at higher playback rates.
+  const gfx::IntSize& size = Info().mVideo.mImage;
+  size_t frameBytes =
+      std::max<size_t>(size_t(size.width) * size.height * 3 / 2, 1);
+  size_t share = BACKGROUND_VIDEO_QUEUE_BUDGET /
+                 std::max<uint32_t>(sBackgroundVideoDecoders, 1);
+  size_t budgetFrames =
+      size_t(share / frameBytes / std::max(mPlaybackRate, 1.0));
+  return std::clamp<size_t>(budgetFrames, MIN_VIDEO_QUEUE_SIZE, ampleFrames);
+}
+
+void MediaDecoderStateMachine::UpdateVideoQueueBudget() {
+  MOZ_ASSERT(OnTaskQueue());
+  // The visible, playing element keeps its full queue; every other one with
+  // video shares the process-wide budget.
+  bool usesBudget = !mShuttingDown && mInfo && HasVideo() &&
+                    (mPlayState != MediaDecoder::PLAY_STATE_PLAYING ||
+                     mVideoDecodeMode == VideoDecodeMode::Suspend);
+  if (usesBudget == mUsesBackgroundVideoBudget) {
+    return;
+  }
+  mUsesBackgroundVideoBudget = usesBudget;
+  if (usesBudget) {
+    ++sBackgroundVideoDecoders;
+  } else {
+    --sBackgroundVideoDecoders;
+  }
+  LOG("UpdateVideoQueueBudget(), background=%d, background decoders=%u",
+      usesBudget, uint32_t(sBackgroundVideoDecoders));
 }
 
 void MediaDecoderStateMachine::GetDebugInfo(
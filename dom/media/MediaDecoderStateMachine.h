@@ -455,6 +455,10 @@ class MediaDecoderStateMachine
   // Must hold monitor.
   uint32_t GetAmpleVideoFrames() const;
 
+  // Updates whether the video queue is sized from the budget shared by the
+  // paused and hidden elements of the process, see GetAmpleVideoFrames().
+  void UpdateVideoQueueBudget();
+
   // Our "ample" audio threshold. Once we've this much audio decoded, we
   // pause decoding.
   media::TimeUnit mAmpleAudioThreshold;
@@ -560,6 +564,14 @@ class MediaDecoderStateMachine
   // after Initialization. TaskQueue thread only.
   bool mIsMediaSinkSuspended = false;
 
+  // True when this state machine is counted in the decoders sharing the
+  // background video queue budget.
+  bool mUsesBackgroundVideoBudget = false;
+
+  // The one-shot video queue trim this state machine last completed, see
+  // GetAmpleVideoFrames().
+  mutable uint32_t mVideoQueueTrimGeneration = 0;
+
   Atomic<bool> mShuttingDown;
 
   Atomic<bool> mInitialized;
@@ -671,6 +671,46 @@ void MediaTrackGraphImpl::UpdateTrackOrder() {
   }
 
   MOZ_ASSERT(orderedTrackCount == mFirstCycleBreaker);
+
+  // Process() handles every track after the first AudioNodeTrack one audio
+  // block at a time, which multiplies the cost of tracks that could produce
+  // all of their output at once, such as the ForwardedInputTracks of many
+  // remote peers, by the number of blocks in an iteration. Move the tracks
+  // which don't depend on any AudioNodeTrack ahead of those which do. This
+  // keeps the relative order within each group, and so the order of dependent
+  // tracks, since no track of the first group has an input in the second.
+  AutoTArray<MediaTrack*, 16> dependentTracks;
+  uint32_t reorderedTrackCount = 0;
+  for (uint32_t i = 0; i < mFirstCycleBreaker; ++i) {
+    MediaTrack* t = mTracks[i];
+    ProcessedMediaTrack* pt = t->AsProcessedTrack();
+    if (pt) {
+      pt->mDependsOnAudioNodes = t->AsAudioNodeTrack() || pt->InMutedCycle();
+      for (uint32_t j = 0;
+           !pt->mDependsOnAudioNodes && j < pt->mInputs.Length(); ++j) {
+        MediaTrack* source = pt->mInputs[j]->GetSource();
+        ProcessedMediaTrack* processedSource = source->AsProcessedTrack();
+        pt->mDependsOnAudioNodes =
+            source->AsAudioNodeTrack() ||
+            (processedSource && (source->IsSuspended() ||
+                                 processedSource->mDependsOnAudioNodes));
+      }
+      if (pt->mDependsOnAudioNodes) {
+        dependentTracks.AppendElement(t);
+        continue;
+      }
+    }
+    mTracks[reorderedTrackCount] = t;
+    ++reorderedTrackCount;
+  }
+  for (MediaTrack* t : dependentTracks) {
+    mTracks[reorderedTrackCount] = t;
+    ++reorderedTrackCount;
+  }
+  MOZ_ASSERT(reorderedTrackCount == mFirstCycleBreaker);
+  for (uint32_t i = mFirstCycleBreaker; i < mTracks.Length(); ++i) {
+    mTracks[i]->AsProcessedTrack()->mDependsOnAudioNodes = true;
+  }
 }
 
 TrackTime MediaTrackGraphImpl::PlayAudio(const TrackAndVolume& aOutput,
@@ -971,7 +971,8 @@ class ProcessedMediaTrack : public MediaTrack {
                       MediaSegment* aSegment)
       : MediaTrack(aSampleRate, aType, aSegment),
         mAutoend(true),
-        mCycleMarker(0) {}
+        mCycleMarker(0),
+        mDependsOnAudioNodes(false) {}
 
   // Control API.
   /**
@@ -1063,6 +1064,10 @@ class ProcessedMediaTrack : public MediaTrack {
   // whether this track is in a muted cycle.  During ordering it can contain
   // other marker values - see MediaTrackGraphImpl::UpdateTrackOrder().
   uint32_t mCycleMarker;
+  // After UpdateTrackOrder(), true for AudioNodeTracks, tracks in muted cycles
+  // and tracks processing input from one of these, directly or not. These
+  // tracks are ordered last, since they are processed one block at a time.
+  bool mDependsOnAudioNodes;
 };
 
 /**
@@ -9,6 +9,7 @@
 #include "FFmpegLog.h"
 #include "mozilla/widget/DMABufLibWrapper.h"
 #include "libavutil/pixfmt.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/StaticPrefs_media.h"
 #include "mozilla/gfx/gfxVars.h"
 #include "mozilla/widget/va_drmcommon.h"
@@ -125,6 +126,11 @@ VideoFramePool<LIBAV_VER>::VideoFramePool(int aFFMPEGPoolSize)
 
 VideoFramePool<LIBAV_VER>::~VideoFramePool() {
   MutexAutoLock lock(mSurfaceLock);
+  DMABUF_LOG(
+      "VideoFramePool::~VideoFramePool() %u frames zero-copy, copied %u with "
+      "zero-copy disabled, %u low on ffmpeg surfaces",
+      mZeroCopyFrames, mCopiedFrames[size_t(CopyReason::ZeroCopyDisabled)],
+      mCopiedFrames[size_t(CopyReason::LowOnFFmpegSurfaces)]);
   mDMABufSurfaces.Clear();
 }
 
@@ -166,7 +172,7 @@ void VideoFramePool<LIBAV_VER>::CheckNewFFMPEGSurface(
   }
 }
 
-bool VideoFramePool<LIBAV_VER>::ShouldCopySurface() {
+bool VideoFramePool<LIBAV_VER>::ShouldCopySurface(CopyReason* aReason) {
   // Number of used HW surfaces.
   int surfacesUsed = 0;
   int surfacesUsedFFmpeg = 0;
@@ -189,11 +195,27 @@ bool VideoFramePool<LIBAV_VER>::ShouldCopySurface() {
       (int)mDMABufSurfaces.Length(), surfacesUsed - surfacesUsedFFmpeg,
       surfacesUsedFFmpeg, mFFMPEGPoolSize, freeRatio);
   if (!gfx::gfxVars::HwDecodedVideoZeroCopy()) {
+    *aReason = CopyReason::ZeroCopyDisabled;
     return true;
   }
+  *aReason = CopyReason::LowOnFFmpegSurfaces;
   return freeRatio < SURFACE_COPY_THRESHOLD;
 }
 
+void VideoFramePool<LIBAV_VER>::CountFrame(bool aCopied, CopyReason aReason) {
+  if (!aCopied) {
+    mZeroCopyFrames++;
+    return;
+  }
+  if (mCopiedFrames[size_t(aReason)]++ == 0) {
+    PROFILER_MARKER_TEXT(
+        "VideoFramePool", MEDIA_PLAYBACK, {},
+        aReason == CopyReason::ZeroCopyDisabled
+            ? "Copying decoded frames: zero-copy disabled"_ns
+            : "Copying decoded frames: low on ffmpeg surfaces"_ns);
+  }
+}
+
 RefPtr<VideoFrameSurface<LIBAV_VER>>
 VideoFramePool<LIBAV_VER>::GetVideoFrameSurface(
     VADRMPRIMESurfaceDescriptor& aVaDesc, int aWidth, int aHeight,
@@ -221,7 +243,8 @@ VideoFramePool<LIBAV_VER>::GetVideoFrameSurface(
   DMABUF_LOG("Using VA-API DMABufSurface UID %d FFMPEG ID 0x%x",
              surface->GetUID(), ffmpegSurfaceID);
 
-  bool copySurface = mTextureCopyWorks && ShouldCopySurface();
+  CopyReason copyReason = CopyReason::ZeroCopyDisabled;
+  bool copySurface = mTextureCopyWorks && ShouldCopySurface(&copyReason);
   if (!surface->UpdateYUVData(aVaDesc, aWidth, aHeight, copySurface)) {
     if (!copySurface) {
       // Failed without texture copy. We can't do more here.
@@ -244,6 +267,7 @@ VideoFramePool<LIBAV_VER>::GetVideoFrameSurface(
   }
 
   videoSurface->MarkAsUsed(ffmpegSurfaceID);
+  CountFrame(copySurface, copyReason);
 
   if (!copySurface) {
     // Check that newly added ffmpeg surface isn't already used by different
@@ -376,7 +400,8 @@ VideoFramePool<LIBAV_VER>::GetVideoFrameSurface(AVDRMFrameDescriptor& aDesc,
   DMABUF_LOG("Using V4L2 DMABufSurface UID %d FFMPEG ID 0x%x",
              surface->GetUID(), ffmpegSurfaceID);
 
-  bool copySurface = mTextureCopyWorks && ShouldCopySurface();
+  CopyReason copyReason = CopyReason::ZeroCopyDisabled;
+  bool copySurface = mTextureCopyWorks && ShouldCopySurface(&copyReason);
   if (!surface->UpdateYUVData(layerDesc.value(), crop_width, crop_height,
                               copySurface)) {
     if (!copySurface) {
@@ -401,6 +426,7 @@ VideoFramePool<LIBAV_VER>::GetVideoFrameSurface(AVDRMFrameDescriptor& aDesc,
   }
 
   videoSurface->MarkAsUsed(ffmpegSurfaceID);
+  CountFrame(copySurface, copyReason);
 
   if (!copySurface) {
     // Check that newly added ffmpeg surface isn't already used by different
@@ -132,9 +132,20 @@ class VideoFramePool<LIBAV_VER> {
   void ReleaseUnusedVAAPIFrames();
 
  private:
+  // Why a decoded frame is copied to a surface of ours instead of being
+  // exported as it is.
+  enum class CopyReason : uint8_t {
+    // gfxVars::HwDecodedVideoZeroCopy() is off.
+    ZeroCopyDisabled,
+    // Too few of the ffmpeg surfaces are free to keep more of them locked.
+    LowOnFFmpegSurfaces,
+    Count
+  };
+
   RefPtr<VideoFrameSurface<LIBAV_VER>> GetFreeVideoFrameSurface();
-  bool ShouldCopySurface();
+  bool ShouldCopySurface(CopyReason* aReason);
   void CheckNewFFMPEGSurface(VASurfaceID aNewSurfaceID);
+  void CountFrame(bool aCopied, CopyReason aReason);
 
  private:
   // Protect mDMABufSurfaces pool access
@@ -148,6 +159,10 @@ class VideoFramePool<LIBAV_VER> {
   Maybe<bool> mTextureCreationWorks;
   // We may fail to copy DMABuf memory on NVIDIA drivers.
   bool mTextureCopyWorks = true;
+  // Number of frames exported without a copy, and of frames copied for each
+  // CopyReason, logged when the pool is destroyed.
+  uint32_t mZeroCopyFrames = 0;
+  uint32_t mCopiedFrames[size_t(CopyReason::Count)] = {};
 };
 
 }  // namespace mozilla
@@ -19,6 +19,10 @@
 #  include "mozilla/SSE.h"
 #  include "AudioNodeEngineGeneric.h"
 #endif
+#if defined(USE_AVX2) && defined(USE_FMA3)
+#  include "mozilla/SSE.h"
+#  include "AudioNodeEngineGeneric.h"
+#endif
 #include "AudioBlock.h"
 #include "Tracing.h"
 
@@ -78,6 +82,12 @@ void AudioBufferAddWithScale(const float* aInput, float aScale, float* aOutput,
 
 #ifdef USE_SSE2
   if (mozilla::supports_sse2()) {
+#  if defined(USE_AVX2) && defined(USE_FMA3)
+    if (mozilla::supports_fma3() && mozilla::supports_avx2()) {
+      Engine<xsimd::fma3<xsimd::avx2>>::AudioBufferAddWithScale(
+          aInput, aScale, aOutput, aSize);
+    } else
+#  endif
 #  if defined(USE_SSE42) && defined(USE_FMA3)
     if (mozilla::supports_fma3() && mozilla::supports_sse4_2()) {
       Engine<xsimd::fma3<xsimd::sse4_2>>::AudioBufferAddWithScale(
@@ -339,7 +349,7 @@ void AudioBlockPanStereoToStereo(const float aInputL[WEBAUDIO_BLOCK_SIZE],
   if (mozilla::supports_sse2()) {
 #  if defined(USE_SSE42) && defined(USE_FMA3)
     if (mozilla::supports_fma3() && mozilla::supports_sse4_2()) {
-      Engine<xsimd::fma3<xsimd::sse2>>::AudioBlockPanStereoToStereo(
+      Engine<xsimd::fma3<xsimd::sse4_2>>::AudioBlockPanStereoToStereo(
           aInputL, aInputR, aGainL, aGainR, aIsOnTheLeft, aOutputL, aOutputR);
     } else
 #  endif
@@ -372,6 +382,12 @@ float AudioBufferSumOfSquares(const float* aInput, uint32_t aLength) {
 
 #ifdef USE_SSE2
   if (mozilla::supports_sse()) {
+#  if defined(USE_AVX2) && defined(USE_FMA3)
+    if (mozilla::supports_fma3() && mozilla::supports_avx2()) {
+      return Engine<xsimd::fma3<xsimd::avx2>>::AudioBufferSumOfSquares(
+          aInput, aLength);
+    }
+#  endif
 #  if defined(USE_SSE42) && defined(USE_FMA3)
     if (mozilla::supports_fma3() && mozilla::supports_sse4_2()) {
       return Engine<xsimd::fma3<xsimd::sse4_2>>::AudioBufferSumOfSquares(
@@ -395,6 +411,12 @@ float AudioBufferSumOfSquares(const float* aInput, uint32_t aLength) {
 void NaNToZeroInPlace(float* aSamples, size_t aCount) {
 #ifdef USE_SSE2
   if (mozilla::supports_sse2()) {
+#  if defined(USE_AVX2) && defined(USE_FMA3)
+    if (mozilla::supports_fma3() && mozilla::supports_avx2()) {
+      Engine<xsimd::fma3<xsimd::avx2>>::NaNToZeroInPlace(aSamples, aCount);
+      return;
+    }
+#  endif
     Engine<xsimd::sse2>::NaNToZeroInPlace(aSamples, aCount);
     return;
   }
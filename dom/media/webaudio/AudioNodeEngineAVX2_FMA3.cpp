@@ -0,0 +1,18 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngineGenericImpl.h"
+
+namespace mozilla {
+// Audio blocks are only guaranteed to be 16-byte aligned, so only the
+// functions that handle a misaligned prologue themselves are instantiated
+// for 32-byte vectors.
+template void Engine<xsimd::fma3<xsimd::avx2>>::AudioBufferAddWithScale(
+    const float* aInput, float aScale, float* aOutput, uint32_t aSize);
+template float Engine<xsimd::fma3<xsimd::avx2>>::AudioBufferSumOfSquares(
+    const float* aInput, uint32_t aLength);
+template void Engine<xsimd::fma3<xsimd::avx2>>::NaNToZeroInPlace(
+    float* aSamples, size_t aCount);
+}  // namespace mozilla
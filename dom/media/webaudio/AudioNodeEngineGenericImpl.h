@@ -31,37 +31,40 @@ static bool is_aligned(const void* ptr) {
 template <class Arch>
 void Engine<Arch>::AudioBufferAddWithScale(const float* aInput, float aScale,
                                            float* aOutput, uint32_t aSize) {
+  // Peel off a scalar head until aOutput is aligned. aInput may still be
+  // misaligned relative to aOutput, e.g. 16-byte aligned buffers with 32-byte
+  // vectors, in which case it is read with unaligned loads below rather than
+  // falling back to scalar code for the whole buffer.
   if constexpr (Arch::requires_alignment()) {
-    if (aScale == 1.0f) {
-      while (!is_aligned<Arch>(aInput) || !is_aligned<Arch>(aOutput)) {
-        if (!aSize) return;
-        *aOutput += *aInput;
-        ++aOutput;
-        ++aInput;
-        --aSize;
-      }
-    } else {
-      while (!is_aligned<Arch>(aInput) || !is_aligned<Arch>(aOutput)) {
-        if (!aSize) return;
-        *aOutput += *aInput * aScale;
-        ++aOutput;
-        ++aInput;
-        --aSize;
-      }
+    while (!is_aligned<Arch>(aOutput)) {
+      if (!aSize) return;
+      *aOutput += *aInput * aScale;
+      ++aOutput;
+      ++aInput;
+      --aSize;
     }
   }
-  MOZ_ASSERT(is_aligned<Arch>(aInput), "aInput is aligned");
   MOZ_ASSERT(is_aligned<Arch>(aOutput), "aOutput is aligned");
 
   xsimd::batch<float, Arch> vgain(aScale);
 
   uint32_t aVSize = aSize & ~(xsimd::batch<float, Arch>::size - 1);
-  MOZ_UNROLL(4)
-  for (unsigned i = 0; i < aVSize; i += xsimd::batch<float, Arch>::size) {
-    auto vin1 = xsimd::batch<float, Arch>::load_aligned(&aInput[i]);
-    auto vin2 = xsimd::batch<float, Arch>::load_aligned(&aOutput[i]);
-    auto vout = xsimd::fma(vin1, vgain, vin2);
-    vout.store_aligned(&aOutput[i]);
+  if (is_aligned<Arch>(aInput)) {
+    MOZ_UNROLL(4)
+    for (unsigned i = 0; i < aVSize; i += xsimd::batch<float, Arch>::size) {
+      auto vin1 = xsimd::batch<float, Arch>::load_aligned(&aInput[i]);
+      auto vin2 = xsimd::batch<float, Arch>::load_aligned(&aOutput[i]);
+      auto vout = xsimd::fma(vin1, vgain, vin2);
+      vout.store_aligned(&aOutput[i]);
+    }
+  } else {
+    MOZ_UNROLL(4)
+    for (unsigned i = 0; i < aVSize; i += xsimd::batch<float, Arch>::size) {
+      auto vin1 = xsimd::batch<float, Arch>::load_unaligned(&aInput[i]);
+      auto vin2 = xsimd::batch<float, Arch>::load_aligned(&aOutput[i]);
+      auto vout = xsimd::fma(vin1, vgain, vin2);
+      vout.store_aligned(&aOutput[i]);
+    }
   }
 
   for (unsigned i = aVSize; i < aSize; ++i) {
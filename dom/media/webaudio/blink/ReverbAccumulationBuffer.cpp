@@ -74,6 +74,35 @@ void ReverbAccumulationBuffer::readAndClear(float* destination,
   m_readTimeFrame += numberOfFrames;
 }
 
+void ReverbAccumulationBuffer::readAndAddTo(float* destination,
+                                            size_t numberOfFrames) {
+  size_t bufferLength = m_buffer.Length();
+  bool isCopySafe =
+      m_readIndex <= bufferLength && numberOfFrames <= bufferLength;
+
+  MOZ_ASSERT(isCopySafe);
+  if (!isCopySafe) return;
+
+  size_t framesAvailable = bufferLength - m_readIndex;
+  size_t numberOfFrames1 = std::min(numberOfFrames, framesAvailable);
+  size_t numberOfFrames2 = numberOfFrames - numberOfFrames1;
+
+  float* source = m_buffer.Elements();
+  AudioBufferAddWithScale(source + m_readIndex, 1.0f, destination,
+                          numberOfFrames1);
+  memset(source + m_readIndex, 0, sizeof(float) * numberOfFrames1);
+
+  // Handle wrap-around if necessary
+  if (numberOfFrames2 > 0) {
+    AudioBufferAddWithScale(source, 1.0f, destination + numberOfFrames1,
+                            numberOfFrames2);
+    memset(source, 0, sizeof(float) * numberOfFrames2);
+  }
+
+  m_readIndex = (m_readIndex + numberOfFrames) % bufferLength;
+  m_readTimeFrame += numberOfFrames;
+}
+
 void ReverbAccumulationBuffer::accumulate(const float* source,
                                           size_t numberOfFrames,
                                           size_t* readIndex,
@@ -48,6 +48,9 @@ class ReverbAccumulationBuffer {
   // This will read from, then clear-out numberOfFrames
   void readAndClear(float* destination, size_t numberOfFrames);
 
+  // Same as readAndClear(), but adds the frames read to destination.
+  void readAndAddTo(float* destination, size_t numberOfFrames);
+
   // Each ReverbConvolverStage will accumulate its output at the appropriate
   // delay from the read position. We need to pass in and update readIndex here,
   // since each ReverbConvolverStage may be running in a different thread than
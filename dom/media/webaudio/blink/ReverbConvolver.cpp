@@ -29,6 +29,8 @@
 #include "ReverbConvolver.h"
 #include "ReverbConvolverStage.h"
 
+#include <algorithm>
+
 using namespace mozilla;
 
 namespace WebCore {
@@ -55,6 +57,15 @@ const size_t MinFFTSize = 256;
 // every several processing slices.  This way we amortize the cost over more
 // processing slices.
 const size_t MaxRealtimeFFTSize = 4096;
+// The stages past RealtimeFrameLimit are split between one background thread
+// for every BackgroundThreadFrames of the impulse response, up to
+// MaxBackgroundThreads, so that the tail of long reverbs is not limited to
+// the throughput of a single core.
+const size_t BackgroundThreadFrames = 2 * 48000;
+const size_t MaxBackgroundThreads = 3;
+
+ReverbConvolver::BackgroundWorker::BackgroundWorker()
+    : m_thread("ConvolverWorker"), m_moreInputBuffered(false) {}
 
 ReverbConvolver::ReverbConvolver(const float* impulseResponseData,
                                  size_t impulseResponseLength,
@@ -63,16 +74,33 @@ ReverbConvolver::ReverbConvolver(const float* impulseResponseData,
                                  bool* aAllocationFailure)
     : m_impulseResponseLength(impulseResponseLength),
       m_inputBuffer(InputBufferSize),
-      m_backgroundThread("ConvolverWorker"),
       m_backgroundThreadMonitor("ConvolverMonitor"),
       m_useBackgroundThreads(useBackgroundThreads),
-      m_wantsToExit(false),
-      m_moreInputBuffered(false) {
+      m_wantsToExit(false) {
   *aAllocationFailure = !m_accumulationBuffer.allocate(impulseResponseLength +
                                                        WEBAUDIO_BLOCK_SIZE);
   if (*aAllocationFailure) {
     return;
   }
+
+  size_t backgroundLength = impulseResponseLength > RealtimeFrameLimit
+                                ? impulseResponseLength - RealtimeFrameLimit
+                                : 0;
+  if (this->useBackgroundThreads() && backgroundLength > 0) {
+    size_t workerCount = std::clamp<size_t>(
+        (backgroundLength + BackgroundThreadFrames - 1) /
+            BackgroundThreadFrames,
+        1, MaxBackgroundThreads);
+    for (size_t i = 0; i < workerCount; ++i) {
+      UniquePtr<BackgroundWorker> worker = MakeUnique<BackgroundWorker>();
+      *aAllocationFailure = !worker->m_accumulationBuffer.allocate(
+          impulseResponseLength + WEBAUDIO_BLOCK_SIZE);
+      if (*aAllocationFailure) {
+        return;
+      }
+      m_backgroundWorkers.AppendElement(std::move(worker));
+    }
+  }
   // For the moment, a good way to know if we have real-time constraint is to
   // check if we're using background threads. Otherwise, assume we're being run
   // from a command-line tool.
@@ -107,15 +135,27 @@ ReverbConvolver::ReverbConvolver(const float* impulseResponseData,
     // at the same time
     int renderPhase = convolverRenderPhase + stagePhase;
 
+    bool isBackgroundStage =
+        this->useBackgroundThreads() && stageOffset > RealtimeFrameLimit;
+
+    // Background stages are given to the worker covering their offset in
+    // the tail.
+    BackgroundWorker* worker = nullptr;
+    if (isBackgroundStage) {
+      size_t workerIndex = std::min(
+          (stageOffset - RealtimeFrameLimit) * m_backgroundWorkers.Length() /
+              backgroundLength,
+          m_backgroundWorkers.Length() - 1);
+      worker = m_backgroundWorkers[workerIndex].get();
+    }
+
     UniquePtr<ReverbConvolverStage> stage(new ReverbConvolverStage(
         response, totalResponseLength, reverbTotalLatency, stageOffset,
-        stageSize, fftSize, renderPhase, &m_accumulationBuffer));
-
-    bool isBackgroundStage = false;
+        stageSize, fftSize, renderPhase,
+        worker ? &worker->m_accumulationBuffer : &m_accumulationBuffer));
 
-    if (this->useBackgroundThreads() && stageOffset > RealtimeFrameLimit) {
-      m_backgroundStages.AppendElement(std::move(stage));
-      isBackgroundStage = true;
+    if (worker) {
+      worker->m_stages.AppendElement(std::move(stage));
     } else
       m_stages.AppendElement(std::move(stage));
 
@@ -150,33 +190,45 @@ ReverbConvolver::ReverbConvolver(const float* impulseResponseData,
     }
   }
 
-  // Start up background thread
+  m_backgroundWorkers.RemoveElementsBy(
+      [](const auto& aWorker) { return aWorker->m_stages.IsEmpty(); });
+
+  // Start up background threads
   // FIXME: would be better to up the thread priority here.  It doesn't need to
   // be real-time, but higher than the default...
-  if (this->useBackgroundThreads() && m_backgroundStages.Length() > 0) {
-    if (!m_backgroundThread.Start()) {
+  for (auto& worker : m_backgroundWorkers) {
+    if (!worker->m_thread.Start()) {
       NS_WARNING("Cannot start convolver thread.");
       return;
     }
-    m_backgroundThread.message_loop()->PostTask(NewNonOwningRunnableMethod(
-        "WebCore::ReverbConvolver::backgroundThreadEntry", this,
-        &ReverbConvolver::backgroundThreadEntry));
+    worker->m_thread.message_loop()->PostTask(
+        NewNonOwningRunnableMethod<BackgroundWorker*>(
+            "WebCore::ReverbConvolver::backgroundThreadEntry", this,
+            &ReverbConvolver::backgroundThreadEntry, worker.get()));
   }
 }
 
 ReverbConvolver::~ReverbConvolver() {
-  // Wait for background thread to stop
-  if (useBackgroundThreads() && m_backgroundThread.IsRunning()) {
-    m_wantsToExit = true;
+  // Wait for background threads to stop
+  if (m_backgroundWorkers.IsEmpty()) {
+    return;
+  }
 
-    // Wake up thread so it can return
-    {
-      MonitorAutoLock locker(m_backgroundThreadMonitor);
-      m_moreInputBuffered = true;
-      m_backgroundThreadMonitor.Notify();
+  m_wantsToExit = true;
+
+  // Wake up threads so they can return
+  {
+    MonitorAutoLock locker(m_backgroundThreadMonitor);
+    for (auto& worker : m_backgroundWorkers) {
+      worker->m_moreInputBuffered = true;
     }
+    m_backgroundThreadMonitor.NotifyAll();
+  }
 
-    m_backgroundThread.Stop();
+  for (auto& worker : m_backgroundWorkers) {
+    if (worker->m_thread.IsRunning()) {
+      worker->m_thread.Stop();
+    }
   }
 }
 
@@ -190,31 +242,34 @@ size_t ReverbConvolver::sizeOfIncludingThis(
     }
   }
 
-  amount += m_backgroundStages.ShallowSizeOfExcludingThis(aMallocSizeOf);
-  for (size_t i = 0; i < m_backgroundStages.Length(); i++) {
-    if (m_backgroundStages[i]) {
-      amount += m_backgroundStages[i]->sizeOfIncludingThis(aMallocSizeOf);
+  // NB: The buffer sizes are static, so even though they might be accessed
+  //     in another thread it's safe to measure them.
+  amount += m_backgroundWorkers.ShallowSizeOfExcludingThis(aMallocSizeOf);
+  for (const auto& worker : m_backgroundWorkers) {
+    amount += aMallocSizeOf(worker.get());
+    amount += worker->m_stages.ShallowSizeOfExcludingThis(aMallocSizeOf);
+    for (const auto& stage : worker->m_stages) {
+      amount += stage->sizeOfIncludingThis(aMallocSizeOf);
     }
+    amount += worker->m_accumulationBuffer.sizeOfExcludingThis(aMallocSizeOf);
   }
 
-  // NB: The buffer sizes are static, so even though they might be accessed
-  //     in another thread it's safe to measure them.
   amount += m_accumulationBuffer.sizeOfExcludingThis(aMallocSizeOf);
   amount += m_inputBuffer.sizeOfExcludingThis(aMallocSizeOf);
 
   // Possible future measurements:
-  // - m_backgroundThread
+  // - BackgroundWorker::m_thread
   // - m_backgroundThreadMonitor
   return amount;
 }
 
-void ReverbConvolver::backgroundThreadEntry() {
+void ReverbConvolver::backgroundThreadEntry(BackgroundWorker* aWorker) {
   while (!m_wantsToExit) {
     // Wait for realtime thread to give us more input
-    m_moreInputBuffered = false;
+    aWorker->m_moreInputBuffered = false;
     {
       MonitorAutoLock locker(m_backgroundThreadMonitor);
-      while (!m_moreInputBuffered && !m_wantsToExit)
+      while (!aWorker->m_moreInputBuffered && !m_wantsToExit)
         m_backgroundThreadMonitor.Wait();
     }
 
@@ -222,16 +277,16 @@ void ReverbConvolver::backgroundThreadEntry() {
     // buffer's write index
     int writeIndex = m_inputBuffer.writeIndex();
 
-    // Even though it doesn't seem like every stage needs to maintain its own
-    // version of readIndex we do this in case we want to run in more than one
-    // background thread.
+    // Every stage maintains its own version of readIndex, as the stages of
+    // each background thread read the input at their own pace.
+    nsTArray<UniquePtr<ReverbConvolverStage> >& stages = aWorker->m_stages;
     int readIndex;
 
-    while ((readIndex = m_backgroundStages[0]->inputReadIndex()) !=
+    while ((readIndex = stages[0]->inputReadIndex()) !=
            writeIndex) {  // FIXME: do better to detect buffer overrun...
       // Accumulate contributions from each stage
-      for (size_t i = 0; i < m_backgroundStages.Length(); ++i)
-        m_backgroundStages[i]->processInBackground(this);
+      for (size_t i = 0; i < stages.Length(); ++i)
+        stages[i]->processInBackground(this);
     }
   }
 }
@@ -252,8 +307,11 @@ void ReverbConvolver::process(const float* sourceChannelData,
 
   // Finally read from accumulation buffer
   m_accumulationBuffer.readAndClear(destination, WEBAUDIO_BLOCK_SIZE);
+  for (auto& worker : m_backgroundWorkers) {
+    worker->m_accumulationBuffer.readAndAddTo(destination, WEBAUDIO_BLOCK_SIZE);
+  }
 
-  // Now that we've buffered more input, wake up our background thread.
+  // Now that we've buffered more input, wake up our background threads.
 
   // Not using a MonitorAutoLock looks strange, but we use a TryLock() instead
   // because this is run on the real-time thread where it is a disaster for the
@@ -262,9 +320,11 @@ void ReverbConvolver::process(const float* sourceChannelData,
   // We're called repeatedly and frequently (around every 3ms).  The background
   // thread is processing well into the future and has a considerable amount of
   // leeway here...
-  if (m_backgroundThreadMonitor.TryLock()) {
-    m_moreInputBuffered = true;
-    m_backgroundThreadMonitor.Notify();
+  if (!m_backgroundWorkers.IsEmpty() && m_backgroundThreadMonitor.TryLock()) {
+    for (auto& worker : m_backgroundWorkers) {
+      worker->m_moreInputBuffered = true;
+    }
+    m_backgroundThreadMonitor.NotifyAll();
     m_backgroundThreadMonitor.Unlock();
   }
 }
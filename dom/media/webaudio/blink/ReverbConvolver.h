@@ -66,13 +66,27 @@ class ReverbConvolver {
   ReverbInputBuffer* inputBuffer() { return &m_inputBuffer; }
 
   bool useBackgroundThreads() const { return m_useBackgroundThreads; }
-  void backgroundThreadEntry();
 
   size_t sizeOfIncludingThis(mozilla::MallocSizeOf aMallocSizeOf) const;
 
  private:
+  // The stages of a contiguous part of the tail of the impulse response,
+  // processed on their own thread.  Each worker accumulates into its own
+  // buffer, so that workers running at different paces never add to the same
+  // frames concurrently.
+  struct BackgroundWorker {
+    BackgroundWorker();
+
+    nsTArray<UniquePtr<ReverbConvolverStage> > m_stages;
+    ReverbAccumulationBuffer m_accumulationBuffer;
+    base::Thread m_thread;
+    std::atomic<bool> m_moreInputBuffered;
+  };
+
+  void backgroundThreadEntry(BackgroundWorker* aWorker);
+
   nsTArray<UniquePtr<ReverbConvolverStage> > m_stages;
-  nsTArray<UniquePtr<ReverbConvolverStage> > m_backgroundStages;
+  nsTArray<UniquePtr<BackgroundWorker> > m_backgroundWorkers;
   size_t m_impulseResponseLength;
 
   ReverbAccumulationBuffer m_accumulationBuffer;
@@ -81,12 +95,10 @@ class ReverbConvolver {
   // from the realtime thread.
   ReverbInputBuffer m_inputBuffer;
 
-  // Background thread and synchronization
-  base::Thread m_backgroundThread;
+  // Background threads synchronization
   mozilla::Monitor m_backgroundThreadMonitor MOZ_UNANNOTATED;
   bool m_useBackgroundThreads;
   std::atomic<bool> m_wantsToExit;
-  std::atomic<bool> m_moreInputBuffered;
 };
 
 }  // namespace WebCore
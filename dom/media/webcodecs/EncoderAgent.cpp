@@ -284,6 +284,8 @@ RefPtr<ShutdownPromise> EncoderAgent::Shutdown() {
   // Cancel encoder in flight if any.
   mEncodeRequest.DisconnectIfExists();
   mEncodePromise.RejectIfExists(r, __func__);
+  mEncodeInputs.Clear();
+  mEncodeData.Clear();
 
   // Cancel flush-out in flight if any.
   mDrainRequest.DisconnectIfExists();
@@ -299,8 +301,16 @@ RefPtr<ShutdownPromise> EncoderAgent::Shutdown() {
 }
 
 RefPtr<EncoderAgent::EncodePromise> EncoderAgent::Encode(MediaData* aInput) {
-  MOZ_ASSERT(mOwnerThread->IsOnCurrentThread());
   MOZ_ASSERT(aInput);
+  nsTArray<RefPtr<MediaData>> inputs;
+  inputs.AppendElement(aInput);
+  return Encode(std::move(inputs));
+}
+
+RefPtr<EncoderAgent::EncodePromise> EncoderAgent::Encode(
+    nsTArray<RefPtr<MediaData>>&& aInputs) {
+  MOZ_ASSERT(mOwnerThread->IsOnCurrentThread());
+  MOZ_ASSERT(!aInputs.IsEmpty());
   MOZ_ASSERT(mState == State::Configured || mState == State::Error);
   MOZ_ASSERT(mEncodePromise.IsEmpty());
   MOZ_ASSERT(!mEncodeRequest.Exists());
@@ -318,27 +328,49 @@ RefPtr<EncoderAgent::EncodePromise> EncoderAgent::Encode(MediaData* aInput) {
   SetState(State::Encoding);
 
   RefPtr<EncodePromise> p = mEncodePromise.Ensure(__func__);
+  MOZ_ASSERT(mEncodeInputs.IsEmpty());
+  MOZ_ASSERT(mEncodeData.IsEmpty());
+  mEncodeInputs = std::move(aInputs);
+  EncodeNextInput();
+  return p;
+}
+
+void EncoderAgent::EncodeNextInput() {
+  MOZ_ASSERT(mOwnerThread->IsOnCurrentThread());
+  MOZ_ASSERT(mState == State::Encoding);
+  MOZ_ASSERT(!mEncodeInputs.IsEmpty());
+  MOZ_ASSERT(mEncoder);
 
-  mEncoder->Encode(aInput)
+  RefPtr<MediaData> input = mEncodeInputs[0];
+  mEncodeInputs.RemoveElementAt(0);
+
+  mEncoder->Encode(input)
       ->Then(
           mOwnerThread, __func__,
           [self = RefPtr{this}](MediaDataEncoder::EncodedData&& aData) {
             self->mEncodeRequest.Complete();
+            self->mEncodeData.AppendElements(std::move(aData));
+            if (!self->mEncodeInputs.IsEmpty()) {
+              self->EncodeNextInput();
+              return;
+            }
             LOGV("EncoderAgent #%zu (%p) encode successful", self->mId,
                  self.get());
             self->SetState(State::Configured);
-            self->mEncodePromise.Resolve(std::move(aData), __func__);
+            self->mEncodePromise.Resolve(std::move(self->mEncodeData),
+                                         __func__);
+            self->mEncodeData.Clear();
           },
           [self = RefPtr{this}](const MediaResult& aError) {
             self->mEncodeRequest.Complete();
             LOGV("EncoderAgent #%zu (%p) failed to encode", self->mId,
                  self.get());
+            self->mEncodeInputs.Clear();
+            self->mEncodeData.Clear();
             self->SetState(State::Error);
             self->mEncodePromise.Reject(aError, __func__);
           })
       ->Track(mEncodeRequest);
-
-  return p;
 }
 
 RefPtr<EncoderAgent::EncodePromise> EncoderAgent::Drain() {
@@ -56,6 +56,9 @@ class EncoderAgent final {
   RefPtr<ShutdownPromise> Shutdown();
   using EncodePromise = MediaDataEncoder::EncodePromise;
   RefPtr<EncodePromise> Encode(MediaData* aInput);
+  // Encodes the inputs one after the other without returning to the caller in
+  // between, and resolves with the data output for all of them.
+  RefPtr<EncodePromise> Encode(nsTArray<RefPtr<MediaData>>&& aInputs);
   // WebCodecs's flush() flushes out all the pending encoded data in the
   // encoder. It's called Drain internally.
   RefPtr<EncodePromise> Drain();
@@ -71,6 +74,8 @@ class EncoderAgent final {
   RefPtr<EncodePromise> Dry();
   void DryUntilDrain();
 
+  void EncodeNextInput();
+
   MOZ_DEFINE_ENUM_CLASS_WITH_TOSTRING_AT_CLASS_SCOPE(
       State, (Unconfigured, Configuring, Configured, Encoding, Flushing,
               ShuttingDown, Error));
@@ -99,6 +104,10 @@ class EncoderAgent final {
   // Encoding
   MozPromiseHolder<EncodePromise> mEncodePromise;
   MozPromiseRequestHolder<EncodePromise> mEncodeRequest;
+  // The inputs of the current Encode() call yet to be given to mEncoder, and
+  // the data output so far.
+  nsTArray<RefPtr<MediaData>> mEncodeInputs;
+  MediaDataEncoder::EncodedData mEncodeData;
 
   // Drain
   MozPromiseRequestHolder<EncodePromise> mDrainRequest;
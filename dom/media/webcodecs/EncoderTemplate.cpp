@@ -49,6 +49,22 @@ namespace mozilla::dom {
 #endif  // LOGV
 #define LOGV(msg, ...) LOG_INTERNAL(Verbose, msg, ##__VA_ARGS__)
 
+// The maximum number of consecutive encode messages given to the
+// EncoderAgent at once.
+static constexpr size_t kMaxEncodeBatchSize = 8;
+
+// A batch only resolves once all of its inputs are encoded, which delays the
+// output of its first input. That is only acceptable for video encoders
+// configured for quality; realtime encoders and audio encoders, which have no
+// latency mode, encode and output each input on its own.
+static bool AllowsEncodeBatching(const VideoEncoderConfigInternal& aConfig) {
+  return aConfig.mLatencyMode == LatencyMode::Quality;
+}
+
+static bool AllowsEncodeBatching(const AudioEncoderConfigInternal&) {
+  return false;
+}
+
 /*
  * Below are ControlMessage classes implementations
  */
@@ -833,10 +849,29 @@ MessageProcessedResult EncoderTemplate<EncoderType>::ProcessEncodeMessage(
   mProcessingMessage = aMessage;
   mControlMessageQueue.pop();
 
-  LOGV("%s %p processing %s", EncoderType::Name.get(), this,
-       aMessage->ToString().get());
+  // In quality mode, take the encode messages queued right after this one as
+  // well, so that frames enqueued in a burst are given to the EncoderAgent
+  // together rather than each waiting for the previous one to come back
+  // through the control message queue. aMessage stands for the whole batch.
+  nsTArray<RefPtr<EncodeMessage>> batch;
+  batch.AppendElement(aMessage);
+  size_t maxBatchSize = mActiveConfig && AllowsEncodeBatching(*mActiveConfig)
+                            ? kMaxEncodeBatchSize
+                            : 1;
+  while (batch.Length() < maxBatchSize && !mControlMessageQueue.empty()) {
+    RefPtr<EncodeMessage> next =
+        mControlMessageQueue.front()->AsEncodeMessage();
+    if (!next) {
+      break;
+    }
+    batch.AppendElement(std::move(next));
+    mControlMessageQueue.pop();
+  }
+
+  LOGV("%s %p processing %s (%zu message(s))", EncoderType::Name.get(), this,
+       aMessage->ToString().get(), batch.Length());
 
-  mEncodeQueueSize -= 1;
+  mEncodeQueueSize -= batch.Length();
   ScheduleDequeueEvent();
 
   // Treat it like decode error if no EncoderAgent is available or the encoded
@@ -857,14 +892,18 @@ MessageProcessedResult EncoderTemplate<EncoderType>::ProcessEncodeMessage(
   }
 
   MOZ_ASSERT(mActiveConfig);
-  RefPtr<InputTypeInternal> data = aMessage->mData;
-  if (!data) {
-    LOGE("%s %p, data for %s is empty or invalid", EncoderType::Name.get(),
-         this, aMessage->ToString().get());
-    return closeOnError();
+  nsTArray<RefPtr<MediaData>> inputs(batch.Length());
+  for (const RefPtr<EncodeMessage>& message : batch) {
+    RefPtr<InputTypeInternal> data = message->mData;
+    if (!data) {
+      LOGE("%s %p, data for %s is empty or invalid", EncoderType::Name.get(),
+           this, message->ToString().get());
+      return closeOnError();
+    }
+    inputs.AppendElement(std::move(data));
   }
 
-  mAgent->Encode(data.get())
+  mAgent->Encode(std::move(inputs))
       ->Then(GetCurrentSerialEventTarget(), __func__,
              [self = RefPtr{this}, id = mAgent->mId, aMessage](
                  EncoderAgent::EncodePromise::ResolveOrRejectValue&& aResult) {
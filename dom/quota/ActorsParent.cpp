@@ -2741,7 +2741,11 @@ nsresult QuotaManager::LoadQuota() {
             QM_TRY_INSPECT(const bool& exists,
                            MOZ_TO_RESULT_INVOKE_MEMBER(directory, Exists));
 
-            QM_TRY(OkIf(exists), Err(NS_ERROR_FILE_NOT_FOUND));
+            // The origin was removed in a session which didn't unload the
+            // quota info, see MarkOriginDirtyInCache.
+            if (!exists) {
+              return Ok{};
+            }
 
             QM_TRY_INSPECT(const bool& isDirectory,
                            MOZ_TO_RESULT_INVOKE_MEMBER(directory, IsDirectory));
@@ -2803,6 +2807,10 @@ nsresult QuotaManager::LoadQuota() {
 
     autoRemoveQuota.release();
 
+    // Keep the cache valid from now on, origins which change are marked as
+    // accessed in it first.
+    mIOThreadAccessible.Access()->mCacheTracksChanges = true;
+
     return NS_OK;
   };
 
@@ -2909,6 +2917,13 @@ void QuotaManager::UnloadQuota() {
   MOZ_ASSERT(mTemporaryStorageInitializedInternal);
   MOZ_ASSERT(mCacheUsable);
 
+  {
+    auto ioThreadData = mIOThreadAccessible.Access();
+
+    ioThreadData->mCacheTracksChanges = false;
+    ioThreadData->mDirtyCachedOrigins.Clear();
+  }
+
   auto autoRemoveQuota = MakeScopeExit([&] { RemoveQuota(); });
 
   mozStorageTransaction transaction(
@@ -3029,6 +3044,122 @@ void QuotaManager::RemoveOriginFromCache(
   QM_TRY(MOZ_TO_RESULT(transaction.Commit()), QM_VOID);
 }
 
+void QuotaManager::AddOriginToCache(
+    const FullOriginMetadata& aFullOriginMetadata) {
+  AssertIsOnIOThread();
+
+  auto ioThreadData = mIOThreadAccessible.Access();
+
+  if (!ioThreadData->mCacheTracksChanges || aFullOriginMetadata.mIsPrivate ||
+      aFullOriginMetadata.mPersistenceType == PERSISTENCE_TYPE_PRIVATE) {
+    return;
+  }
+
+  MOZ_ASSERT(mStorageConnection);
+
+  // The usage doesn't matter, accessed origins are fully initialized when the
+  // quota info is loaded from the cache.
+  QM_TRY(
+      ([&]() -> Result<Ok, nsresult> {
+        QM_TRY_INSPECT(
+            const auto& stmt,
+            MOZ_TO_RESULT_INVOKE_MEMBER_TYPED(
+                nsCOMPtr<mozIStorageStatement>, mStorageConnection,
+                CreateStatement,
+                "INSERT OR REPLACE INTO origin (repository_id, suffix, "
+                "group_, origin, client_usages, usage, last_access_time, "
+                "accessed, persisted) "
+                "VALUES (:repository_id, :suffix, :group_, :origin, '', 0, "
+                ":last_access_time, 1, :persisted)"_ns));
+
+        QM_TRY(MOZ_TO_RESULT(stmt->BindInt32ByName(
+            "repository_id"_ns, aFullOriginMetadata.mPersistenceType)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindUTF8StringByName(
+            "suffix"_ns, aFullOriginMetadata.mSuffix)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindUTF8StringByName(
+            "group_"_ns, aFullOriginMetadata.mGroup)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindUTF8StringByName(
+            "origin"_ns, aFullOriginMetadata.mOrigin)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindInt64ByName(
+            "last_access_time"_ns, aFullOriginMetadata.mLastAccessTime)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindInt32ByName(
+            "persisted"_ns, aFullOriginMetadata.mPersisted)));
+        QM_TRY(MOZ_TO_RESULT(stmt->Execute()));
+
+        return Ok{};
+      }()),
+      QM_VOID, [this](const auto&) { StopTrackingCacheChanges(); });
+
+  ioThreadData->mDirtyCachedOrigins.Insert(
+      nsPrintfCString("%d:%s", aFullOriginMetadata.mPersistenceType,
+                      aFullOriginMetadata.mOrigin.get()));
+}
+
+void QuotaManager::MarkOriginDirtyInCache(
+    const OriginMetadata& aOriginMetadata) {
+  AssertIsOnIOThread();
+
+  auto ioThreadData = mIOThreadAccessible.Access();
+
+  if (!ioThreadData->mCacheTracksChanges || aOriginMetadata.mIsPrivate ||
+      aOriginMetadata.mPersistenceType == PERSISTENCE_TYPE_PRIVATE) {
+    return;
+  }
+
+  MOZ_ASSERT(mStorageConnection);
+
+  // Origins are marked at most once per session, so this is usually just a
+  // hash lookup.
+  if (!ioThreadData->mDirtyCachedOrigins.EnsureInserted(
+          nsPrintfCString("%d:%s", aOriginMetadata.mPersistenceType,
+                          aOriginMetadata.mOrigin.get()))) {
+    return;
+  }
+
+  // If the origin isn't in the cache, it was created in this session and
+  // AddOriginToCache has already added it as accessed.
+  QM_TRY(
+      ([&]() -> Result<Ok, nsresult> {
+        QM_TRY_INSPECT(
+            const auto& stmt,
+            MOZ_TO_RESULT_INVOKE_MEMBER_TYPED(
+                nsCOMPtr<mozIStorageStatement>, mStorageConnection,
+                CreateStatement,
+                "UPDATE origin SET accessed = 1 "
+                "WHERE repository_id = :repository_id "
+                "AND origin = :origin"_ns));
+
+        QM_TRY(MOZ_TO_RESULT(stmt->BindInt32ByName(
+            "repository_id"_ns, aOriginMetadata.mPersistenceType)));
+        QM_TRY(MOZ_TO_RESULT(stmt->BindUTF8StringByName(
+            "origin"_ns, aOriginMetadata.mOrigin)));
+        QM_TRY(MOZ_TO_RESULT(stmt->Execute()));
+
+        return Ok{};
+      }()),
+      QM_VOID, [this](const auto&) { StopTrackingCacheChanges(); });
+}
+
+void QuotaManager::StopTrackingCacheChanges() {
+  AssertIsOnIOThread();
+
+  {
+    auto ioThreadData = mIOThreadAccessible.Access();
+
+    if (!ioThreadData->mCacheTracksChanges) {
+      return;
+    }
+
+    ioThreadData->mCacheTracksChanges = false;
+    ioThreadData->mDirtyCachedOrigins.Clear();
+  }
+
+  MOZ_ASSERT(mStorageConnection);
+
+  // The cache is written again by UnloadQuota.
+  QM_WARNONLY_TRY(InvalidateCache(*mStorageConnection));
+}
+
 already_AddRefed<QuotaObject> QuotaManager::GetQuotaObject(
     PersistenceType aPersistenceType, const OriginMetadata& aOriginMetadata,
     Client::Type aClientType, nsIFile* aFile, int64_t aFileSize,
@@ -3196,12 +3327,25 @@ Nullable<bool> QuotaManager::OriginPersisted(
 void QuotaManager::PersistOrigin(const OriginMetadata& aOriginMetadata) {
   AssertIsOnIOThread();
 
-  MutexAutoLock lock(mQuotaMutex);
+  Maybe<FullOriginMetadata> maybeFullOriginMetadata;
 
-  RefPtr<OriginInfo> originInfo =
-      LockedGetOriginInfo(PERSISTENCE_TYPE_DEFAULT, aOriginMetadata);
-  if (originInfo && !originInfo->LockedPersisted()) {
-    originInfo->LockedPersist();
+  {
+    MutexAutoLock lock(mQuotaMutex);
+
+    RefPtr<OriginInfo> originInfo =
+        LockedGetOriginInfo(PERSISTENCE_TYPE_DEFAULT, aOriginMetadata);
+    if (originInfo && !originInfo->LockedPersisted()) {
+      originInfo->LockedPersist();
+
+      maybeFullOriginMetadata =
+          Some(originInfo->LockedFlattenToFullOriginMetadata());
+    }
+  }
+
+  // The persisted flag of accessed origins is checked against the metadata
+  // file when the quota info is loaded from the cache.
+  if (maybeFullOriginMetadata) {
+    AddOriginToCache(*maybeFullOriginMetadata);
   }
 }
 
@@ -6106,6 +6250,9 @@ QuotaManager::EnsureTemporaryOriginIsInitializedInternal(
     // Get directory for this origin and persistence type.
     QM_TRY_UNWRAP(auto directory, GetOriginDirectory(aOriginMetadata));
 
+    // Clients only change an origin after ensuring it's initialized.
+    MarkOriginDirtyInCache(aOriginMetadata);
+
     if (IsTemporaryOriginInitializedInternal(aOriginMetadata)) {
       return std::pair(std::move(directory), false);
     }
@@ -6369,7 +6516,7 @@ nsresult QuotaManager::EnsureTemporaryStorageIsInitializedInternal() {
       CleanupTemporaryStorage();
     }
 
-    if (mCacheUsable) {
+    if (mCacheUsable && !mIOThreadAccessible.Access()->mCacheTracksChanges) {
       QM_TRY(InvalidateCache(*mStorageConnection));
     }
 
@@ -6821,6 +6968,10 @@ void QuotaManager::OriginClearCompleted(
       (*mClients)[type]->OnOriginClearCompleted(aOriginMetadata);
     }
   } else {
+    if (aOriginMetadata.mPersistenceType != PERSISTENCE_TYPE_PERSISTENT) {
+      MarkOriginDirtyInCache(aOriginMetadata);
+    }
+
     (*mClients)[aClientType.Value()]->OnOriginClearCompleted(aOriginMetadata);
   }
 }
@@ -6831,6 +6982,10 @@ void QuotaManager::RepositoryClearCompleted(PersistenceType aPersistenceType) {
   if (aPersistenceType == PERSISTENCE_TYPE_PERSISTENT) {
     mInitializedOriginsInternal.Clear();
   } else {
+    if (aPersistenceType != PERSISTENCE_TYPE_PRIVATE) {
+      StopTrackingCacheChanges();
+    }
+
     RemoveTemporaryOrigins(aPersistenceType);
   }
 
@@ -7522,6 +7677,8 @@ void QuotaManager::AddTemporaryOrigin(
   MOZ_ASSERT(!containsOrigin);
 
   array.AppendElement(aFullOriginMetadata);
+
+  AddOriginToCache(aFullOriginMetadata);
 }
 
 void QuotaManager::RemoveTemporaryOrigin(
@@ -7529,6 +7686,8 @@ void QuotaManager::RemoveTemporaryOrigin(
   AssertIsOnIOThread();
   MOZ_ASSERT(IsBestEffortPersistenceType(aOriginMetadata.mPersistenceType));
 
+  MarkOriginDirtyInCache(aOriginMetadata);
+
   auto entry = mIOThreadAccessible.Access()->mAllTemporaryOrigins.Lookup(
       aOriginMetadata.mGroup);
   if (!entry) {
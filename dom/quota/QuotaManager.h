@@ -214,6 +214,16 @@ class QuotaManager final : public BackgroundThreadObject {
 
   void RemoveOriginFromCache(const OriginMetadata& aOriginMetadata);
 
+  // While the quota info loaded from the cache is in use, the cache is kept
+  // valid by marking origins as accessed in it before they change, so that
+  // only those need to be fully initialized again if the session doesn't end
+  // with UnloadQuota (e.g. after a crash).
+  void AddOriginToCache(const FullOriginMetadata& aFullOriginMetadata);
+
+  void MarkOriginDirtyInCache(const OriginMetadata& aOriginMetadata);
+
+  void StopTrackingCacheChanges();
+
   already_AddRefed<QuotaObject> GetQuotaObject(
       PersistenceType aPersistenceType, const OriginMetadata& aOriginMetadata,
       Client::Type aClientType, nsIFile* aFile, int64_t aFileSize = -1,
@@ -909,6 +919,12 @@ class QuotaManager final : public BackgroundThreadObject {
   struct IOThreadAccessible {
     nsTHashMap<nsCStringHashKey, nsTArray<FullOriginMetadata>>
         mAllTemporaryOrigins;
+    // Origins already marked as accessed in the cache in this session, keyed
+    // by persistence type and origin.
+    nsTHashSet<nsCString> mDirtyCachedOrigins;
+    // Whether the cache is kept valid during the session, see
+    // MarkOriginDirtyInCache.
+    bool mCacheTracksChanges = false;
   };
   ThreadBound<IOThreadAccessible> mIOThreadAccessible;
 
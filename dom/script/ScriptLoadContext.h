@@ -36,6 +36,7 @@
 #include "nsCOMPtr.h"
 #include "nsCycleCollectionParticipant.h"
 #include "nsIScriptElement.h"
+#include "XPCSharedStencilShmem.h"
 
 class nsICacheInfoChannel;
 struct JSContext;
@@ -303,6 +304,11 @@ class ScriptLoadContext : public JS::loader::LoadContextBase,
   // result or cancelling the task.
   RefPtr<CompileOrDecodeTask> mCompileOrDecodeTask;
 
+  // Key of the script in the stencils shared across content processes, see
+  // xpc::SharedStencilShmem. Computed from the source text, before the source
+  // is cleared.
+  Maybe<xpc::SharedStencilShmem::Key> mSharedStencilKey;
+
   uint32_t mLineNo;
   JS::ColumnNumberOneOrigin mColumnNo;
 
@@ -33,12 +33,14 @@
 #include "js/Transcoding.h"  // JS::TranscodeRange, JS::TranscodeResult, JS::IsTranscodeFailureResult
 #include "js/Utility.h"
 #include "xpcpublic.h"
+#include "XPCSharedStencilShmem.h"
 #include "GeckoProfiler.h"
 #include "nsContentSecurityManager.h"
 #include "nsCycleCollectionParticipant.h"
 #include "nsIContent.h"
 #include "nsJSUtils.h"
 #include "mozilla/dom/AutoEntryScript.h"
+#include "mozilla/dom/ContentChild.h"
 #include "mozilla/dom/DocGroup.h"
 #include "mozilla/dom/Element.h"
 #include "mozilla/dom/JSExecutionContext.h"
@@ -46,6 +48,7 @@
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/dom/SRILogHelper.h"
 #include "mozilla/dom/WindowContext.h"
+#include "mozilla/ipc/BigBuffer.h"
 #include "mozilla/Mutex.h"  // mozilla::Mutex
 #include "mozilla/net/HttpBaseChannel.h"
 #include "mozilla/net/UrlClassifierFeatureFactory.h"
@@ -1839,6 +1842,53 @@ class OffThreadCompilationCompleteTask : public Task {
 static constexpr size_t OffThreadMinimumTextLength = 5 * 1000;
 static constexpr size_t OffThreadMinimumBytecodeLength = 5 * 1000;
 
+// Compute the key of an external classic script in the stencils shared across
+// content processes, if it is not computed yet. This hashes the source text,
+// so it is only done when the key is going to be used.
+static void MaybeComputeSharedStencilKey(
+    ScriptLoadRequest* aRequest, const JS::ReadOnlyCompileOptions& aOptions) {
+  ScriptLoadContext* context = aRequest->GetScriptLoadContext();
+  if (context->mSharedStencilKey.isSome() || !XRE_IsContentProcess() ||
+      aRequest->IsModuleRequest() || context->mIsInline ||
+      !aRequest->IsTextSource()) {
+    return;
+  }
+
+  ContentChild* child = ContentChild::GetSingleton();
+  if (!child || !xpc::SharedStencilShmem::IsEnabledForRemoteType(
+                    child->GetRemoteType())) {
+    return;
+  }
+
+  Span<const uint8_t> bytes =
+      aRequest->IsUTF16Text()
+          ? AsBytes(Span(aRequest->ScriptText<char16_t>().begin(),
+                         aRequest->ScriptText<char16_t>().length()))
+          : AsBytes(Span(aRequest->ScriptText<Utf8Unit>().begin(),
+                         aRequest->ScriptText<Utf8Unit>().length()));
+
+  context->mSharedStencilKey.emplace(xpc::SharedStencilShmem::ComputeKey(
+      aRequest->mURL, aOptions.mutedErrors(), bytes));
+}
+
+// Return the encoded stencil shared by another content process for this
+// request, or an empty range.
+static xpc::SharedStencilShmem::ContentType LookupSharedStencil(
+    ScriptLoadRequest* aRequest, const JS::ReadOnlyCompileOptions& aOptions) {
+  auto& shmem = xpc::SharedStencilShmem::GetSingleton();
+  if (!shmem.HasSnapshot()) {
+    return xpc::SharedStencilShmem::ContentType();
+  }
+
+  MaybeComputeSharedStencilKey(aRequest, aOptions);
+  ScriptLoadContext* context = aRequest->GetScriptLoadContext();
+  if (context->mSharedStencilKey.isNothing()) {
+    return xpc::SharedStencilShmem::ContentType();
+  }
+
+  return shmem.Lookup(*context->mSharedStencilKey);
+}
+
 nsresult ScriptLoader::AttemptOffThreadScriptCompile(
     ScriptLoadRequest* aRequest, bool* aCouldCompileOut) {
   // If speculative parsing is enabled, the request may not be ready to run if
@@ -1888,6 +1938,12 @@ nsresult ScriptLoader::AttemptOffThreadScriptCompile(
       TRACE_FOR_TEST(aRequest, "scriptloader_main_thread_compile");
       return NS_OK;
     }
+
+    // Decoding the stencil shared by another content process on the main
+    // thread is faster than compiling the script off-thread.
+    if (!LookupSharedStencil(aRequest, options).IsEmpty()) {
+      return NS_OK;
+    }
   } else {
     MOZ_ASSERT(aRequest->IsBytecode());
 
@@ -2195,6 +2251,9 @@ nsresult ScriptLoader::CreateOffThreadTask(
       case JS::DelazificationOption::ConcurrentLargeFirst:
         TRACE_FOR_TEST(aRequest, "delazification_concurrent_large_first");
         break;
+      case JS::DelazificationOption::ConcurrentParallel:
+        TRACE_FOR_TEST(aRequest, "delazification_concurrent_parallel");
+        break;
       case JS::DelazificationOption::ParseEverythingEagerly:
         TRACE_FOR_TEST(aRequest, "delazification_parse_everything_eagerly");
         break;
@@ -2747,6 +2806,26 @@ nsresult ScriptLoader::InstantiateClassicScriptFromMaybeEncodedSource(
   }
 
   MOZ_ASSERT(aRequest->IsSource());
+
+  // Decode the stencil shared by another content process instead of compiling
+  // the script. The shared memory outlives the JS engine, so the decoded
+  // stencil can borrow it. This script is not encoded again.
+  if (!aRequest->GetScriptLoadContext()->mCompileOrDecodeTask &&
+      aRequest->GetScriptLoadContext()->mSharedStencilKey.isSome()) {
+    xpc::SharedStencilShmem::ContentType shared =
+        xpc::SharedStencilShmem::GetSingleton().Lookup(
+            *aRequest->GetScriptLoadContext()->mSharedStencilKey);
+    if (!shared.IsEmpty()) {
+      LOG(("ScriptLoadRequest (%p): Decode Shared Stencil and Execute",
+           aRequest));
+      AUTO_PROFILER_MARKER_TEXT("SharedStencilDecodeMainThread", JS,
+                                MarkerInnerWindowIdFromJSContext(aCx),
+                                profilerLabelString);
+      TRACE_FOR_TEST(aRequest, "scriptloader_shared_stencil_decode");
+      return aExec.Decode(shared);
+    }
+  }
+
   CalculateBytecodeCacheFlag(aRequest);
   aExec.SetEncodeBytecode(aRequest->PassedConditionForBytecodeEncoding());
 
@@ -2996,6 +3075,12 @@ nsresult ScriptLoader::EvaluateScript(nsIGlobalObject* aGlobalObject,
          mTotalFullParseSize));
   }
 
+  // Compute the key used to decode the script from the stencils shared by
+  // other content processes.
+  if (xpc::SharedStencilShmem::GetSingleton().HasSnapshot()) {
+    MaybeComputeSharedStencilKey(aRequest, options);
+  }
+
   TRACE_FOR_TEST(aRequest, "scriptloader_execute");
   JS::Rooted<JSObject*> global(cx, aGlobalObject->GetGlobalJSObject());
   JSExecutionContext exec(cx, global, options, classicScriptValue,
@@ -3028,6 +3113,13 @@ nsresult ScriptLoader::EvaluateScript(nsIGlobalObject* aGlobalObject,
   // dispatch test-only event.
   rv = MaybePrepareForBytecodeEncodingAfterExecute(aRequest, rv);
 
+  // The source is cleared before the bytecode is encoded, compute the key
+  // now such that the encoded stencil can be shared with other processes.
+  if (aRequest->IsMarkedForBytecodeEncoding() &&
+      StaticPrefs::dom_script_loader_bytecode_cache_enabled()) {
+    MaybeComputeSharedStencilKey(aRequest, options);
+  }
+
   // Even if we are not saving the bytecode of the current script, we have
   // to trigger the encoding of the bytecode, as the current script can
   // call functions of a script for which we are recording the bytecode.
@@ -3154,6 +3246,34 @@ void ScriptLoader::EncodeBytecode() {
   }
 }
 
+// Send the encoded stencil of a classic script to the parent process, which
+// shares it with the content processes of the same remote type launched later.
+static void MaybeSendSharedStencil(ScriptLoadRequest* aRequest) {
+  ScriptLoadContext* context = aRequest->GetScriptLoadContext();
+  if (context->mSharedStencilKey.isNothing()) {
+    return;
+  }
+
+  // The key is only computed when sharing is enabled for this process.
+  ContentChild* child = ContentChild::GetSingleton();
+  if (!child) {
+    return;
+  }
+
+  Span<const uint8_t> xdr = Span(aRequest->SRIAndBytecode().begin(),
+                                 aRequest->SRIAndBytecode().length())
+                                .From(aRequest->GetSRILength());
+  if (xdr.IsEmpty() ||
+      xdr.Length() > xpc::SharedStencilShmem::MaxEntryLength) {
+    return;
+  }
+
+  const xpc::SharedStencilShmem::Key& key = *context->mSharedStencilKey;
+  nsTArray<uint8_t> keyArray;
+  keyArray.AppendElements(key.data(), key.size());
+  (void)child->SendAddSharedStencil(keyArray, mozilla::ipc::BigBuffer(xdr));
+}
+
 void ScriptLoader::EncodeRequestBytecode(JSContext* aCx,
                                          ScriptLoadRequest* aRequest) {
   using namespace mozilla::Telemetry;
@@ -3197,6 +3317,12 @@ void ScriptLoader::EncodeRequestBytecode(JSContext* aCx,
     return;
   }
 
+  // Share the encoded stencil with the content processes of the same remote
+  // type launched later.
+  if (!aRequest->IsModuleRequest()) {
+    MaybeSendSharedStencil(aRequest);
+  }
+
   Vector<uint8_t> compressedBytecode;
   // TODO probably need to move this to a helper thread
   if (!ScriptBytecodeCompress(aRequest->SRIAndBytecode(),
@@ -3943,26 +4069,28 @@ void ScriptLoader::ApplyDelazifyStrategy(JS::CompileOptions* aOptions) {
   uint32_t strategyIndex =
       StaticPrefs::dom_script_loader_delazification_strategy();
 
-  // Assert that all enumerated values of DelazificationOption are dense between
-  // OnDemandOnly and ParseEverythingEagerly.
-#ifdef DEBUG
+  // The values of DelazificationOption are dense, starting at OnDemandOnly.
+  // Strategies added after ParseEverythingEagerly keep the meaning of the
+  // existing pref values.
   uint32_t count = 0;
+#define _COUNT_ENTRIES(Name) count++;
+  FOREACH_DELAZIFICATION_STRATEGY(_COUNT_ENTRIES);
+#undef _COUNT_ENTRIES
+  static_assert(uint8_t(JS::DelazificationOption::ParseEverythingEagerly) == 4,
+                "Existing pref values must keep their meaning");
+
+#ifdef DEBUG
   uint32_t mask = 0;
-#  define _COUNT_ENTRIES(Name) count++;
 #  define _MASK_ENTRIES(Name) \
     mask |= 1 << uint32_t(JS::DelazificationOption::Name);
 
-  FOREACH_DELAZIFICATION_STRATEGY(_COUNT_ENTRIES);
-  MOZ_ASSERT(count == uint32_t(strategy) + 1);
   FOREACH_DELAZIFICATION_STRATEGY(_MASK_ENTRIES);
   MOZ_ASSERT(((mask + 1) & mask) == 0);
-#  undef _COUNT_ENTRIES
 #  undef _MASK_ENTRIES
 #endif
 
-  // Any strategy index larger than ParseEverythingEagerly would default to
-  // ParseEverythingEagerly.
-  if (strategyIndex <= uint32_t(strategy)) {
+  // Any strategy index out of range would default to ParseEverythingEagerly.
+  if (strategyIndex < count) {
     strategy = JS::DelazificationOption(uint8_t(strategyIndex));
   }
 
@@ -31,6 +31,7 @@
 #include "ServiceWorkerPrivate.h"
 #include "mozilla/Assertions.h"
 #include "mozilla/LoadInfo.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticPrefs_dom.h"
 #include "mozilla/UniquePtr.h"
@@ -231,6 +232,9 @@ FetchEventOpChild::FetchEventOpChild(
         ->Then(
             GetCurrentSerialEventTarget(), __func__,
             [this](FetchServiceResponse&& aResponse) {
+              PROFILER_MARKER_TEXT("ServiceWorker navigation preload", DOM, {},
+                                   "response available"_ns);
+
               if (!mWasSent) {
                 // The actor wasn't sent yet, we can still send the preload
                 // response with it.
@@ -271,6 +275,9 @@ FetchEventOpChild::FetchEventOpChild(
         ->Then(
             GetCurrentSerialEventTarget(), __func__,
             [this](ResponseEndArgs&& aResponse) {
+              PROFILER_MARKER_TEXT("ServiceWorker navigation preload", DOM, {},
+                                   "response end"_ns);
+
               if (!mWasSent) {
                 // The actor wasn't sent yet, we can still send the preload
                 // response end args with it.
@@ -22,6 +22,7 @@
 #include "mozilla/Maybe.h"
 #include "mozilla/OriginAttributes.h"
 #include "mozilla/Preferences.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/RemoteLazyInputStreamStorage.h"
 #include "mozilla/Result.h"
 #include "mozilla/ResultExtensions.h"
@@ -1107,6 +1108,9 @@ nsresult ServiceWorkerPrivate::SendFetchEventInternal(
     return NS_ERROR_DOM_INVALID_STATE_ERR;
   }
 
+  // Includes the worker launch if it isn't running yet.
+  const TimeStamp fetchEventStart = TimeStamp::Now();
+
   MOZ_TRY(SpawnWorkerIfNeeded(
       ServiceWorkerLifetimeExtension(FullLifetimeExtension{})));
   MOZ_TRY(MaybeStoreStreamForBackgroundThread(
@@ -1123,9 +1127,15 @@ nsresult ServiceWorkerPrivate::SendFetchEventInternal(
       std::move(aRegistration), std::move(aPreloadResponseReadyPromises),
       CreateEventKeepAliveToken())
       ->Then(GetCurrentSerialEventTarget(), __func__,
-             [holder = std::move(holder)](
+             [holder = std::move(holder), fetchEventStart,
+              scriptSpec = mInfo->ScriptSpec()](
                  const GenericPromise::ResolveOrRejectValue& aResult) {
                Unused << NS_WARN_IF(aResult.IsReject());
+
+               PROFILER_MARKER_TEXT(
+                   "ServiceWorker fetch event", DOM,
+                   MarkerTiming::IntervalUntilNowFrom(fetchEventStart),
+                   scriptSpec);
              });
 
   return NS_OK;
@@ -1648,6 +1658,11 @@ void ServiceWorkerPrivate::CreationFailed() {
   MOZ_ASSERT(NS_IsMainThread());
   MOZ_ASSERT(mControllerChild);
 
+  PROFILER_MARKER_TEXT(
+      "ServiceWorker launch", DOM,
+      MarkerTiming::IntervalUntilNowFrom(mServiceWorkerLaunchTimeStart),
+      "failed"_ns);
+
   if (mRemoteWorkerData.remoteType().Find(SERVICEWORKER_REMOTE_TYPE) !=
       kNotFound) {
     Telemetry::AccumulateTimeDelta(
@@ -1676,6 +1691,11 @@ void ServiceWorkerPrivate::CreationSucceeded() {
     return;
   }
 
+  PROFILER_MARKER_TEXT(
+      "ServiceWorker launch", DOM,
+      MarkerTiming::IntervalUntilNowFrom(mServiceWorkerLaunchTimeStart),
+      mInfo->ScriptSpec());
+
   if (mRemoteWorkerData.remoteType().Find(SERVICEWORKER_REMOTE_TYPE) !=
       kNotFound) {
     Telemetry::AccumulateTimeDelta(
@@ -11,6 +11,7 @@
 #include "mozilla/dom/ReadableStream.h"
 #include "mozilla/dom/ReadableStreamDefaultReader.h"
 #include "mozilla/dom/WritableStream.h"
+#include "mozilla/dom/WritableStreamDefaultController.h"
 #include "mozilla/dom/WritableStreamDefaultWriter.h"
 #include "mozilla/dom/Promise.h"
 #include "mozilla/dom/Promise-inl.h"
@@ -18,6 +19,7 @@
 #include "mozilla/AlreadyAddRefed.h"
 #include "mozilla/ErrorResult.h"
 #include "nsCycleCollectionParticipant.h"
+#include "nsIAsyncInputStream.h"
 #include "nsISupportsImpl.h"
 
 #include "js/Exception.h"
@@ -64,11 +66,13 @@ class PipeToPump final : public AbortFollower {
   friend class ShutdownActionFinishedPromiseHandler;
 
   PipeToPump(Promise* aPromise, ReadableStreamDefaultReader* aReader,
-             WritableStreamDefaultWriter* aWriter, bool aPreventClose,
+             WritableStreamDefaultWriter* aWriter,
+             already_AddRefed<nsIInputStream> aNativeInput, bool aPreventClose,
              bool aPreventAbort, bool aPreventCancel)
       : mPromise(aPromise),
         mReader(aReader),
         mWriter(aWriter),
+        mNativeInput(aNativeInput),
         mPreventClose(aPreventClose),
         mPreventAbort(aPreventAbort),
         mPreventCancel(aPreventCancel) {}
@@ -107,6 +111,12 @@ class PipeToPump final : public AbortFollower {
   MOZ_CAN_RUN_SCRIPT void OnWriterReady(JSContext* aCx, JS::Handle<JS::Value>);
   MOZ_CAN_RUN_SCRIPT void Read(JSContext* aCx);
 
+  MOZ_CAN_RUN_SCRIPT void WriteNativeInput(JSContext* aCx);
+  MOZ_CAN_RUN_SCRIPT void OnNativeInputWritten(JSContext* aCx,
+                                               JS::Handle<JS::Value>);
+  MOZ_CAN_RUN_SCRIPT void OnNativeInputWriteFailed(
+      JSContext* aCx, JS::Handle<JS::Value> aError);
+
   MOZ_CAN_RUN_SCRIPT void OnSourceClosed(JSContext* aCx, JS::Handle<JS::Value>);
   MOZ_CAN_RUN_SCRIPT void OnSourceErrored(
       JSContext* aCx, JS::Handle<JS::Value> aSourceStoredError);
@@ -119,6 +129,9 @@ class PipeToPump final : public AbortFollower {
   RefPtr<ReadableStreamDefaultReader> mReader;
   RefPtr<WritableStreamDefaultWriter> mWriter;
   RefPtr<Promise> mLastWritePromise;
+  // The input stream underlying the source while it's being written to the
+  // sink of dest as a whole, see MaybeGetInputStreamForNativePipe.
+  nsCOMPtr<nsIInputStream> mNativeInput;
   const bool mPreventClose;
   const bool mPreventAbort;
   const bool mPreventCancel;
@@ -336,6 +349,11 @@ void PipeToPump::Start(JSContext* aCx, AbortSignal* aSignal) {
   writerClosed->AppendNativeHandler(new PipeToPumpHandler(
       this, &PipeToPump::OnDestClosed, &PipeToPump::OnDestErrored));
 
+  if (mNativeInput) {
+    WriteNativeInput(aCx);
+    return;
+  }
+
   Read(aCx);
 }
 
@@ -407,6 +425,17 @@ void PipeToPump::ShutdownWithAction(
   // Step 2. Set shuttingDown to true.
   mShuttingDown = true;
 
+  // The native input is written as a single chunk, so stop reading it to not
+  // wait for the rest of the source to be written before the shutdown action.
+  // This is only done when the source is going to be canceled anyway, see
+  // MaybeGetInputStreamForNativePipe. Closing a synchronous input, e.g. of a
+  // Blob, makes the copy see its end on the next read.
+  if (nsCOMPtr<nsIAsyncInputStream> input = do_QueryInterface(mNativeInput)) {
+    input->CloseWithStatus(NS_BASE_STREAM_CLOSED);
+  } else if (mNativeInput) {
+    mNativeInput->Close();
+  }
+
   // Step 3. If dest.[[state]] is "writable" and !
   // WritableStreamCloseQueuedOrInFlight(dest) is false,
   RefPtr<WritableStream> dest = mWriter->GetStream();
@@ -572,6 +601,7 @@ void PipeToPump::Finalize(JSContext* aCx,
   mReader = nullptr;
   mWriter = nullptr;
   mLastWritePromise = nullptr;
+  mNativeInput = nullptr;
   Unfollow();
 }
 
@@ -733,6 +763,76 @@ void PipeToPump::Read(JSContext* aCx) {
   }
 }
 
+void PipeToPump::WriteNativeInput(JSContext* aCx) {
+#ifdef DEBUG
+  mReadChunk = true;
+#endif
+
+  // (Constraint) Backpressure must be enforced:
+  // The sink only reads from the input stream as fast as it can write it.
+  RefPtr<UnderlyingSinkAlgorithmsBase> sink =
+      mWriter->GetStream()->Controller()->GetAlgorithms();
+  MOZ_ASSERT(sink && sink->CanWriteInputStream());
+
+  ErrorResult rv;
+  RefPtr<Promise> promise =
+      sink->WriteInputStreamCallback(aCx, mNativeInput, rv);
+  if (rv.MaybeSetPendingException(aCx)) {
+    JS::Rooted<JS::Value> error(aCx);
+    JS::Rooted<Maybe<JS::Value>> someError(aCx);
+
+    // The error was moved to the JSContext by MaybeSetPendingException.
+    if (JS_GetPendingException(aCx, &error)) {
+      someError = Some(error.get());
+    }
+
+    JS_ClearPendingException(aCx);
+
+    mNativeInput = nullptr;
+    Shutdown(aCx, someError);
+    return;
+  }
+
+  mLastWritePromise = promise;
+  mLastWritePromise->AppendNativeHandler(
+      new PipeToPumpHandler(this, &PipeToPump::OnNativeInputWritten,
+                            &PipeToPump::OnNativeInputWriteFailed));
+}
+
+void PipeToPump::OnNativeInputWritten(JSContext* aCx, JS::Handle<JS::Value>) {
+  mNativeInput = nullptr;
+
+  // The input stream was closed by the shutdown, not read to its end.
+  if (mShuttingDown) {
+    return;
+  }
+
+  // The whole source has been written, so close it as if its end had been
+  // read. Its reader's closed promise then propagates the closing to dest.
+  RefPtr<ReadableStream> source = mReader->GetStream();
+  IgnoredErrorResult rv;
+  source->CloseNative(aCx, rv);
+  NS_WARNING_ASSERTION(!rv.Failed(), "Failed to close the piped source");
+}
+
+void PipeToPump::OnNativeInputWriteFailed(JSContext* aCx,
+                                          JS::Handle<JS::Value> aError) {
+  mNativeInput = nullptr;
+
+  if (mShuttingDown) {
+    return;
+  }
+
+  // The sink was written without going through the writer, so error dest the
+  // way a rejected write would have. Its writer's closed promise then
+  // propagates the error to the source.
+  RefPtr<WritableStreamDefaultController> controller =
+      mWriter->GetStream()->Controller();
+  IgnoredErrorResult rv;
+  WritableStreamDefaultControllerErrorIfNeeded(aCx, controller, aError, rv);
+  NS_WARNING_ASSERTION(!rv.Failed(), "Failed to error the piped dest");
+}
+
 // Step 3. Closing must be propagated forward: if source.[[state]] is or
 // becomes "closed", then
 void PipeToPump::OnSourceClosed(JSContext* aCx, JS::Handle<JS::Value>) {
@@ -896,6 +996,7 @@ NS_IMPL_CYCLE_COLLECTION_TRAVERSE_BEGIN(PipeToPump)
   NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mReader)
   NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mWriter)
   NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mLastWritePromise)
+  NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mNativeInput)
 NS_IMPL_CYCLE_COLLECTION_TRAVERSE_END
 
 NS_IMPL_CYCLE_COLLECTION_UNLINK_BEGIN(PipeToPump)
@@ -903,8 +1004,32 @@ NS_IMPL_CYCLE_COLLECTION_UNLINK_BEGIN(PipeToPump)
   NS_IMPL_CYCLE_COLLECTION_UNLINK(mReader)
   NS_IMPL_CYCLE_COLLECTION_UNLINK(mWriter)
   NS_IMPL_CYCLE_COLLECTION_UNLINK(mLastWritePromise)
+  NS_IMPL_CYCLE_COLLECTION_UNLINK(mNativeInput)
 NS_IMPL_CYCLE_COLLECTION_UNLINK_END
 
+// Returns the input stream underlying aSource if it can be written to the sink
+// of aDest directly, without reading it in chunks.
+static already_AddRefed<nsIInputStream> MaybeGetInputStreamForNativePipe(
+    ReadableStream* aSource, WritableStream* aDest, bool aPreventCancel) {
+  // Shutting down closes the input stream, which keeps the rest of the source
+  // from being read later, so only do this when the source would be canceled.
+  if (aPreventCancel || aSource->Disturbed() ||
+      aSource->State() != ReadableStream::ReaderState::Readable ||
+      aDest->State() != WritableStream::WriterState::Writable) {
+    return nullptr;
+  }
+
+  // Writes queued by a previous writer have to be written first.
+  WritableStreamDefaultController* controller = aDest->Controller();
+  UnderlyingSinkAlgorithmsBase* sink = controller->GetAlgorithms();
+  if (!sink || !sink->CanWriteInputStream() || !controller->Started() ||
+      aDest->HasOperationMarkedInFlight() || !controller->Queue().isEmpty()) {
+    return nullptr;
+  }
+
+  return do_AddRef(aSource->MaybeGetInputStreamIfUnread());
+}
+
 namespace streams_abstract {
 // https://streams.spec.whatwg.org/#readable-stream-pipe-to
 already_AddRefed<Promise> ReadableStreamPipeTo(
@@ -940,7 +1065,10 @@ already_AddRefed<Promise> ReadableStreamPipeTo(
   //         !AcquireReadableStreamDefaultReader(source).
 
   // Note: In the interests of simplicity, we choose here to always acquire
-  // a default reader.
+  // a default reader. When both the source and dest are native, the reader is
+  // only used to keep the source locked, see PipeToPump::WriteNativeInput.
+  nsCOMPtr<nsIInputStream> nativeInput =
+      MaybeGetInputStreamForNativePipe(aSource, aDest, aPreventCancel);
   RefPtr<ReadableStreamDefaultReader> reader =
       AcquireReadableStreamDefaultReader(aSource, aRv);
   if (aRv.Failed()) {
@@ -965,8 +1093,9 @@ already_AddRefed<Promise> ReadableStreamPipeTo(
       Promise::CreateInfallible(aSource->GetParentObject());
 
   // Steps 14-15.
-  RefPtr<PipeToPump> pump = new PipeToPump(
-      promise, reader, writer, aPreventClose, aPreventAbort, aPreventCancel);
+  RefPtr<PipeToPump> pump =
+      new PipeToPump(promise, reader, writer, nativeInput.forget(),
+                     aPreventClose, aPreventAbort, aPreventCancel);
   pump->Start(cx, aSignal);
 
   // Step 16. Return promise.
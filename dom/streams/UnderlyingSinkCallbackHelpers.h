@@ -50,6 +50,17 @@ class UnderlyingSinkAlgorithmsBase : public nsISupports {
   // from closed/errored(aborted) streams, without waiting for GC.
   virtual void ReleaseObjects() {}
 
+  // Implement these to let pipeTo() write the nsIInputStream of a native
+  // source (see UnderlyingSourceAlgorithmsBase::MaybeGetInputStreamIfUnread)
+  // directly, to skip JS-related overhead of reading and writing chunks. The
+  // returned promise is settled once the input stream is entirely written.
+  virtual bool CanWriteInputStream() { return false; }
+  MOZ_CAN_RUN_SCRIPT virtual already_AddRefed<Promise>
+  WriteInputStreamCallback(JSContext* aCx, nsIInputStream* aInputStream,
+                           ErrorResult& aRv) {
+    MOZ_CRASH("Only called when CanWriteInputStream() returns true");
+  }
+
  protected:
   virtual ~UnderlyingSinkAlgorithmsBase() = default;
 };
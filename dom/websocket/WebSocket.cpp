@@ -2061,16 +2061,11 @@ nsresult WebSocket::CreateAndDispatchMessageEvent(const nsACString& aData,
       return NS_ERROR_UNEXPECTED;
     }
   } else {
-    // JS string
-    nsAutoString utf16Data;
-    if (!AppendUTF8toUTF16(aData, utf16Data, mozilla::fallible)) {
-      return NS_ERROR_OUT_OF_MEMORY;
+    // JS string, which shares the buffer of the message when it is ASCII and
+    // is otherwise converted from UTF-8 without going through a UTF-16 copy.
+    if (!xpc::NonVoidUTF8StringToJsval(cx, aData, &jsData)) {
+      return NS_ERROR_FAILURE;
     }
-    JSString* jsString;
-    jsString = JS_NewUCStringCopyN(cx, utf16Data.get(), utf16Data.Length());
-    NS_ENSURE_TRUE(jsString, NS_ERROR_FAILURE);
-
-    jsData.setString(jsString);
   }
 
   mImpl->mService->WebSocketMessageAvailable(
@@ -962,6 +962,7 @@ class WorkerThreadPrimaryRunnable final : public Runnable {
   WorkerPrivate* mWorkerPrivate;
   SafeRefPtr<WorkerThread> mThread;
   JSRuntime* mParentRuntime;
+  const TimeStamp mCreationTime;
 
   class FinishedRunnable final : public Runnable {
     SafeRefPtr<WorkerThread> mThread;
@@ -988,7 +989,8 @@ class WorkerThreadPrimaryRunnable final : public Runnable {
       : mozilla::Runnable("WorkerThreadPrimaryRunnable"),
         mWorkerPrivate(aWorkerPrivate),
         mThread(std::move(aThread)),
-        mParentRuntime(aParentRuntime) {
+        mParentRuntime(aParentRuntime),
+        mCreationTime(TimeStamp::Now()) {
     MOZ_ASSERT(aWorkerPrivate);
     MOZ_ASSERT(mThread);
   }
@@ -2086,6 +2088,11 @@ WorkerThreadPrimaryRunnable::Run() {
   AUTO_PROFILER_LABEL_DYNAMIC_CSTR("WorkerThreadPrimaryRunnable::Run", OTHER,
                                    url.get());
 
+  // Startup phases, to tell thread creation, PBackground and JSContext setup
+  // apart from the global setup and the script evaluation which follow.
+  PROFILER_MARKER_TEXT("Worker thread start", DOM,
+                       MarkerTiming::IntervalUntilNowFrom(mCreationTime), url);
+
   using mozilla::ipc::BackgroundChild;
   {
     bool runLoopRan = false;
@@ -2110,6 +2117,8 @@ WorkerThreadPrimaryRunnable::Run() {
 
     mWorkerPrivate->AssertIsOnWorkerThread();
 
+    TimeStamp phaseStart = TimeStamp::Now();
+
     // This needs to be initialized on the worker thread before being used on
     // the main thread and calling BackgroundChild::GetOrCreateForCurrentThread
     // exposes it to the main thread.
@@ -2119,6 +2128,9 @@ WorkerThreadPrimaryRunnable::Run() {
       return NS_ERROR_FAILURE;
     }
 
+    PROFILER_MARKER_TEXT("Worker PBackground setup", DOM,
+                         MarkerTiming::IntervalUntilNowFrom(phaseStart), url);
+
     nsWeakPtr globalScopeSentinel;
     nsWeakPtr debuggerScopeSentinel;
     // Never use the following pointers without checking their corresponding
@@ -2126,6 +2138,8 @@ WorkerThreadPrimaryRunnable::Run() {
     WorkerGlobalScopeBase* globalScopeRawPtr = nullptr;
     WorkerGlobalScopeBase* debuggerScopeRawPtr = nullptr;
     {
+      phaseStart = TimeStamp::Now();
+
       nsCycleCollector_startup();
 
       auto context = MakeUnique<WorkerJSContext>(mWorkerPrivate);
@@ -2140,6 +2154,9 @@ WorkerThreadPrimaryRunnable::Run() {
         return NS_ERROR_FAILURE;
       }
 
+      PROFILER_MARKER_TEXT("Worker JSContext setup", DOM,
+                           MarkerTiming::IntervalUntilNowFrom(phaseStart), url);
+
       failureCleanup.release();
       runLoopRan = true;
 
@@ -23,6 +23,7 @@
 #include "mozilla/ExtensionPolicyService.h"
 #include "mozilla/Mutex.h"
 #include "mozilla/ProfilerLabels.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/Result.h"
 #include "mozilla/ScopeExit.h"
 #include "mozilla/StaticPrefs_browser.h"
@@ -6099,6 +6100,9 @@ WorkerGlobalScope* WorkerPrivate::GetOrCreateGlobalScope(JSContext* aCx) {
     return data->mScope;
   }
 
+  // Creating the global defines all the worker exposed interfaces on it.
+  AUTO_PROFILER_MARKER_TEXT("Worker global setup", DOM, {}, ""_ns);
+
   if (IsSharedWorker()) {
     data->mScope =
         new SharedWorkerGlobalScope(this, CreateClientSource(), WorkerName());
@@ -88,6 +88,16 @@ using Events = XMLHttpRequest::Events;
  *  the outstanding Send count is still non-zero, we dispatch a control
  *  runnable which is guaranteed to run.
  *
+ *  The response body is received by the main thread XHR, which decodes and
+ *  accumulates it.  It is not handed to the worker per chunk: only the events
+ *  are posted to the worker, and the response is snapshotted for
+ *  readystatechange events only, as a shared string buffer, blob or array
+ *  buffer builder rather than a copy.  Delivering the data to the worker
+ *  directly would need the whole XHR state machine (decoding, progress
+ *  events, response types, sync XHR) to run off the main thread.  Fetch in
+ *  workers does not have this issue as FetchDriver retargets the delivery of
+ *  the data off the main thread.
+ *
  *  NB: Some of this could probably be simplified now that we have the
  *  inner/outer channel ids.
  */
@@ -21,6 +21,7 @@
 #include "mozilla/NativeKeyBindingsType.h"  // for NativeKeyBindingsType
 #include "mozilla/Preferences.h"            // for Preferences
 #include "mozilla/PresShell.h"              // for PresShell
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/TextEvents.h"             // for WidgetCompositionEvent
 #include "mozilla/dom/DataTransfer.h"
 #include "mozilla/dom/Document.h"  // for Document
@@ -638,6 +639,16 @@ nsresult EditorEventListener::KeyPress(WidgetKeyboardEvent* aKeyboardEvent) {
   }
 
   nsresult rv = editorBase->HandleKeyPressEvent(aKeyboardEvent);
+  // From the native key event to the editor having handled it, including the
+  // layout flush above and the time the event waited to be dispatched.  The
+  // key itself is left out so that profiles don't record what was typed.
+  if (profiler_thread_is_being_profiled_for_markers() &&
+      !aKeyboardEvent->mTimeStamp.IsNull()) {
+    PROFILER_MARKER_TEXT(
+        "Editor keypress", DOM,
+        MarkerTiming::IntervalUntilNowFrom(aKeyboardEvent->mTimeStamp),
+        editorBase->IsHTMLEditor() ? "HTMLEditor"_ns : "TextEditor"_ns);
+  }
   if (NS_FAILED(rv)) {
     NS_WARNING("EditorBase::HandleKeyPressEvent() failed");
     return rv;
@@ -9,6 +9,13 @@
 #include "SkConvolver.h"
 #include "skia/include/core/SkBitmap.h"
 
+#include <algorithm>
+
+#include "mozilla/Atomics.h"
+#include "mozilla/Monitor.h"
+#include "mozilla/TaskController.h"
+#include "nsISupportsImpl.h"
+
 namespace mozilla::gfx {
 
 ConvolutionFilter::ConvolutionFilter()
@@ -67,6 +74,110 @@ bool ConvolutionFilter::ComputeResizeFilter(ResizeMethod aResizeMethod,
   }
 }
 
+// Below this many source pixels, scaling on a single thread is fast enough
+// that waking up pool threads costs more than it saves.
+static const int64_t kMinPixelsForParallelScale = 2048 * 2048;
+// The fewest output rows worth handing to another thread.
+static const int32_t kMinRowsPerScaleBand = 64;
+static const int32_t kMaxScaleBands = 8;
+
+// The output rows of a Scale() call, split in bands which are convolved both
+// by the calling thread and by TaskController pool threads, whichever claims
+// a band first. Since the calling thread also claims bands, it never waits on
+// a band no thread is working on, even when the pool is busy with other work
+// or when Scale() itself runs on a pool thread.
+class ScaleBands final {
+ public:
+  NS_INLINE_DECL_THREADSAFE_REFCOUNTING(ScaleBands)
+
+  ScaleBands(const SkPixmap& aSrc, const ConvolutionFilter& aXFilter,
+             const ConvolutionFilter& aYFilter, uint8_t* aDstData,
+             int32_t aDstStride, int32_t aNumBands)
+      : mSrc(aSrc),
+        mXFilter(aXFilter),
+        mYFilter(aYFilter),
+        mDstData(aDstData),
+        mDstStride(aDstStride),
+        mNumBands(aNumBands),
+        mMonitor("ScaleBands") {}
+
+  // Convolves bands until all of them have been claimed. mSrc, the filters and
+  // mDstData are only accessed after claiming a band, so this is safe to call
+  // after Scale() returned.
+  void ConvolveBands() {
+    for (int32_t band = mNextBand++; band < mNumBands; band = mNextBand++) {
+      int32_t numRows = mYFilter.NumValues();
+      int32_t firstRow = int64_t(numRows) * band / mNumBands;
+      int32_t endRow = int64_t(numRows) * (band + 1) / mNumBands;
+      bool ok = skia::BGRAConvolve2D(
+          static_cast<const uint8_t*>(mSrc.addr()), int(mSrc.rowBytes()),
+          !mSrc.isOpaque(), mXFilter.GetSkiaFilter(), mYFilter.GetSkiaFilter(),
+          int(mDstStride), mDstData, firstRow, endRow);
+
+      MonitorAutoLock lock(mMonitor);
+      mSucceeded = mSucceeded && ok;
+      if (++mBandsDone == mNumBands) {
+        lock.Notify();
+      }
+    }
+  }
+
+  // Waits for the bands still being convolved by other threads.
+  bool Wait() {
+    MonitorAutoLock lock(mMonitor);
+    while (mBandsDone < mNumBands) {
+      lock.Wait();
+    }
+    return mSucceeded;
+  }
+
+ private:
+  ~ScaleBands() = default;
+
+  const SkPixmap mSrc;
+  const ConvolutionFilter& mXFilter;
+  const ConvolutionFilter& mYFilter;
+  uint8_t* const mDstData;
+  const int32_t mDstStride;
+  const int32_t mNumBands;
+  Atomic<int32_t> mNextBand{0};
+  Monitor mMonitor;
+  int32_t mBandsDone MOZ_GUARDED_BY(mMonitor) = 0;
+  bool mSucceeded MOZ_GUARDED_BY(mMonitor) = true;
+};
+
+class ScaleBandsTask final : public Task {
+ public:
+  explicit ScaleBandsTask(ScaleBands* aBands)
+      : Task(Kind::OffMainThreadOnly, EventQueuePriority::RenderBlocking),
+        mBands(aBands) {}
+
+  TaskResult Run() override {
+    mBands->ConvolveBands();
+    return TaskResult::Complete;
+  }
+
+#ifdef MOZ_COLLECTING_RUNNABLE_TELEMETRY
+  bool GetName(nsACString& aName) override {
+    aName.AssignLiteral("ScaleBandsTask");
+    return true;
+  }
+#endif
+
+ private:
+  RefPtr<ScaleBands> mBands;
+};
+
+static int32_t NumScaleBands(int32_t aSrcWidth, int32_t aSrcHeight,
+                             int32_t aDstHeight) {
+  if (int64_t(aSrcWidth) * aSrcHeight < kMinPixelsForParallelScale) {
+    return 1;
+  }
+  int32_t numThreads = TaskController::GetPoolThreadCount() + 1;
+  return std::clamp(std::min(aDstHeight / kMinRowsPerScaleBand, numThreads),
+                    1, kMaxScaleBands);
+}
+
 bool Scale(uint8_t* srcData, int32_t srcWidth, int32_t srcHeight,
            int32_t srcStride, uint8_t* dstData, int32_t dstWidth,
            int32_t dstHeight, int32_t dstStride, SurfaceFormat format) {
@@ -105,10 +216,22 @@ bool Scale(uint8_t* srcData, int32_t srcWidth, int32_t srcHeight,
     xOrYFilter = &yFilter;
   }
 
-  return skia::BGRAConvolve2D(
-      static_cast<const uint8_t*>(srcPixmap.addr()), int(srcPixmap.rowBytes()),
-      !srcPixmap.isOpaque(), xFilter.GetSkiaFilter(),
-      xOrYFilter->GetSkiaFilter(), int(dstStride), dstData);
+  int32_t numBands = NumScaleBands(srcWidth, srcHeight, dstHeight);
+  if (numBands == 1) {
+    return skia::BGRAConvolve2D(
+        static_cast<const uint8_t*>(srcPixmap.addr()),
+        int(srcPixmap.rowBytes()), !srcPixmap.isOpaque(),
+        xFilter.GetSkiaFilter(), xOrYFilter->GetSkiaFilter(), int(dstStride),
+        dstData);
+  }
+
+  auto bands = MakeRefPtr<ScaleBands>(srcPixmap, xFilter, *xOrYFilter, dstData,
+                                      dstStride, numBands);
+  for (int32_t i = 1; i < numBands; ++i) {
+    TaskController::Get()->AddTask(MakeAndAddRef<ScaleBandsTask>(bands));
+  }
+  bands->ConvolveBands();
+  return bands->Wait();
 }
 
 }  // namespace mozilla::gfx
@@ -35,7 +35,11 @@ already_AddRefed<DataSourceSurface> FilterProcessing::ExtractAlpha(
     ExtractAlpha_SSE2(size, sourceData, sourceStride, alphaData, alphaStride);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    ExtractAlpha_NEON(size, sourceData, sourceStride, alphaData, alphaStride);
+#else
     ExtractAlpha_Scalar(size, sourceData, sourceStride, alphaData, alphaStride);
+#endif
   }
 
   return alpha.forget();
@@ -48,7 +52,11 @@ already_AddRefed<DataSourceSurface> FilterProcessing::ConvertToB8G8R8A8(
     return ConvertToB8G8R8A8_SSE2(aSurface);
 #endif
   }
+#ifdef USE_NEON_FILTERS
+  return ConvertToB8G8R8A8_NEON(aSurface);
+#else
   return ConvertToB8G8R8A8_Scalar(aSurface);
+#endif
 }
 
 already_AddRefed<DataSourceSurface> FilterProcessing::ApplyBlending(
@@ -72,8 +80,13 @@ void FilterProcessing::ApplyMorphologyHorizontal(
                                    aDestStride, aDestRect, aRadius, aOp);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    ApplyMorphologyHorizontal_NEON(aSourceData, aSourceStride, aDestData,
+                                   aDestStride, aDestRect, aRadius, aOp);
+#else
     ApplyMorphologyHorizontal_Scalar(aSourceData, aSourceStride, aDestData,
                                      aDestStride, aDestRect, aRadius, aOp);
+#endif
   }
 }
 
@@ -87,8 +100,13 @@ void FilterProcessing::ApplyMorphologyVertical(
                                  aDestStride, aDestRect, aRadius, aOp);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    ApplyMorphologyVertical_NEON(aSourceData, aSourceStride, aDestData,
+                                 aDestStride, aDestRect, aRadius, aOp);
+#else
     ApplyMorphologyVertical_Scalar(aSourceData, aSourceStride, aDestData,
                                    aDestStride, aDestRect, aRadius, aOp);
+#endif
   }
 }
 
@@ -99,7 +117,11 @@ already_AddRefed<DataSourceSurface> FilterProcessing::ApplyColorMatrix(
     return ApplyColorMatrix_SSE2(aInput, aMatrix);
 #endif
   }
+#ifdef USE_NEON_FILTERS
+  return ApplyColorMatrix_NEON(aInput, aMatrix);
+#else
   return ApplyColorMatrix_Scalar(aInput, aMatrix);
+#endif
 }
 
 void FilterProcessing::ApplyComposition(DataSourceSurface* aSource,
@@ -110,7 +132,11 @@ void FilterProcessing::ApplyComposition(DataSourceSurface* aSource,
     ApplyComposition_SSE2(aSource, aDest, aOperator);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    ApplyComposition_NEON(aSource, aDest, aOperator);
+#else
     ApplyComposition_Scalar(aSource, aDest, aOperator);
+#endif
   }
 }
 
@@ -152,9 +178,15 @@ void FilterProcessing::SeparateColorChannels(
                                channelStride);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    SeparateColorChannels_NEON(size, sourceData, sourceStride, channel0Data,
+                               channel1Data, channel2Data, channel3Data,
+                               channelStride);
+#else
     SeparateColorChannels_Scalar(size, sourceData, sourceStride, channel0Data,
                                  channel1Data, channel2Data, channel3Data,
                                  channelStride);
+#endif
   }
 }
 
@@ -192,9 +224,15 @@ already_AddRefed<DataSourceSurface> FilterProcessing::CombineColorChannels(
                               channel3Data);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    CombineColorChannels_NEON(size, resultStride, resultData, channelStride,
+                              channel0Data, channel1Data, channel2Data,
+                              channel3Data);
+#else
     CombineColorChannels_Scalar(size, resultStride, resultData, channelStride,
                                 channel0Data, channel1Data, channel2Data,
                                 channel3Data);
+#endif
   }
 
   return result.forget();
@@ -211,8 +249,13 @@ void FilterProcessing::DoPremultiplicationCalculation(const IntSize& aSize,
                                         aSourceData, aSourceStride);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    DoPremultiplicationCalculation_NEON(aSize, aTargetData, aTargetStride,
+                                        aSourceData, aSourceStride);
+#else
     DoPremultiplicationCalculation_Scalar(aSize, aTargetData, aTargetStride,
                                           aSourceData, aSourceStride);
+#endif
   }
 }
 
@@ -227,8 +270,13 @@ void FilterProcessing::DoUnpremultiplicationCalculation(const IntSize& aSize,
                                           aSourceData, aSourceStride);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    DoUnpremultiplicationCalculation_NEON(aSize, aTargetData, aTargetStride,
+                                          aSourceData, aSourceStride);
+#else
     DoUnpremultiplicationCalculation_Scalar(aSize, aTargetData, aTargetStride,
                                             aSourceData, aSourceStride);
+#endif
   }
 }
 
@@ -241,8 +289,13 @@ void FilterProcessing::DoOpacityCalculation(
                               aSourceStride, aValue);
 #endif
   } else {
+#ifdef USE_NEON_FILTERS
+    DoOpacityCalculation_NEON(aSize, aTargetData, aTargetStride, aSourceData,
+                              aSourceStride, aValue);
+#else
     DoOpacityCalculation_Scalar(aSize, aTargetData, aTargetStride, aSourceData,
                                 aSourceStride, aValue);
+#endif
   }
 }
 
@@ -263,8 +316,13 @@ already_AddRefed<DataSourceSurface> FilterProcessing::RenderTurbulence(
                                  aNumOctaves, aType, aStitch, aTileRect);
 #endif
   }
+#ifdef USE_NEON_FILTERS
+  return RenderTurbulence_NEON(aSize, aOffset, aBaseFrequency, aSeed,
+                               aNumOctaves, aType, aStitch, aTileRect);
+#else
   return RenderTurbulence_Scalar(aSize, aOffset, aBaseFrequency, aSeed,
                                  aNumOctaves, aType, aStitch, aTileRect);
+#endif
 }
 
 already_AddRefed<DataSourceSurface> FilterProcessing::ApplyArithmeticCombine(
@@ -275,7 +333,11 @@ already_AddRefed<DataSourceSurface> FilterProcessing::ApplyArithmeticCombine(
     return ApplyArithmeticCombine_SSE2(aInput1, aInput2, aK1, aK2, aK3, aK4);
 #endif
   }
+#ifdef USE_NEON_FILTERS
+  return ApplyArithmeticCombine_NEON(aInput1, aInput2, aK1, aK2, aK3, aK4);
+#else
   return ApplyArithmeticCombine_Scalar(aInput1, aInput2, aK1, aK2, aK3, aK4);
+#endif
 }
 
 }  // namespace gfx
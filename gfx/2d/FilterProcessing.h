@@ -192,6 +192,57 @@ class FilterProcessing {
       DataSourceSurface* aInput1, DataSourceSurface* aInput2, Float aK1,
       Float aK2, Float aK3, Float aK4);
 #endif
+
+#ifdef USE_NEON_FILTERS
+  static void ExtractAlpha_NEON(const IntSize& size, uint8_t* sourceData,
+                                int32_t sourceStride, uint8_t* alphaData,
+                                int32_t alphaStride);
+  static already_AddRefed<DataSourceSurface> ConvertToB8G8R8A8_NEON(
+      SourceSurface* aSurface);
+  static void ApplyMorphologyHorizontal_NEON(
+      uint8_t* aSourceData, int32_t aSourceStride, uint8_t* aDestData,
+      int32_t aDestStride, const IntRect& aDestRect, int32_t aRadius,
+      MorphologyOperator aOperator);
+  static void ApplyMorphologyVertical_NEON(
+      uint8_t* aSourceData, int32_t aSourceStride, uint8_t* aDestData,
+      int32_t aDestStride, const IntRect& aDestRect, int32_t aRadius,
+      MorphologyOperator aOperator);
+  static already_AddRefed<DataSourceSurface> ApplyColorMatrix_NEON(
+      DataSourceSurface* aInput, const Matrix5x4& aMatrix);
+  static void ApplyComposition_NEON(DataSourceSurface* aSource,
+                                    DataSourceSurface* aDest,
+                                    CompositeOperator aOperator);
+  static void SeparateColorChannels_NEON(
+      const IntSize& size, uint8_t* sourceData, int32_t sourceStride,
+      uint8_t* channel0Data, uint8_t* channel1Data, uint8_t* channel2Data,
+      uint8_t* channel3Data, int32_t channelStride);
+  static void CombineColorChannels_NEON(
+      const IntSize& size, int32_t resultStride, uint8_t* resultData,
+      int32_t channelStride, uint8_t* channel0Data, uint8_t* channel1Data,
+      uint8_t* channel2Data, uint8_t* channel3Data);
+  static void DoPremultiplicationCalculation_NEON(const IntSize& aSize,
+                                                  uint8_t* aTargetData,
+                                                  int32_t aTargetStride,
+                                                  uint8_t* aSourceData,
+                                                  int32_t aSourceStride);
+  static void DoUnpremultiplicationCalculation_NEON(const IntSize& aSize,
+                                                    uint8_t* aTargetData,
+                                                    int32_t aTargetStride,
+                                                    uint8_t* aSourceData,
+                                                    int32_t aSourceStride);
+  static void DoOpacityCalculation_NEON(const IntSize& aSize,
+                                        uint8_t* aTargetData,
+                                        int32_t aTargetStride,
+                                        uint8_t* aSourceData,
+                                        int32_t aSourceStride, Float aValue);
+  static already_AddRefed<DataSourceSurface> RenderTurbulence_NEON(
+      const IntSize& aSize, const Point& aOffset, const Size& aBaseFrequency,
+      int32_t aSeed, int aNumOctaves, TurbulenceType aType, bool aStitch,
+      const Rect& aTileRect);
+  static already_AddRefed<DataSourceSurface> ApplyArithmeticCombine_NEON(
+      DataSourceSurface* aInput1, DataSourceSurface* aInput2, Float aK1,
+      Float aK2, Float aK3, Float aK4);
+#endif
 };
 
 // Constant-time max and min functions for unsigned arguments
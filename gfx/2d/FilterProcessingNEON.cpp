@@ -0,0 +1,120 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#define SIMD_COMPILE_NEON
+
+#include "FilterProcessingSIMD-inl.h"
+
+#ifndef USE_NEON_FILTERS
+static_assert(
+    false, "If this file is built, FilterProcessing.h should know about it!");
+#endif
+
+namespace mozilla::gfx {
+
+void FilterProcessing::ExtractAlpha_NEON(const IntSize& size,
+                                         uint8_t* sourceData,
+                                         int32_t sourceStride,
+                                         uint8_t* alphaData,
+                                         int32_t alphaStride) {
+  ExtractAlpha_SIMD<uint8x16_t>(size, sourceData, sourceStride, alphaData,
+                                alphaStride);
+}
+
+already_AddRefed<DataSourceSurface> FilterProcessing::ConvertToB8G8R8A8_NEON(
+    SourceSurface* aSurface) {
+  return ConvertToB8G8R8A8_SIMD<uint8x16_t>(aSurface);
+}
+
+void FilterProcessing::ApplyMorphologyHorizontal_NEON(
+    uint8_t* aSourceData, int32_t aSourceStride, uint8_t* aDestData,
+    int32_t aDestStride, const IntRect& aDestRect, int32_t aRadius,
+    MorphologyOperator aOp) {
+  ApplyMorphologyHorizontal_SIMD<int16x8_t, uint8x16_t>(
+      aSourceData, aSourceStride, aDestData, aDestStride, aDestRect, aRadius,
+      aOp);
+}
+
+void FilterProcessing::ApplyMorphologyVertical_NEON(
+    uint8_t* aSourceData, int32_t aSourceStride, uint8_t* aDestData,
+    int32_t aDestStride, const IntRect& aDestRect, int32_t aRadius,
+    MorphologyOperator aOp) {
+  ApplyMorphologyVertical_SIMD<int16x8_t, uint8x16_t>(
+      aSourceData, aSourceStride, aDestData, aDestStride, aDestRect, aRadius,
+      aOp);
+}
+
+already_AddRefed<DataSourceSurface> FilterProcessing::ApplyColorMatrix_NEON(
+    DataSourceSurface* aInput, const Matrix5x4& aMatrix) {
+  return ApplyColorMatrix_SIMD<int32x4_t, int16x8_t, uint8x16_t>(aInput,
+                                                                 aMatrix);
+}
+
+void FilterProcessing::ApplyComposition_NEON(DataSourceSurface* aSource,
+                                             DataSourceSurface* aDest,
+                                             CompositeOperator aOperator) {
+  return ApplyComposition_SIMD<int32x4_t, int16x8_t, uint8x16_t>(
+      aSource, aDest, aOperator);
+}
+
+void FilterProcessing::SeparateColorChannels_NEON(
+    const IntSize& size, uint8_t* sourceData, int32_t sourceStride,
+    uint8_t* channel0Data, uint8_t* channel1Data, uint8_t* channel2Data,
+    uint8_t* channel3Data, int32_t channelStride) {
+  SeparateColorChannels_SIMD<uint8x16_t>(
+      size, sourceData, sourceStride, channel0Data, channel1Data, channel2Data,
+      channel3Data, channelStride);
+}
+
+void FilterProcessing::CombineColorChannels_NEON(
+    const IntSize& size, int32_t resultStride, uint8_t* resultData,
+    int32_t channelStride, uint8_t* channel0Data, uint8_t* channel1Data,
+    uint8_t* channel2Data, uint8_t* channel3Data) {
+  CombineColorChannels_SIMD<uint8x16_t>(
+      size, resultStride, resultData, channelStride, channel0Data,
+      channel1Data, channel2Data, channel3Data);
+}
+
+void FilterProcessing::DoPremultiplicationCalculation_NEON(
+    const IntSize& aSize, uint8_t* aTargetData, int32_t aTargetStride,
+    uint8_t* aSourceData, int32_t aSourceStride) {
+  DoPremultiplicationCalculation_SIMD<int32x4_t, int16x8_t, uint8x16_t>(
+      aSize, aTargetData, aTargetStride, aSourceData, aSourceStride);
+}
+
+void FilterProcessing::DoUnpremultiplicationCalculation_NEON(
+    const IntSize& aSize, uint8_t* aTargetData, int32_t aTargetStride,
+    uint8_t* aSourceData, int32_t aSourceStride) {
+  DoUnpremultiplicationCalculation_SIMD<int16x8_t, uint8x16_t>(
+      aSize, aTargetData, aTargetStride, aSourceData, aSourceStride);
+}
+
+void FilterProcessing::DoOpacityCalculation_NEON(
+    const IntSize& aSize, uint8_t* aTargetData, int32_t aTargetStride,
+    uint8_t* aSourceData, int32_t aSourceStride, Float aValue) {
+  DoOpacityCalculation_SIMD<int16x8_t, uint8x16_t>(
+      aSize, aTargetData, aTargetStride, aSourceData, aSourceStride, aValue);
+}
+
+already_AddRefed<DataSourceSurface> FilterProcessing::RenderTurbulence_NEON(
+    const IntSize& aSize, const Point& aOffset, const Size& aBaseFrequency,
+    int32_t aSeed, int aNumOctaves, TurbulenceType aType, bool aStitch,
+    const Rect& aTileRect) {
+  return RenderTurbulence_SIMD<float32x4_t, int32x4_t, uint8x16_t>(
+      aSize, aOffset, aBaseFrequency, aSeed, aNumOctaves, aType, aStitch,
+      aTileRect);
+}
+
+already_AddRefed<DataSourceSurface>
+FilterProcessing::ApplyArithmeticCombine_NEON(DataSourceSurface* aInput1,
+                                              DataSourceSurface* aInput2,
+                                              Float aK1, Float aK2, Float aK3,
+                                              Float aK4) {
+  return ApplyArithmeticCombine_SIMD<int32x4_t, int16x8_t, uint8x16_t>(
+      aInput1, aInput2, aK1, aK2, aK3, aK4);
+}
+
+}  // namespace mozilla::gfx
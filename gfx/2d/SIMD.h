@@ -9,13 +9,18 @@
 
 /**
  * Consumers of this file need to #define SIMD_COMPILE_SSE2 before including it
- * if they want access to the SSE2 functions.
+ * if they want access to the SSE2 functions, or SIMD_COMPILE_NEON for the
+ * AArch64 NEON functions.
  */
 
 #ifdef SIMD_COMPILE_SSE2
 #  include <xmmintrin.h>
 #endif
 
+#ifdef SIMD_COMPILE_NEON
+#  include <arm_neon.h>
+#endif
+
 namespace mozilla {
 namespace gfx {
 
@@ -1031,6 +1036,320 @@ inline __m128i F32ToI32(__m128 m) { return _mm_cvtps_epi32(m); }
 
 #endif  // SIMD_COMPILE_SSE2
 
+#ifdef SIMD_COMPILE_NEON
+
+// NEON
+//
+// Like the scalar backend, this uses int16x8_t for both i16x8_t and u16x8_t.
+// The instructions used here are only available on AArch64.
+
+template <>
+inline uint8x16_t Load8<uint8x16_t>(const uint8_t* aSource) {
+  return vld1q_u8(aSource);
+}
+
+inline void Store8(uint8_t* aTarget, uint8x16_t aM) { vst1q_u8(aTarget, aM); }
+
+template <>
+inline uint8x16_t FromZero8<uint8x16_t>() {
+  return vdupq_n_u8(0);
+}
+
+template <>
+inline uint8x16_t From8<uint8x16_t>(uint8_t a, uint8_t b, uint8_t c, uint8_t d,
+                                    uint8_t e, uint8_t f, uint8_t g, uint8_t h,
+                                    uint8_t i, uint8_t j, uint8_t k, uint8_t l,
+                                    uint8_t m, uint8_t n, uint8_t o,
+                                    uint8_t p) {
+  const uint8_t values[16] = {a, b, c, d, e, f, g, h,
+                              i, j, k, l, m, n, o, p};
+  return vld1q_u8(values);
+}
+
+template <>
+inline int16x8_t FromI16<int16x8_t>(int16_t a, int16_t b, int16_t c, int16_t d,
+                                    int16_t e, int16_t f, int16_t g,
+                                    int16_t h) {
+  const int16_t values[8] = {a, b, c, d, e, f, g, h};
+  return vld1q_s16(values);
+}
+
+template <>
+inline int16x8_t FromU16<int16x8_t>(uint16_t a, uint16_t b, uint16_t c,
+                                    uint16_t d, uint16_t e, uint16_t f,
+                                    uint16_t g, uint16_t h) {
+  const uint16_t values[8] = {a, b, c, d, e, f, g, h};
+  return vreinterpretq_s16_u16(vld1q_u16(values));
+}
+
+template <>
+inline int16x8_t FromI16<int16x8_t>(int16_t a) {
+  return vdupq_n_s16(a);
+}
+
+template <>
+inline int16x8_t FromU16<int16x8_t>(uint16_t a) {
+  return vreinterpretq_s16_u16(vdupq_n_u16(a));
+}
+
+template <>
+inline int32x4_t From32<int32x4_t>(int32_t a, int32_t b, int32_t c,
+                                   int32_t d) {
+  const int32_t values[4] = {a, b, c, d};
+  return vld1q_s32(values);
+}
+
+template <>
+inline int32x4_t From32<int32x4_t>(int32_t a) {
+  return vdupq_n_s32(a);
+}
+
+template <>
+inline float32x4_t FromF32<float32x4_t>(float a, float b, float c, float d) {
+  const float values[4] = {a, b, c, d};
+  return vld1q_f32(values);
+}
+
+template <>
+inline float32x4_t FromF32<float32x4_t>(float a) {
+  return vdupq_n_f32(a);
+}
+
+template <int32_t aNumberOfBits>
+inline int16x8_t ShiftRight16(int16x8_t aM) {
+  return vreinterpretq_s16_u16(
+      vshrq_n_u16(vreinterpretq_u16_s16(aM), aNumberOfBits));
+}
+
+template <int32_t aNumberOfBits>
+inline int32x4_t ShiftRight32(int32x4_t aM) {
+  return vshrq_n_s32(aM, aNumberOfBits);
+}
+
+inline int16x8_t Add16(int16x8_t aM1, int16x8_t aM2) {
+  return vaddq_s16(aM1, aM2);
+}
+
+inline int32x4_t Add32(int32x4_t aM1, int32x4_t aM2) {
+  return vaddq_s32(aM1, aM2);
+}
+
+inline int16x8_t Sub16(int16x8_t aM1, int16x8_t aM2) {
+  return vsubq_s16(aM1, aM2);
+}
+
+inline int32x4_t Sub32(int32x4_t aM1, int32x4_t aM2) {
+  return vsubq_s32(aM1, aM2);
+}
+
+inline uint8x16_t Min8(uint8x16_t aM1, uint8x16_t aM2) {
+  return vminq_u8(aM1, aM2);
+}
+
+inline uint8x16_t Max8(uint8x16_t aM1, uint8x16_t aM2) {
+  return vmaxq_u8(aM1, aM2);
+}
+
+inline int32x4_t Min32(int32x4_t aM1, int32x4_t aM2) {
+  return vminq_s32(aM1, aM2);
+}
+
+inline int32x4_t Max32(int32x4_t aM1, int32x4_t aM2) {
+  return vmaxq_s32(aM1, aM2);
+}
+
+inline int16x8_t Mul16(int16x8_t aM1, int16x8_t aM2) {
+  return vmulq_s16(aM1, aM2);
+}
+
+inline void Mul16x4x2x2To32x4x2(int16x8_t aFactorsA1B1, int16x8_t aFactorsA2B2,
+                                int32x4_t& aProductA, int32x4_t& aProductB) {
+  aProductA = vmull_s16(vget_low_s16(aFactorsA1B1), vget_low_s16(aFactorsA2B2));
+  aProductB = vmull_high_s16(aFactorsA1B1, aFactorsA2B2);
+}
+
+inline int32x4_t MulAdd16x8x2To32x4(int16x8_t aFactorsA,
+                                    int16x8_t aFactorsB) {
+  int32x4_t lo = vmull_s16(vget_low_s16(aFactorsA), vget_low_s16(aFactorsB));
+  int32x4_t hi = vmull_high_s16(aFactorsA, aFactorsB);
+  return vpaddq_s32(lo, hi);
+}
+
+template <int8_t aIndex>
+inline int32x4_t Splat32(int32x4_t aM) {
+  AssertIndex<aIndex>();
+  return vdupq_laneq_s32(aM, aIndex);
+}
+
+template <int8_t aIndex>
+inline uint8x16_t Splat32On8(uint8x16_t aM) {
+  AssertIndex<aIndex>();
+  return vreinterpretq_u8_s32(
+      vdupq_laneq_s32(vreinterpretq_s32_u8(aM), aIndex));
+}
+
+template <int8_t i0, int8_t i1, int8_t i2, int8_t i3>
+inline int32x4_t Shuffle32(int32x4_t aM) {
+  AssertIndex<i0>();
+  AssertIndex<i1>();
+  AssertIndex<i2>();
+  AssertIndex<i3>();
+  int32x4_t m = vdupq_n_s32(vgetq_lane_s32(aM, i3));
+  m = vsetq_lane_s32(vgetq_lane_s32(aM, i2), m, 1);
+  m = vsetq_lane_s32(vgetq_lane_s32(aM, i1), m, 2);
+  return vsetq_lane_s32(vgetq_lane_s32(aM, i0), m, 3);
+}
+
+template <int8_t i0, int8_t i1, int8_t i2, int8_t i3>
+inline int16x8_t ShuffleLo16(int16x8_t aM) {
+  AssertIndex<i0>();
+  AssertIndex<i1>();
+  AssertIndex<i2>();
+  AssertIndex<i3>();
+  int16x8_t m = vsetq_lane_s16(vgetq_lane_s16(aM, i3), aM, 0);
+  m = vsetq_lane_s16(vgetq_lane_s16(aM, i2), m, 1);
+  m = vsetq_lane_s16(vgetq_lane_s16(aM, i1), m, 2);
+  return vsetq_lane_s16(vgetq_lane_s16(aM, i0), m, 3);
+}
+
+template <int8_t i0, int8_t i1, int8_t i2, int8_t i3>
+inline int16x8_t ShuffleHi16(int16x8_t aM) {
+  AssertIndex<i0>();
+  AssertIndex<i1>();
+  AssertIndex<i2>();
+  AssertIndex<i3>();
+  int16x8_t m = vsetq_lane_s16(vgetq_lane_s16(aM, 4 + i3), aM, 4);
+  m = vsetq_lane_s16(vgetq_lane_s16(aM, 4 + i2), m, 5);
+  m = vsetq_lane_s16(vgetq_lane_s16(aM, 4 + i1), m, 6);
+  return vsetq_lane_s16(vgetq_lane_s16(aM, 4 + i0), m, 7);
+}
+
+template <int8_t aIndexLo, int8_t aIndexHi>
+inline int16x8_t Splat16(int16x8_t aM) {
+  AssertIndex<aIndexLo>();
+  AssertIndex<aIndexHi>();
+  return vcombine_s16(vdup_laneq_s16(aM, aIndexLo),
+                      vdup_laneq_s16(aM, 4 + aIndexHi));
+}
+
+inline int16x8_t UnpackLo8x8ToI16x8(uint8x16_t aM) {
+  return vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(aM)));
+}
+
+inline int16x8_t UnpackHi8x8ToI16x8(uint8x16_t aM) {
+  return vreinterpretq_s16_u16(vmovl_high_u8(aM));
+}
+
+inline int16x8_t UnpackLo8x8ToU16x8(uint8x16_t aM) {
+  return vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(aM)));
+}
+
+inline int16x8_t UnpackHi8x8ToU16x8(uint8x16_t aM) {
+  return vreinterpretq_s16_u16(vmovl_high_u8(aM));
+}
+
+inline uint8x16_t InterleaveLo8(uint8x16_t m1, uint8x16_t m2) {
+  return vzip1q_u8(m1, m2);
+}
+
+inline uint8x16_t InterleaveHi8(uint8x16_t m1, uint8x16_t m2) {
+  return vzip2q_u8(m1, m2);
+}
+
+inline int16x8_t InterleaveLo16(int16x8_t m1, int16x8_t m2) {
+  return vzip1q_s16(m1, m2);
+}
+
+inline int16x8_t InterleaveHi16(int16x8_t m1, int16x8_t m2) {
+  return vzip2q_s16(m1, m2);
+}
+
+inline int32x4_t InterleaveLo32(int32x4_t m1, int32x4_t m2) {
+  return vzip1q_s32(m1, m2);
+}
+
+template <uint8_t aNumBytes>
+inline uint8x16_t Rotate8(uint8x16_t a1234, uint8x16_t a5678) {
+  return vextq_u8(a1234, a5678, aNumBytes);
+}
+
+inline int16x8_t PackAndSaturate32To16(int32x4_t m1, int32x4_t m2) {
+  return vcombine_s16(vqmovn_s32(m1), vqmovn_s32(m2));
+}
+
+inline int16x8_t PackAndSaturate32ToU16(int32x4_t m1, int32x4_t m2) {
+  return vcombine_s16(vqmovn_s32(m1), vqmovn_s32(m2));
+}
+
+inline uint8x16_t PackAndSaturate32To8(int32x4_t m1, int32x4_t m2,
+                                       int32x4_t m3, const int32x4_t& m4) {
+  // Pack into 8 16bit signed integers (saturating).
+  int16x8_t m12 = PackAndSaturate32To16(m1, m2);
+  int16x8_t m34 = PackAndSaturate32To16(m3, m4);
+
+  // Pack into 16 8bit unsigned integers (saturating).
+  return vcombine_u8(vqmovun_s16(m12), vqmovun_s16(m34));
+}
+
+inline uint8x16_t PackAndSaturate16To8(int16x8_t m1, int16x8_t m2) {
+  return vcombine_u8(vqmovun_s16(m1), vqmovun_s16(m2));
+}
+
+inline int32x4_t FastDivideBy255(int32x4_t m) {
+  // v = (m << 8) + (m + (255,255,255,255))
+  int32x4_t v = vaddq_s32(vshlq_n_s32(m, 8), vaddq_s32(m, vdupq_n_s32(255)));
+  // v = v >> 16
+  return vshrq_n_s32(v, 16);
+}
+
+inline int16x8_t FastDivideBy255_16(int16x8_t m) {
+  uint16x8_t u = vreinterpretq_u16_s16(m);
+  int32x4_t lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(u)));
+  int32x4_t hi = vreinterpretq_s32_u32(vmovl_high_u16(u));
+  return PackAndSaturate32To16(FastDivideBy255(lo), FastDivideBy255(hi));
+}
+
+inline uint8x16_t Pick(uint8x16_t mask, uint8x16_t a, uint8x16_t b) {
+  return vbslq_u8(mask, b, a);
+}
+
+inline int32x4_t Pick(int32x4_t mask, int32x4_t a, int32x4_t b) {
+  return vbslq_s32(vreinterpretq_u32_s32(mask), b, a);
+}
+
+inline float32x4_t MixF32(float32x4_t a, float32x4_t b, float t) {
+  return vaddq_f32(a, vmulq_n_f32(vsubq_f32(b, a), t));
+}
+
+inline float32x4_t WSumF32(float32x4_t a, float32x4_t b, float wa, float wb) {
+  return vaddq_f32(vmulq_n_f32(a, wa), vmulq_n_f32(b, wb));
+}
+
+inline float32x4_t AbsF32(float32x4_t a) { return vabsq_f32(a); }
+
+inline float32x4_t AddF32(float32x4_t a, float32x4_t b) {
+  return vaddq_f32(a, b);
+}
+
+inline float32x4_t MulF32(float32x4_t a, float32x4_t b) {
+  return vmulq_f32(a, b);
+}
+
+inline float32x4_t DivF32(float32x4_t a, float32x4_t b) {
+  return vdivq_f32(a, b);
+}
+
+template <uint8_t aIndex>
+inline float32x4_t SplatF32(float32x4_t m) {
+  AssertIndex<aIndex>();
+  return vdupq_laneq_f32(m, aIndex);
+}
+
+// Rounds to nearest, ties to even, like _mm_cvtps_epi32 does by default.
+inline int32x4_t F32ToI32(float32x4_t m) { return vcvtnq_s32_f32(m); }
+
+#endif  // SIMD_COMPILE_NEON
+
 }  // namespace simd
 
 }  // namespace gfx
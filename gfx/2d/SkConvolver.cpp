@@ -486,12 +486,21 @@ bool SkConvolutionFilter1D::ComputeFilterValues(
 /**
  *  Returns false if it was unable to perform the convolution/rescale. in which
  * case the output buffer is assumed to be undefined.
+ *
+ * Only output rows [firstOutputRow, endOutputRow) are written, endOutputRow
+ * being clamped to filterY.numValues(), so that separate bands of the output
+ * can be convolved concurrently.
  */
 bool BGRAConvolve2D(const unsigned char* sourceData, int sourceByteRowStride,
                     bool sourceHasAlpha, const SkConvolutionFilter1D& filterX,
                     const SkConvolutionFilter1D& filterY,
-                    int outputByteRowStride, unsigned char* output) {
+                    int outputByteRowStride, unsigned char* output,
+                    int firstOutputRow, int endOutputRow) {
   int maxYFilterSize = filterY.maxFilter();
+  int numOutputRows = std::min(endOutputRow, filterY.numValues());
+  if (firstOutputRow < 0 || firstOutputRow >= numOutputRows) {
+    return false;
+  }
 
   // The next row in the input that we will generate a horizontally
   // convolved row for. If the filter doesn't start at the beginning of the
@@ -500,7 +509,7 @@ bool BGRAConvolve2D(const unsigned char* sourceData, int sourceByteRowStride,
   // row for convolution as the first pixel for the first vertical filter.
   int filterOffset = 0, filterLength = 0;
   const SkConvolutionFilter1D::ConvolutionFixed* filterValues =
-      filterY.FilterForValue(0, &filterOffset, &filterLength);
+      filterY.FilterForValue(firstOutputRow, &filterOffset, &filterLength);
   int nextXRow = filterOffset;
 
   // We loop over each row in the input doing a horizontal convolution. This
@@ -538,7 +547,6 @@ bool BGRAConvolve2D(const unsigned char* sourceData, int sourceByteRowStride,
   // Loop over every possible output row, processing just enough horizontal
   // convolutions to run each subsequent vertical convolution.
   MOZ_ASSERT(outputByteRowStride >= filterX.numValues() * 4);
-  int numOutputRows = filterY.numValues();
 
   // We need to check which is the last line to convolve before we advance 4
   // lines in one iteration.
@@ -546,7 +554,7 @@ bool BGRAConvolve2D(const unsigned char* sourceData, int sourceByteRowStride,
   filterY.FilterForValue(numOutputRows - 1, &lastFilterOffset,
                          &lastFilterLength);
 
-  for (int outY = 0; outY < numOutputRows; outY++) {
+  for (int outY = firstOutputRow; outY < numOutputRows; outY++) {
     filterValues = filterY.FilterForValue(outY, &filterOffset, &filterLength);
 
     // Generate output rows until we have enough to run the current filter.
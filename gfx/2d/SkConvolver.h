@@ -9,6 +9,7 @@
 
 #include "mozilla/Assertions.h"
 #include <cfloat>
+#include <climits>
 #include <cmath>
 #include "mozilla/Vector.h"
 
@@ -162,7 +163,8 @@ void convolve_vertically(
 bool BGRAConvolve2D(const unsigned char* sourceData, int sourceByteRowStride,
                     bool sourceHasAlpha, const SkConvolutionFilter1D& filterX,
                     const SkConvolutionFilter1D& filterY,
-                    int outputByteRowStride, unsigned char* output);
+                    int outputByteRowStride, unsigned char* output,
+                    int firstOutputRow = 0, int endOutputRow = INT_MAX);
 
 }  // namespace skia
 
@@ -14,7 +14,9 @@
 #include "mozilla/dom/WorkerRunnable.h"
 #include "mozilla/layers/TextureRecorded.h"
 #include "mozilla/layers/SharedSurfacesChild.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/StaticPrefs_gfx.h"
+#include "nsPrintfCString.h"
 #include "RecordedCanvasEventImpl.h"
 
 namespace mozilla {
@@ -150,6 +152,13 @@ bool CanvasDrawEventRecorder::WaitForCheckpoint(int64_t aCheckpoint) {
   mHeader->writerWaitCount = aCheckpoint;
   mHeader->writerState = State::Waiting;
 
+  // Spinning did not give the translator enough time to catch up, so the
+  // producer of the canvas commands is now stalled.
+  AUTO_PROFILER_MARKER_TEXT(
+      "CanvasRecorderStall", GRAPHICS, {},
+      nsPrintfCString("%" PRId64 " events behind",
+                      aCheckpoint - mHeader->processedCount));
+
   // Wait unless we detect the reading side has closed.
   while (!mHelpers->ReaderClosed() && mHeader->readerState != State::Failed) {
     if (mWriterSemaphore->Wait(Some(TimeDuration::FromMilliseconds(100)))) {
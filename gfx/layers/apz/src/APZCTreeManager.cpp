@@ -687,6 +687,16 @@ std::vector<LayersId> APZCTreeManager::UpdateHitTestingTree(
   // We do not support tree structures where the root node has siblings.
   MOZ_ASSERT(!(mRootNode && mRootNode->GetPrevSibling()));
 
+  // Visit the nodes in the same order as GetTargetNode(), keeping the first
+  // node found for each guid.
+  mNodesByGuid.clear();
+  ForEachNodePostOrder<ReverseIterator>(
+      mRootNode.get(), [this](HitTestingTreeNode* aNode) {
+        if (AsyncPanZoomController* apzc = aNode->GetApzc()) {
+          mNodesByGuid.emplace(apzc->GetGuid(), aNode);
+        }
+      });
+
   {  // scope lock and update our mApzcMap before we destroy all the unused
     // APZC instances
     MutexAutoLock lock(mMapLock);
@@ -2733,6 +2743,7 @@ void APZCTreeManager::ClearTree() {
                                  nodesToDestroy.AppendElement(aNode);
                                });
 
+  mNodesByGuid.clear();
   for (size_t i = 0; i < nodesToDestroy.Length(); i++) {
     nodesToDestroy[i]->Destroy();
   }
@@ -2974,6 +2985,12 @@ already_AddRefed<AsyncPanZoomController> APZCTreeManager::GetTargetAPZC(
 already_AddRefed<HitTestingTreeNode> APZCTreeManager::GetTargetNode(
     const ScrollableLayerGuid& aGuid, GuidComparator aComparator) const {
   mTreeLock.AssertCurrentThreadIn();
+  if (aComparator == &ScrollableLayerGuid::EqualsIgnoringPresShell) {
+    auto it = mNodesByGuid.find(aGuid);
+    RefPtr<HitTestingTreeNode> target =
+        it != mNodesByGuid.end() ? it->second : nullptr;
+    return target.forget();
+  }
   RefPtr<HitTestingTreeNode> target =
       DepthFirstSearchPostOrder<ReverseIterator>(
           mRootNode.get(), [&aGuid, &aComparator](HitTestingTreeNode* node) {
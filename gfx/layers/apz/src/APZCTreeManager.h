@@ -844,6 +844,14 @@ class APZCTreeManager : public IAPZCTreeManager, public APZInputBridge {
    * IMPORTANT: See the note about lock ordering at the top of this file. */
   mutable mozilla::RecursiveMutex mTreeLock;
   RefPtr<HitTestingTreeNode> mRootNode MOZ_GUARDED_BY(mTreeLock);
+  /* For each APZC guid, ignoring the presShellId, the node that
+   * GetTargetNode() would find first for it. This is rebuilt with the tree so
+   * that the WebRender hit-testing, which looks up a node for every hit
+   * result, doesn't do a full tree walk per lookup. */
+  std::unordered_map<ScrollableLayerGuid, HitTestingTreeNode*,
+                     ScrollableLayerGuid::HashIgnoringPresShellFn,
+                     ScrollableLayerGuid::EqualIgnoringPresShellFn>
+      mNodesByGuid MOZ_GUARDED_BY(mTreeLock);
 
   /*
    * A set of LayersIds for which APZCTM should only send empty
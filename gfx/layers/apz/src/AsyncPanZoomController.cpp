@@ -1688,6 +1688,8 @@ nsEventStatus AsyncPanZoomController::OnScale(const PinchGestureInput& aEvent) {
           -mY.ScaleWillOverscrollAmount(spanRatio, cssFocusPoint.y);
 
       ScaleWithFocus(spanRatio, cssFocusPoint);
+      RecordScrollPayload(aEvent.mTimeStamp,
+                          CompositionPayloadType::eAPZPinchZoom);
 
       if (neededDisplacement != CSSPoint()) {
         ScrollBy(neededDisplacement);
@@ -4186,11 +4188,11 @@ bool AsyncPanZoomController::CallDispatchScroll(
                                           aOverscrollHandoffState);
 }
 
-void AsyncPanZoomController::RecordScrollPayload(const TimeStamp& aTimeStamp) {
+void AsyncPanZoomController::RecordScrollPayload(
+    const TimeStamp& aTimeStamp, CompositionPayloadType aType) {
   RecursiveMutexAutoLock lock(mRecursiveMutex);
   if (!mScrollPayload) {
-    mScrollPayload = Some(
-        CompositionPayload{CompositionPayloadType::eAPZScroll, aTimeStamp});
+    mScrollPayload = Some(CompositionPayload{aType, aTimeStamp});
   }
 }
 
@@ -1785,7 +1785,12 @@ class AsyncPanZoomController {
                           ParentLayerPoint& aEndPoint,
                           OverscrollHandoffState& aOverscrollHandoffState);
 
-  void RecordScrollPayload(const TimeStamp& aTimeStamp);
+  // Records the time of the input event that caused the next composite, so
+  // that its latency to presentation is reported. Only the earliest event
+  // since the last sample is kept.
+  void RecordScrollPayload(
+      const TimeStamp& aTimeStamp,
+      CompositionPayloadType aType = CompositionPayloadType::eAPZScroll);
 
   /**
    * A helper function for overscrolling during panning. This is a wrapper
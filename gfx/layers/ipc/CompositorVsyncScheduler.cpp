@@ -16,6 +16,7 @@
 #endif
 #include "mozilla/AutoRestore.h"  // for AutoRestore
 #include "mozilla/DebugOnly.h"    // for DebugOnly
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/StaticPrefs_gfx.h"
 #include "mozilla/StaticPrefs_layers.h"
 #include "mozilla/gfx/2D.h"     // for DrawTarget
@@ -28,6 +29,7 @@
 #include "nsDebug.h"           // for NS_ASSERTION, etc
 #include "nsISupportsImpl.h"   // for MOZ_COUNT_CTOR, etc
 #include "nsIWidget.h"         // for nsIWidget
+#include "nsPrintfCString.h"   // for nsPrintfCString
 #include "nsThreadUtils.h"     // for NS_IsMainThread
 #include "mozilla/Telemetry.h"
 #include "mozilla/VsyncDispatcher.h"
@@ -71,6 +73,7 @@ CompositorVsyncScheduler::CompositorVsyncScheduler(
       mIsObservingVsync(false),
       mRendersDelayedByVsyncReasons(wr::RenderReasons::NONE),
       mVsyncNotificationsSkipped(0),
+      mVsyncsMissedForPendingComposite(0),
       mWidget(aWidget),
       mCurrentCompositeTaskMonitor("CurrentCompositeTaskMonitor"),
       mCurrentCompositeTask(nullptr),
@@ -258,11 +261,23 @@ void CompositorVsyncScheduler::Composite(const VsyncEvent& aVsyncEvent,
     if (mVsyncSchedulerOwner->IsPendingComposite()) {
       // If previous composite is still on going, finish it and wait for the
       // next vsync.
+      if (mVsyncsMissedForPendingComposite++ == 0) {
+        mFirstMissedVsyncTime = aVsyncEvent.mTime;
+      }
       mVsyncSchedulerOwner->FinishPendingComposite();
       return;
     }
   }
 
+  if (mVsyncsMissedForPendingComposite) {
+    PROFILER_MARKER_TEXT(
+        "CompositorMissedVsync", GRAPHICS,
+        MarkerTiming::Interval(mFirstMissedVsyncTime, aVsyncEvent.mTime),
+        nsPrintfCString("%u vsyncs missed by a pending composite",
+                        mVsyncsMissedForPendingComposite));
+    mVsyncsMissedForPendingComposite = 0;
+  }
+
   if (mCompositeRequestedAt || mAsapScheduling) {
     mCompositeRequestedAt = TimeStamp();
     mLastComposeTime = SampleTime::FromVsync(aVsyncEvent.mTime);
@@ -167,6 +167,10 @@ class CompositorVsyncScheduler {
   wr::RenderReasons mRendersDelayedByVsyncReasons;
   TimeStamp mCompositeRequestedAt;
   int32_t mVsyncNotificationsSkipped;
+  // Number of vsyncs in a row on which the previous composite was still
+  // pending, and the time of the first of them.
+  uint32_t mVsyncsMissedForPendingComposite;
+  TimeStamp mFirstMissedVsyncTime;
   widget::CompositorWidget* mWidget;
   RefPtr<CompositorVsyncScheduler::Observer> mVsyncObserver;
 
@@ -46,6 +46,10 @@ class CacheStats {
   void AddReused() { mReused++; }
   void AddTotal() { mTotal++; }
 
+  size_t Cached() const { return mCached; }
+  size_t Reused() const { return mReused; }
+  size_t Total() const { return mTotal; }
+
  private:
   size_t mCached = 0;
   size_t mReused = 0;
@@ -20,6 +20,7 @@
 #include "mozilla/PerfStats.h"
 #include "nsDisplayList.h"
 #include "nsLayoutUtils.h"
+#include "nsPrintfCString.h"
 #include "WebRenderCanvasRenderer.h"
 #include "LayerUserData.h"
 
@@ -366,6 +367,19 @@ void WebRenderLayerManager::EndTransactionWithoutLayer(
         *mDLBuilder, resourceUpdates, aDisplayList, aDisplayListBuilder,
         mScrollData, std::move(aFilters));
 
+    if (mDisplayItemCache.IsEnabled()) {
+      // Items that were reused are sent as references to the ones WebRender
+      // already has, instead of being serialized again.
+      CacheStats& stats = mDisplayItemCache.Stats();
+      if (profiler_thread_is_being_profiled_for_markers()) {
+        PROFILER_MARKER_TEXT(
+            "DisplayItemCache", GRAPHICS, {},
+            nsPrintfCString("%zu of %zu items reused, %zu newly cached",
+                            stats.Reused(), stats.Total(), stats.Cached()));
+      }
+      stats.Reset();
+    }
+
     aDisplayListBuilder->NotifyAndClearScrollContainerFrames();
 
     builderDumpIndex = mWebRenderCommandBuilder.GetBuilderDumpIndex();
@@ -11,6 +11,7 @@
 #include "mozilla/gfx/2D.h"
 #include "mozilla/gfx/Blur.h"
 #include "mozilla/gfx/PathHelpers.h"
+#include "mozilla/Logging.h"
 #include "mozilla/Maybe.h"
 #include "nsExpirationTracker.h"
 #include "nsClassHashtable.h"
@@ -21,6 +22,8 @@
 using namespace mozilla;
 using namespace mozilla::gfx;
 
+static LazyLogModule sBlurCacheLog("blurcache");
+
 gfxAlphaBoxBlur::~gfxAlphaBoxBlur() = default;
 
 UniquePtr<gfxContext> gfxAlphaBoxBlur::Init(gfxContext* aDestinationCtx,
@@ -303,7 +306,11 @@ struct BlurCacheKey : public PLDHashEntryHdr {
 struct BlurCacheData {
   BlurCacheData(SourceSurface* aBlur, const IntMargin& aBlurMargin,
                 BlurCacheKey&& aKey)
-      : mBlur(aBlur), mBlurMargin(aBlurMargin), mKey(std::move(aKey)) {}
+      : mBlur(aBlur), mBlurMargin(aBlurMargin), mKey(std::move(aKey)) {
+    IntSize size = aBlur->GetSize();
+    mBytes = size_t(size.width) * size.height *
+             BytesPerPixel(aBlur->GetFormat());
+  }
 
   BlurCacheData(BlurCacheData&& aOther) = default;
 
@@ -313,20 +320,30 @@ struct BlurCacheData {
   RefPtr<SourceSurface> mBlur;
   IntMargin mBlurMargin;
   BlurCacheKey mKey;
+  size_t mBytes;
 };
 
 /**
- * This class implements a cache with no maximum size, that retains the
- * SourceSurfaces used to draw the blurs.
+ * This class implements a cache that retains the SourceSurfaces used to draw
+ * the blurs.
  *
- * An entry stays in the cache as long as it is used often.
+ * An entry stays in the cache as long as it is used often, and while the
+ * surfaces of all the entries fit in MAX_BYTES. When a new entry doesn't fit,
+ * the least recently used generations are expired early to make room for it.
  */
 class BlurCache final : public nsExpirationTracker<BlurCacheData, 4> {
  public:
   BlurCache()
       : nsExpirationTracker<BlurCacheData, 4>(GENERATION_MS, "BlurCache") {}
 
+  ~BlurCache() {
+    MOZ_LOG(sBlurCacheLog, LogLevel::Debug,
+            ("BlurCache: %u hits, %u misses", mHits, mMisses));
+  }
+
   virtual void NotifyExpired(BlurCacheData* aObject) override {
+    MOZ_ASSERT(mBytes >= aObject->mBytes);
+    mBytes -= aObject->mBytes;
     RemoveObject(aObject);
     mHashEntries.Remove(aObject->mKey);
   }
@@ -337,6 +354,7 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData, 4> {
                         BackendType aBackendType) {
     BlurCacheData* blur = mHashEntries.Get(BlurCacheKey(
         aMinSize, aBlurRadius, aCornerRadii, aShadowColor, aBackendType));
+    CountLookup(blur);
     if (blur) {
       MarkUsed(blur);
     }
@@ -354,6 +372,7 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData, 4> {
     BlurCacheKey key(aOuterMinSize, aInnerMinSize, aBlurRadius, aCornerRadii,
                      aShadowColor, insetBoxShadow, aBackendType);
     BlurCacheData* blur = mHashEntries.Get(key);
+    CountLookup(blur);
     if (blur) {
       MarkUsed(blur);
     }
@@ -362,6 +381,13 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData, 4> {
   }
 
   void RegisterEntry(UniquePtr<BlurCacheData> aValue) {
+    if (aValue->mBytes > MAX_BYTES) {
+      return;
+    }
+    while (mBytes + aValue->mBytes > MAX_BYTES && !IsEmpty()) {
+      AgeOneGeneration();
+    }
+
     nsresult rv = AddObject(aValue.get());
     if (NS_FAILED(rv)) {
       // We are OOM, and we cannot track this object. We don't want stall
@@ -371,11 +397,31 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData, 4> {
       // anyway, we probably don't want to retain things.
       return;
     }
+    mBytes += aValue->mBytes;
     mHashEntries.InsertOrUpdate(aValue->mKey, std::move(aValue));
   }
 
  protected:
+  void CountLookup(BlurCacheData* aBlur) {
+    if (aBlur) {
+      ++mHits;
+    } else {
+      ++mMisses;
+    }
+    if ((mHits + mMisses) % 1000 == 0) {
+      MOZ_LOG(sBlurCacheLog, LogLevel::Debug,
+              ("BlurCache: %u hits, %u misses, %zu bytes", mHits, mMisses,
+               mBytes));
+    }
+  }
+
   static const uint32_t GENERATION_MS = 1000;
+  // The surfaces are small, since only the corners and one pixel of the edges
+  // of a box shadow are blurred, so this only bounds pathological pages.
+  static const size_t MAX_BYTES = 16 * 1024 * 1024;
+  size_t mBytes = 0;
+  uint32_t mHits = 0;
+  uint32_t mMisses = 0;
   /**
    * FIXME use nsTHashtable to avoid duplicating the BlurCacheKey.
    * https://bugzilla.mozilla.org/show_bug.cgi?id=761393#c47
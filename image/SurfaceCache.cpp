@@ -23,13 +23,17 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/Attributes.h"
 #include "mozilla/CheckedInt.h"
+#include "mozilla/Compression.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Likely.h"
+#include "mozilla/LinkedList.h"
 #include "mozilla/RefPtr.h"
 #include "mozilla/StaticMutex.h"
 #include "mozilla/StaticPrefs_image.h"
 #include "mozilla/StaticPtr.h"
+#include "mozilla/UniquePtrExtensions.h"
 
+#include "nsClassHashtable.h"
 #include "nsExpirationTracker.h"
 #include "nsHashKeys.h"
 #include "nsIMemoryReporter.h"
@@ -45,6 +49,7 @@ using std::min;
 namespace mozilla {
 
 using namespace gfx;
+using namespace Compression;
 
 namespace image {
 
@@ -228,6 +233,79 @@ class CachedSurface {
   bool mIsLocked;
 };
 
+/**
+ * A CompressedSurface holds the LZ4 compressed pixels of a static raster
+ * surface which was evicted from the cache, so that the surface can be brought
+ * back without decoding the image again when it is needed. As far as its image
+ * is concerned, the surface is still cached until the compressed copy is
+ * discarded as well.
+ *
+ * Compressed surfaces are kept in the order they were evicted in, and their
+ * size is counted against the same budget as the surfaces themselves.
+ */
+class CompressedSurface final : public LinkedListElement<CompressedSurface> {
+ public:
+  CompressedSurface(const ImageKey aImageKey, const SurfaceKey& aSurfaceKey,
+                    bool aHasAlpha, UniqueFreePtr<char> aData, size_t aLength,
+                    size_t aUncompressedLength)
+      : mImageKey(aImageKey),
+        mSurfaceKey(aSurfaceKey),
+        mHasAlpha(aHasAlpha),
+        mData(std::move(aData)),
+        mLength(aLength),
+        mUncompressedLength(aUncompressedLength) {}
+
+  ImageKey GetImageKey() const { return mImageKey; }
+  const SurfaceKey& GetSurfaceKey() const { return mSurfaceKey; }
+  Cost GetCost() const { return mLength; }
+
+  /**
+   * Decompresses the pixels into a new imgFrame.
+   *
+   * @return the frame, or nullptr if it could not be allocated.
+   */
+  already_AddRefed<imgFrame> Decompress() const {
+    bool nonPremult =
+        bool(mSurfaceKey.Flags() & SurfaceFlags::NO_PREMULTIPLY_ALPHA);
+    auto frame = MakeRefPtr<imgFrame>();
+    nsresult rv = frame->InitForDecoder(
+        mSurfaceKey.Size(),
+        mHasAlpha ? SurfaceFormat::OS_RGBA : SurfaceFormat::OS_RGBX,
+        nonPremult, Nothing(), /* aShouldRecycle */ false);
+    if (NS_FAILED(rv)) {
+      return nullptr;
+    }
+
+    RawAccessFrameRef frameRef = frame->RawAccessRef();
+    size_t length = 0;
+    if (!frameRef ||
+        !LZ4::decompress(mData.get(), mLength,
+                         reinterpret_cast<char*>(frameRef.Data()),
+                         mUncompressedLength, &length) ||
+        length != mUncompressedLength) {
+      frame->Abort();
+      return nullptr;
+    }
+
+    frame->ImageUpdated(frame->GetRect());
+    frame->Finish(mHasAlpha ? Opacity::SOME_TRANSPARENCY
+                            : Opacity::FULLY_OPAQUE);
+    return frame.forget();
+  }
+
+  size_t SizeOfIncludingThis(MallocSizeOf aMallocSizeOf) const {
+    return aMallocSizeOf(this) + aMallocSizeOf(mData.get());
+  }
+
+ private:
+  const ImageKey mImageKey;
+  const SurfaceKey mSurfaceKey;
+  const bool mHasAlpha;
+  const UniqueFreePtr<char> mData;
+  const size_t mLength;
+  const size_t mUncompressedLength;
+};
+
 static int64_t AreaOfIntSize(const IntSize& aSize) {
   return static_cast<int64_t>(aSize.width) * static_cast<int64_t>(aSize.height);
 }
@@ -776,6 +854,7 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
         mMaxCost(aSurfaceCacheSize),
         mAvailableCost(aSurfaceCacheSize),
         mLockedCost(0),
+        mCompressedCost(0),
         mOverflowCount(0),
         mAlreadyPresentCount(0),
         mTableFailureCount(0),
@@ -801,6 +880,11 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
 
   InsertOutcome Insert(NotNull<ISurfaceProvider*> aProvider, bool aSetAvailable,
                        const StaticMutexAutoLock& aAutoLock) {
+    // A compressed copy of this surface would be older than the one we are
+    // given, drop it. (This also keeps Lookup() below from restoring it.)
+    RemoveCompressed(aProvider->GetImageKey(), aProvider->GetSurfaceKey(),
+                     /* aNotifyImage */ false);
+
     // If this is a duplicate surface, refuse to replace the original.
     // XXX(seth): Calling Lookup() and then RemoveEntry() does the lookup
     // twice. We'll make this more efficient in bug 1185137.
@@ -829,13 +913,17 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
       return InsertOutcome::FAILURE;
     }
 
-    // Remove elements in order of cost until we can fit this in the cache. Note
-    // that locked surfaces aren't in mCosts, so we never remove them here.
+    // Remove elements in order of cost until we can fit this in the cache, and
+    // then the compressed copies of surfaces evicted earlier. Note that locked
+    // surfaces aren't in mCosts, so we never remove them here.
     while (cost > mAvailableCost) {
-      MOZ_ASSERT(!mCosts.IsEmpty(),
-                 "Removed everything and it still won't fit");
-      Remove(mCosts.LastElement().Surface(), /* aStopTracking */ true,
-             aAutoLock);
+      if (mCosts.IsEmpty()) {
+        MOZ_ASSERT(!mCompressedByAge.isEmpty(),
+                   "Removed everything and it still won't fit");
+        RemoveOldestCompressed();
+        continue;
+      }
+      Evict(mCosts.LastElement().Surface(), aAutoLock);
     }
 
     // Locate the appropriate per-image cache. If there's not an existing cache
@@ -913,6 +1001,189 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
     MaybeRemoveEmptyCache(imageKey, cache);
   }
 
+  // Removes a surface which went unused for a while or which needs to make room
+  // for another one, keeping a compressed copy of it if we can. A surface kept
+  // compressed isn't considered discarded by its image, since Lookup() will
+  // decompress it back transparently.
+  void Evict(NotNull<CachedSurface*> aSurface,
+             const StaticMutexAutoLock& aAutoLock) {
+    ImageKey imageKey = aSurface->GetImageKey();
+
+    RefPtr<ImageSurfaceCache> cache = GetImageCache(imageKey);
+    MOZ_ASSERT(cache, "Shouldn't try to evict a surface with no image cache");
+
+    // Stop tracking first, so that the cost of the compressed copy can be
+    // taken out of the cost the surface frees.
+    StopTracking(aSurface, /* aIsTracked */ true, aAutoLock);
+
+    if (!Compress(aSurface) && !aSurface->IsPlaceholder()) {
+      static_cast<Image*>(imageKey)->OnSurfaceDiscarded(
+          aSurface->GetSurfaceKey());
+    }
+
+    // Individual surfaces must be freed outside the lock.
+    mCachedSurfacesDiscard.AppendElement(cache->Remove(aSurface));
+
+    MaybeRemoveEmptyCache(imageKey, cache);
+  }
+
+  // Stores a compressed copy of a static raster surface in the compressed tier.
+  // Returns false if the surface can't be compressed or isn't worth it.
+  bool Compress(NotNull<CachedSurface*> aSurface) {
+    const ImageKey imageKey = aSurface->GetImageKey();
+    const SurfaceKey& surfaceKey = aSurface->GetSurfaceKey();
+    if (!aSurface->IsDecoded() ||
+        surfaceKey.Playback() != PlaybackType::eStatic ||
+        surfaceKey.Region() ||
+        imageKey->GetType() != imgIContainer::TYPE_RASTER) {
+      return false;
+    }
+
+    // Compression happens under the surface cache lock, so we bound how long
+    // it can take. Larger surfaces are just discarded, as before.
+    const Cost maxCompressedCost = mMaxCost / kCompressedCostFraction;
+    Cost cost = aSurface->GetCostEntry().GetCost();
+    if (cost > kMaxCompressibleSurfaceBytes || cost / 2 > maxCompressedCost) {
+      return false;
+    }
+
+    DrawableSurface drawableSurface = aSurface->GetDrawableSurface();
+    if (!drawableSurface) {
+      return false;
+    }
+    RawAccessFrameRef frameRef = drawableSurface->RawAccessRef();
+    if (!frameRef) {
+      return false;
+    }
+
+    uint8_t* data = nullptr;
+    uint32_t length = 0;
+    frameRef->GetImageData(&data, &length);
+    MOZ_ASSERT(data == frameRef.Data());
+
+    UniqueFreePtr<char> compressed(
+        static_cast<char*>(malloc(LZ4::maxCompressedSize(length))));
+    if (!compressed) {
+      return false;
+    }
+    size_t compressedLength = LZ4::compress(reinterpret_cast<char*>(data),
+                                            length, compressed.get());
+    if (compressedLength == 0 || compressedLength > length / 2) {
+      // Among others, photos with noise don't compress well enough to be worth
+      // decompressing rather than decoding again.
+      return false;
+    }
+    if (char* shrunk = static_cast<char*>(
+            realloc(compressed.get(), compressedLength))) {
+      Unused << compressed.release();
+      compressed.reset(shrunk);
+    }
+
+    auto entry = MakeUnique<CompressedSurface>(
+        imageKey, surfaceKey, drawableSurface->FormatHasAlpha(),
+        std::move(compressed), compressedLength, length);
+
+    while (mCompressedCost + entry->GetCost() > maxCompressedCost) {
+      MOZ_ASSERT(!mCompressedByAge.isEmpty());
+      RemoveOldestCompressed();
+    }
+
+    CompressedSurfaceTable* table =
+        mCompressedSurfaces.GetOrInsertNew(imageKey);
+    mCompressedByAge.insertBack(entry.get());
+    mCompressedCost += entry->GetCost();
+    mAvailableCost -= entry->GetCost();
+    table->InsertOrUpdate(surfaceKey, std::move(entry));
+    return true;
+  }
+
+  // Drops the compressed copy of a surface, if we have one.
+  void RemoveCompressed(const ImageKey aImageKey, const SurfaceKey& aSurfaceKey,
+                        bool aNotifyImage) {
+    UniquePtr<CompressedSurface> compressed =
+        TakeCompressed(aImageKey, aSurfaceKey);
+    if (compressed && aNotifyImage) {
+      static_cast<Image*>(aImageKey)->OnSurfaceDiscarded(aSurfaceKey);
+    }
+  }
+
+  void RemoveOldestCompressed() {
+    CompressedSurface* oldest = mCompressedByAge.getFirst();
+    MOZ_ASSERT(oldest);
+    RemoveCompressed(oldest->GetImageKey(), oldest->GetSurfaceKey(),
+                     /* aNotifyImage */ true);
+  }
+
+  void RemoveAllCompressed() {
+    while (!mCompressedByAge.isEmpty()) {
+      RemoveOldestCompressed();
+    }
+  }
+
+  // Drops the compressed surfaces of an image which is going away or whose
+  // surfaces are invalid, without telling it. Returns true if there were any.
+  bool RemoveAllCompressed(const ImageKey aImageKey) {
+    UniquePtr<CompressedSurfaceTable> table;
+    if (!mCompressedSurfaces.Remove(aImageKey, &table)) {
+      return false;
+    }
+    for (const auto& compressed : table->Values()) {
+      compressed->remove();
+      MOZ_ASSERT(mCompressedCost >= compressed->GetCost(),
+                 "Costs don't balance");
+      mCompressedCost -= compressed->GetCost();
+      mAvailableCost += compressed->GetCost();
+    }
+    return true;
+  }
+
+  UniquePtr<CompressedSurface> TakeCompressed(const ImageKey aImageKey,
+                                              const SurfaceKey& aSurfaceKey) {
+    UniquePtr<CompressedSurface> compressed;
+    CompressedSurfaceTable* table = mCompressedSurfaces.Get(aImageKey);
+    if (!table || !table->Remove(aSurfaceKey, &compressed)) {
+      return nullptr;
+    }
+    if (table->IsEmpty()) {
+      mCompressedSurfaces.Remove(aImageKey);
+    }
+
+    compressed->remove();
+    MOZ_ASSERT(mCompressedCost >= compressed->GetCost(), "Costs don't balance");
+    mCompressedCost -= compressed->GetCost();
+    mAvailableCost += compressed->GetCost();
+    return compressed;
+  }
+
+  // If we only have a compressed copy of the requested surface, decompresses it
+  // and puts it back in the cache.
+  void MaybeDecompress(const ImageKey aImageKey, const SurfaceKey& aSurfaceKey,
+                       const StaticMutexAutoLock& aAutoLock) {
+    if (mCompressedSurfaces.IsEmpty()) {
+      return;
+    }
+
+    UniquePtr<CompressedSurface> compressed =
+        TakeCompressed(aImageKey, aSurfaceKey);
+    if (!compressed) {
+      return;
+    }
+
+    RefPtr<imgFrame> frame = compressed->Decompress();
+    if (!frame) {
+      static_cast<Image*>(aImageKey)->OnSurfaceDiscarded(aSurfaceKey);
+      return;
+    }
+
+    NotNull<RefPtr<ISurfaceProvider>> provider =
+        MakeNotNull<SimpleSurfaceProvider*>(aImageKey, aSurfaceKey,
+                                            WrapNotNull(frame));
+    if (Insert(provider, /* aSetAvailable = */ false, aAutoLock) !=
+        InsertOutcome::SUCCESS) {
+      static_cast<Image*>(aImageKey)->OnSurfaceDiscarded(aSurfaceKey);
+    }
+  }
+
   bool StartTracking(NotNull<CachedSurface*> aSurface,
                      const StaticMutexAutoLock& aAutoLock) {
     CostEntry costEntry = aSurface->GetCostEntry();
@@ -974,6 +1245,8 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
 
   LookupResult Lookup(const ImageKey aImageKey, const SurfaceKey& aSurfaceKey,
                       const StaticMutexAutoLock& aAutoLock, bool aMarkUsed) {
+    MaybeDecompress(aImageKey, aSurfaceKey, aAutoLock);
+
     RefPtr<ImageSurfaceCache> cache = GetImageCache(aImageKey);
     if (!cache) {
       // No cached surfaces for this image.
@@ -1013,6 +1286,8 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
                                const SurfaceKey& aSurfaceKey,
                                const StaticMutexAutoLock& aAutoLock,
                                bool aMarkUsed) {
+    MaybeDecompress(aImageKey, aSurfaceKey, aAutoLock);
+
     RefPtr<ImageSurfaceCache> cache = GetImageCache(aImageKey);
     if (!cache) {
       // No cached surfaces for this image.
@@ -1134,7 +1409,9 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
       const ImageKey aImageKey, const StaticMutexAutoLock& aAutoLock) {
     RefPtr<ImageSurfaceCache> cache = GetImageCache(aImageKey);
     if (!cache) {
-      return nullptr;  // No cached surfaces for this image, so nothing to do.
+      // No cached surfaces for this image, but there may be compressed ones.
+      RemoveAllCompressed(aImageKey);
+      return nullptr;
     }
 
     // Discard all of the cached surfaces for this image.
@@ -1150,6 +1427,7 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
     // The per-image cache isn't needed anymore, so remove it as well.
     // This implicitly unlocks the image if it was locked.
     mImageCaches.Remove(aImageKey);
+    RemoveAllCompressed(aImageKey);
 
     // Since we did not actually remove any of the surfaces from the cache
     // itself, only stopped tracking them, we should free it outside the lock.
@@ -1174,9 +1452,12 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
 
   bool InvalidateImage(const ImageKey aImageKey,
                        const StaticMutexAutoLock& aAutoLock) {
+    // Compressed surfaces hold the pixels from before the invalidation.
+    bool hadCompressed = RemoveAllCompressed(aImageKey);
+
     RefPtr<ImageSurfaceCache> cache = GetImageCache(aImageKey);
     if (!cache) {
-      return false;  // No cached surfaces for this image, so nothing to do.
+      return hadCompressed;  // No cached surfaces for this image.
     }
 
     bool rv = cache->Invalidate(
@@ -1187,7 +1468,7 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
         });
 
     MaybeRemoveEmptyCache(aImageKey, cache);
-    return rv;
+    return rv || hadCompressed;
   }
 
   void DiscardAll(const StaticMutexAutoLock& aAutoLock) {
@@ -1198,9 +1479,13 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
       Remove(mCosts.LastElement().Surface(), /* aStopTracking */ true,
              aAutoLock);
     }
+    RemoveAllCompressed();
   }
 
   void DiscardForMemoryPressure(const StaticMutexAutoLock& aAutoLock) {
+    // Compressed surfaces are the coldest ones, so they go first.
+    RemoveAllCompressed();
+
     // Compute our discardable cost. Since locked surfaces aren't discardable,
     // we exclude them.
     const Cost discardableCost = (mMaxCost - mAvailableCost) - mLockedCost;
@@ -1271,6 +1556,18 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
     for (const auto& data : mImageCaches.Values()) {
       bytes += data->ShallowSizeOfIncludingThis(aMallocSizeOf);
     }
+    bytes += mCompressedSurfaces.ShallowSizeOfExcludingThis(aMallocSizeOf);
+    for (const auto& table : mCompressedSurfaces.Values()) {
+      bytes += table->ShallowSizeOfIncludingThis(aMallocSizeOf);
+    }
+    return bytes;
+  }
+
+  size_t SizeOfCompressedSurfaces(MallocSizeOf aMallocSizeOf) const {
+    size_t bytes = 0;
+    for (const CompressedSurface* compressed : mCompressedByAge) {
+      bytes += compressed->SizeOfIncludingThis(aMallocSizeOf);
+    }
     return bytes;
   }
 
@@ -1303,6 +1600,16 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
       ShallowSizeOfIncludingThis(SurfaceCacheMallocSizeOf, lock),
 "Memory used by the surface cache data structures, excluding surface data.");
 
+    MOZ_COLLECT_REPORT(
+      "explicit/images/cache/compressed-surfaces", KIND_HEAP, UNITS_BYTES,
+      SizeOfCompressedSurfaces(SurfaceCacheMallocSizeOf),
+"Memory used by compressed copies of surfaces evicted from the surface cache.");
+
+    MOZ_COLLECT_REPORT(
+      "imagelib-surface-cache-estimated-compressed",
+      KIND_OTHER, UNITS_BYTES, mCompressedCost,
+"Estimated memory used by compressed surfaces in the imagelib surface cache.");
+
     MOZ_COLLECT_REPORT(
       "imagelib-surface-cache-estimated-total",
       KIND_OTHER, UNITS_BYTES, (mMaxCost - mAvailableCost),
@@ -1521,8 +1828,7 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
    protected:
     void NotifyExpiredLocked(CachedSurface* aSurface,
                              const StaticMutexAutoLock& aAutoLock) override {
-      sInstance->Remove(WrapNotNull(aSurface), /* aStopTracking */ true,
-                        aAutoLock);
+      sInstance->Evict(WrapNotNull(aSurface), aAutoLock);
     }
 
     void NotifyHandlerEndLocked(const StaticMutexAutoLock& aAutoLock) override {
@@ -1559,8 +1865,22 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
     virtual ~MemoryPressureObserver() {}
   };
 
+  // The compressed tier may take up to this fraction of the cache's budget.
+  static const Cost kCompressedCostFraction = 4;
+  // Surfaces larger than this aren't compressed when evicted.
+  static const Cost kMaxCompressibleSurfaceBytes = 8 * 1024 * 1024;
+
+  typedef nsClassHashtable<nsGenericHashKey<SurfaceKey>, CompressedSurface>
+      CompressedSurfaceTable;
+
   nsTArray<CostEntry> mCosts;
   nsRefPtrHashtable<nsPtrHashKey<Image>, ImageSurfaceCache> mImageCaches;
+  // All compressed surfaces, from the least recently evicted one. Declared
+  // before mCompressedSurfaces, which owns them and unlinks them when
+  // destroyed.
+  LinkedList<CompressedSurface> mCompressedByAge;
+  nsClassHashtable<nsPtrHashKey<Image>, CompressedSurfaceTable>
+      mCompressedSurfaces;
   nsTArray<RefPtr<CachedSurface>> mCachedSurfacesDiscard;
   SurfaceTracker mExpirationTracker;
   RefPtr<MemoryPressureObserver> mMemoryPressureObserver;
@@ -1569,6 +1889,7 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
   const Cost mMaxCost;
   Cost mAvailableCost;
   Cost mLockedCost;
+  Cost mCompressedCost;
   size_t mOverflowCount;
   size_t mAlreadyPresentCount;
   size_t mTableFailureCount;
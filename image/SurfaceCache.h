@@ -184,7 +184,9 @@ enum class InsertOutcome : uint8_t {
  * image surfaces, temporary surfaces (e.g. for caching rotated or clipped
  * versions of images), or dynamically generated surfaces (e.g. for animations).
  * SurfaceCache entries normally expire from the cache automatically if they go
- * too long without being accessed.
+ * too long without being accessed. Expired or evicted static raster surfaces
+ * may be kept LZ4 compressed for a while, within the same budget, and are
+ * decompressed back into the cache by Lookup() and LookupBestMatch().
  *
  * Because SurfaceCache must support both normal surfaces and dynamically
  * generated surfaces, it does not actually hold surfaces directly. Instead, it
@@ -76,6 +76,13 @@ class Collator final {
   int32_t CompareStrings(Span<const char16_t> aSource,
                          Span<const char16_t> aTarget) const;
 
+  /**
+   * Compare two UTF-8 strings. This lets callers holding ASCII or UTF-8 data
+   * skip inflating it to UTF-16 first.
+   */
+  int32_t CompareStrings(Span<const char> aSource,
+                         Span<const char> aTarget) const;
+
   int32_t CompareSortKeys(Span<const uint8_t> aKey1,
                           Span<const uint8_t> aKey2) const;
 
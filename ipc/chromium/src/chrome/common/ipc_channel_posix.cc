@@ -620,6 +620,41 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
     MOZ_ASSERT(amt_to_write > 0);
 
     const bool intentional_short_write = !iter.Done();
+
+    // If the rest of this message fits, append the messages queued after it
+    // to the same sendmsg call, so that a backlog of small messages is flushed
+    // with one syscall rather than one per message. Messages with attachments
+    // are left for a later call, as their handles must go with their data.
+    const size_t first_amt_to_write = amt_to_write;
+    if (!intentional_short_write && num_fds == 0) {
+      const size_t queued = output_queue_.Count();
+      for (size_t i = 1; i < queued && iov_count < kMaxIOVecSize &&
+                         PipeBufHasSpaceAfter(amt_to_write);
+           ++i) {
+        Message* next = output_queue_.ElementAt(i).get();
+        if (!next->attached_handles_.IsEmpty()) {
+          break;
+        }
+#if defined(XP_DARWIN)
+        if (next->num_send_rights() != 0) {
+          break;
+        }
+#endif
+        next->header()->num_handles = 0;
+
+        Pickle::BufferList::IterImpl next_iter(next->Buffers());
+        while (!next_iter.Done() && iov_count < kMaxIOVecSize &&
+               PipeBufHasSpaceAfter(amt_to_write)) {
+          size_t size = next_iter.RemainingInSegment();
+          iov[iov_count].iov_base = next_iter.Data();
+          iov[iov_count].iov_len = size;
+          iov_count++;
+          amt_to_write += size;
+          next_iter.Advance(next->Buffers(), size);
+        }
+      }
+    }
+
     msgh.msg_iov = iov;
     msgh.msg_iovlen = iov_count;
 
@@ -667,13 +702,23 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
       }
     }
 
+    // Bytes written past the end of this message belong to the messages
+    // batched after it, which are accounted for once this one is done.
+    size_t batched_bytes_written = 0;
+    if (bytes_written > 0 &&
+        static_cast<size_t>(bytes_written) > first_amt_to_write) {
+      batched_bytes_written =
+          static_cast<size_t>(bytes_written) - first_amt_to_write;
+      bytes_written = static_cast<ssize_t>(first_amt_to_write);
+    }
+
     if (intentional_short_write ||
-        static_cast<size_t>(bytes_written) != amt_to_write) {
+        static_cast<size_t>(bytes_written) != first_amt_to_write) {
       // If write() fails with EAGAIN or EMSGSIZE then bytes_written will be -1.
       if (bytes_written > 0) {
         MOZ_DIAGNOSTIC_ASSERT(intentional_short_write ||
                               static_cast<size_t>(bytes_written) <
-                                  amt_to_write);
+                                  first_amt_to_write);
         partial_write_->iter_.AdvanceAcrossSegments(msg->Buffers(),
                                                     bytes_written);
         partial_write_->handles_ = handles.From(num_fds);
@@ -726,6 +771,27 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
       OutputQueuePop();
       // msg has been destroyed, so clear the dangling reference.
       msg = nullptr;
+
+      while (batched_bytes_written > 0) {
+        Message* next = output_queue_.FirstElement().get();
+        AddIPCProfilerMarker(*next, other_pid_, MessageDirection::eSending,
+                             MessagePhase::TransferStart);
+        const size_t next_size = next->Buffers().Size();
+        if (batched_bytes_written < next_size) {
+          // Only the start of this message went out, the next iteration
+          // continues it.
+          Pickle::BufferList::IterImpl next_iter(next->Buffers());
+          next_iter.AdvanceAcrossSegments(next->Buffers(),
+                                          batched_bytes_written);
+          partial_write_.emplace(
+              PartialWrite{next_iter, next->attached_handles_});
+          break;
+        }
+        AddIPCProfilerMarker(*next, other_pid_, MessageDirection::eSending,
+                             MessagePhase::TransferEnd);
+        batched_bytes_written -= next_size;
+        OutputQueuePop();
+      }
     }
   }
   return true;
@@ -95,6 +95,17 @@ MessageBufferReader::~MessageBufferReader() {
   }
 }
 
+bool MessageBufferReader::HasRemainingBytes() {
+  if (remaining_ == 0) {
+    return false;
+  }
+  // The shared memory region was mapped with the full length.
+  if (buffer_) {
+    return true;
+  }
+  return reader_->HasBytesAvailable(remaining_);
+}
+
 bool MessageBufferReader::ReadBytesInto(void* data, uint32_t len) {
   MOZ_RELEASE_ASSERT(len == remaining_ || (len % 4) == 0,
                      "all reads except for the final read must be a multiple "
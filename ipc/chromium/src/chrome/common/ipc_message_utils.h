@@ -548,6 +548,12 @@ class MOZ_STACK_CLASS MessageBufferReader {
   // integration between `MessageBufferReader` and `Pickle`.
   [[nodiscard]] bool ReadBytesInto(void* data, uint32_t len);
 
+  // Whether the bytes left to read are known to be present, either in the
+  // mapped shared memory region or in the message itself. This lets callers
+  // size their buffers from `full_len` without trusting the sender. Returns
+  // false if nothing is left to read, including after a failed construction.
+  bool HasRemainingBytes();
+
  private:
   MessageReader* reader_;
   RefPtr<mozilla::ipc::SharedMemory> shmem_;
@@ -56,6 +56,14 @@ ForkServer::ForkServer(int* aArgc, char*** aArgv) : mArgc(aArgc), mArgv(aArgv) {
  * and which might change incompatibly or become unavailable by the
  * time they're started.  For example: the omnijar files, or certain
  * shared libraries.
+ *
+ * The fork server is single threaded and runs before XPCOM is initialized,
+ * which is what makes fork() safe here: only the calling thread survives in
+ * the child, so anything that starts threads or holds locks (the JS engine
+ * and its helper threads, the style system, font list loaders) cannot be
+ * warmed up before forking.  Content processes get those from the parent
+ * through shared memory instead, e.g. the shared UA style sheets and the
+ * startup cache.
  */
 static void ForkServerPreload(int& aArgc, char** aArgv) {
   Omnijar::ChildProcessInit(aArgc, aArgv);
@@ -1044,7 +1044,9 @@ void MessageChannel::OnMessageReceivedFromLink(UniquePtr<Message> aMsg) {
   // blocked. This is okay, since we always check for pending events before
   // blocking again.
 
-  RefPtr<MessageTask> task = new MessageTask(this, std::move(aMsg));
+  RefPtr<MessageTask> task = new MessageTask(
+      this, std::move(aMsg),
+      profiler_is_active() ? TimeStamp::Now() : TimeStamp());
   mPending.insertBack(task);
 
   if (!alwaysDeferred) {
@@ -1441,7 +1443,19 @@ void MessageChannel::RunMessage(ActorLifecycleProxy* aProxy,
     mMaybeDeferredPendingCount--;
   }
 
+  // Covers both the time the message waited in the queue and the time its
+  // handler ran, which is what the receiving side adds to the latency of
+  // the message.
+  const TimeStamp receivedTime = aTask.ReceivedTime();
+  const char* name = msg->name();
+
   DispatchMessage(aProxy, std::move(msg));
+
+  if (!receivedTime.IsNull()) {
+    PROFILER_MARKER_TEXT("IPC handler", IPC,
+                         MarkerTiming::IntervalUntilNowFrom(receivedTime),
+                         nsDependentCString(name));
+  }
 }
 
 NS_IMPL_ISUPPORTS_INHERITED(MessageChannel::MessageTask, CancelableRunnable,
@@ -1466,12 +1480,14 @@ static uint32_t ToRunnablePriority(IPC::Message::PriorityValue aPriority) {
 }
 
 MessageChannel::MessageTask::MessageTask(MessageChannel* aChannel,
-                                         UniquePtr<Message> aMessage)
+                                         UniquePtr<Message> aMessage,
+                                         TimeStamp aReceivedTime)
     : CancelableRunnable(aMessage->name()),
       mMonitor(aChannel->mMonitor),
       mChannel(aChannel),
       mMessage(std::move(aMessage)),
       mPriority(ToRunnablePriority(mMessage->priority())),
+      mReceivedTime(aReceivedTime),
       mScheduled(false)
 #ifdef FUZZING_SNAPSHOT
       ,
@@ -2222,7 +2238,8 @@ void MessageChannel::RepostAllMessages() {
   MessageQueue queue = std::move(mPending);
   while (RefPtr<MessageTask> task = queue.popFirst()) {
     task->AssertMonitorHeld(*mMonitor);
-    RefPtr<MessageTask> newTask = new MessageTask(this, std::move(task->Msg()));
+    RefPtr<MessageTask> newTask =
+        new MessageTask(this, std::move(task->Msg()), task->ReceivedTime());
     newTask->AssertMonitorHeld(*mMonitor);
     mPending.insertBack(newTask);
     newTask->Post();
@@ -13,6 +13,7 @@
 #include "mozilla/BaseProfilerMarkers.h"
 #include "mozilla/LinkedList.h"
 #include "mozilla/Monitor.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Vector.h"
 #if defined(XP_WIN)
 #  include "mozilla/ipc/Neutering.h"
@@ -453,7 +454,8 @@ class MessageChannel : HasResultCodes {
                       public nsIRunnablePriority,
                       public nsIRunnableIPCMessageType {
    public:
-    explicit MessageTask(MessageChannel* aChannel, UniquePtr<Message> aMessage);
+    MessageTask(MessageChannel* aChannel, UniquePtr<Message> aMessage,
+                TimeStamp aReceivedTime);
     MessageTask() = delete;
     MessageTask(const MessageTask&) = delete;
 
@@ -479,6 +481,10 @@ class MessageChannel : HasResultCodes {
       return mMessage;
     }
 
+    // When the message arrived from the link, only recorded while the
+    // profiler is active.
+    const TimeStamp& ReceivedTime() const { return mReceivedTime; }
+
     void AssertMonitorHeld(const RefCountedMonitor& aMonitor)
         MOZ_REQUIRES(aMonitor) MOZ_ASSERT_CAPABILITY(*mMonitor) {
       aMonitor.AssertSameMonitor(*mMonitor);
@@ -501,6 +507,7 @@ class MessageChannel : HasResultCodes {
     MessageChannel* const mChannel;
     UniquePtr<Message> mMessage MOZ_GUARDED_BY(*mMonitor);
     uint32_t const mPriority;
+    TimeStamp const mReceivedTime;
     bool mScheduled : 1 MOZ_GUARDED_BY(*mMonitor);
 #ifdef FUZZING_SNAPSHOT
     const bool mIsFuzzMsg;
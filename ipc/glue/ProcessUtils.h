@@ -82,6 +82,18 @@ void ExportSharedJSInit(GeckoChildProcessHost& procHost,
 // JS::Runtime.
 bool ImportSharedJSInit(SharedMemoryHandle aJsInitHandle, uint64_t aJsInitLen);
 
+// Generate command line argument to give a content process of |aRemoteType|
+// the encoded stencils shared by other processes of the same remote type. If
+// there are none, this would be a no-op.
+void ExportSharedStencils(GeckoChildProcessHost& procHost,
+                          const nsACString& aRemoteType,
+                          geckoargs::ChildProcessArgs& aExtraOpts);
+
+// Map the encoded stencils shared by the parent process, used by the script
+// loader to decode scripts instead of compiling them.
+bool ImportSharedStencils(SharedMemoryHandle aJsStencilsHandle,
+                          uint64_t aJsStencilsLen);
+
 }  // namespace ipc
 }  // namespace mozilla
 
@@ -15,6 +15,7 @@
 #include "nsPrintfCString.h"
 
 #include "XPCSelfHostedShmem.h"
+#include "XPCSharedStencilShmem.h"
 
 namespace mozilla {
 namespace ipc {
@@ -179,5 +180,48 @@ bool ImportSharedJSInit(SharedMemoryHandle aJsInitHandle, uint64_t aJsInitLen) {
   return true;
 }
 
+void ExportSharedStencils(mozilla::ipc::GeckoChildProcessHost& procHost,
+                          const nsACString& aRemoteType,
+                          geckoargs::ChildProcessArgs& aExtraOpts) {
+#if defined(ANDROID) || defined(XP_IOS)
+  return;
+#else
+  // Preallocated processes do not have a site yet, and these stencils are
+  // only shared with processes of the remote type which produced them.
+  if (!xpc::SharedStencilShmem::IsEnabledForRemoteType(aRemoteType)) {
+    return;
+  }
+
+  SharedMemoryHandle handle;
+  size_t len = 0;
+  auto& shmem = xpc::SharedStencilShmem::GetSingleton();
+  if (!shmem.CloneSnapshotHandle(aRemoteType, &handle, &len)) {
+    return;
+  }
+
+  // command line: -jsStencilsHandle handle -jsStencilsLen length
+  geckoargs::sJsStencilsHandle.Put(std::move(handle), aExtraOpts);
+  geckoargs::sJsStencilsLen.Put((uintptr_t)(len), aExtraOpts);
+#endif
+}
+
+bool ImportSharedStencils(SharedMemoryHandle aJsStencilsHandle,
+                          uint64_t aJsStencilsLen) {
+  // As for ImportSharedJSInit, this is an optimization, and the content
+  // process compiles the scripts if the arguments are not provided.
+  if (!aJsStencilsLen || !aJsStencilsHandle) {
+    return true;
+  }
+
+  size_t len = (uintptr_t)(aJsStencilsLen);
+  auto& shmem = xpc::SharedStencilShmem::GetSingleton();
+  if (!shmem.InitFromChild(std::move(aJsStencilsHandle), len)) {
+    NS_WARNING("failed to open the shared stencils in the child");
+    return false;
+  }
+
+  return true;
+}
+
 }  // namespace ipc
 }  // namespace mozilla
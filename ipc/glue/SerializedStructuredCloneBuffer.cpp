@@ -6,6 +6,7 @@
 
 #include "mozilla/ipc/SerializedStructuredCloneBuffer.h"
 #include "js/StructuredClone.h"
+#include "mozilla/Unused.h"
 
 namespace IPC {
 
@@ -51,8 +52,19 @@ bool ParamTraits<JSStructuredCloneData>::Read(MessageReader* aReader,
   // can be revisited in the future if it turns out to be a noticable
   // performance regression. (bug 1783242)
 
-  mozilla::BufferList<js::SystemAllocPolicy> buffers(0, 0, 4096);
+  using BufferList = mozilla::BufferList<js::SystemAllocPolicy>;
+  BufferList buffers(0, 0, 4096);
   MessageBufferReader bufReader(aReader, length);
+  // Large clones arrive through shared memory; reading them into a single
+  // segment avoids an allocation and a copy call for every 4k of data. The
+  // length comes from the sender, so only preallocate once the reader has
+  // checked that the data is really there. If that allocation fails, fall
+  // back to standard sized segments below.
+  if (length > 4096 && bufReader.HasRemainingBytes()) {
+    size_t capacity = (size_t(length) + BufferList::kSegmentAlignment - 1) &
+                      ~(BufferList::kSegmentAlignment - 1);
+    mozilla::Unused << buffers.Init(0, capacity);
+  }
   uint32_t read = 0;
   while (read < length) {
     size_t bufLen;
@@ -915,16 +915,15 @@ void ModuleLoaderBase::StartFetchingModuleDependencies(
   }
 
   // Remove already visited requested modules from the list. Put unvisited
-  // requested modules into the visited set.
-  size_t i = 0;
-  while (i < requestedModules.Length()) {
-    if (visitedSet->Contains(requestedModules[i])) {
-      requestedModules.RemoveElementAt(i);
-    } else {
-      visitedSet->PutEntry(requestedModules[i]);
-      i++;
+  // requested modules into the visited set. This is done in a single pass, as
+  // modules can have many imports.
+  requestedModules.RemoveElementsBy([&](const ModuleMapKey& aKey) {
+    if (visitedSet->Contains(aKey)) {
+      return true;
     }
-  }
+    visitedSet->PutEntry(aKey);
+    return false;
+  });
 
   if (requestedModules.Length() == 0) {
     // There are no descendants to load so this request is ready.
@@ -79,6 +79,9 @@ enum class AsmJSOption : uint8_t {
   DisabledByDebugger,
 };
 
+// The values of these options are used by the
+// dom.script_loader.delazification.strategy pref, so new options must be
+// added at the end.
 #define FOREACH_DELAZIFICATION_STRATEGY(_)                                     \
   /* Do not delazify anything eagerly. */                                      \
   _(OnDemandOnly)                                                              \
@@ -107,7 +110,14 @@ enum class AsmJSOption : uint8_t {
    * may disallow syntax-parse altogether. These conditions are checked in the \
    * CompileOptions constructor.                                               \
    */                                                                          \
-  _(ParseEverythingEagerly)
+  _(ParseEverythingEagerly)                                                    \
+                                                                               \
+  /*                                                                           \
+   * Delazify functions on multiple helper threads. The functions of the       \
+   * top-level script are divided between the threads, which each delazify     \
+   * their share in a depth first traversal.                                   \
+   */                                                                          \
+  _(ConcurrentParallel)
 
 enum class DelazificationOption : uint8_t {
 #define _ENUM_ENTRY(Name) Name,
@@ -359,13 +369,15 @@ class JS_PUBLIC_API TransitiveCompileOptions {
   bool consumeDelazificationCache() const {
     return eagerDelazificationIsOneOf<
         DelazificationOption::ConcurrentDepthFirst,
-        DelazificationOption::ConcurrentLargeFirst>();
+        DelazificationOption::ConcurrentLargeFirst,
+        DelazificationOption::ConcurrentParallel>();
   }
   bool populateDelazificationCache() const {
     return eagerDelazificationIsOneOf<
         DelazificationOption::CheckConcurrentWithOnDemand,
         DelazificationOption::ConcurrentDepthFirst,
-        DelazificationOption::ConcurrentLargeFirst>();
+        DelazificationOption::ConcurrentLargeFirst,
+        DelazificationOption::ConcurrentParallel>();
   }
   bool waitForDelazificationCache() const {
     return eagerDelazificationIsOneOf<
@@ -1358,6 +1358,40 @@ inline JS_PUBLIC_API bool NeedGrayRootsForZone(Zone* zoneArg) {
 extern JS_PUBLIC_API bool AtomsZoneIsCollecting(JSRuntime* runtime);
 extern JS_PUBLIC_API bool IsAtomsZone(Zone* zone);
 
+/**
+ * Summary of the tenured heap for one zone and one alloc kind, as reported by
+ * JS::CollectHeapCensus.
+ */
+struct HeapCensusKindInfo {
+  // Arenas are counted in |occupancyHistogram| by the fraction of their cells
+  // that are in use. Bin i counts arenas with occupancy in the range
+  // [i / OccupancyBins, (i + 1) / OccupancyBins), except that full arenas are
+  // counted in the last bin.
+  static constexpr size_t OccupancyBins = 8;
+
+  size_t thingSize = 0;
+  size_t arenaCount = 0;
+  size_t cellCount = 0;
+  size_t freeCellCount = 0;
+  size_t occupancyHistogram[OccupancyBins] = {};
+
+  size_t usedCellCount() const { return cellCount - freeCellCount; }
+};
+
+using HeapCensusCallback = void (*)(void* data, Zone* zone,
+                                    const char* allocKindName,
+                                    const HeapCensusKindInfo& info);
+
+/**
+ * Report the arena count, free cell count and arena occupancy histogram for
+ * every alloc kind with at least one arena in every zone. This finishes any
+ * ongoing incremental GC but does not iterate individual cells, so it is much
+ * cheaper than JS::CollectRuntimeStats.
+ */
+extern JS_PUBLIC_API void CollectHeapCensus(JSContext* cx,
+                                            HeapCensusCallback callback,
+                                            void* data);
+
 }  // namespace JS
 
 namespace js {
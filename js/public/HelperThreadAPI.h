@@ -12,9 +12,13 @@
 #ifndef js_HelperThreadAPI_h
 #define js_HelperThreadAPI_h
 
+#include "mozilla/TimeStamp.h"  // mozilla::TimeDuration
+
 #include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t
 
-#include "jstypes.h"  // JS_PUBLIC_API
+#include "jstypes.h"     // JS_PUBLIC_API
+#include "js/Utility.h"  // js::ThreadType
 
 namespace JS {
 
@@ -36,6 +40,39 @@ extern JS_PUBLIC_API void RunHelperThreadTask(HelperThreadTask* task);
 extern JS_PUBLIC_API const char* GetHelperThreadTaskName(
     HelperThreadTask* task);
 
+/**
+ * Priority of a helper thread task. The external thread pool can use it to
+ * order the tasks it runs, including against its own tasks.
+ */
+enum class HelperThreadTaskPriority : uint8_t {
+  // Work the main thread may be blocked on, such as parallel GC tasks.
+  High,
+
+  // Compilation of code which is being run.
+  Normal,
+
+  // Work which only improves later performance or memory usage, such as
+  // tier-2 wasm compilation, source compression or freeing memory.
+  Background
+};
+
+// Function to get the priority of the helper thread task.
+extern JS_PUBLIC_API HelperThreadTaskPriority
+GetHelperThreadTaskPriority(HelperThreadTask* task);
+
+/**
+ * Time the helper thread tasks of a given type waited between being dispatched
+ * to the thread pool and starting to run.
+ */
+struct HelperThreadTaskWaitTimes {
+  size_t count = 0;
+  mozilla::TimeDuration total;
+  mozilla::TimeDuration max;
+};
+
+extern JS_PUBLIC_API HelperThreadTaskWaitTimes
+GetHelperThreadTaskWaitTimes(js::ThreadType threadType);
+
 }  // namespace JS
 
 #endif  // js_HelperThreadAPI_h
@@ -8,6 +8,8 @@
 #ifndef js_JitCodeAPI_h
 #define js_JitCodeAPI_h
 
+#include "jstypes.h"
+
 #include "js/AllocPolicy.h"
 #include "js/ColumnNumber.h"  // JS::LimitedColumnNumberOneOrigin
 #include "js/Initialization.h"
@@ -92,6 +94,14 @@ class JitCodeIterator {
   size_t iteratorIndex = 0;
 };
 
+// Toggle writing a perf map file (/tmp/perf-<pid>.map) for JIT code, so perf
+// can symbolize JIT frames. This is cheap enough to leave enabled in
+// production. Code compiled while the map is disabled is not recorded.
+//
+// Returns false if perf maps aren't supported on this platform, the map file
+// couldn't be created, or a jitdump mode was selected with IONPERF.
+extern JS_PUBLIC_API bool SetJitPerfMapEnabled(bool enabled);
+
 }  // namespace JS
 
 #endif /* js_JitCodeAPI_h */
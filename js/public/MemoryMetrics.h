@@ -188,6 +188,7 @@ struct ClassInfo {
   MACRO(Objects, MallocHeap, objectsMallocHeapElementsAsmJS)     \
   MACRO(Objects, MallocHeap, objectsMallocHeapGlobalData)        \
   MACRO(Objects, MallocHeap, objectsMallocHeapGlobalVarNamesSet) \
+  MACRO(Objects, MallocHeap, objectsMallocHeapMapSetData)        \
   MACRO(Objects, MallocHeap, objectsMallocHeapMisc)              \
   MACRO(Objects, NonHeap, objectsNonHeapElementsNormal)          \
   MACRO(Objects, NonHeap, objectsNonHeapElementsShared)          \
@@ -504,6 +505,8 @@ struct RuntimeSizes {
   MACRO(_, MallocHeap, sharedImmutableStringsCache) \
   MACRO(_, MallocHeap, sharedIntlData)              \
   MACRO(_, MallocHeap, uncompressedSourceCache)     \
+  MACRO(_, MallocHeap, regExpBytecodeCache)         \
+  MACRO(_, MallocHeap, arrayBufferContentsPool)     \
   MACRO(_, MallocHeap, scriptData)                  \
   MACRO(_, MallocHeap, wasmRuntime)                 \
   MACRO(_, Ignore, wasmGuardPages)                  \
@@ -526,6 +529,10 @@ struct RuntimeSizes {
   ScriptSourceInfo scriptSourceInfo;
   GCSizes gc;
 
+  // Counts of string searches in ropes, see JSRuntime.
+  uint64_t ropeSearchesWithoutFlattening = 0;
+  uint64_t ropeSearchesFlattened = 0;
+
   typedef js::HashMap<const char*, ScriptSourceInfo, mozilla::CStringHasher,
                       js::SystemAllocPolicy>
       ScriptSourcesHashMap;
@@ -638,6 +645,7 @@ struct ZoneStats {
   MACRO(Other, GCHeapUsed, dictPropMapsGCHeap)             \
   MACRO(Other, MallocHeap, propMapChildren)                \
   MACRO(Other, MallocHeap, propMapTables)                  \
+  MACRO(Other, MallocHeap, dictPropMapTables)              \
   MACRO(Other, GCHeapUsed, scopesGCHeap)                   \
   MACRO(Other, MallocHeap, scopesMallocHeap)               \
   MACRO(Other, GCHeapUsed, regExpSharedsGCHeap)            \
@@ -7,9 +7,11 @@
 #ifndef js_UbiNodeBreadthFirst_h
 #define js_UbiNodeBreadthFirst_h
 
+#include "mozilla/Assertions.h"
+
 #include "js/HashTable.h"
 #include "js/UbiNode.h"
-#include "js/Vector.h"
+#include "js/Utility.h"
 
 namespace JS {
 namespace ubi {
@@ -218,31 +220,75 @@ struct BreadthFirst {
   Handler& handler;
 
   // A queue template. Appending and popping the front are constant time.
-  // Wasted space is never more than some recent actual population plus the
-  // current population.
+  //
+  // Elements are stored in fixed-size segments, which are freed as soon as
+  // all their elements are popped. The wasted space is thus never more than a
+  // segment at each end, however large the frontier of the traversal grows.
   template <typename T>
   class Queue {
-    js::Vector<T, 0, js::SystemAllocPolicy> head, tail;
+    static constexpr size_t SegmentLength = 1024;
+
+    struct Segment {
+      Segment* next = nullptr;
+      size_t length = 0;
+      T elements[SegmentLength];
+    };
+
+    // Segments are linked from |front_| to |back_|. Elements before
+    // |frontIndex| in the front segment have been popped.
+    Segment* front_;
+    Segment* back_;
     size_t frontIndex;
 
    public:
-    Queue() : head(), tail(), frontIndex(0) {}
-    bool empty() { return frontIndex >= head.length(); }
+    Queue() : front_(nullptr), back_(nullptr), frontIndex(0) {}
+    ~Queue() {
+      while (front_) {
+        Segment* next = front_->next;
+        js_delete(front_);
+        front_ = next;
+      }
+    }
+
+    Queue(const Queue&) = delete;
+    Queue& operator=(const Queue&) = delete;
+
+    bool empty() { return !front_ || frontIndex >= front_->length; }
     T& front() {
       MOZ_ASSERT(!empty());
-      return head[frontIndex];
+      return front_->elements[frontIndex];
     }
     void popFront() {
       MOZ_ASSERT(!empty());
       frontIndex++;
-      if (frontIndex >= head.length()) {
-        head.clearAndFree();
-        head.swap(tail);
-        frontIndex = 0;
+      if (frontIndex < front_->length) {
+        return;
       }
+      frontIndex = 0;
+      if (front_ == back_) {
+        // Reuse the last segment rather than freeing it.
+        front_->length = 0;
+        return;
+      }
+      Segment* next = front_->next;
+      js_delete(front_);
+      front_ = next;
     }
     bool append(const T& elt) {
-      return frontIndex == 0 ? head.append(elt) : tail.append(elt);
+      if (!back_ || back_->length == SegmentLength) {
+        Segment* segment = js_new<Segment>();
+        if (!segment) {
+          return false;
+        }
+        if (back_) {
+          back_->next = segment;
+        } else {
+          front_ = segment;
+        }
+        back_ = segment;
+      }
+      back_->elements[back_->length++] = elt;
+      return true;
     }
   };
 
@@ -23,6 +23,7 @@
 #include "builtin/RawJSONObject.h"
 #include "js/friend/ErrorMessages.h"  // js::GetErrorMessage, JSMSG_*
 #include "js/friend/StackLimits.h"    // js::AutoCheckRecursionLimit
+#include "js/HashTable.h"             // js::HashMap
 #include "js/Object.h"                // JS::GetBuiltinClass
 #include "js/Prefs.h"                 // JS::Prefs
 #include "js/ProfilingCategory.h"
@@ -1089,6 +1090,106 @@ class OwnNonIndexKeysIterForJSON {
   }
 };
 
+// Serialization plans for the named properties of the objects seen by
+// FastSerializeJSONProperty, keyed by shape. A plan lists the slots of the
+// properties to serialize in order, along with their keys already quoted and
+// followed by ':', such that objects sharing a shape are serialized by copying
+// the keys instead of iterating over the shape and quoting each key again.
+//
+// Plans live for a single call of FastSerializeJSONProperty, during which
+// nothing can GC nor run any script, so shapes can neither move nor change.
+class JSONShapePlans {
+ public:
+  struct Property {
+    uint32_t slot;
+    uint32_t keyStart;
+    uint32_t keyLength;
+  };
+
+  // Range of properties in |properties_|.
+  struct Plan {
+    uint32_t begin;
+    uint32_t end;
+  };
+
+ private:
+  HashMap<Shape*, Plan> plans_;
+  Vector<Property> properties_;
+  StringBuilder keys_;
+
+ public:
+  explicit JSONShapePlans(JSContext* cx)
+      : plans_(cx), properties_(cx), keys_(cx) {}
+
+  // Lookup or build the plan of |nobj|'s shape. If the properties of |nobj|
+  // cannot be handled by the fast path, set |*whySlow| and return true.
+  bool lookup(JSContext* cx, NativeObject* nobj, Plan* plan,
+              BailReason* whySlow) {
+    auto p = plans_.lookupForAdd(nobj->shape());
+    if (p) {
+      *plan = p->value();
+      return true;
+    }
+
+    OwnNonIndexKeysIterForJSON iter(nobj);
+    plan->begin = properties_.length();
+    while (!iter.done()) {
+      PropertyInfoWithKey prop = iter.next();
+
+      // A non-Array with indexed elements would need to sort the indexes
+      // numerically, which this code does not support. These objects are
+      // skipped when obj->isIndexed(), so no index properties should be found
+      // here.
+      mozilla::DebugOnly<uint32_t> index = -1;
+      MOZ_ASSERT(!IdIsIndex(prop.key(), &index));
+      MOZ_ASSERT(prop.key().isString());
+
+      uint32_t keyStart = keys_.length();
+      if (!QuoteJSONString(cx, keys_, prop.key().toString()) ||
+          !keys_.append(':')) {
+        return false;
+      }
+      uint32_t keyLength = keys_.length() - keyStart;
+      if (!properties_.append(Property{prop.slot(), keyStart, keyLength})) {
+        return false;
+      }
+    }
+    *whySlow = iter.cannotFastStringify();
+    if (*whySlow != BailReason::NO_REASON) {
+      return true;
+    }
+    plan->end = properties_.length();
+
+    return plans_.add(p, nobj->shape(), *plan);
+  }
+
+  const Property& property(uint32_t index) const { return properties_[index]; }
+
+  bool appendKey(StringBuilder& sb, const Property& prop) const {
+    if (keys_.isUnderlyingBufferLatin1()) {
+      return sb.append(keys_.rawLatin1Begin() + prop.keyStart, prop.keyLength);
+    }
+    return sb.append(keys_.rawTwoByteBegin() + prop.keyStart, prop.keyLength);
+  }
+};
+
+// Iterator over the properties of a JSONShapePlans::Plan.
+class PlannedPropertiesIterForJSON {
+  uint32_t index_;
+  uint32_t end_;
+
+ public:
+  explicit PlannedPropertiesIterForJSON(const JSONShapePlans::Plan& plan)
+      : index_(plan.begin), end_(plan.end) {}
+
+  bool done() const { return index_ == end_; }
+
+  uint32_t next() {
+    MOZ_ASSERT(!done());
+    return index_++;
+  }
+};
+
 // Steps from https://262.ecma-international.org/14.0/#sec-serializejsonproperty
 static bool EmitSimpleValue(JSContext* cx, StringBuilder& sb, const Value& v) {
   /* Step 8. */
@@ -1220,7 +1321,7 @@ static bool PreprocessFastValue(JSContext* cx, Value* vp, StringifyContext* scx,
 // handled separately in the FastSerializeJSONProperty code.
 struct FastStackEntry {
   NativeObject* nobj;
-  Variant<DenseElementsIteratorForJSON, OwnNonIndexKeysIterForJSON> iter;
+  Variant<DenseElementsIteratorForJSON, PlannedPropertiesIterForJSON> iter;
   bool isArray;  // Cached nobj->is<ArrayObject>()
 
   // Given an object, a FastStackEntry starts with the dense elements. The
@@ -1242,9 +1343,19 @@ struct FastStackEntry {
     isArray = other.isArray;
   }
 
-  // Advance from dense elements to the named properties.
-  void advanceToProperties() {
-    iter = AsVariant(OwnNonIndexKeysIterForJSON(nobj));
+  // Advance from dense elements to the named properties. If they cannot be
+  // handled by the fast path, set |*whySlow| and return true.
+  bool advanceToProperties(JSContext* cx, JSONShapePlans& plans,
+                           BailReason* whySlow) {
+    JSONShapePlans::Plan plan;
+    if (!plans.lookup(cx, nobj, &plan, whySlow)) {
+      return false;
+    }
+    if (*whySlow != BailReason::NO_REASON) {
+      return true;
+    }
+    iter = AsVariant(PlannedPropertiesIterForJSON(plan));
+    return true;
   }
 };
 
@@ -1317,6 +1428,7 @@ static bool FastSerializeJSONProperty(JSContext* cx, Handle<Value> v,
   }
 
   constexpr size_t MAX_STACK_DEPTH = 20;
+  JSONShapePlans plans(cx);
   Vector<FastStackEntry> stack(cx);
   if (!stack.reserve(MAX_STACK_DEPTH - 1)) {
     return false;
@@ -1412,12 +1524,17 @@ static bool FastSerializeJSONProperty(JSContext* cx, Handle<Value> v,
       if (top.isArray) {
         MOZ_ASSERT(!top.nobj->isIndexed() || IsPackedArray(top.nobj));
       } else {
-        top.advanceToProperties();
+        if (!top.advanceToProperties(cx, plans, whySlow)) {
+          return false;
+        }
+        if (*whySlow != BailReason::NO_REASON) {
+          return true;
+        }
       }
     }
 
-    if (top.iter.is<OwnNonIndexKeysIterForJSON>()) {
-      auto& iter = top.iter.as<OwnNonIndexKeysIterForJSON>();
+    if (top.iter.is<PlannedPropertiesIterForJSON>()) {
+      auto& iter = top.iter.as<PlannedPropertiesIterForJSON>();
       bool nesting = false;
       while (!iter.done()) {
         // Interrupts can GC and we are working with unrooted pointers.
@@ -1427,16 +1544,9 @@ static bool FastSerializeJSONProperty(JSContext* cx, Handle<Value> v,
           return true;
         }
 
-        PropertyInfoWithKey prop = iter.next();
+        const JSONShapePlans::Property& prop = plans.property(iter.next());
 
-        // A non-Array with indexed elements would need to sort the indexes
-        // numerically, which this code does not support. These objects are
-        // skipped when obj->isIndexed(), so no index properties should be found
-        // here.
-        mozilla::DebugOnly<uint32_t> index = -1;
-        MOZ_ASSERT(!IdIsIndex(prop.key(), &index));
-
-        Value val = top.nobj->getSlot(prop.slot());
+        Value val = top.nobj->getSlot(prop.slot);
         if (!PreprocessFastValue(cx, &val, scx, whySlow)) {
           return false;
         }
@@ -1455,12 +1565,7 @@ static bool FastSerializeJSONProperty(JSContext* cx, Handle<Value> v,
         }
         wroteMember = true;
 
-        MOZ_ASSERT(prop.key().isString());
-        if (!QuoteJSONString(cx, scx->sb, prop.key().toString())) {
-          return false;
-        }
-
-        if (!scx->sb.append(':')) {
+        if (!plans.appendKey(scx->sb, prop)) {
           return false;
         }
         if (val.isObject()) {
@@ -1485,10 +1590,6 @@ static bool FastSerializeJSONProperty(JSContext* cx, Handle<Value> v,
           return false;
         }
       }
-      *whySlow = iter.cannotFastStringify();
-      if (*whySlow != BailReason::NO_REASON) {
-        return true;
-      }
       if (nesting) {
         continue;  // Break out to outer loop.
       }
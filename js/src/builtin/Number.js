@@ -30,6 +30,25 @@ function Number_toLocaleString() {
       numberFormatCache.runtimeDefaultLocale = intl_RuntimeDefaultLocale();
     }
     numberFormat = numberFormatCache.numberFormat;
+  } else if (typeof locales === "string" && options === undefined) {
+    // Also cache the formatter for the last requested locale, which covers
+    // repeated |x.toLocaleString("de")| calls. The runtime default locale is
+    // part of the key because unsupported locales resolve to it.
+    if (
+      numberFormatCache.locales !== locales ||
+      !intl_IsRuntimeDefaultLocale(
+        numberFormatCache.localesRuntimeDefaultLocale
+      )
+    ) {
+      numberFormatCache.localesNumberFormat = intl_NumberFormat(
+        locales,
+        options
+      );
+      numberFormatCache.locales = locales;
+      numberFormatCache.localesRuntimeDefaultLocale =
+        intl_RuntimeDefaultLocale();
+    }
+    numberFormat = numberFormatCache.localesNumberFormat;
   } else {
     numberFormat = intl_NumberFormat(locales, options);
   }
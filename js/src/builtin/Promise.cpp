@@ -6992,12 +6992,8 @@ void PromiseObject::dumpOwnStringContent(js::GenericPrinter& out) const {}
     return true;
   }
 
-  if (promise->state() == JS::PromiseState::Rejected) {
-    // We don't optimize rejected Promises for now.
-    *canSkip = false;
-    return true;
-  }
-
+  // Rejected promises are skippable too: ExtractAwaitValue throws their
+  // reason, as the generator would have done when resumed with it.
   *canSkip = true;
   return true;
 }
@@ -7022,10 +7018,23 @@ void PromiseObject::dumpOwnStringContent(js::GenericPrinter& out) const {}
   }
 
   JSObject* obj = &val.toObject();
-  PromiseObject* promise = &obj->as<PromiseObject>();
-  resolved.set(promise->value());
+  Rooted<PromiseObject*> promise(cx, &obj->as<PromiseObject>());
+  if (promise->state() == JS::PromiseState::Fulfilled) {
+    resolved.set(promise->value());
+    return true;
+  }
 
-  return true;
+  // Awaiting a rejected promise handles it, as PerformPromiseThen would have
+  // done when registering the await reactions.
+  MOZ_ASSERT(promise->state() == JS::PromiseState::Rejected);
+  if (promise->isUnhandled()) {
+    cx->runtime()->removeUnhandledRejectedPromise(cx, promise);
+  }
+  promise->setHandled();
+
+  RootedValue reason(cx, promise->reason());
+  cx->setPendingException(reason, ShouldCaptureStack::Maybe);
+  return false;
 }
 
 JS::AutoDebuggerJobQueueInterruption::AutoDebuggerJobQueueInterruption()
@@ -2173,56 +2173,65 @@ int js::StringFindPattern(const JSLinearString* text, const JSLinearString* pat,
 
 using LinearStringVector = Vector<JSLinearString*, 16, SystemAllocPolicy>;
 
-template <typename TextChar, typename PatChar>
+template <typename PatChar>
 static int RopeMatchImpl(const AutoCheckCannotGC& nogc,
-                         LinearStringVector& strings, const PatChar* pat,
-                         size_t patLen) {
-  /* Absolute offset from the beginning of the logical text string. */
+                         LinearStringVector& strings, size_t start,
+                         const PatChar* pat, size_t patLen) {
+  /* Absolute offset from the beginning of the first node. */
   int pos = 0;
 
   for (JSLinearString** outerp = strings.begin(); outerp != strings.end();
        ++outerp) {
     /* Try to find a match within 'outer'. */
     JSLinearString* outer = *outerp;
-    const TextChar* chars = outer->chars<TextChar>(nogc);
     size_t len = outer->length();
-    int matchResult = StringMatch(chars, len, pat, patLen);
+    size_t from = outerp == strings.begin() ? start : 0;
+    MOZ_ASSERT(from <= len);
+
+    int matchResult =
+        outer->hasLatin1Chars()
+            ? StringMatch(outer->latin1Chars(nogc) + from, len - from, pat,
+                          patLen)
+            : StringMatch(outer->twoByteChars(nogc) + from, len - from, pat,
+                          patLen);
     if (matchResult != -1) {
       /* Matched! */
-      return pos + matchResult;
+      return pos + int(from) + matchResult;
     }
 
-    /* Try to find a match starting in 'outer' and running into other nodes. */
-    const TextChar* const text = chars + (patLen > len ? 0 : len - patLen + 1);
-    const TextChar* const textend = chars + len;
+    /*
+     * Try to find a match starting in 'outer' and running into other nodes.
+     * Nodes can have different encodings, and at most |patLen - 1| positions
+     * are checked per node, so read characters one by one.
+     */
     const PatChar p0 = *pat;
     const PatChar* const p1 = pat + 1;
     const PatChar* const patend = pat + patLen;
-    for (const TextChar* t = text; t != textend;) {
-      if (*t++ != p0) {
+    for (size_t t = std::max(from, patLen > len ? 0 : len - patLen + 1);
+         t < len; t++) {
+      if (outer->latin1OrTwoByteChar(t) != p0) {
         continue;
       }
 
       JSLinearString** innerp = outerp;
-      const TextChar* ttend = textend;
-      const TextChar* tt = t;
+      JSLinearString* inner = outer;
+      size_t tt = t + 1;
       for (const PatChar* pp = p1; pp != patend; ++pp, ++tt) {
-        while (tt == ttend) {
+        while (tt == inner->length()) {
           if (++innerp == strings.end()) {
             return -1;
           }
 
-          JSLinearString* inner = *innerp;
-          tt = inner->chars<TextChar>(nogc);
-          ttend = tt + inner->length();
+          inner = *innerp;
+          tt = 0;
         }
-        if (*pp != *tt) {
+        if (*pp != inner->latin1OrTwoByteChar(tt)) {
           goto break_continue;
         }
       }
 
       /* Matched! */
-      return pos + (t - chars) - 1; /* -1 because of *t++ above */
+      return pos + int(t);
 
     break_continue:;
     }
@@ -2234,37 +2243,41 @@ static int RopeMatchImpl(const AutoCheckCannotGC& nogc,
 }
 
 /*
- * RopeMatch takes the text to search and the pattern to search for in the text.
- * RopeMatch returns false on OOM and otherwise returns the match index through
- * the 'match' outparam (-1 for not found).
+ * RopeMatch takes the text to search, the pattern to search for in the text
+ * and the index at which the search starts. RopeMatch returns false on OOM and
+ * otherwise returns the match index through the 'match' outparam (-1 for not
+ * found).
  */
 static bool RopeMatch(JSContext* cx, JSRope* text, const JSLinearString* pat,
-                      int* match) {
+                      uint32_t start, int* match) {
+  MOZ_ASSERT(start <= text->length());
+
   uint32_t patLen = pat->length();
   if (patLen == 0) {
-    *match = 0;
+    *match = start;
     return true;
   }
-  if (text->length() < patLen) {
+  if (text->length() - start < patLen) {
     *match = -1;
     return true;
   }
 
   /*
-   * List of leaf nodes in the rope. If we run out of memory when trying to
-   * append to this list, we can still fall back to StringMatch, so use the
-   * system allocator so we don't report OOM in that case.
+   * List of leaf nodes in the rope which can contain a match. If we run out of
+   * memory when trying to append to this list, we can still fall back to
+   * StringMatch, so use the system allocator so we don't report OOM in that
+   * case.
    */
   LinearStringVector strings;
 
+  /* Length of the leaf nodes skipped because they end before |start|. */
+  size_t skipped = 0;
+
   /*
    * We don't want to do rope matching if there is a poor node-to-char ratio,
    * since this means spending a lot of time in the match loop below. We also
    * need to build the list of leaf nodes. Do both here: iterate over the
    * nodes so long as there are not too many.
-   *
-   * We also don't use rope matching if the rope contains both Latin-1 and
-   * TwoByte nodes, to simplify the match algorithm.
    */
   {
     size_t threshold = text->length() >> sRopeMatchThresholdRatioLog2;
@@ -2273,43 +2286,57 @@ static bool RopeMatch(JSContext* cx, JSRope* text, const JSLinearString* pat,
       return false;
     }
 
-    bool textIsLatin1 = text->hasLatin1Chars();
     while (!r.empty()) {
-      if (threshold-- == 0 || r.front()->hasLatin1Chars() != textIsLatin1 ||
-          !strings.append(r.front())) {
+      JSLinearString* front = r.front();
+      bool skip = strings.empty() && skipped + front->length() <= start;
+      if (threshold-- == 0 || (!skip && !strings.append(front))) {
         JSLinearString* linear = text->ensureLinear(cx);
         if (!linear) {
           return false;
         }
 
-        *match = StringMatch(linear, pat);
+        cx->runtime()->ropeSearchesFlattened++;
+        *match = StringMatch(linear, pat, start);
         return true;
       }
+      if (skip) {
+        skipped += front->length();
+      }
       if (!r.popFront()) {
         return false;
       }
     }
   }
 
+  cx->runtime()->ropeSearchesWithoutFlattening++;
+
   AutoCheckCannotGC nogc;
-  if (text->hasLatin1Chars()) {
-    if (pat->hasLatin1Chars()) {
-      *match = RopeMatchImpl<Latin1Char>(nogc, strings, pat->latin1Chars(nogc),
-                                         patLen);
-    } else {
-      *match = RopeMatchImpl<Latin1Char>(nogc, strings, pat->twoByteChars(nogc),
-                                         patLen);
-    }
+  int result;
+  if (pat->hasLatin1Chars()) {
+    result = RopeMatchImpl(nogc, strings, start - skipped,
+                           pat->latin1Chars(nogc), patLen);
   } else {
-    if (pat->hasLatin1Chars()) {
-      *match = RopeMatchImpl<char16_t>(nogc, strings, pat->latin1Chars(nogc),
-                                       patLen);
-    } else {
-      *match = RopeMatchImpl<char16_t>(nogc, strings, pat->twoByteChars(nogc),
-                                       patLen);
-    }
+    result = RopeMatchImpl(nogc, strings, start - skipped,
+                           pat->twoByteChars(nogc), patLen);
   }
 
+  *match = (result == -1) ? -1 : int(skipped) + result;
+  return true;
+}
+
+/*
+ * Search for |pat| in |text| from the index |start|, without flattening |text|
+ * if it's a rope. Returns false on OOM and otherwise returns the match index
+ * through the 'match' outparam (-1 for not found).
+ */
+static bool StringMatchMaybeRope(JSContext* cx, JSString* text,
+                                 const JSLinearString* pat, uint32_t start,
+                                 int* match) {
+  if (text->isRope()) {
+    return RopeMatch(cx, &text->asRope(), pat, start, match);
+  }
+
+  *match = StringMatch(&text->asLinear(), pat, start);
   return true;
 }
 
@@ -2380,28 +2407,28 @@ bool js::str_includes(JSContext* cx, unsigned argc, Value* vp) {
   uint32_t start = std::min(pos, textLen);
 
   // Steps 9-10.
-  JSLinearString* text = str->ensureLinear(cx);
-  if (!text) {
+  int match;
+  if (!StringMatchMaybeRope(cx, str, searchStr, start, &match)) {
     return false;
   }
 
-  args.rval().setBoolean(StringMatch(text, searchStr, start) != -1);
+  args.rval().setBoolean(match != -1);
   return true;
 }
 
 bool js::StringIncludes(JSContext* cx, HandleString string,
                         HandleString searchString, bool* result) {
-  JSLinearString* text = string->ensureLinear(cx);
-  if (!text) {
+  JSLinearString* searchStr = searchString->ensureLinear(cx);
+  if (!searchStr) {
     return false;
   }
 
-  JSLinearString* searchStr = searchString->ensureLinear(cx);
-  if (!searchStr) {
+  int match;
+  if (!StringMatchMaybeRope(cx, string, searchStr, 0, &match)) {
     return false;
   }
 
-  *result = StringMatch(text, searchStr, 0) != -1;
+  *result = match != -1;
   return true;
 }
 
@@ -2451,12 +2478,12 @@ bool js::str_indexOf(JSContext* cx, unsigned argc, Value* vp) {
   }
 
   // Steps 10 and 11
-  JSLinearString* text = str->ensureLinear(cx);
-  if (!text) {
+  int match;
+  if (!StringMatchMaybeRope(cx, str, searchStr, start, &match)) {
     return false;
   }
 
-  args.rval().setInt32(StringMatch(text, searchStr, start));
+  args.rval().setInt32(match);
   return true;
 }
 
@@ -2467,17 +2494,17 @@ bool js::StringIndexOf(JSContext* cx, HandleString string,
     return true;
   }
 
-  JSLinearString* text = string->ensureLinear(cx);
-  if (!text) {
+  JSLinearString* searchStr = searchString->ensureLinear(cx);
+  if (!searchStr) {
     return false;
   }
 
-  JSLinearString* searchStr = searchString->ensureLinear(cx);
-  if (!searchStr) {
+  int match;
+  if (!StringMatchMaybeRope(cx, string, searchStr, 0, &match)) {
     return false;
   }
 
-  *result = StringMatch(text, searchStr, 0);
+  *result = match;
   return true;
 }
 
@@ -3170,8 +3197,10 @@ static JSLinearString* InterpretDollarReplacement(
 template <typename StrChar, typename RepChar>
 static bool StrFlatReplaceGlobal(JSContext* cx, const JSLinearString* str,
                                  const JSLinearString* pat,
-                                 const JSLinearString* rep, StringBuilder& sb) {
+                                 const JSLinearString* rep, int firstMatch,
+                                 StringBuilder& sb) {
   MOZ_ASSERT(str->length() > 0);
+  MOZ_ASSERT_IF(firstMatch >= 0, firstMatch == StringMatch(str, pat, 0));
 
   AutoCheckCannotGC nogc;
   const StrChar* strChars = str->chars<StrChar>(nogc);
@@ -3208,12 +3237,10 @@ static bool StrFlatReplaceGlobal(JSContext* cx, const JSLinearString* str,
     }
   }
 
+  // The caller may already have searched for the first match.
   uint32_t start = 0;
-  for (;;) {
-    int match = StringMatch(str, pat, start);
-    if (match < 0) {
-      break;
-    }
+  int match = firstMatch >= 0 ? firstMatch : StringMatch(str, pat, start);
+  while (match >= 0) {
     if (!sb.append(strChars + start, match - start)) {
       return false;
     }
@@ -3221,6 +3248,7 @@ static bool StrFlatReplaceGlobal(JSContext* cx, const JSLinearString* str,
       return false;
     }
     start = match + pat->length();
+    match = StringMatch(str, pat, start);
   }
 
   if (!sb.append(strChars + start, str->length() - start)) {
@@ -3253,6 +3281,18 @@ JSString* js::StringFlatReplaceString(JSContext* cx, HandleString string,
     return nullptr;
   }
 
+  // Avoid flattening |string| when there's nothing to replace. Otherwise the
+  // replacement loop starts from the match we found.
+  int firstMatch = -1;
+  if (string->isRope()) {
+    if (!RopeMatch(cx, &string->asRope(), linearPat, 0, &firstMatch)) {
+      return nullptr;
+    }
+    if (firstMatch == -1) {
+      return string;
+    }
+  }
+
   Rooted<JSLinearString*> linearStr(cx, string->ensureLinear(cx));
   if (!linearStr) {
     return nullptr;
@@ -3264,13 +3304,13 @@ JSString* js::StringFlatReplaceString(JSContext* cx, HandleString string,
       return nullptr;
     }
     if (linearRepl->hasTwoByteChars()) {
-      if (!StrFlatReplaceGlobal<char16_t, char16_t>(cx, linearStr, linearPat,
-                                                    linearRepl, sb)) {
+      if (!StrFlatReplaceGlobal<char16_t, char16_t>(
+              cx, linearStr, linearPat, linearRepl, firstMatch, sb)) {
         return nullptr;
       }
     } else {
-      if (!StrFlatReplaceGlobal<char16_t, Latin1Char>(cx, linearStr, linearPat,
-                                                      linearRepl, sb)) {
+      if (!StrFlatReplaceGlobal<char16_t, Latin1Char>(
+              cx, linearStr, linearPat, linearRepl, firstMatch, sb)) {
         return nullptr;
       }
     }
@@ -3279,13 +3319,13 @@ JSString* js::StringFlatReplaceString(JSContext* cx, HandleString string,
       if (!sb.ensureTwoByteChars()) {
         return nullptr;
       }
-      if (!StrFlatReplaceGlobal<Latin1Char, char16_t>(cx, linearStr, linearPat,
-                                                      linearRepl, sb)) {
+      if (!StrFlatReplaceGlobal<Latin1Char, char16_t>(
+              cx, linearStr, linearPat, linearRepl, firstMatch, sb)) {
         return nullptr;
       }
     } else {
       if (!StrFlatReplaceGlobal<Latin1Char, Latin1Char>(
-              cx, linearStr, linearPat, linearRepl, sb)) {
+              cx, linearStr, linearPat, linearRepl, firstMatch, sb)) {
         return nullptr;
       }
     }
@@ -3308,7 +3348,7 @@ JSString* js::str_replace_string_raw(JSContext* cx, HandleString string,
    */
   int32_t match;
   if (string->isRope()) {
-    if (!RopeMatch(cx, &string->asRope(), pat, &match)) {
+    if (!RopeMatch(cx, &string->asRope(), pat, 0, &match)) {
       return nullptr;
     }
   } else {
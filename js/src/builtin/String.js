@@ -863,6 +863,19 @@ function String_localeCompare(that) {
       collatorCache.runtimeDefaultLocale = intl_RuntimeDefaultLocale();
     }
     collator = collatorCache.collator;
+  } else if (typeof locales === "string" && options === undefined) {
+    // Also cache the collator for the last requested locale, which covers
+    // repeated |a.localeCompare(b, "de")| calls. The runtime default locale
+    // is part of the key because unsupported locales resolve to it.
+    if (
+      collatorCache.locales !== locales ||
+      !intl_IsRuntimeDefaultLocale(collatorCache.localesRuntimeDefaultLocale)
+    ) {
+      collatorCache.localesCollator = intl_Collator(locales, options);
+      collatorCache.locales = locales;
+      collatorCache.localesRuntimeDefaultLocale = intl_RuntimeDefaultLocale();
+    }
+    collator = collatorCache.localesCollator;
   } else {
     collator = intl_Collator(locales, options);
   }
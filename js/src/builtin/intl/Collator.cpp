@@ -12,6 +12,7 @@
 #include "mozilla/intl/Collator.h"
 #include "mozilla/intl/Locale.h"
 #include "mozilla/Span.h"
+#include "mozilla/TextUtils.h"
 
 #include "builtin/Array.h"
 #include "builtin/intl/CommonFunctions.h"
@@ -55,7 +56,7 @@ const JSClass CollatorObject::class_ = {
     "Intl.Collator",
     JSCLASS_HAS_RESERVED_SLOTS(CollatorObject::SLOT_COUNT) |
         JSCLASS_HAS_CACHED_PROTO(JSProto_Collator) |
-        JSCLASS_FOREGROUND_FINALIZE,
+        JSCLASS_BACKGROUND_FINALIZE,
     &CollatorObject::classOps_,
     &CollatorObject::classSpec_,
 };
@@ -148,8 +149,6 @@ bool js::intl_Collator(JSContext* cx, unsigned argc, Value* vp) {
 }
 
 void js::CollatorObject::finalize(JS::GCContext* gcx, JSObject* obj) {
-  MOZ_ASSERT(gcx->onMainThread());
-
   if (mozilla::intl::Collator* coll = obj->as<CollatorObject>().getCollator()) {
     intl::RemoveICUCellMemory(gcx, obj, CollatorObject::EstimatedMemoryUse);
     delete coll;
@@ -423,6 +422,32 @@ static bool intl_CompareStrings(JSContext* cx, mozilla::intl::Collator* coll,
     return true;
   }
 
+  // ASCII is valid UTF-8, so two ASCII-only Latin-1 strings can be handed to
+  // ICU directly instead of being inflated to two-byte copies first. ICU's
+  // own Latin-1 fast path still applies to UTF-8 input.
+  if (str1->hasLatin1Chars() && str2->hasLatin1Chars()) {
+    Rooted<JSLinearString*> linear1(cx, str1->ensureLinear(cx));
+    if (!linear1) {
+      return false;
+    }
+    JSLinearString* linear2 = str2->ensureLinear(cx);
+    if (!linear2) {
+      return false;
+    }
+
+    JS::AutoCheckCannotGC nogc;
+    auto chars1 = mozilla::Span(
+        reinterpret_cast<const char*>(linear1->latin1Chars(nogc)),
+        linear1->length());
+    auto chars2 = mozilla::Span(
+        reinterpret_cast<const char*>(linear2->latin1Chars(nogc)),
+        linear2->length());
+    if (mozilla::IsAscii(chars1) && mozilla::IsAscii(chars2)) {
+      result.setInt32(coll->CompareStrings(chars1, chars2));
+      return true;
+    }
+  }
+
   AutoStableStringChars stableChars1(cx);
   if (!stableChars1.initTwoByte(cx, str1)) {
     return false;
@@ -69,7 +69,7 @@ const JSClass DateTimeFormatObject::class_ = {
     "Intl.DateTimeFormat",
     JSCLASS_HAS_RESERVED_SLOTS(DateTimeFormatObject::SLOT_COUNT) |
         JSCLASS_HAS_CACHED_PROTO(JSProto_DateTimeFormat) |
-        JSCLASS_FOREGROUND_FINALIZE,
+        JSCLASS_BACKGROUND_FINALIZE,
     &DateTimeFormatObject::classOps_,
     &DateTimeFormatObject::classSpec_,
 };
@@ -197,8 +197,6 @@ bool js::intl_CreateDateTimeFormat(JSContext* cx, unsigned argc, Value* vp) {
 }
 
 void js::DateTimeFormatObject::finalize(JS::GCContext* gcx, JSObject* obj) {
-  MOZ_ASSERT(gcx->onMainThread());
-
   auto* dateTimeFormat = &obj->as<DateTimeFormatObject>();
   mozilla::intl::DateTimeFormat* df = dateTimeFormat->getDateFormat();
   mozilla::intl::DateIntervalFormat* dif =
@@ -73,7 +73,7 @@ const JSClass NumberFormatObject::class_ = {
     "Intl.NumberFormat",
     JSCLASS_HAS_RESERVED_SLOTS(NumberFormatObject::SLOT_COUNT) |
         JSCLASS_HAS_CACHED_PROTO(JSProto_NumberFormat) |
-        JSCLASS_FOREGROUND_FINALIZE,
+        JSCLASS_BACKGROUND_FINALIZE,
     &NumberFormatObject::classOps_,
     &NumberFormatObject::classSpec_,
 };
@@ -171,8 +171,6 @@ bool js::intl_NumberFormat(JSContext* cx, unsigned argc, Value* vp) {
 }
 
 void js::NumberFormatObject::finalize(JS::GCContext* gcx, JSObject* obj) {
-  MOZ_ASSERT(gcx->onMainThread());
-
   auto* numberFormat = &obj->as<NumberFormatObject>();
   mozilla::intl::NumberFormat* nf = numberFormat->getNumberFormatter();
   mozilla::intl::NumberRangeFormat* nrf =
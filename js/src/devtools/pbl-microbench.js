@@ -0,0 +1,49 @@
+// Microbenchmarks for js/src/devtools/pbl-vs-interp.sh, covering the ops the
+// portable baseline interpreter has fast paths for: comparisons feeding
+// conditional jumps, local and argument reads feeding property gets, and
+// calls.
+
+function loopCompare(n) {
+  let count = 0;
+  for (let i = 0; i < n; i++) {
+    if (i % 3 == 0) {
+      count++;
+    }
+    if (i > count) {
+      count += 2;
+    }
+  }
+  return count;
+}
+
+function sumProps(points) {
+  let sum = 0;
+  for (let i = 0; i < points.length; i++) {
+    let p = points[i];
+    sum += p.x + p.y;
+  }
+  return sum;
+}
+
+function add(a, b) {
+  return a + b;
+}
+
+function loopCall(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum = add(sum, i) & 0xffff;
+  }
+  return sum;
+}
+
+let points = [];
+for (let i = 0; i < 1000; i++) {
+  points.push({ x: i, y: -i });
+}
+
+loopCompare(3000000);
+for (let i = 0; i < 2000; i++) {
+  sumProps(points);
+}
+loopCall(2000000);
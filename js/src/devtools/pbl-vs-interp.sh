@@ -0,0 +1,61 @@
+#!/usr/bin/env bash
+
+set -e -o pipefail
+
+function echo_to_stderr {
+    echo "$1" 1>&2
+}
+
+function usage_and_exit {
+    echo_to_stderr "Usage:"
+    echo_to_stderr "    $0 <path-to-js> <number-of-iterations> [<script.js>...]"
+    echo_to_stderr
+    echo_to_stderr "Run each script <number-of-iterations> times with the portable"
+    echo_to_stderr "baseline interpreter and with the C++ interpreter, and write the"
+    echo_to_stderr "running times in milliseconds as CSV to stdout. The JITs are disabled"
+    echo_to_stderr "in both configurations. The shell must be built with"
+    echo_to_stderr "--enable-portable-baseline-interp."
+    echo_to_stderr
+    echo_to_stderr "Without scripts, js/src/devtools/pbl-microbench.js is run."
+    exit 1
+}
+
+if [[ "$#" -lt "2" ]]; then
+    usage_and_exit
+fi
+
+JS=$1
+ITERATIONS=$2
+shift 2
+
+if [[ ! -x "$JS" ]]; then
+    echo_to_stderr "error: '$JS' is not executable"
+    echo_to_stderr
+    usage_and_exit
+fi
+
+SCRIPTS=("$@")
+if [[ "${#SCRIPTS[@]}" == "0" ]]; then
+    SCRIPTS=("$(dirname $0)/pbl-microbench.js")
+fi
+
+COMMON_FLAGS="--no-blinterp --no-baseline --no-ion"
+PBL_FLAGS="$COMMON_FLAGS --portable-baseline-eager"
+INTERP_FLAGS="$COMMON_FLAGS --no-portable-baseline"
+
+function run_ms {
+    local start end
+    start=$(date +%s%N)
+    "$JS" $1 -f "$2" > /dev/null
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 ))
+}
+
+echo "script,iteration,pbl,interp"
+for script in "${SCRIPTS[@]}"; do
+    for (( i = 0; i < ITERATIONS; i++ )); do
+        pbl=$(run_ms "$PBL_FLAGS" "$script")
+        interp=$(run_ms "$INTERP_FLAGS" "$script")
+        echo "$(basename $script),$i,$pbl,$interp"
+    done
+done
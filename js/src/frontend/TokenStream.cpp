@@ -25,6 +25,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <type_traits>
 #include <utility>
 
@@ -2032,6 +2033,23 @@ bool AppendCodePointToCharBuffer(CharBuffer& charBuffer, char32_t codePoint) {
   return charBuffer.append(units[1]);
 }
 
+template <typename Unit>
+[[nodiscard]] static bool AppendAsciiToCharBuffer(CharBuffer& charBuffer,
+                                                  const Unit* units,
+                                                  size_t length) {
+  size_t oldLength = charBuffer.length();
+  if (!charBuffer.growByUninitialized(length)) {
+    return false;
+  }
+
+  char16_t* dest = charBuffer.begin() + oldLength;
+  for (size_t i = 0; i < length; i++) {
+    MOZ_ASSERT(CodeUnitValue(units[i]) < 0x80);
+    dest[i] = char16_t(CodeUnitValue(units[i]));
+  }
+  return true;
+}
+
 template <typename Unit, class AnyCharsAccess>
 bool TokenStreamSpecific<Unit, AnyCharsAccess>::putIdentInCharBuffer(
     const Unit* identStart) {
@@ -2097,6 +2115,9 @@ template <typename Unit, class AnyCharsAccess>
   // code points in the loop below.
   int32_t unit;
   while (true) {
+    // Consume the common ASCII IdentifierPart code units in bulk.
+    this->sourceUnits.consumeAsciiIdentifierParts();
+
     unit = peekCodeUnit();
     if (unit == EOF) {
       break;
@@ -2256,9 +2277,109 @@ static const uint8_t firstCharKinds[] = {
 static_assert(LastCharKind < (1 << (sizeof(firstCharKinds[0]) * 8)),
               "Elements of firstCharKinds[] are too small");
 
+// Return a pointer to the first code unit of |units[0..limit]| that is either
+// non-ASCII or one of |stops|, or |limit| if there's no such code unit.
+//
+// Units are tested 64 bits at a time: a word is skipped if none of its lanes
+// has a bit above the ASCII range and none of its lanes is zero once XOR'd
+// with a stop character.  For each lane |v|, |(v - 1) & ~v| sets the lane's
+// high bit iff |v| is zero, and borrows only propagate out of zero lanes, so
+// the test is exact for the word as a whole.  Words containing a match are
+// then scanned one unit at a time.
+template <typename Unit, size_t N>
+static MOZ_ALWAYS_INLINE const Unit* FindNonAsciiOrStop(
+    const Unit* units, const Unit* limit, const char (&stops)[N]) {
+  static_assert(sizeof(Unit) == 1 || sizeof(Unit) == 2,
+                "expected UTF-8 or UTF-16 code units");
+
+  constexpr size_t UnitsPerWord = sizeof(uint64_t) / sizeof(Unit);
+  constexpr uint64_t Ones =
+      sizeof(Unit) == 1 ? 0x0101'0101'0101'0101 : 0x0001'0001'0001'0001;
+  constexpr uint64_t HighBits = Ones << (8 * sizeof(Unit) - 1);
+  constexpr uint64_t NonAsciiBits =
+      sizeof(Unit) == 1 ? 0x8080'8080'8080'8080 : 0xFF80'FF80'FF80'FF80;
+
+  while (PointerRangeSize(units, limit) >= UnitsPerWord) {
+    uint64_t word;
+    memcpy(&word, units, sizeof(word));
+
+    uint64_t found = word & NonAsciiBits;
+    for (char stop : stops) {
+      uint64_t v = word ^ (Ones * uint8_t(stop));
+      found |= (v - Ones) & ~v & HighBits;
+    }
+    if (found) {
+      break;
+    }
+
+    units += UnitsPerWord;
+  }
+
+  for (; units < limit; units++) {
+    auto unit = CodeUnitValue(*units);
+    if (unit >= 0x80) {
+      return units;
+    }
+    for (char stop : stops) {
+      if (unit == uint8_t(stop)) {
+        return units;
+      }
+    }
+  }
+
+  return limit;
+}
+
+template <typename Unit>
+template <size_t N>
+void SourceUnits<Unit>::consumeAsciiCodeUnitsExcept(const char (&stops)[N]) {
+  MOZ_ASSERT(!isPoisoned(), "shouldn't use poisoned SourceUnits");
+  ptr = FindNonAsciiOrStop(ptr, limit_, stops);
+}
+
+template <typename Unit>
+void SourceUnits<Unit>::consumeAsciiIdentifierParts() {
+  MOZ_ASSERT(!isPoisoned(), "shouldn't use poisoned SourceUnits");
+  while (ptr < limit_) {
+    auto unit = CodeUnitValue(*ptr);
+    if (unit >= 0x80 || !unicode::IsIdentifierPartASCII(char(unit))) {
+      return;
+    }
+    ptr++;
+  }
+}
+
+template <typename Unit>
+void SourceUnits<Unit>::consumeAsciiSpaces() {
+  MOZ_ASSERT(!isPoisoned(), "shouldn't use poisoned SourceUnits");
+
+  // Indentation is commonly made of long runs of ' ', skip them a word at a
+  // time.
+  constexpr size_t UnitsPerWord = sizeof(uint64_t) / sizeof(Unit);
+  constexpr uint64_t Spaces =
+      sizeof(Unit) == 1 ? 0x2020'2020'2020'2020 : 0x0020'0020'0020'0020;
+  while (PointerRangeSize(ptr, limit_) >= UnitsPerWord) {
+    uint64_t word;
+    memcpy(&word, ptr, sizeof(word));
+    if (word != Spaces) {
+      break;
+    }
+    ptr += UnitsPerWord;
+  }
+
+  while (ptr < limit_ && (*ptr == Unit(' ') || *ptr == Unit('\t'))) {
+    ptr++;
+  }
+}
+
 template <>
 void SourceUnits<char16_t>::consumeRestOfSingleLineComment() {
   while (MOZ_LIKELY(!atEnd())) {
+    consumeAsciiCodeUnitsExcept({'\n', '\r'});
+    if (atEnd()) {
+      return;
+    }
+
     char16_t unit = peekCodeUnit();
     if (IsLineTerminator(unit)) {
       return;
@@ -2271,6 +2392,11 @@ void SourceUnits<char16_t>::consumeRestOfSingleLineComment() {
 template <>
 void SourceUnits<Utf8Unit>::consumeRestOfSingleLineComment() {
   while (MOZ_LIKELY(!atEnd())) {
+    consumeAsciiCodeUnitsExcept({'\n', '\r'});
+    if (atEnd()) {
+      return;
+    }
+
     const Utf8Unit unit = peekCodeUnit();
     if (IsSingleUnitLineTerminator(unit)) {
       return;
@@ -2744,6 +2870,7 @@ template <typename Unit, class AnyCharsAccess>
     // Skip over non-EOL whitespace chars.
     //
     if (c1kind == Space) {
+      this->sourceUnits.consumeAsciiSpaces();
       continue;
     }
 
@@ -3157,6 +3284,10 @@ template <typename Unit, class AnyCharsAccess>
           unsigned linenoBefore = anyChars.lineno;
 
           do {
+            // Skip the code units which need no handling in bulk.
+            this->sourceUnits.consumeAsciiCodeUnitsExcept(
+                {'*', '@', '#', '\n', '\r'});
+
             int32_t unit = getCodeUnit();
             if (unit == EOF) {
               error(JSMSG_UNTERMINATED_COMMENT);
@@ -3278,8 +3409,27 @@ bool TokenStreamSpecific<Unit, AnyCharsAccess>::getStringOrTemplateToken(
   // We need to detect any of these chars:  " or ', \n (or its
   // equivalents), \\, EOF.  Because we detect EOL sequences here and
   // put them back immediately, we can use getCodeUnit().
+  //
+  // Runs of the other ASCII code units are appended in bulk.  '$' only needs
+  // handling in templates.
+  const char stops[] = {untilChar, '\\', '\r', '\n',
+                        parsingTemplate ? '$' : untilChar};
   int32_t unit;
-  while ((unit = getCodeUnit()) != untilChar) {
+  while (true) {
+    const Unit* runStart = this->sourceUnits.addressOfNextCodeUnit();
+    this->sourceUnits.consumeAsciiCodeUnitsExcept(stops);
+    const Unit* runEnd = this->sourceUnits.addressOfNextCodeUnit();
+    if (runStart != runEnd &&
+        !AppendAsciiToCharBuffer(this->charBuffer, runStart,
+                                 PointerRangeSize(runStart, runEnd))) {
+      return false;
+    }
+
+    unit = getCodeUnit();
+    if (unit == untilChar) {
+      break;
+    }
+
     if (unit == EOF) {
       ReportPrematureEndOfLiteral(JSMSG_EOF_BEFORE_END_OF_LITERAL);
       return false;
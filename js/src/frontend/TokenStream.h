@@ -1459,6 +1459,24 @@ class SourceUnits {
    */
   void consumeRestOfSingleLineComment();
 
+  /**
+   * Consume ASCII code units up to (but not including) the first code unit
+   * that is non-ASCII or one of |stops|, or up to the end.  Source text is
+   * scanned a word at a time, so this is cheaper than consuming units one at
+   * a time when long runs are expected (comments, string literals).
+   *
+   * This call DOES NOT UPDATE LINE-STATUS: callers must include '\r' and '\n'
+   * in |stops| and handle them themselves.
+   */
+  template <size_t N>
+  void consumeAsciiCodeUnitsExcept(const char (&stops)[N]);
+
+  /** Consume the ASCII IdentifierPart code units that follow. */
+  void consumeAsciiIdentifierParts();
+
+  /** Consume the ' ' and '\t' code units that follow. */
+  void consumeAsciiSpaces();
+
   /**
    * The maximum radius of code around the location of an error that should
    * be included in a syntax error message -- this many code units to either
@@ -13,6 +13,7 @@
 #include "gc/GCInternals.h"
 #include "gc/GCLock.h"
 #include "gc/GCProbes.h"
+#include "gc/Memory.h"
 #include "gc/Nursery.h"
 #include "threading/CpuCount.h"
 #include "util/Poison.h"
@@ -645,15 +646,46 @@ void BackgroundAllocTask::run(AutoLockHelperThreadState& lock) {
 
 /* static */
 void* ArenaChunk::allocate(GCRuntime* gc) {
-  void* chunk = MapAlignedPages(ChunkSize, ChunkSize);
+  void* chunk = nullptr;
+  if (HugePagesEnabled()) {
+    chunk = gc->allocateHugePageChunk();
+  }
   if (!chunk) {
-    return nullptr;
+    chunk = MapAlignedPages(ChunkSize, ChunkSize);
+    if (!chunk) {
+      return nullptr;
+    }
   }
 
   gc->stats().count(gcstats::COUNT_NEW_CHUNK);
   return chunk;
 }
 
+void* GCRuntime::allocateHugePageChunk() {
+  // A huge page covers two chunks, so map a huge page sized region, return the
+  // first chunk and keep the second for the next allocation. If the kernel
+  // backs the region with a huge page, both chunks share a single TLB entry.
+  static_assert(HugePageSize == 2 * ChunkSize);
+
+  void* chunk = spareHugePageChunk.exchange(nullptr);
+  if (!chunk) {
+    void* region = MapAlignedHugePages(HugePageSize);
+    if (!region) {
+      return nullptr;
+    }
+
+    chunk = region;
+    void* spare = static_cast<uint8_t*>(region) + ChunkSize;
+    if (!spareHugePageChunk.compareExchange(nullptr, spare)) {
+      // Another thread stored a spare chunk while we were allocating.
+      UnmapPages(spare, ChunkSize);
+    }
+  }
+
+  stats().count(gcstats::COUNT_NEW_HUGE_PAGE_CHUNK);
+  return chunk;
+}
+
 static inline bool ShouldDecommitNewChunk(bool allMemoryCommitted,
                                           const GCSchedulingState& state) {
   if (!DecommitEnabled()) {
@@ -677,6 +677,23 @@ void GCRuntime::updateCellPointers(Zone* zone, AllocKinds kinds) {
   for (; !fgArenas.done(); fgArenas.next()) {
     UpdateArenaListSegmentPointers(this, fgArenas.get());
   }
+
+  // Rather than waiting for the background tasks to finish, help them by
+  // taking segments from the shared work list until it is exhausted. The list
+  // is shared with the tasks, so take the helper thread lock again, which
+  // |unlock| released, only while taking a segment from it.
+  for (;;) {
+    ArenaListSegment segment{nullptr, nullptr};
+    {
+      AutoLockHelperThreadState listLock;
+      if (bgArenas.done()) {
+        break;
+      }
+      segment = bgArenas.get();
+      bgArenas.next();
+    }
+    UpdateArenaListSegmentPointers(this, segment);
+  }
 }
 
 // After cells have been relocated any pointers to a cell's old locations must
@@ -1010,6 +1010,9 @@ void GCRuntime::finish() {
   FreeChunkPool(fullChunks_.ref());
   FreeChunkPool(availableChunks_.ref());
   FreeChunkPool(emptyChunks_.ref());
+  if (void* spare = spareHugePageChunk.exchange(nullptr)) {
+    UnmapPages(spare, ChunkSize);
+  }
 
   TlsGCContext.set(nullptr);
 
@@ -2124,7 +2127,13 @@ void js::gc::BackgroundDecommitTask::run(AutoLockHelperThreadState& lock) {
 
       if (DecommitEnabled()) {
         gc->decommitEmptyChunks(cancel_, gcLock);
-        gc->decommitFreeArenas(cancel_, gcLock);
+
+        // Decommitting individual arenas would cause the kernel to split any
+        // huge pages backing the chunk, so only decommit whole chunks when
+        // huge pages are enabled.
+        if (!HugePagesEnabled()) {
+          gc->decommitFreeArenas(cancel_, gcLock);
+        }
       }
     }
   }
@@ -2446,6 +2455,10 @@ void GCRuntime::purgeRuntime() {
   cx->frontendCollectionPool().purge();
 
   rt->caches().purge();
+  rt->arrayBufferContentsPool.purge();
+  if (isShrinkingGC()) {
+    rt->caches().regExpBytecodeCache.purge();
+  }
 
   if (rt->isMainRuntime()) {
     SharedImmutableStringsCache::getSingleton().purge();
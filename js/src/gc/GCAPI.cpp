@@ -10,10 +10,13 @@
 
 #include "mozilla/TimeStamp.h"
 
+#include <algorithm>
+
 #include "jsapi.h"
 #include "jsfriendapi.h"
 
 #include "gc/GC.h"
+#include "gc/GCInternals.h"
 #include "gc/PublicIterators.h"
 #include "jit/JitZone.h"
 #include "js/HeapAPI.h"
@@ -23,6 +26,7 @@
 #include "vm/Realm.h"
 #include "vm/Scope.h"
 
+#include "gc/GC-inl.h"
 #include "gc/Marking-inl.h"
 #include "gc/StableCellHasher-inl.h"
 #include "vm/GeckoProfiler-inl.h"
@@ -479,6 +483,51 @@ JS_PUBLIC_API bool JS::WasIncrementalGC(JSRuntime* rt) {
   return rt->gc.isIncrementalGc();
 }
 
+static void CollectZoneHeapCensus(Zone* zone, JS::HeapCensusCallback callback,
+                                  void* data) {
+  using JS::HeapCensusKindInfo;
+
+  for (auto kind : AllAllocKinds()) {
+    HeapCensusKindInfo info;
+    info.thingSize = Arena::thingSize(kind);
+    size_t thingsPerArena = Arena::thingsPerArena(kind);
+
+    for (ArenaIter arena(zone, kind); !arena.done(); arena.next()) {
+      size_t freeCells = arena->countFreeCells();
+      size_t usedCells = thingsPerArena - freeCells;
+      size_t bin = std::min(
+          usedCells * HeapCensusKindInfo::OccupancyBins / thingsPerArena,
+          HeapCensusKindInfo::OccupancyBins - 1);
+
+      info.arenaCount++;
+      info.cellCount += thingsPerArena;
+      info.freeCellCount += freeCells;
+      info.occupancyHistogram[bin]++;
+    }
+
+    if (info.arenaCount) {
+      callback(data, zone, AllocKindName(kind), info);
+    }
+  }
+}
+
+JS_PUBLIC_API void JS::CollectHeapCensus(JSContext* cx,
+                                         HeapCensusCallback callback,
+                                         void* data) {
+  MOZ_ASSERT(callback);
+
+  AutoPrepareForTracing prep(cx);
+
+  // Include the shared atoms zone if present.
+  if (Zone* zone = cx->runtime()->gc.maybeSharedAtomsZone()) {
+    CollectZoneHeapCensus(zone, callback, data);
+  }
+
+  for (ZonesIter zone(cx->runtime(), WithAtoms); !zone.done(); zone.next()) {
+    CollectZoneHeapCensus(zone, callback, data);
+  }
+}
+
 bool js::gc::CreateUniqueIdForNativeObject(NativeObject* nobj, uint64_t* uidp) {
   JSRuntime* runtime = nobj->runtimeFromMainThread();
   *uidp = NextCellUniqueId(runtime);
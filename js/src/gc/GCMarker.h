@@ -203,6 +203,10 @@ class MarkStack {
   TaggedPtr popPtr();
   SlotsOrElementsRange popSlotsOrElementsRange();
 
+  // Issue a prefetch for the cell referenced by the top stack entry, if any,
+  // so that its header is likely to be in cache by the time it is scanned.
+  void prefetchTop() const;
+
   void clearAndResetCapacity();
   void clearAndFreeStack();
 
@@ -210,7 +214,11 @@ class MarkStack {
 
   [[nodiscard]] bool ensureSpace(size_t count);
 
+  // Move some work from |src| to |dst|, which must be empty. The first
+  // version moves half of the work up to a fixed limit. The second moves
+  // |wordsToMove| words, adjusted to an entry boundary.
   static void moveWork(MarkStack& dst, MarkStack& src);
+  static void moveWork(MarkStack& dst, MarkStack& src, size_t wordsToMove);
 
   size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) const;
 
@@ -428,6 +436,10 @@ class GCMarker {
 
   static void moveWork(GCMarker* dst, GCMarker* src);
 
+  // Move roughly 1/|shares| of the work in |src| to |dst|. Used to split work
+  // evenly between markers at the start of parallel marking.
+  static void moveWorkShare(GCMarker* dst, GCMarker* src, size_t shares);
+
   [[nodiscard]] bool initStack();
   void resetStackCapacity();
   void freeStack();
@@ -579,6 +579,10 @@ class GCRuntime {
 
   void recycleChunk(ArenaChunk* chunk, const AutoLockGC& lock);
 
+  // Allocate a chunk from a huge page backed region when huge pages are
+  // enabled. Returns nullptr on failure.
+  void* allocateHugePageChunk();
+
 #ifdef JS_GC_ZEAL
   void startVerifyPreBarriers();
   void endVerifyPreBarriers();
@@ -1092,6 +1096,12 @@ class GCRuntime {
   // so as to reduce the cost of operations on the available lists.
   GCLockData<ChunkPool> fullChunks_;
 
+  // When huge pages are enabled chunks are allocated in pairs from huge page
+  // sized regions. This holds the second chunk of the most recent region until
+  // it is needed. This is accessed both with and without the GC lock held, so
+  // it is atomic.
+  mozilla::Atomic<void*, mozilla::ReleaseAcquire> spareHugePageChunk;
+
   /*
    * JSGC_MIN_EMPTY_CHUNK_COUNT
    *
@@ -101,7 +101,11 @@ PhaseKindGraphRoots = [
                     addPhaseKind("MARK_RUNTIME_DATA", "Mark Runtime-wide Data", 52),
                     addPhaseKind("MARK_EMBEDDING", "Mark Embedding", 53),
                 ],
-            )
+            ),
+            addPhaseKind("MINOR_GC_TRACE_STORE_BUFFER", "Trace Store Buffer", 83),
+            addPhaseKind("MINOR_GC_TENURE_FIXED_POINT", "Tenure To Fixed Point", 84),
+            addPhaseKind("MINOR_GC_SWEEP", "Sweep Nursery", 85),
+            addPhaseKind("MINOR_GC_FREE_BUFFERS", "Free Nursery Buffers", 86),
         ],
     ),
     addPhaseKind("WAIT_BACKGROUND_THREAD", "Wait Background Thread", 2),
@@ -236,6 +240,10 @@ PhaseKindGraphRoots = [
         45,
         [
             getPhaseKind("MARK_ROOTS"),
+            getPhaseKind("MINOR_GC_TRACE_STORE_BUFFER"),
+            getPhaseKind("MINOR_GC_TENURE_FIXED_POINT"),
+            getPhaseKind("MINOR_GC_SWEEP"),
+            getPhaseKind("MINOR_GC_FREE_BUFFERS"),
         ],
     ),
     addPhaseKind(
@@ -244,6 +252,10 @@ PhaseKindGraphRoots = [
         46,
         [
             getPhaseKind("MARK_ROOTS"),
+            getPhaseKind("MINOR_GC_TRACE_STORE_BUFFER"),
+            getPhaseKind("MINOR_GC_TENURE_FIXED_POINT"),
+            getPhaseKind("MINOR_GC_SWEEP"),
+            getPhaseKind("MINOR_GC_FREE_BUFFERS"),
         ],
     ),
     addPhaseKind(
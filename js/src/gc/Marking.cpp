@@ -1243,6 +1243,14 @@ void GCMarker::moveWork(GCMarker* dst, GCMarker* src) {
   MarkStack::moveWork(dst->stack, src->stack);
 }
 
+void GCMarker::moveWorkShare(GCMarker* dst, GCMarker* src, size_t shares) {
+  MOZ_ASSERT(dst->stack.isEmpty());
+  MOZ_ASSERT(src->canDonateWork());
+  MOZ_ASSERT(shares >= 2);
+
+  MarkStack::moveWork(dst->stack, src->stack, src->stack.position() / shares);
+}
+
 bool GCMarker::initStack() {
   MOZ_ASSERT(!isActive());
   MOZ_ASSERT(markColor_ == gc::MarkColor::Black);
@@ -1477,6 +1485,7 @@ inline bool GCMarker::processMarkStackTop(SliceBudget& budget) {
 
   if (stack.peekTag() == MarkStack::SlotsOrElementsRangeTag) {
     auto range = stack.popSlotsOrElementsRange();
+    stack.prefetchTop();
     obj = range.ptr().asRangeObject();
     NativeObject* nobj = &obj->as<NativeObject>();
     kind = range.kind();
@@ -1516,6 +1525,7 @@ inline bool GCMarker::processMarkStackTop(SliceBudget& budget) {
 
   {
     MarkStack::TaggedPtr ptr = stack.popPtr();
+    stack.prefetchTop();
     switch (ptr.tag()) {
       case MarkStack::ObjectTag: {
         obj = ptr.as<JSObject>();
@@ -1878,7 +1888,17 @@ void MarkStack::moveWork(MarkStack& dst, MarkStack& src) {
   static const size_t MaxWordsToMove = 4096;
 
   size_t totalWords = src.position();
-  size_t wordsToMove = std::min(totalWords / 2, MaxWordsToMove);
+  moveWork(dst, src, std::min(totalWords / 2, MaxWordsToMove));
+}
+
+/* static */
+void MarkStack::moveWork(MarkStack& dst, MarkStack& src, size_t wordsToMove) {
+  MOZ_ASSERT(dst.isEmpty());
+  MOZ_ASSERT(wordsToMove <= src.position() / 2);
+
+  if (wordsToMove == 0) {
+    return;
+  }
 
   size_t targetPos = src.position() - wordsToMove;
 
@@ -1982,6 +2002,19 @@ inline MarkStack::TaggedPtr MarkStack::popPtr() {
   return TaggedPtr::fromBits(*end());
 }
 
+inline void MarkStack::prefetchTop() const {
+  if (isEmpty()) {
+    return;
+  }
+
+  // The top word of every entry is a tagged cell pointer, including for slot
+  // and element ranges where it refers to the owning object. Prefetching is a
+  // hint only and never faults, so this does not need to check the tag.
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(peekPtr().ptr());
+#endif
+}
+
 inline MarkStack::SlotsOrElementsRange MarkStack::popSlotsOrElementsRange() {
   MOZ_ASSERT(!isEmpty());
   MOZ_ASSERT(TagIsRangeTag(peekTag()));
@@ -2315,6 +2348,10 @@ IncrementalProgress JS::Zone::enterWeakMarkingMode(GCMarker* marker,
   // An OrderedHashMap::MutableRange stays valid even when the underlying table
   // (zone->gcEphemeronEdges) is mutated, which is useful here since we may add
   // additional entries while iterating over the Range.
+  //
+  // Entries whose edges have all been marked are removed from the table as we
+  // go. Otherwise every re-entry into weak marking mode, for example when
+  // resuming after running out of budget, would rescan them.
   EphemeronEdgeTable::MutableRange r = gcEphemeronEdges().mutableAll();
   while (!r.empty()) {
     Cell* src = r.front().key;
@@ -2325,6 +2362,13 @@ IncrementalProgress JS::Zone::enterWeakMarkingMode(GCMarker* marker,
     if (IsMarked(srcColor) && edges.length() > 0) {
       uint32_t steps = edges.length();
       marker->markEphemeronEdges(edges, AsMarkColor(srcColor));
+
+      // Marking can remove entries from this table and rehash it, so look the
+      // entry up again by its key instead of keeping a pointer to it.
+      if (auto* entry = gcEphemeronEdges().get(src);
+          entry && entry->value.empty()) {
+        gcEphemeronEdges().remove(entry);
+      }
       budget.step(steps);
       if (budget.isOverBudget()) {
         return NotFinished;
@@ -25,6 +25,8 @@
 
 #  include <algorithm>
 #  include <errno.h>
+#  include <stdlib.h>
+#  include <string.h>
 #  include <unistd.h>
 
 #  if !defined(__wasi__)
@@ -115,6 +117,9 @@ static size_t maxValidAddress = 0;
 static size_t hugeSplit = 0;
 #endif
 
+// Whether to allocate GC chunks from huge page backed regions.
+static bool hugePagesEnabled = false;
+
 size_t SystemPageSize() { return pageSize; }
 
 size_t SystemAddressBits() { return numAddressBits; }
@@ -182,6 +187,8 @@ void* TestMapAlignedPagesLastDitch(size_t length, size_t alignment) {
 
 bool DecommitEnabled() { return SystemPageSize() == PageSize; }
 
+bool HugePagesEnabled() { return hugePagesEnabled; }
+
 /* Returns the offset from the nearest aligned address at or below |region|. */
 static inline size_t OffsetFromAligned(void* region, size_t alignment) {
   return uintptr_t(region) % alignment;
@@ -401,6 +408,10 @@ void InitMemorySubsystem() {
 #else  // !defined(JS_64BIT)
     numAddressBits = 32;
 #endif
+#ifdef MADV_HUGEPAGE
+    const char* env = getenv("JS_GC_HUGE_PAGES");
+    hugePagesEnabled = env && *env && strcmp(env, "0") != 0;
+#endif
 #ifdef RLIMIT_AS
     if (jit::HasJitBackend()) {
       rlimit as_limit;
@@ -774,6 +785,22 @@ static bool TryToAlignChunk(void** aRegion, void** aRetainedRegion,
 
 #endif
 
+void* MapAlignedHugePages(size_t length) {
+  MOZ_ASSERT(HugePagesEnabled());
+  MOZ_ASSERT(length % HugePageSize == 0);
+
+  void* region = MapAlignedPages(length, HugePageSize);
+#ifdef MADV_HUGEPAGE
+  if (region) {
+    // This is only advice. The memory is still usable if the kernel has
+    // transparent huge pages disabled.
+    (void)madvise(region, length, MADV_HUGEPAGE);
+  }
+#endif
+
+  return region;
+}
+
 void UnmapPages(void* region, size_t length) {
   MOZ_RELEASE_ASSERT(region &&
                      OffsetFromAligned(region, allocGranularity) == 0);
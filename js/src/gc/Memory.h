@@ -37,6 +37,19 @@ bool UsingScattershotAllocator();
 void* MapAlignedPages(size_t length, size_t alignment);
 void UnmapPages(void* region, size_t length);
 
+// The size of a transparent huge page.
+static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+// Whether GC chunks should be allocated from huge page sized regions that the
+// OS is advised to back with transparent huge pages. This is opt-in by setting
+// the JS_GC_HUGE_PAGES environment variable and is only supported on
+// platforms that provide MADV_HUGEPAGE.
+bool HugePagesEnabled();
+
+// Allocate pages aligned to HugePageSize and advise the OS to back them with
+// huge pages. |length| must be a multiple of HugePageSize.
+void* MapAlignedHugePages(size_t length);
+
 // We can only decommit unused pages if the page size is less than or equal to
 // the hardcoded Arena size for the running process.
 bool DecommitEnabled();
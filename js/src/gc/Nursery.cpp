@@ -1547,13 +1547,18 @@ js::Nursery::CollectionResult js::Nursery::doCollection(AutoGCSession& session,
   // been moved to the major heap. If these objects have any outgoing pointers
   // to the nursery, then those nursery objects get moved as well, until no
   // objects are left to move. That is, we iterate to a fixed point.
-  startProfile(ProfileKey::CollectToObjFP);
-  mover.collectToObjectFixedPoint();
-  endProfile(ProfileKey::CollectToObjFP);
+  {
+    gcstats::AutoPhase ap(stats(),
+                          gcstats::PhaseKind::MINOR_GC_TENURE_FIXED_POINT);
+
+    startProfile(ProfileKey::CollectToObjFP);
+    mover.collectToObjectFixedPoint();
+    endProfile(ProfileKey::CollectToObjFP);
 
-  startProfile(ProfileKey::CollectToStrFP);
-  mover.collectToStringFixedPoint();
-  endProfile(ProfileKey::CollectToStrFP);
+    startProfile(ProfileKey::CollectToStrFP);
+    mover.collectToStringFixedPoint();
+    endProfile(ProfileKey::CollectToStrFP);
+  }
 
 #ifdef JS_GC_ZEAL
   if (reportPromotion_ && options != JS::GCOptions::Shutdown) {
@@ -1565,9 +1570,12 @@ js::Nursery::CollectionResult js::Nursery::doCollection(AutoGCSession& session,
 
   // Sweep to update any pointers to nursery objects that have now been
   // tenured.
-  startProfile(ProfileKey::Sweep);
-  sweep();
-  endProfile(ProfileKey::Sweep);
+  {
+    gcstats::AutoPhase ap(stats(), gcstats::PhaseKind::MINOR_GC_SWEEP);
+    startProfile(ProfileKey::Sweep);
+    sweep();
+    endProfile(ProfileKey::Sweep);
+  }
 
   // Update any slot or element pointers whose destination has been tenured.
   startProfile(ProfileKey::UpdateJitActivations);
@@ -1580,17 +1588,21 @@ js::Nursery::CollectionResult js::Nursery::doCollection(AutoGCSession& session,
   endProfile(ProfileKey::ObjectsTenuredCallback);
 
   // Sweep.
-  startProfile(ProfileKey::FreeMallocedBuffers);
-  gc->queueBuffersForFreeAfterMinorGC(fromSpace.mallocedBuffers,
-                                      stringBuffersToReleaseAfterMinorGC_);
-  fromSpace.mallocedBufferBytes = 0;
-  endProfile(ProfileKey::FreeMallocedBuffers);
-
-  // Give trailer blocks associated with non-tenured Wasm{Struct,Array}Objects
-  // back to our `mallocedBlockCache_`.
-  startProfile(ProfileKey::FreeTrailerBlocks);
-  freeTrailerBlocks(options, reason);
-  endProfile(ProfileKey::FreeTrailerBlocks);
+  {
+    gcstats::AutoPhase ap(stats(), gcstats::PhaseKind::MINOR_GC_FREE_BUFFERS);
+
+    startProfile(ProfileKey::FreeMallocedBuffers);
+    gc->queueBuffersForFreeAfterMinorGC(fromSpace.mallocedBuffers,
+                                        stringBuffersToReleaseAfterMinorGC_);
+    fromSpace.mallocedBufferBytes = 0;
+    endProfile(ProfileKey::FreeMallocedBuffers);
+
+    // Give trailer blocks associated with non-tenured Wasm{Struct,Array}Objects
+    // back to our `mallocedBlockCache_`.
+    startProfile(ProfileKey::FreeTrailerBlocks);
+    freeTrailerBlocks(options, reason);
+    endProfile(ProfileKey::FreeTrailerBlocks);
+  }
 
   startProfile(ProfileKey::ClearNursery);
   clear();
@@ -1657,31 +1669,36 @@ void js::Nursery::traceRoots(AutoGCSession& session, TenuringTracer& mover) {
     MOZ_ASSERT(gc->storeBuffer().isEnabled());
     MOZ_ASSERT(gc->storeBuffer().isEmpty());
 
-    startProfile(ProfileKey::TraceWholeCells);
-    sb.traceWholeCells(mover);
-    endProfile(ProfileKey::TraceWholeCells);
+    {
+      gcstats::AutoPhase ap(stats(),
+                            gcstats::PhaseKind::MINOR_GC_TRACE_STORE_BUFFER);
+
+      startProfile(ProfileKey::TraceWholeCells);
+      sb.traceWholeCells(mover);
+      endProfile(ProfileKey::TraceWholeCells);
 
-    cellsToSweep = sb.releaseCellSweepSet();
+      cellsToSweep = sb.releaseCellSweepSet();
 
-    startProfile(ProfileKey::TraceValues);
-    sb.traceValues(mover);
-    endProfile(ProfileKey::TraceValues);
+      startProfile(ProfileKey::TraceValues);
+      sb.traceValues(mover);
+      endProfile(ProfileKey::TraceValues);
 
-    startProfile(ProfileKey::TraceWasmAnyRefs);
-    sb.traceWasmAnyRefs(mover);
-    endProfile(ProfileKey::TraceWasmAnyRefs);
+      startProfile(ProfileKey::TraceWasmAnyRefs);
+      sb.traceWasmAnyRefs(mover);
+      endProfile(ProfileKey::TraceWasmAnyRefs);
 
-    startProfile(ProfileKey::TraceCells);
-    sb.traceCells(mover);
-    endProfile(ProfileKey::TraceCells);
+      startProfile(ProfileKey::TraceCells);
+      sb.traceCells(mover);
+      endProfile(ProfileKey::TraceCells);
 
-    startProfile(ProfileKey::TraceSlots);
-    sb.traceSlots(mover);
-    endProfile(ProfileKey::TraceSlots);
+      startProfile(ProfileKey::TraceSlots);
+      sb.traceSlots(mover);
+      endProfile(ProfileKey::TraceSlots);
 
-    startProfile(ProfileKey::TraceGenericEntries);
-    sb.traceGenericEntries(&mover);
-    endProfile(ProfileKey::TraceGenericEntries);
+      startProfile(ProfileKey::TraceGenericEntries);
+      sb.traceGenericEntries(&mover);
+      endProfile(ProfileKey::TraceGenericEntries);
+    }
 
     startProfile(ProfileKey::MarkRuntime);
     gc->traceRuntimeForMinorGC(&mover, session);
@@ -70,14 +70,33 @@ bool ParallelMarker::markOneColor(MarkColor color, SliceBudget& sliceBudget) {
   for (size_t i = 0; i < workerCount(); i++) {
     GCMarker* marker = gc->markers[i].get();
     tasks[i].emplace(this, marker, color, sliceBudget);
+  }
 
-    // Attempt to populate empty mark stacks.
-    //
-    // TODO: When tuning for more than two markers we may need to adopt a more
-    // sophisticated approach.
-    if (!marker->hasEntriesForCurrentColor() && gc->marker().canDonateWork()) {
-      GCMarker::moveWork(marker, &gc->marker());
+  // Attempt to populate empty mark stacks.
+  //
+  // Roots are pushed onto the main thread's mark stack, so at the start of a
+  // slice that stack often holds most of the work. This is particularly true
+  // for gray marking, where all the gray roots and incoming cross-compartment
+  // edges have just been traced. Split the work evenly between the main
+  // marker and the empty markers rather than leaving them to receive it a
+  // limited amount at a time by donation.
+  GCMarker* mainMarker = &gc->marker();
+  size_t shares = 1;
+  for (size_t i = 1; i < workerCount(); i++) {
+    if (!gc->markers[i]->hasEntriesForCurrentColor()) {
+      shares++;
+    }
+  }
+  for (size_t i = 1; i < workerCount() && shares > 1; i++) {
+    GCMarker* marker = gc->markers[i].get();
+    if (marker->hasEntriesForCurrentColor()) {
+      continue;
+    }
+    if (!mainMarker->canDonateWork()) {
+      break;
     }
+    GCMarker::moveWorkShare(marker, mainMarker, shares);
+    shares--;
   }
 
   AutoLockHelperThreadState lock;
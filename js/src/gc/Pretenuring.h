@@ -249,6 +249,15 @@ class AllocSite {
     nurseryPromotedCount = 0;
   }
 
+  // Start a newly created site in the long-lived state. This is used when a
+  // previous execution of the same script found this site to be long-lived.
+  void initLongLivedState() {
+    MOZ_ASSERT(isNormal());
+    MOZ_ASSERT(state() == State::Unknown);
+    MOZ_ASSERT(!hasNurseryAllocations());
+    setState(State::LongLived);
+  }
+
   uint32_t incAllocCount() { return ++nurseryAllocCount; }
   uint32_t* nurseryAllocCountAddress() { return &nurseryAllocCount; }
 
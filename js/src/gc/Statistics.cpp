@@ -588,9 +588,10 @@ UniqueChars Statistics::formatDetailedTotals() const {
   ---- Totals ----\n\
     Total Time: %.3fms\n\
     Max Pause: %.3fms\n\
+    Mark Rate: %.0f cells/ms\n\
 ";
   char buffer[1024];
-  SprintfLiteral(buffer, format, t(total), t(longest));
+  SprintfLiteral(buffer, format, t(total), t(longest), computeMarkRate());
   return DuplicateString(buffer);
 }
 
@@ -701,6 +702,7 @@ void Statistics::formatJsonDescription(JSONPrinter& json) const {
     json.property("store_buffer_overflows", storebufferOverflows);
   }
   json.property("slices", slices_.length());
+  json.property("mark_rate", uint64_t(computeMarkRate()));
 
   const double mmu20 = computeMMU(TimeDuration::FromMilliseconds(20));
   const double mmu50 = computeMMU(TimeDuration::FromMilliseconds(50));
@@ -723,6 +725,10 @@ void Statistics::formatJsonDescription(JSONPrinter& json) const {
   if (addedChunks) {
     json.property("added_chunks", addedChunks);
   }
+  uint32_t addedHugePageChunks = getCount(COUNT_NEW_HUGE_PAGE_CHUNK);
+  if (addedHugePageChunks) {
+    json.property("added_huge_page_chunks", addedHugePageChunks);
+  }
   uint32_t removedChunks = getCount(COUNT_DESTROY_CHUNK);
   if (removedChunks) {
     json.property("removed_chunks", removedChunks);
@@ -1048,13 +1054,10 @@ void Statistics::sendGCTelemetry() {
     markNotGrayOrWeak = TimeDuration::Zero();
   }
 
-  size_t markCount = getCount(COUNT_CELLS_MARKED);
-
   runtime->metrics().GC_PREPARE_MS(prepareTotal);
   runtime->metrics().GC_MARK_MS(markNotGrayOrWeak);
   if (markTotal >= TimeDuration::FromMicroseconds(1)) {
-    double markRate = double(markCount) / t(markTotal);
-    runtime->metrics().GC_MARK_RATE_2(uint32_t(markRate));
+    runtime->metrics().GC_MARK_RATE_2(uint32_t(computeMarkRate()));
   }
   runtime->metrics().GC_SWEEP_MS(phaseTimes[Phase::SWEEP]);
   if (gc->didCompactZones()) {
@@ -1542,6 +1545,16 @@ void Statistics::endSCC(unsigned scc, TimeStamp start) {
   sccTimes[scc] += TimeBetween(start, TimeStamp::Now());
 }
 
+// Cells marked per millisecond of marking time.
+double Statistics::computeMarkRate() const {
+  TimeDuration markTotal = SumPhase(PhaseKind::MARK, phaseTimes);
+  if (markTotal < TimeDuration::FromMicroseconds(1)) {
+    return 0.0;
+  }
+
+  return double(getCount(COUNT_CELLS_MARKED)) / t(markTotal);
+}
+
 /*
  * Calculate minimum mutator utilization for previous incremental GC.
  *
@@ -39,6 +39,10 @@ namespace gcstats {
 enum Count {
   COUNT_NEW_CHUNK,
   COUNT_DESTROY_CHUNK,
+
+  // Number of new chunks allocated from huge page backed regions.
+  COUNT_NEW_HUGE_PAGE_CHUNK,
+
   COUNT_MINOR_GC,
 
   // Number of times a 'put' into a storebuffer overflowed, triggering a
@@ -490,6 +494,10 @@ struct Statistics {
 
   double computeMMU(TimeDuration window) const;
 
+  // Cells marked per millisecond of marking time, or zero if too little time
+  // was spent marking to give a meaningful result.
+  double computeMarkRate() const;
+
   void printSliceProfile();
   ProfileDurations getProfileTimes(const SliceData& slice) const;
   void updateTotalProfileTimes(const ProfileDurations& times);
@@ -538,8 +538,8 @@ class Zone : public js::ZoneAllocator, public js::gc::GraphNodeBase<JS::Zone> {
 
   // To support weak pointers in some special cases we keep a list of objects
   // that need to be traced weakly on GC. This is currently only used for the
-  // JIT's ShapeListObject. It's assumed that there will not be many of these
-  // objects.
+  // JIT's ShapeListObject and ShapeSlotTableObject. It's assumed that there
+  // will not be many of these objects.
   using ObjectVector = js::GCVector<JSObject*, 0, js::SystemAllocPolicy>;
   js::MainThreadOrGCTaskData<ObjectVector> objectsWithWeakPointers;
 
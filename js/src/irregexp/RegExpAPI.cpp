@@ -33,6 +33,7 @@
 #include "js/friend/ErrorMessages.h"  // JSMSG_*
 #include "js/friend/StackLimits.h"    // js::ReportOverRecursed
 #include "util/StringBuilder.h"
+#include "vm/Caches.h"  // js::RegExpBytecodeCache
 #include "vm/MatchPairs.h"
 #include "vm/PlainObject.h"
 #include "vm/RegExpShared.h"
@@ -769,9 +770,39 @@ bool InitializeNamedCaptures(JSContext* cx, HandleRegExpShared re,
   return true;
 }
 
+// Use the bytecode which was compiled for an identical regexp, in any zone of
+// the runtime, if the bytecode cache contains it.
+static bool UseCachedByteCode(JSContext* cx, MutableHandleRegExpShared re,
+                              bool isLatin1) {
+  MOZ_ASSERT(re->kind() == RegExpShared::Kind::RegExp);
+
+  uint32_t maxRegisters;
+  RegExpBytecodeCache::UniqueByteCode bytecode =
+      cx->caches().regExpBytecodeCache.lookup(re->getSource(), re->getFlags(),
+                                              isLatin1, &maxRegisters);
+  if (!bytecode) {
+    return false;
+  }
+
+  uint32_t length = bytecode->length();
+  re->updateMaxRegisters(maxRegisters);
+  re->setByteCode(bytecode.release(), isLatin1);
+  js::AddCellMemory(re, length, MemoryUse::RegExpSharedBytecode);
+  return true;
+}
+
 bool CompilePattern(JSContext* cx, MutableHandleRegExpShared re,
                     Handle<JSLinearString*> input,
                     RegExpShared::CodeKind codeKind) {
+  bool isLatin1 = input->hasLatin1Chars();
+  bool useNativeCode = codeKind == RegExpShared::CodeKind::Jitcode;
+
+  // Once parsed, the bytecode doesn't need anything from the parser.
+  if (!useNativeCode && re->kind() == RegExpShared::Kind::RegExp &&
+      UseCachedByteCode(cx, re, isLatin1)) {
+    return true;
+  }
+
   Rooted<JSAtom*> pattern(cx, re->getSource());
   JS::RegExpFlags flags = re->getFlags();
   LifoAllocScope allocScope(&cx->tempLifoAlloc());
@@ -832,14 +863,18 @@ bool CompilePattern(JSContext* cx, MutableHandleRegExpShared re,
     // Add one to capture_count to account for the whole-match capture.
     uint32_t pairCount = data.capture_count + 1;
     re->useRegExpMatch(pairCount);
+
+    // The named captures and the pair count come from the parser, but the
+    // bytecode can be shared with an identical regexp.
+    if (!useNativeCode && UseCachedByteCode(cx, re, isLatin1)) {
+      return true;
+    }
   }
 
   MOZ_ASSERT(re->kind() == RegExpShared::Kind::RegExp);
 
   RegExpCompiler compiler(cx->isolate, &zone, data.capture_count, flags,
-                          input->hasLatin1Chars());
-
-  bool isLatin1 = input->hasLatin1Chars();
+                          isLatin1);
 
   SampleCharacters(input, compiler);
   data.node = compiler.PreprocessRegExp(&data, isLatin1);
@@ -850,7 +885,6 @@ bool CompilePattern(JSContext* cx, MutableHandleRegExpShared re,
     return false;
   }
 
-  bool useNativeCode = codeKind == RegExpShared::CodeKind::Jitcode;
   MOZ_ASSERT_IF(useNativeCode, IsNativeRegExpEnabled());
 
   switch (Assemble(cx, &compiler, &data, re, pattern, &zone, useNativeCode,
@@ -865,6 +899,12 @@ bool CompilePattern(JSContext* cx, MutableHandleRegExpShared re,
     case AssembleResult::Success:
       break;
   }
+
+  if (!useNativeCode) {
+    cx->caches().regExpBytecodeCache.put(pattern, flags, isLatin1,
+                                         re->getByteCode(isLatin1),
+                                         re->getMaxRegisters());
+  }
   return true;
 }
 
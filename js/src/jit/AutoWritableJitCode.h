@@ -9,21 +9,153 @@
 
 #include "mozilla/Assertions.h"
 #include "mozilla/Attributes.h"
-#include "mozilla/ScopeExit.h"
 #include "mozilla/TimeStamp.h"
 
+#include <algorithm>
 #include <stddef.h>
+#include <stdint.h>
 
+#include "gc/Memory.h"
 #include "jit/ExecutableAllocator.h"
 #include "jit/JitCode.h"
 #include "jit/JitOptions.h"
 #include "jit/ProcessExecutableMemory.h"
+#include "js/AllocPolicy.h"
+#include "js/Vector.h"
 #include "vm/JSContext.h"
 #include "vm/Realm.h"
 #include "vm/Runtime.h"
 
 namespace js::jit {
 
+// Records the time spent changing page protections in the current realm's
+// timers.
+class MOZ_RAII AutoProtectTimer {
+  JSRuntime* rt_;
+  mozilla::TimeStamp startTime_;
+
+ public:
+  explicit AutoProtectTimer(JSRuntime* rt) : rt_(rt) {
+    // Taking TimeStamps frequently can be expensive, and there's no point
+    // measuring this if write protection is disabled.
+    if (JitOptions.writeProtectCode) {
+      startTime_ = mozilla::TimeStamp::Now();
+    }
+  }
+  ~AutoProtectTimer() {
+    if (!startTime_.IsNull()) {
+      if (Realm* realm = rt_->mainContextFromOwnThread()->realm()) {
+        realm->timers.protectTime += mozilla::TimeStamp::Now() - startTime_;
+      }
+    }
+  }
+};
+
+// Batches the protection changes made by the AutoWritableJitCode scopes
+// created while it's live, for operations that patch many pieces of JIT code
+// at once, like invalidating Ion frames or toggling profiler instrumentation.
+//
+// Code that's made writable within the batch stays writable until the batch
+// ends. Pages shared by several JitCodes are then only made writable once, and
+// all pages are made executable again with one call per contiguous range. No
+// JIT code may run while a batch is live.
+//
+// Batches are per-runtime and are ignored when write protection is disabled or
+// another batch is already live, in which case the outer batch makes the code
+// executable. JitCode::finalize flushes the batch, to make sure it doesn't
+// refer to memory that's been freed.
+class MOZ_RAII AutoWritableJitCodeBatch {
+  JSRuntime* rt_;
+
+  // Page-aligned [start, end) ranges that are writable, sorted by address and
+  // not adjacent to each other.
+  struct PageRange {
+    uintptr_t start;
+    uintptr_t end;
+  };
+  Vector<PageRange, 8, SystemAllocPolicy> ranges_;
+
+  static PageRange pageRange(void* addr, size_t size) {
+    uintptr_t pageMask = gc::SystemPageSize() - 1;
+    uintptr_t start = uintptr_t(addr) & ~pageMask;
+    uintptr_t end = (uintptr_t(addr) + size + pageMask) & ~pageMask;
+    return {start, end};
+  }
+
+  // Returns the index of the first range that ends at or after |start|.
+  size_t lowerBound(uintptr_t start) const {
+    size_t lo = 0;
+    size_t hi = ranges_.length();
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (ranges_[mid].end < start) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+ public:
+  explicit AutoWritableJitCodeBatch(JSRuntime* rt) : rt_(rt) {
+    if (JitOptions.writeProtectCode && !rt->autoWritableJitCodeBatch()) {
+      rt->setAutoWritableJitCodeBatch(this);
+    }
+  }
+
+  ~AutoWritableJitCodeBatch() {
+    if (rt_->autoWritableJitCodeBatch() == this) {
+      flush();
+      rt_->setAutoWritableJitCodeBatch(nullptr);
+    }
+  }
+
+  // Whether all pages overlapping [addr, addr + size) are already writable.
+  bool contains(void* addr, size_t size) const {
+    PageRange range = pageRange(addr, size);
+    size_t index = lowerBound(range.start);
+    return index < ranges_.length() && ranges_[index].start <= range.start &&
+           range.end <= ranges_[index].end;
+  }
+
+  // Record that [addr, addr + size) has been made writable, merging it with
+  // the ranges it overlaps or touches. Returns false on OOM, in which case the
+  // caller must make the code executable itself.
+  [[nodiscard]] bool add(void* addr, size_t size) {
+    PageRange range = pageRange(addr, size);
+    size_t index = lowerBound(range.start);
+    size_t last = index;
+    while (last < ranges_.length() && ranges_[last].start <= range.end) {
+      range.start = std::min(range.start, ranges_[last].start);
+      range.end = std::max(range.end, ranges_[last].end);
+      last++;
+    }
+    if (index == last) {
+      return ranges_.insert(ranges_.begin() + index, range) != nullptr;
+    }
+    ranges_[index] = range;
+    ranges_.erase(ranges_.begin() + index + 1, ranges_.begin() + last);
+    return true;
+  }
+
+  // Make all the code in the batch executable.
+  void flush() {
+    if (ranges_.empty()) {
+      return;
+    }
+
+    AutoProtectTimer timer(rt_);
+    for (const PageRange& range : ranges_) {
+      if (!ExecutableAllocator::makeExecutableAndFlushICache(
+              reinterpret_cast<void*>(range.start), range.end - range.start)) {
+        MOZ_CRASH();
+      }
+    }
+    ranges_.clear();
+  }
+};
+
 // This class ensures JIT code is executable on its destruction. Creators
 // must call makeWritable(), and not attempt to write to the buffer if it fails.
 //
@@ -36,6 +168,9 @@ class MOZ_RAII AutoWritableJitCodeFallible {
   size_t size_;
   AutoMarkJitCodeWritableForThread writableForThread_;
 
+  // Whether the live AutoWritableJitCodeBatch will make the code executable.
+  bool batched_ = false;
+
  public:
   explicit AutoWritableJitCodeFallible(JitCode* code)
       : rt_(code->runtimeFromMainThread()),
@@ -45,25 +180,30 @@ class MOZ_RAII AutoWritableJitCodeFallible {
   }
 
   [[nodiscard]] bool makeWritable() {
-    return ExecutableAllocator::makeWritable(addr_, size_);
+    AutoWritableJitCodeBatch* batch = rt_->autoWritableJitCodeBatch();
+    if (batch && batch->contains(addr_, size_)) {
+      batched_ = true;
+      return true;
+    }
+    if (!ExecutableAllocator::makeWritable(addr_, size_)) {
+      return false;
+    }
+    batched_ = batch && batch->add(addr_, size_);
+    return true;
   }
 
   ~AutoWritableJitCodeFallible() {
-    // Taking TimeStamps frequently can be expensive, and there's no point
-    // measuring this if write protection is disabled.
-    const bool measuringTime = JitOptions.writeProtectCode;
-    const mozilla::TimeStamp startTime =
-        measuringTime ? mozilla::TimeStamp::Now() : mozilla::TimeStamp();
-    auto timer = mozilla::MakeScopeExit([&] {
-      if (measuringTime) {
-        if (Realm* realm = rt_->mainContextFromOwnThread()->realm()) {
-          realm->timers.protectTime += mozilla::TimeStamp::Now() - startTime;
-        }
+    if (!batched_) {
+      // The batch may expect some of the pages we're about to make executable
+      // to be writable, so flush it first.
+      if (AutoWritableJitCodeBatch* batch = rt_->autoWritableJitCodeBatch()) {
+        batch->flush();
       }
-    });
 
-    if (!ExecutableAllocator::makeExecutableAndFlushICache(addr_, size_)) {
-      MOZ_CRASH();
+      AutoProtectTimer timer(rt_);
+      if (!ExecutableAllocator::makeExecutableAndFlushICache(addr_, size_)) {
+        MOZ_CRASH();
+      }
     }
     rt_->toggleAutoWritableJitCodeActive(false);
   }
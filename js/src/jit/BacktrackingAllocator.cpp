@@ -1357,6 +1357,14 @@ size_t BacktrackingAllocator::computePriority(LiveBundle* bundle) {
   return lifetimeTotal;
 }
 
+size_t BacktrackingAllocator::queuePriority(LiveBundle* bundle) {
+  // In linear scan mode, bundles which start earlier are processed first.
+  if (linearScan) {
+    return CodePosition::MAX.bits() - bundle->firstRange()->from().bits();
+  }
+  return computePriority(bundle);
+}
+
 bool BacktrackingAllocator::minimalDef(LiveRange* range, LNode* ins) {
   // Whether this is a minimal range capturing a definition at ins.
   return (range->to() <= minimalDefEnd(ins).next()) &&
@@ -2356,7 +2364,7 @@ bool BacktrackingAllocator::mergeAndQueueRegisters() {
         }
         bundle->setSpillSet(spill);
 
-        size_t priority = computePriority(bundle);
+        size_t priority = queuePriority(bundle);
         if (!allocationQueue.insert(QueueItem(bundle, priority))) {
           return false;
         }
@@ -2447,7 +2455,7 @@ bool BacktrackingAllocator::updateVirtualRegisterListsThenRequeueBundles(
   // Queue the new bundles for register assignment.
   for (size_t i = 0; i < newBundles.length(); i++) {
     LiveBundle* newBundle = newBundles[i];
-    size_t priority = computePriority(newBundle);
+    size_t priority = queuePriority(newBundle);
     if (!allocationQueue.insert(QueueItem(newBundle, priority))) {
       return false;
     }
@@ -3429,7 +3437,9 @@ bool BacktrackingAllocator::tryAllocateRegister(PhysicalRegister& r,
 
     if (conflicting.empty()) {
       conflicting = std::move(aliasedConflicting);
-    } else {
+    } else if (!linearScan || minimalBundle(bundle)) {
+      // In linear scan mode only minimal bundles evict other bundles, so
+      // don't bother comparing spill weights for other bundles.
       if (maximumSpillWeight(aliasedConflicting) <
           maximumSpillWeight(conflicting)) {
         conflicting = std::move(aliasedConflicting);
@@ -3519,7 +3529,7 @@ bool BacktrackingAllocator::evictBundle(LiveBundle* bundle) {
 
   bundle->setAllocation(LAllocation());
 
-  size_t priority = computePriority(bundle);
+  size_t priority = queuePriority(bundle);
   return allocationQueue.insert(QueueItem(bundle, priority));
 }
 
@@ -3648,9 +3658,12 @@ bool BacktrackingAllocator::processBundle(const MIRGenerator* mir,
       }
 
       // If that didn't work, but we have one or more non-call bundles known to
-      // be conflicting, maybe we can evict them and try again.
-      if ((attempt < MAX_ATTEMPTS || minimalBundle(bundle)) && !hasCall &&
-          !conflicting.empty() &&
+      // be conflicting, maybe we can evict them and try again. In linear scan
+      // mode only minimal bundles, which must get a register, evict others.
+      bool mayEvict =
+          linearScan ? minimalBundle(bundle)
+                     : (attempt < MAX_ATTEMPTS || minimalBundle(bundle));
+      if (mayEvict && !hasCall && !conflicting.empty() &&
           maximumSpillWeight(conflicting) < computeSpillWeight(bundle)) {
         for (size_t i = 0; i < conflicting.length(); i++) {
           if (!evictBundle(conflicting[i])) {
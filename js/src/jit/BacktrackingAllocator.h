@@ -667,6 +667,13 @@ class BacktrackingAllocator : protected RegisterAllocator {
   // This flag is set when testing new allocator modifications.
   bool testbed;
 
+  // This flag is set to allocate in linear scan order: bundles are processed
+  // in order of their start position and only minimal bundles may evict
+  // other bundles. Bundles that don't get a register are split right away.
+  // This is cheaper than the default allocation order, at the cost of more
+  // spills and moves. See processBundle().
+  bool linearScan;
+
   using VirtualRegBitSet = SparseBitSet<BackgroundSystemAllocPolicy>;
   Vector<VirtualRegBitSet, 0, JitAllocPolicy> liveIn;
   Vector<VirtualRegister, 0, JitAllocPolicy> vregs;
@@ -807,6 +814,7 @@ class BacktrackingAllocator : protected RegisterAllocator {
 
   // Misc helpers: computation of bundle priorities and spill weights
   size_t computePriority(LiveBundle* bundle);
+  size_t queuePriority(LiveBundle* bundle);
   bool minimalDef(LiveRange* range, LNode* ins);
   bool minimalUse(LiveRange* range, UsePosition* use);
   bool minimalBundle(LiveBundle* bundle, bool* pfixed = nullptr);
@@ -913,9 +921,10 @@ class BacktrackingAllocator : protected RegisterAllocator {
   // visible bit.
  public:
   BacktrackingAllocator(MIRGenerator* mir, LIRGenerator* lir, LIRGraph& graph,
-                        bool testbed)
+                        bool testbed, bool linearScan)
       : RegisterAllocator(mir, lir, graph),
         testbed(testbed),
+        linearScan(linearScan),
         liveIn(mir->alloc()),
         vregs(mir->alloc()) {}
 
@@ -2056,7 +2056,8 @@ bool jit::FinishBailoutToBaseline(BaselineBailoutInfo* bailoutInfoArg) {
       break;
 
     case BailoutKind::HoistBoundsCheck:
-      // An instruction hoisted or generated by tryHoistBoundsCheck bailed out.
+      // An instruction hoisted or generated by tryHoistBoundsCheck or by loop
+      // unrolling bailed out.
       MOZ_ASSERT(!outerScript->failedBoundsCheck());
       outerScript->setFailedBoundsCheck();
       InvalidateAfterBailout(cx, outerScript, "bounds check failure");
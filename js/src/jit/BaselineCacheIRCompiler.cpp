@@ -6,6 +6,9 @@
 
 #include "jit/BaselineCacheIRCompiler.h"
 
+#include "mozilla/Array.h"
+#include "mozilla/MathAlgorithms.h"
+
 #include "gc/GC.h"
 #include "jit/CacheIR.h"
 #include "jit/CacheIRCloner.h"
@@ -2211,8 +2214,343 @@ bool ShapeListObject::traceWeak(JSTracer* trc) {
   return length != 0;
 }
 
-bool js::jit::TryFoldingStubs(JSContext* cx, ICFallbackStub* fallback,
-                              JSScript* script, ICScript* icScript) {
+const JSClass ShapeSlotTableObject::class_ = {
+    "JIT ShapeSlotTable",
+    0,
+    &classOps_,
+};
+
+const JSClassOps ShapeSlotTableObject::classOps_ = {
+    nullptr,                      // addProperty
+    nullptr,                      // delProperty
+    nullptr,                      // enumerate
+    nullptr,                      // newEnumerate
+    nullptr,                      // resolve
+    nullptr,                      // mayResolve
+    nullptr,                      // finalize
+    nullptr,                      // call
+    nullptr,                      // construct
+    ShapeSlotTableObject::trace,  // trace
+};
+
+/* static */ ShapeSlotTableObject* ShapeSlotTableObject::create(JSContext* cx) {
+  NativeObject* obj = NewTenuredObjectWithGivenProto(cx, &class_, nullptr);
+  if (!obj) {
+    return nullptr;
+  }
+
+  // Register this object so the GC can sweep its weak pointers.
+  if (!cx->zone()->registerObjectWithWeakPointers(obj)) {
+    return nullptr;
+  }
+
+  Rooted<ShapeSlotTableObject*> table(cx, &obj->as<ShapeSlotTableObject>());
+  if (!table->resize(cx, MinCapacity)) {
+    return nullptr;
+  }
+  return table;
+}
+
+uint32_t ShapeSlotTableObject::numEntries() const {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < capacity() * 2; i++) {
+    if (shapeAt(i)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// The elements only ever hold PrivateValues and Int32Values, which don't need
+// GC barriers, so insert and fill write them directly. This lets us use them
+// while sweeping.
+void ShapeSlotTableObject::insert(Shape* shape, uint32_t slot) {
+  uint32_t entry = hash(shape) & (capacity() - 1);
+  while (shapeAt(entry)) {
+    MOZ_ASSERT(shapeAt(entry) != shape);
+    entry++;
+    MOZ_ASSERT(entry < capacity() * 2);
+  }
+  elements_[entry * 2].unbarrieredSet(PrivateValue(shape));
+  elements_[entry * 2 + 1].unbarrieredSet(Int32Value(int32_t(slot)));
+}
+
+void ShapeSlotTableObject::fill(const Entry* entries, uint32_t count) {
+  MOZ_ASSERT(count * 2 <= capacity());
+  for (uint32_t i = 0; i < capacity() * 2; i++) {
+    elements_[i * 2].unbarrieredSet(PrivateValue(nullptr));
+    elements_[i * 2 + 1].unbarrieredSet(Int32Value(0));
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    insert(entries[i].shape, entries[i].slot);
+  }
+}
+
+bool ShapeSlotTableObject::resize(JSContext* cx, uint32_t newCapacity) {
+  MOZ_ASSERT(mozilla::IsPowerOfTwo(newCapacity));
+  MOZ_ASSERT(newCapacity > capacity());
+
+  mozilla::Array<Entry, MaxEntries> entries;
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < capacity() * 2; i++) {
+    if (Shape* shape = shapeAt(i)) {
+      entries[count++] = Entry{shape, slotAt(i)};
+    }
+  }
+
+  uint32_t oldLength = length();
+  uint32_t newLength = newCapacity * 4;
+  if (!ensureElements(cx, newLength)) {
+    return false;
+  }
+  ensureDenseInitializedLength(oldLength, newLength - oldLength);
+
+  fill(entries.begin(), count);
+  return true;
+}
+
+bool ShapeSlotTableObject::add(JSContext* cx, Shape* shape, uint32_t slot) {
+  uint32_t count = numEntries();
+  MOZ_ASSERT(count < MaxEntries);
+  if ((count + 1) * 2 > capacity() && !resize(cx, capacity() * 2)) {
+    return false;
+  }
+  insert(shape, slot);
+  return true;
+}
+
+void ShapeSlotTableObject::trace(JSTracer* trc, JSObject* obj) {
+  if (trc->traceWeakEdges()) {
+    obj->as<ShapeSlotTableObject>().traceWeak(trc);
+  }
+}
+
+bool ShapeSlotTableObject::traceWeak(JSTracer* trc) {
+  uint32_t length = getDenseInitializedLength();
+  if (length == 0) {
+    return false;  // Object may be uninitialized.
+  }
+
+  // The table is keyed on the shape's address, so rehash the live entries.
+  // Compacting GC may have moved them.
+  mozilla::Array<Entry, MaxEntries> entries;
+  uint32_t count = 0;
+  uint32_t numCleared = 0;
+  for (uint32_t i = 0; i < capacity() * 2; i++) {
+    Shape* shape = shapeAt(i);
+    if (!shape) {
+      continue;
+    }
+    MOZ_ASSERT(shape->is<Shape>());
+    if (TraceManuallyBarrieredWeakEdge(trc, &shape,
+                                       "ShapeSlotTableObject shape")) {
+      entries[count++] = Entry{shape, slotAt(i)};
+    } else {
+      numCleared++;
+    }
+  }
+
+  fill(entries.begin(), count);
+
+  if (numCleared) {
+    JitSpew(JitSpew_StubFolding, "Cleared %u/%u shapes from %p", numCleared,
+            count + numCleared, this);
+  }
+
+  return true;
+}
+
+// Returns whether |reader| reads the CacheIR for a GetProp stub that loads an
+// own data property, as attached by GetPropIRGenerator::tryAttachNative:
+//
+//   GuardToObject, GuardShape, Load{Fixed,Dynamic}SlotResult, ReturnFromIC
+//
+// Stubs like this for different shapes can be folded into a single
+// LoadSlotByShapeTableResult, even if the property is stored in a different
+// slot for each shape.
+static bool IsFoldableSlotLoad(CacheIRReader& reader, uint32_t* shapeOffset,
+                               uint32_t* slotOffset, bool* isDynamic) {
+  if (!reader.more() || reader.readOp() != CacheOp::GuardToObject) {
+    return false;
+  }
+  ValOperandId valId = reader.valOperandId();
+  if (valId.id() != 0) {
+    return false;
+  }
+  ObjOperandId objId(valId.id());
+
+  if (!reader.more() || reader.readOp() != CacheOp::GuardShape) {
+    return false;
+  }
+  if (reader.objOperandId() != objId) {
+    return false;
+  }
+  *shapeOffset = reader.stubOffset();
+
+  if (!reader.more()) {
+    return false;
+  }
+  CacheOp op = reader.readOp();
+  if (op != CacheOp::LoadFixedSlotResult &&
+      op != CacheOp::LoadDynamicSlotResult) {
+    return false;
+  }
+  if (reader.objOperandId() != objId) {
+    return false;
+  }
+  *slotOffset = reader.stubOffset();
+  *isDynamic = op == CacheOp::LoadDynamicSlotResult;
+
+  return reader.more() && reader.readOp() == CacheOp::ReturnFromIC &&
+         !reader.more();
+}
+
+// Returns the ShapeSlotTableObject if |stub| is a folded stub created by
+// TryFoldingSlotLoads.
+static ShapeSlotTableObject* GetFoldedSlotTable(ICCacheIRStub* stub) {
+  const CacheIRStubInfo* stubInfo = stub->stubInfo();
+  if (stubInfo->kind() != CacheKind::GetProp) {
+    return nullptr;
+  }
+
+  CacheIRReader reader(stubInfo);
+  if (reader.readOp() != CacheOp::GuardToObject) {
+    return nullptr;
+  }
+  ObjOperandId objId(reader.valOperandId().id());
+
+  if (!reader.more() ||
+      reader.readOp() != CacheOp::LoadSlotByShapeTableResult) {
+    return nullptr;
+  }
+  if (reader.objOperandId() != objId) {
+    return nullptr;
+  }
+  uint32_t tableOffset = reader.stubOffset();
+
+  if (!reader.more() || reader.readOp() != CacheOp::ReturnFromIC) {
+    return nullptr;
+  }
+
+  JSObject* table =
+      stubInfo->getStubField<StubField::Type::JSObject>(stub, tableOffset);
+  return &table->as<ShapeSlotTableObject>();
+}
+
+// Fold GetProp stubs that load an own data property into a single stub with a
+// ShapeSlotTableObject. This is used when the stubs can't be folded with
+// GuardMultipleShapes because the property is stored in different slots.
+static bool TryFoldingSlotLoads(JSContext* cx, ICFallbackStub* fallback,
+                                JSScript* script, ICScript* icScript) {
+  ICEntry* icEntry = icScript->icEntryForStub(fallback);
+  ICStub* entryStub = icEntry->firstStub();
+
+  // Don't fold unless there are at least two stubs.
+  if (entryStub == fallback) {
+    return true;
+  }
+  ICCacheIRStub* firstStub = entryStub->toCacheIRStub();
+  if (firstStub->next()->isFallback()) {
+    return true;
+  }
+
+  // Check to see if:
+  //   a) all of the stubs in this chain are foldable slot loads.
+  //   b) at least one stub after the first has a non-zero entry count.
+  //   c) all of the shapes have the same realm.
+  uint32_t numActive = 0;
+  Vector<ShapeSlotTableObject::Entry, 8, SystemAllocPolicy> entries;
+
+  for (ICCacheIRStub* stub = firstStub; stub; stub = stub->nextCacheIR()) {
+    const CacheIRStubInfo* stubInfo = stub->stubInfo();
+    if (stubInfo->kind() != CacheKind::GetProp) {
+      return true;
+    }
+
+    CacheIRReader reader(stubInfo);
+    uint32_t shapeOffset, slotOffset;
+    bool isDynamic;
+    if (!IsFoldableSlotLoad(reader, &shapeOffset, &slotOffset, &isDynamic)) {
+      return true;
+    }
+
+    if (stub != firstStub && stub->enteredCount() > 0) {
+      numActive++;
+    }
+
+    Shape* shape =
+        stubInfo->getStubField<StubField::Type::WeakShape>(stub, shapeOffset)
+            .unbarrieredGet();
+    if (shape->realm() != cx->realm()) {
+      return true;
+    }
+    for (const auto& entry : entries) {
+      if (entry.shape == shape) {
+        return true;
+      }
+    }
+
+    gc::ReadBarrier(shape);
+
+    uint32_t offset = stubInfo->getStubRawInt32(stub, slotOffset);
+    uint32_t slot = ShapeSlotTableObject::encodeSlot(isDynamic, offset);
+    if (!entries.append(ShapeSlotTableObject::Entry{shape, slot})) {
+      cx->recoverFromOutOfMemory();
+      return true;
+    }
+  }
+
+  if (numActive == 0) {
+    return true;
+  }
+  MOZ_ASSERT(entries.length() <= ShapeSlotTableObject::MaxEntries);
+
+  CacheIRWriter writer(cx);
+  ValOperandId valId(writer.setInputOperandId(0));
+  ObjOperandId objId = writer.guardToObject(valId);
+  {
+    // Ensure that allocating the table doesn't trigger a GC and sweep the
+    // shapes we've collected. See also TryFoldingShapeGuards.
+    gc::AutoSuppressGC suppressGC(cx);
+
+    Rooted<ShapeSlotTableObject*> table(cx, ShapeSlotTableObject::create(cx));
+    if (!table) {
+      return false;
+    }
+    for (const auto& entry : entries) {
+      if (!table->add(cx, entry.shape, entry.slot)) {
+        return false;
+      }
+    }
+    writer.loadSlotByShapeTableResult(objId, table);
+  }
+  writer.returnFromIC();
+
+  // Replace the existing stubs with the new folded stub.
+  fallback->discardStubs(cx->zone(), icEntry);
+
+  ICAttachResult result =
+      AttachBaselineCacheIRStub(cx, writer, CacheKind::GetProp, script,
+                                icScript, fallback, "StubFoldSlotTable");
+  if (result == ICAttachResult::OOM) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  MOZ_ASSERT(result == ICAttachResult::Attached);
+
+  JitSpew(JitSpew_StubFolding,
+          "Folded stub at offset %u (icScript: %p) into slot table with %zu "
+          "shapes (%s:%u:%u)",
+          fallback->pcOffset(), icScript, entries.length(), script->filename(),
+          script->lineno(), script->column().oneOriginValue());
+
+  fallback->setMayHaveFoldedStub();
+  return true;
+}
+
+static bool TryFoldingShapeGuards(JSContext* cx, ICFallbackStub* fallback,
+                                  JSScript* script, ICScript* icScript,
+                                  bool* folded) {
   ICEntry* icEntry = icScript->icEntryForStub(fallback);
   ICStub* entryStub = icEntry->firstStub();
 
@@ -2405,6 +2743,65 @@ bool js::jit::TryFoldingStubs(JSContext* cx, ICFallbackStub* fallback,
           script->column().oneOriginValue());
 
   fallback->setMayHaveFoldedStub();
+  *folded = true;
+  return true;
+}
+
+bool js::jit::TryFoldingStubs(JSContext* cx, ICFallbackStub* fallback,
+                              JSScript* script, ICScript* icScript) {
+  bool folded = false;
+  if (!TryFoldingShapeGuards(cx, fallback, script, icScript, &folded)) {
+    return false;
+  }
+  if (folded) {
+    return true;
+  }
+  return TryFoldingSlotLoads(cx, fallback, script, icScript);
+}
+
+// Try to add the case attached by |writer| to a folded stub created by
+// TryFoldingSlotLoads.
+static bool AddToFoldedSlotTable(JSContext* cx, const CacheIRWriter& writer,
+                                 ICCacheIRStub* stub) {
+  Rooted<ShapeSlotTableObject*> table(cx, GetFoldedSlotTable(stub));
+  if (!table) {
+    return false;
+  }
+
+  CacheIRReader reader(writer);
+  uint32_t shapeOffset, slotOffset;
+  bool isDynamic;
+  if (!IsFoldableSlotLoad(reader, &shapeOffset, &slotOffset, &isDynamic)) {
+    return false;
+  }
+
+  StubField shapeField =
+      writer.readStubField(shapeOffset, StubField::Type::WeakShape);
+  Shape* shape = reinterpret_cast<Shape*>(shapeField.asWord());
+
+  // Don't add a shape if it's from a different realm than the table. See the
+  // comment in AddToFoldedStub.
+  if (table->realm() != shape->realm()) {
+    return false;
+  }
+
+  // Limit the maximum number of shapes we will add before giving up.
+  if (table->numEntries() == ShapeSlotTableObject::MaxEntries) {
+    return false;
+  }
+
+  StubField slotField =
+      writer.readStubField(slotOffset, StubField::Type::RawInt32);
+  uint32_t slot =
+      ShapeSlotTableObject::encodeSlot(isDynamic, uint32_t(slotField.asWord()));
+  if (!table->add(cx, shape, slot)) {
+    cx->recoverFromOutOfMemory();
+    return false;
+  }
+
+  JitSpew(JitSpew_StubFolding, "ShapeSlotTableObject %p: new entries: %u",
+          table.get(), table->numEntries());
+
   return true;
 }
 
@@ -2422,6 +2819,10 @@ static bool AddToFoldedStub(JSContext* cx, const CacheIRWriter& writer,
     return false;
   }
 
+  if (AddToFoldedSlotTable(cx, writer, stub)) {
+    return true;
+  }
+
   const CacheIRStubInfo* stubInfo = stub->stubInfo();
   const uint8_t* stubData = stub->stubDataStart();
 
@@ -2659,10 +3060,10 @@ ICAttachResult js::jit::AttachBaselineCacheIRStub(
 
     // Instead of adding a new stub, we have added a new case to an existing
     // folded stub. We do not have to invalidate Warp, because the
-    // ShapeListObject that stores the cases is shared between baseline and
-    // Warp. Reset the entered count for the fallback stub so that we can still
-    // transpile, and reset the bailout counter if we have already been
-    // transpiled.
+    // ShapeListObject or ShapeSlotTableObject that stores the cases is shared
+    // between baseline and Warp. Reset the entered count for the fallback stub
+    // so that we can still transpile, and reset the bailout counter if we have
+    // already been transpiled.
     stub->resetEnteredCount();
     JSScript* owningScript = nullptr;
     if (cx->zone()->jitZone()->hasStubFoldingBailoutData(outerScript)) {
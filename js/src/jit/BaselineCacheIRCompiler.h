@@ -173,6 +173,74 @@ class ShapeListObject : public ListObject {
   bool traceWeak(JSTracer* trc);
 };
 
+// Special object used for storing a table mapping shapes to the slot that
+// holds a property for objects with that shape. This lets a single stub cover
+// a polymorphic property access when the shapes store the property in
+// different slots. Like ShapeListObject, these are only used in the fields of
+// CacheIR stubs and do not escape.
+//
+// The elements are an open-addressed hash table of (shape, slot) entries,
+// stored as pairs of Values. The shape is a PrivateValue, or
+// PrivateValue(nullptr) for an empty entry. The slot is an Int32Value holding
+// the byte offset of the slot, with DynamicSlotFlag set if the offset is
+// relative to the dynamic slots instead of the object.
+//
+// Shapes are hashed to one of the first |capacity()| entries and collisions
+// are resolved by linear probing. The table has 2 * capacity() entries and is
+// kept at most half full, so a probe never runs past the end and always
+// reaches an empty entry. See MacroAssembler::loadSlotByShapeTable.
+class ShapeSlotTableObject : public ListObject {
+ public:
+  static const JSClass class_;
+  static const JSClassOps classOps_;
+
+  static constexpr uint32_t MinCapacity = 8;
+  static constexpr uint32_t MaxEntries = 64;
+
+  struct Entry {
+    Shape* shape;
+    uint32_t slot;
+  };
+
+ private:
+  void insert(Shape* shape, uint32_t slot);
+  void fill(const Entry* entries, uint32_t count);
+  [[nodiscard]] bool resize(JSContext* cx, uint32_t capacity);
+
+ public:
+  static constexpr uint32_t HashShift = gc::CellAlignShift;
+  static constexpr uint32_t DynamicSlotFlag = 1;
+
+  // Fixed and dynamic slot offsets are multiples of sizeof(Value), so the low
+  // bit is available for the flag.
+  static uint32_t encodeSlot(bool isDynamic, uint32_t offset) {
+    MOZ_ASSERT(offset % sizeof(Value) == 0);
+    return isDynamic ? (offset | DynamicSlotFlag) : offset;
+  }
+
+  static uint32_t hash(Shape* shape) {
+    return uint32_t(uintptr_t(shape) >> HashShift);
+  }
+
+  static ShapeSlotTableObject* create(JSContext* cx);
+  static void trace(JSTracer* trc, JSObject* obj);
+
+  uint32_t capacity() const { return length() / 4; }
+  uint32_t numEntries() const;
+
+  Shape* shapeAt(uint32_t entry) const {
+    return static_cast<Shape*>(get(entry * 2).toPrivate());
+  }
+  uint32_t slotAt(uint32_t entry) const {
+    return uint32_t(get(entry * 2 + 1).toInt32());
+  }
+
+  // Adds a new entry, growing the table if necessary. Returns false on OOM.
+  [[nodiscard]] bool add(JSContext* cx, Shape* shape, uint32_t slot);
+
+  bool traceWeak(JSTracer* trc);
+};
+
 }  // namespace jit
 }  // namespace js
 
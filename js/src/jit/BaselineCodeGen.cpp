@@ -6,6 +6,7 @@
 
 #include "jit/BaselineCodeGen.h"
 
+#include "mozilla/BinarySearch.h"
 #include "mozilla/Casting.h"
 
 #include "gc/GC.h"
@@ -31,6 +32,8 @@
 #include "vm/AsyncFunction.h"
 #include "vm/AsyncIteration.h"
 #include "vm/BuiltinObjectKind.h"
+#include "vm/BytecodeIterator.h"
+#include "vm/BytecodeLocation.h"
 #include "vm/EnvironmentObject.h"
 #include "vm/FunctionFlags.h"  // js::FunctionFlags
 #include "vm/Interpreter.h"
@@ -49,6 +52,8 @@
 #include "jit/SharedICHelpers-inl.h"
 #include "jit/TemplateObject-inl.h"
 #include "jit/VMFunctionList-inl.h"
+#include "vm/BytecodeIterator-inl.h"
+#include "vm/BytecodeLocation-inl.h"
 #include "vm/Interpreter-inl.h"
 #include "vm/JSScript-inl.h"
 
@@ -138,8 +143,88 @@ bool BaselineCompiler::init() {
   return true;
 }
 
-bool BaselineCompilerHandler::recordCallRetAddr(JSContext* cx,
-                                                RetAddrEntry::Kind kind,
+bool BaselineCompilerHandler::prepare(JSContext* cx) {
+  MOZ_ASSERT(cx->realm() == script_->realm());
+
+  GlobalLexicalEnvironmentObject& env = cx->global()->lexicalEnvironment();
+  globalLexicalEnvironment_ = &env;
+  globalThis_ = env.thisObject();
+
+  if (compileDebugInstrumentation_) {
+    debugTrapHandler_ = cx->runtime()->jitRuntime()->debugTrapHandler(
+        cx, DebugTrapHandlerKind::Compiler);
+    if (!debugTrapHandler_) {
+      return false;
+    }
+  }
+
+  const OptimizationInfo* info =
+      IonOptimizations.get(OptimizationLevel::Normal);
+  ionWarmUpThreshold_ = info->scriptWarmUpThreshold(cx, script_);
+
+  // Look up the objects we bake into the code for some ops. This is done
+  // here because it can require a JSContext.
+  Rooted<GlobalObject*> global(cx, cx->global());
+  Rooted<PropertyName*> name(cx);
+  for (BytecodeLocation loc : AllBytecodesIterable(script_)) {
+    JSObject* obj = nullptr;
+    switch (loc.getOp()) {
+      case JSOp::BindUnqualifiedGName:
+        name = loc.getPropertyName(script_);
+        obj = MaybeOptimizeBindUnqualifiedGlobalName(cx, global, name);
+        break;
+      case JSOp::BuiltinObject:
+        obj = BuiltinObjectOperation(cx, loc.getBuiltinObjectKind());
+        if (!obj) {
+          return false;
+        }
+        break;
+      case JSOp::ImportMeta:
+        obj = GetModuleObjectForScript(script_);
+        break;
+      default:
+        break;
+    }
+    if (obj && !opConstants_.emplaceBack(loc.bytecodeToOffset(script_), obj)) {
+      ReportOutOfMemory(cx);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+JSObject* BaselineCompilerHandler::opConstant(jsbytecode* pc) const {
+  uint32_t pcOffset = script_->pcToOffset(pc);
+  size_t index;
+  if (!mozilla::BinarySearchIf(
+          opConstants_, 0, opConstants_.length(),
+          [pcOffset](const OpConstant& entry) {
+            if (pcOffset < entry.pcOffset) {
+              return -1;
+            }
+            return pcOffset > entry.pcOffset ? 1 : 0;
+          },
+          &index)) {
+    return nullptr;
+  }
+  return opConstants_[index].object;
+}
+
+bool BaselineCompilerHandler::hasNurseryConstants() const {
+  if (gc::IsInsideNursery(globalLexicalEnvironment_) ||
+      gc::IsInsideNursery(globalThis_)) {
+    return true;
+  }
+  for (const OpConstant& entry : opConstants_) {
+    if (gc::IsInsideNursery(entry.object)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BaselineCompilerHandler::recordCallRetAddr(RetAddrEntry::Kind kind,
                                                 uint32_t retOffset) {
   uint32_t pcOffset = script_->pcToOffset(pc_);
 
@@ -153,16 +238,10 @@ bool BaselineCompilerHandler::recordCallRetAddr(JSContext* cx,
   MOZ_ASSERT_IF(!retAddrEntries_.empty() && !masm_.oom(),
                 retAddrEntries_.back().returnOffset().offset() < retOffset);
 
-  if (!retAddrEntries_.emplaceBack(pcOffset, kind, CodeOffset(retOffset))) {
-    ReportOutOfMemory(cx);
-    return false;
-  }
-
-  return true;
+  return retAddrEntries_.emplaceBack(pcOffset, kind, CodeOffset(retOffset));
 }
 
-bool BaselineInterpreterHandler::recordCallRetAddr(JSContext* cx,
-                                                   RetAddrEntry::Kind kind,
+bool BaselineInterpreterHandler::recordCallRetAddr(RetAddrEntry::Kind kind,
                                                    uint32_t retOffset) {
   switch (kind) {
     case RetAddrEntry::Kind::DebugPrologue:
@@ -196,20 +275,96 @@ bool BaselineInterpreterHandler::addDebugInstrumentationOffset(
   return true;
 }
 
+static bool CreateAllocSitesForCacheIRStub(JSScript* script, uint32_t pcOffset,
+                                           ICCacheIRStub* stub) {
+  const CacheIRStubInfo* stubInfo = stub->stubInfo();
+  uint8_t* stubData = stub->stubDataStart();
+
+  ICScript* icScript = script->jitScript()->icScript();
+
+  uint32_t field = 0;
+  size_t offset = 0;
+  while (true) {
+    StubField::Type fieldType = stubInfo->fieldType(field);
+    if (fieldType == StubField::Type::Limit) {
+      break;
+    }
+
+    if (fieldType == StubField::Type::AllocSite) {
+      gc::AllocSite* site =
+          stubInfo->getPtrStubField<ICCacheIRStub, gc::AllocSite>(stub, offset);
+      if (site->kind() == gc::AllocSite::Kind::Unknown) {
+        gc::AllocSite* newSite =
+            icScript->getOrCreateAllocSite(script, pcOffset);
+        if (!newSite) {
+          return false;
+        }
+
+        stubInfo->replaceStubRawWord(stubData, offset, uintptr_t(site),
+                                     uintptr_t(newSite));
+      }
+    }
+
+    field++;
+    offset += StubField::sizeInBytes(fieldType);
+  }
+
+  return true;
+}
+
+static void CreateAllocSitesForICChain(JSScript* script, uint32_t pcOffset,
+                                       uint32_t entryIndex) {
+  JitScript* jitScript = script->jitScript();
+  ICStub* stub = jitScript->icEntry(entryIndex).firstStub();
+
+  while (!stub->isFallback()) {
+    if (!CreateAllocSitesForCacheIRStub(script, pcOffset,
+                                        stub->toCacheIRStub())) {
+      // This is an optimization and safe to skip if we hit OOM or per-zone
+      // limit.
+      return;
+    }
+    stub = stub->toCacheIRStub()->next();
+  }
+}
+
+static void CreateAllocSitesForICChains(JSScript* script) {
+  JitScript* jitScript = script->jitScript();
+  for (uint32_t i = 0; i < jitScript->numICEntries(); i++) {
+    uint32_t pcOffset = jitScript->fallbackStub(i)->pcOffset();
+    if (BytecodeOpCanHaveAllocSite(JSOp(*script->offsetToPC(pcOffset)))) {
+      CreateAllocSitesForICChain(script, pcOffset, i);
+    }
+  }
+}
+
 MethodStatus BaselineCompiler::compile() {
-  AutoCreatedBy acb(masm, "BaselineCompiler::compile");
+  AutoIncrementalTimer timer(cx->realm()->timers.baselineCompileTime);
+
+  MethodStatus status = prepare();
+  if (status != Method_Compiled) {
+    return status;
+  }
+
+  // Suppress GC during compilation.
+  gc::AutoSuppressGC suppressGC(cx);
 
+  status = emitCode();
+  if (status != Method_Compiled) {
+    MOZ_ASSERT(status == Method_Error);
+    ReportOutOfMemory(cx);
+    return status;
+  }
+
+  return link();
+}
+
+MethodStatus BaselineCompiler::prepare() {
   Rooted<JSScript*> script(cx, handler.script());
   JitSpew(JitSpew_BaselineScripts, "Baseline compiling script %s:%u:%u (%p)",
           script->filename(), script->lineno(),
           script->column().oneOriginValue(), script.get());
 
-  JitSpew(JitSpew_Codegen, "# Emitting baseline code for script %s:%u:%u",
-          script->filename(), script->lineno(),
-          script->column().oneOriginValue());
-
-  AutoIncrementalTimer timer(cx->realm()->timers.baselineCompileTime);
-
   AutoKeepJitScripts keepJitScript(cx);
   if (!script->ensureHasJitScript(cx, keepJitScript)) {
     return Method_Error;
@@ -229,14 +384,33 @@ MethodStatus BaselineCompiler::compile() {
     jitHints->setEagerBaselineHint(script);
   }
 
-  // Suppress GC during compilation.
+  // Suppress GC while preparing, the compiler holds unrooted pointers.
   gc::AutoSuppressGC suppressGC(cx);
 
   if (!script->jitScript()->ensureHasCachedBaselineJitData(cx, script)) {
     return Method_Error;
   }
 
+  if (!handler.prepare(cx)) {
+    return Method_Error;
+  }
+
   MOZ_ASSERT(!script->hasBaselineScript());
+  return Method_Compiled;
+}
+
+bool BaselineCompiler::canEmitCodeOffThread() const {
+  return !compileDebugInstrumentation() && !PerfDebugInfoEnabled() &&
+         !handler.hasNurseryConstants();
+}
+
+MethodStatus BaselineCompiler::emitCode() {
+  AutoCreatedBy acb(masm, "BaselineCompiler::emitCode");
+
+  JSScript* script = handler.script();
+  JitSpew(JitSpew_Codegen, "# Emitting baseline code for script %s:%u:%u",
+          script->filename(), script->lineno(),
+          script->column().oneOriginValue());
 
   perfSpewer_.recordOffset(masm, "Prologue");
   if (!emitPrologue()) {
@@ -258,6 +432,23 @@ MethodStatus BaselineCompiler::compile() {
     return Method_Error;
   }
 
+  return Method_Compiled;
+}
+
+MethodStatus BaselineCompiler::link() {
+  AutoCreatedBy acb(masm, "BaselineCompiler::link");
+
+  Rooted<JSScript*> script(cx, handler.script());
+  MOZ_ASSERT(!script->hasBaselineScript());
+
+  // Suppress GC while linking.
+  gc::AutoSuppressGC suppressGC(cx);
+
+  // Allocation sites for the IC stubs attached in the Baseline Interpreter are
+  // created here instead of in emitNextIC, because this requires the main
+  // thread.
+  CreateAllocSitesForICChains(script);
+
   AutoCreatedBy acb2(masm, "exception_tail");
   Linker linker(masm);
   if (masm.oom()) {
@@ -526,7 +717,7 @@ bool BaselineCodeGen<Handler>::emitOutOfLinePostBarrierSlot() {
 
   // Check one element cache to avoid VM call.
   Label skipBarrier;
-  auto* lastCellAddr = cx->runtime()->gc.addressOfLastBufferedWholeCell();
+  auto* lastCellAddr = masm.runtime()->addressOfLastBufferedWholeCell();
   masm.branchPtr(Assembler::Equal, AbsoluteAddress(lastCellAddr), objReg,
                  &skipBarrier);
 
@@ -542,7 +733,7 @@ bool BaselineCodeGen<Handler>::emitOutOfLinePostBarrierSlot() {
 
   using Fn = void (*)(JSRuntime* rt, js::gc::Cell* cell);
   masm.setupUnalignedABICall(scratch);
-  masm.movePtr(ImmPtr(cx->runtime()), scratch);
+  masm.movePtr(ImmPtr(masm.runtime()->runtime()), scratch);
   masm.passABIArg(scratch);
   masm.passABIArg(objReg);
   masm.callWithABI<Fn, PostWriteBarrier>();
@@ -560,59 +751,6 @@ bool BaselineCodeGen<Handler>::emitOutOfLinePostBarrierSlot() {
 // refer to the catch-all unknown allocation site. This will be the case for
 // stubs created when running in the interpreter. This happens on transition to
 // baseline.
-static bool CreateAllocSitesForCacheIRStub(JSScript* script, uint32_t pcOffset,
-                                           ICCacheIRStub* stub) {
-  const CacheIRStubInfo* stubInfo = stub->stubInfo();
-  uint8_t* stubData = stub->stubDataStart();
-
-  ICScript* icScript = script->jitScript()->icScript();
-
-  uint32_t field = 0;
-  size_t offset = 0;
-  while (true) {
-    StubField::Type fieldType = stubInfo->fieldType(field);
-    if (fieldType == StubField::Type::Limit) {
-      break;
-    }
-
-    if (fieldType == StubField::Type::AllocSite) {
-      gc::AllocSite* site =
-          stubInfo->getPtrStubField<ICCacheIRStub, gc::AllocSite>(stub, offset);
-      if (site->kind() == gc::AllocSite::Kind::Unknown) {
-        gc::AllocSite* newSite =
-            icScript->getOrCreateAllocSite(script, pcOffset);
-        if (!newSite) {
-          return false;
-        }
-
-        stubInfo->replaceStubRawWord(stubData, offset, uintptr_t(site),
-                                     uintptr_t(newSite));
-      }
-    }
-
-    field++;
-    offset += StubField::sizeInBytes(fieldType);
-  }
-
-  return true;
-}
-
-static void CreateAllocSitesForICChain(JSScript* script, uint32_t pcOffset,
-                                       uint32_t entryIndex) {
-  JitScript* jitScript = script->jitScript();
-  ICStub* stub = jitScript->icEntry(entryIndex).firstStub();
-
-  while (!stub->isFallback()) {
-    if (!CreateAllocSitesForCacheIRStub(script, pcOffset,
-                                        stub->toCacheIRStub())) {
-      // This is an optimization and safe to skip if we hit OOM or per-zone
-      // limit.
-      return;
-    }
-    stub = stub->toCacheIRStub()->next();
-  }
-}
-
 template <>
 bool BaselineCompilerCodeGen::emitNextIC() {
   AutoCreatedBy acb(masm, "emitNextIC");
@@ -637,10 +775,6 @@ bool BaselineCompilerCodeGen::emitNextIC() {
   MOZ_ASSERT(stub->pcOffset() == pcOffset);
   MOZ_ASSERT(BytecodeOpHasIC(JSOp(*handler.pc())));
 
-  if (BytecodeOpCanHaveAllocSite(JSOp(*handler.pc()))) {
-    CreateAllocSitesForICChain(script, pcOffset, entryIndex);
-  }
-
   // Load stub pointer into ICStubReg.
   masm.loadPtr(frame.addressOfICScript(), ICStubReg);
   size_t firstStubOffset = ICScript::offsetOfFirstStub(entryIndex);
@@ -651,7 +785,6 @@ bool BaselineCompilerCodeGen::emitNextIC() {
 
   RetAddrEntry::Kind kind = RetAddrEntry::Kind::IC;
   if (!handler.retAddrEntries().emplaceBack(pcOffset, kind, returnOffset)) {
-    ReportOutOfMemory(cx);
     return false;
   }
 
@@ -746,7 +879,7 @@ bool BaselineCodeGen<Handler>::callVMInternal(VMFunctionId id,
   inCall_ = false;
 #endif
 
-  TrampolinePtr code = cx->runtime()->jitRuntime()->getVMWrapper(id);
+  TrampolinePtr code = masm.runtime()->jitRuntime()->getVMWrapper(id);
   const VMFunctionData& fun = GetVMFunction(id);
 
   uint32_t argSize = GetVMFunctionArgSize(fun);
@@ -775,7 +908,7 @@ bool BaselineCodeGen<Handler>::callVMInternal(VMFunctionId id,
 
   restoreInterpreterPCReg();
 
-  return handler.recordCallRetAddr(cx, kind, callOffset);
+  return handler.recordCallRetAddr(kind, callOffset);
 }
 
 template <typename Handler>
@@ -788,19 +921,17 @@ bool BaselineCodeGen<Handler>::callVM(RetAddrEntry::Kind kind,
 
 template <typename Handler>
 bool BaselineCodeGen<Handler>::emitStackCheck() {
+  AbsoluteAddress stackLimit(masm.runtime()->addressOfJitStackLimit());
+
   Label skipCall;
   if (handler.mustIncludeSlotsInStackCheck()) {
     // Subtract the size of script->nslots() first.
     Register scratch = R1.scratchReg();
     masm.moveStackPtrTo(scratch);
     subtractScriptSlotsSize(scratch, R2.scratchReg());
-    masm.branchPtr(Assembler::BelowOrEqual,
-                   AbsoluteAddress(cx->addressOfJitStackLimit()), scratch,
-                   &skipCall);
+    masm.branchPtr(Assembler::BelowOrEqual, stackLimit, scratch, &skipCall);
   } else {
-    masm.branchStackPtrRhs(Assembler::BelowOrEqual,
-                           AbsoluteAddress(cx->addressOfJitStackLimit()),
-                           &skipCall);
+    masm.branchStackPtrRhs(Assembler::BelowOrEqual, stackLimit, &skipCall);
   }
 
   prepareVMCall();
@@ -912,7 +1043,7 @@ void BaselineInterpreterCodeGen::subtractScriptSlotsSize(Register reg,
 template <>
 void BaselineCompilerCodeGen::loadGlobalLexicalEnvironment(Register dest) {
   MOZ_ASSERT(!handler.script()->hasNonSyntacticScope());
-  masm.movePtr(ImmGCPtr(&cx->global()->lexicalEnvironment()), dest);
+  masm.movePtr(ImmGCPtr(handler.globalLexicalEnvironment()), dest);
 }
 
 template <>
@@ -925,7 +1056,7 @@ void BaselineInterpreterCodeGen::loadGlobalLexicalEnvironment(Register dest) {
 template <>
 void BaselineCompilerCodeGen::pushGlobalLexicalEnvironmentValue(
     ValueOperand scratch) {
-  frame.push(ObjectValue(cx->global()->lexicalEnvironment()));
+  frame.push(ObjectValue(*handler.globalLexicalEnvironment()));
 }
 
 template <>
@@ -938,8 +1069,7 @@ void BaselineInterpreterCodeGen::pushGlobalLexicalEnvironmentValue(
 
 template <>
 void BaselineCompilerCodeGen::loadGlobalThisValue(ValueOperand dest) {
-  JSObject* thisObj = cx->global()->lexicalEnvironment().thisObject();
-  masm.moveValue(ObjectValue(*thisObj), dest);
+  masm.moveValue(ObjectValue(*handler.globalThis()), dest);
 }
 
 template <>
@@ -1164,7 +1294,10 @@ void BaselineCompilerCodeGen::emitInitFrameFields(Register nonFunctionEnv) {
   // the caller), take that ICScript and store it in the frame, then
   // overwrite cx->inlinedICScript with nullptr.
   Label notInlined, done;
-  masm.movePtr(ImmPtr(cx->addressOfInlinedICScript()), scratch);
+  const uint8_t* inlinedICScriptPtr =
+      static_cast<const uint8_t*>(masm.runtime()->mainContextPtr()) +
+      JSContext::offsetOfInlinedICScript();
+  masm.movePtr(ImmPtr(inlinedICScriptPtr), scratch);
   Address inlinedAddr(scratch, 0);
   masm.branchPtr(Assembler::Equal, inlinedAddr, ImmWord(0), &notInlined);
   masm.loadPtr(inlinedAddr, scratch2);
@@ -1380,7 +1513,8 @@ bool BaselineCodeGen<Handler>::emitInterruptCheck() {
   frame.syncStack(0);
 
   Label done;
-  masm.branch32(Assembler::Equal, AbsoluteAddress(cx->addressOfInterruptBits()),
+  masm.branch32(Assembler::Equal,
+                AbsoluteAddress(masm.runtime()->addressOfInterruptBits()),
                 Imm32(0), &done);
 
   prepareVMCall();
@@ -1412,7 +1546,6 @@ bool BaselineCompilerCodeGen::emitWarmUpCounterIncrement() {
     uint32_t pcOffset = script->pcToOffset(pc);
     uint32_t nativeOffset = masm.currentOffset();
     if (!handler.osrEntries().emplaceBack(pcOffset, nativeOffset)) {
-      ReportOutOfMemory(cx);
       return false;
     }
   }
@@ -1471,7 +1604,8 @@ bool BaselineCompilerCodeGen::emitWarmUpCounterIncrement() {
 
   const OptimizationInfo* info =
       IonOptimizations.get(OptimizationLevel::Normal);
-  uint32_t warmUpThreshold = info->compilerWarmUpThreshold(cx, script, pc);
+  uint32_t warmUpThreshold = info->compilerWarmUpThreshold(
+      handler.ionWarmUpThreshold(), script, pc);
   masm.branch32(Assembler::LessThan, countReg, Imm32(warmUpThreshold), &done);
 
   // Don't trigger Warp compilations from trial-inlined scripts.
@@ -1540,9 +1674,12 @@ bool BaselineCompilerCodeGen::emitWarmUpCounterIncrement() {
     {
       Label checkOk;
       AbsoluteAddress addressOfEnabled(
-          cx->runtime()->geckoProfiler().addressOfEnabled());
+          masm.runtime()->geckoProfiler().addressOfEnabled());
       masm.branch32(Assembler::Equal, addressOfEnabled, Imm32(0), &checkOk);
-      masm.loadPtr(AbsoluteAddress((void*)&cx->jitActivation), scratchReg);
+      const uint8_t* jitActivationPtr =
+          static_cast<const uint8_t*>(masm.runtime()->mainContextPtr()) +
+          JSContext::offsetOfJitActivation();
+      masm.loadPtr(AbsoluteAddress(jitActivationPtr), scratchReg);
       masm.loadPtr(
           Address(scratchReg, JitActivation::offsetOfLastProfilingFrame()),
           scratchReg);
@@ -1643,22 +1780,16 @@ bool BaselineCompiler::emitDebugTrap() {
                  DebugAPI::hasBreakpointsAt(script, handler.pc());
 
   // Emit patchable call to debug trap handler.
-  JitCode* handlerCode = cx->runtime()->jitRuntime()->debugTrapHandler(
-      cx, DebugTrapHandlerKind::Compiler);
-  if (!handlerCode) {
-    return false;
-  }
-
+  JitCode* handlerCode = handler.debugTrapHandler();
   CodeOffset nativeOffset = masm.toggledCall(handlerCode, enabled);
 
   uint32_t pcOffset = script->pcToOffset(handler.pc());
   if (!debugTrapEntries_.emplaceBack(pcOffset, nativeOffset.offset())) {
-    ReportOutOfMemory(cx);
     return false;
   }
 
   // Add a RetAddrEntry for the return offset -> pc mapping.
-  return handler.recordCallRetAddr(cx, RetAddrEntry::Kind::DebugTrap,
+  return handler.recordCallRetAddr(RetAddrEntry::Kind::DebugTrap,
                                    masm.currentOffset());
 }
 
@@ -2493,7 +2624,7 @@ bool BaselineInterpreterCodeGen::emit_String() {
 template <>
 bool BaselineCompilerCodeGen::emit_Symbol() {
   unsigned which = GET_UINT8(handler.pc());
-  JS::Symbol* sym = cx->runtime()->wellKnownSymbols->get(which);
+  JS::Symbol* sym = masm.runtime()->wellKnownSymbols().get(which);
   frame.push(SymbolValue(sym));
   return true;
 }
@@ -3243,13 +3374,11 @@ bool BaselineCodeGen<Handler>::emit_GetGName() {
 
 template <>
 bool BaselineCompilerCodeGen::tryOptimizeBindUnqualifiedGlobalName() {
-  JSScript* script = handler.script();
-  MOZ_ASSERT(!script->hasNonSyntacticScope());
+  MOZ_ASSERT(!handler.script()->hasNonSyntacticScope());
 
-  Rooted<GlobalObject*> global(cx, &script->global());
-  Rooted<PropertyName*> name(cx, script->getName(handler.pc()));
-  if (JSObject* binding =
-          MaybeOptimizeBindUnqualifiedGlobalName(cx, global, name)) {
+  // MaybeOptimizeBindUnqualifiedGlobalName was called by
+  // BaselineCompilerHandler::prepare.
+  if (JSObject* binding = handler.opConstant(handler.pc())) {
     frame.push(ObjectValue(*binding));
     return true;
   }
@@ -5393,7 +5522,7 @@ bool BaselineCodeGen<Handler>::emit_TableSwitch() {
 
   // Call a stub to convert R0 from double to int32 if needed.
   // Note: this stub may clobber scratch1.
-  masm.call(cx->runtime()->jitRuntime()->getDoubleToInt32ValueStub());
+  masm.call(masm.runtime()->jitRuntime()->getDoubleToInt32ValueStub());
 
   // Load the index in the jump table in |key|, or branch to default pc if not
   // int32 or out-of-range.
@@ -5916,7 +6045,7 @@ bool BaselineCodeGen<Handler>::emit_FinalYieldRval() {
 template <>
 void BaselineCompilerCodeGen::emitJumpToInterpretOpLabel() {
   TrampolinePtr code =
-      cx->runtime()->jitRuntime()->baselineInterpreter().interpretOpAddr();
+      masm.runtime()->jitRuntime()->baselineInterpreter().interpretOpAddr();
   masm.jump(code);
 }
 
@@ -6077,7 +6206,7 @@ bool BaselineCodeGen<Handler>::emit_Resume() {
 #endif
 
   // Record the return address so the return offset -> pc mapping works.
-  if (!handler.recordCallRetAddr(cx, RetAddrEntry::Kind::IC,
+  if (!handler.recordCallRetAddr(RetAddrEntry::Kind::IC,
                                  masm.currentOffset())) {
     return false;
   }
@@ -6098,7 +6227,7 @@ bool BaselineCodeGen<Handler>::emit_Resume() {
     Register scratchReg = scratch2;
     Label skip;
     AbsoluteAddress addressOfEnabled(
-        cx->runtime()->geckoProfiler().addressOfEnabled());
+        masm.runtime()->geckoProfiler().addressOfEnabled());
     masm.branch32(Assembler::Equal, addressOfEnabled, Imm32(0), &skip);
     masm.loadJSContext(scratchReg);
     masm.loadPtr(Address(scratchReg, JSContext::offsetOfProfilingActivation()),
@@ -6370,12 +6499,10 @@ bool BaselineCodeGen<Handler>::emit_InitHomeObject() {
 
 template <>
 bool BaselineCompilerCodeGen::emit_BuiltinObject() {
-  // Built-in objects are constants for a given global.
-  auto kind = BuiltinObjectKind(GET_UINT8(handler.pc()));
-  JSObject* builtin = BuiltinObjectOperation(cx, kind);
-  if (!builtin) {
-    return false;
-  }
+  // Built-in objects are constants for a given global. They're looked up (and
+  // created if needed) by BaselineCompilerHandler::prepare.
+  JSObject* builtin = handler.opConstant(handler.pc());
+  MOZ_ASSERT(builtin);
   frame.push(ObjectValue(*builtin));
   return true;
 }
@@ -6444,9 +6571,11 @@ bool BaselineCodeGen<Handler>::emit_FunWithProto() {
 template <>
 bool BaselineCompilerCodeGen::emit_ImportMeta() {
   // Note: this is like the interpreter implementation, but optimized a bit by
-  // calling GetModuleObjectForScript at compile-time.
+  // calling GetModuleObjectForScript at compile-time. This is done by
+  // BaselineCompilerHandler::prepare.
 
-  Rooted<ModuleObject*> module(cx, GetModuleObjectForScript(handler.script()));
+  JSObject* module = handler.opConstant(handler.pc());
+  MOZ_ASSERT(module);
 
   frame.syncStack(0);
 
@@ -6652,7 +6781,6 @@ MethodStatus BaselineCompiler::emitBody() {
       uint32_t pcOffset = script->pcToOffset(handler.pc());
       uint32_t nativeOffset = masm.currentOffset();
       if (!resumeOffsetEntries_.emplaceBack(pcOffset, nativeOffset)) {
-        ReportOutOfMemory(cx);
         return Method_Error;
       }
     }
@@ -36,8 +36,10 @@ class BaselineCodeGen {
  protected:
   Handler handler;
 
+  // Note: BaselineCompiler doesn't use this while emitting code, because that
+  // can happen on a helper thread. See BaselineCompiler::emitCode.
   JSContext* cx;
-  StackMacroAssembler masm;
+  typename Handler::MacroAssemblerT masm;
 
   typename Handler::FrameInfoT& frame;
 
@@ -295,13 +297,32 @@ class BaselineCompilerHandler {
   bool compileDebugInstrumentation_;
   bool ionCompileable_;
 
+  // The following are computed on the main thread by prepare(), so that
+  // emitting code doesn't need a JSContext.
+  JSObject* globalLexicalEnvironment_ = nullptr;
+  JSObject* globalThis_ = nullptr;
+  JitCode* debugTrapHandler_ = nullptr;
+  uint32_t ionWarmUpThreshold_ = 0;
+
+  // Objects baked into the code for JSOp::BindUnqualifiedGName,
+  // JSOp::BuiltinObject and JSOp::ImportMeta ops, sorted by pc offset.
+  struct OpConstant {
+    uint32_t pcOffset;
+    JSObject* object;
+    OpConstant(uint32_t pcOffset, JSObject* object)
+        : pcOffset(pcOffset), object(object) {}
+  };
+  Vector<OpConstant, 0, SystemAllocPolicy> opConstants_;
+
  public:
   using FrameInfoT = CompilerFrameInfo;
+  using MacroAssemblerT = BaselineHeapMacroAssembler;
 
   BaselineCompilerHandler(JSContext* cx, MacroAssembler& masm,
                           TempAllocator& alloc, JSScript* script);
 
   [[nodiscard]] bool init(JSContext* cx);
+  [[nodiscard]] bool prepare(JSContext* cx);
 
   CompilerFrameInfo& frame() { return frame_; }
 
@@ -335,6 +356,27 @@ class BaselineCompilerHandler {
 
   bool maybeIonCompileable() const { return ionCompileable_; }
 
+  JSObject* globalLexicalEnvironment() const {
+    MOZ_ASSERT(globalLexicalEnvironment_);
+    return globalLexicalEnvironment_;
+  }
+  JSObject* globalThis() const {
+    MOZ_ASSERT(globalThis_);
+    return globalThis_;
+  }
+  JitCode* debugTrapHandler() const {
+    MOZ_ASSERT(debugTrapHandler_);
+    return debugTrapHandler_;
+  }
+  uint32_t ionWarmUpThreshold() const { return ionWarmUpThreshold_; }
+
+  // Returns the object computed by prepare() for the op at |pc|, or nullptr.
+  JSObject* opConstant(jsbytecode* pc) const;
+
+  // Whether any of the objects we bake into the code are nursery objects.
+  // These can be moved by a minor GC while we're compiling off-thread.
+  bool hasNurseryConstants() const;
+
   uint32_t icEntryIndex() const { return icEntryIndex_; }
   void moveToNextICEntry() { icEntryIndex_++; }
 
@@ -343,7 +385,7 @@ class BaselineCompilerHandler {
   RetAddrEntryVector& retAddrEntries() { return retAddrEntries_; }
   OSREntryVector& osrEntries() { return osrEntries_; }
 
-  [[nodiscard]] bool recordCallRetAddr(JSContext* cx, RetAddrEntry::Kind kind,
+  [[nodiscard]] bool recordCallRetAddr(RetAddrEntry::Kind kind,
                                        uint32_t retOffset);
 
   // If a script has more |nslots| than this the stack check must account
@@ -376,8 +418,22 @@ class BaselineCompiler final : private BaselineCompilerCodeGen {
   BaselineCompiler(JSContext* cx, TempAllocator& alloc, JSScript* script);
   [[nodiscard]] bool init();
 
+  // Compile the script on the main thread. This is prepare(), emitCode() and
+  // link() combined.
   MethodStatus compile();
 
+  // Compilation can also be split in separate phases, see BaselineCompileTask.
+  // prepare() and link() must be called on the main thread. emitCode() doesn't
+  // use the JSContext and returns Method_Error on OOM without reporting it, so
+  // it can run on a helper thread if canEmitCodeOffThread() returns true.
+  MethodStatus prepare();
+  MethodStatus emitCode();
+  MethodStatus link();
+
+  bool canEmitCodeOffThread() const;
+
+  JSScript* script() const { return handler.script(); }
+
   bool compileDebugInstrumentation() const {
     return handler.compileDebugInstrumentation();
   }
@@ -423,6 +479,7 @@ class BaselineInterpreterHandler {
 
  public:
   using FrameInfoT = InterpreterFrameInfo;
+  using MacroAssemblerT = StackMacroAssembler;
 
   explicit BaselineInterpreterHandler(JSContext* cx, MacroAssembler& masm);
 
@@ -467,7 +524,7 @@ class BaselineInterpreterHandler {
     return callVMOffsets_;
   }
 
-  [[nodiscard]] bool recordCallRetAddr(JSContext* cx, RetAddrEntry::Kind kind,
+  [[nodiscard]] bool recordCallRetAddr(RetAddrEntry::Kind kind,
                                        uint32_t retOffset);
 
   bool maybeIonCompileable() const { return true; }
@@ -0,0 +1,265 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/BaselineCompileTask.h"
+
+#include "mozilla/Sprintf.h"
+
+#include <algorithm>
+
+#include "gc/GC.h"
+#include "jit/BaselineJIT.h"
+#include "jit/CompileWrappers.h"
+#include "jit/Ion.h"
+#include "jit/JitContext.h"
+#include "jit/JitOptions.h"
+#include "jit/JitRuntime.h"
+#include "jit/JitScript.h"
+#include "jit/PerfSpewer.h"
+#include "vm/GeckoProfiler.h"
+#include "vm/HelperThreads.h"
+#include "vm/HelperThreadState.h"
+#include "vm/JSContext.h"
+#include "vm/JSScript.h"
+#include "vm/Realm.h"
+#include "vm/Time.h"
+
+#include "vm/GeckoProfiler-inl.h"
+#include "vm/JSScript-inl.h"
+#include "vm/Realm-inl.h"
+
+using namespace js;
+using namespace js::jit;
+
+BaselineCompileTask::BaselineCompileTask(JSContext* cx, JSScript* script)
+    : lifo_(TempAllocator::PreferredLifoChunkSize, js::MallocArena),
+      temp_(&lifo_),
+      compiler_(cx, temp_, script),
+      runtime_(CompileRuntime::get(cx->runtime())) {}
+
+void BaselineCompileTask::runHelperThreadTask(
+    AutoLockHelperThreadState& locked) {
+  {
+    AutoUnlockHelperThreadState unlock(locked);
+
+    // Code generation doesn't use the JSContext. Enter the Ion backend so we
+    // can access the same main thread data as off-thread Ion compilations.
+    JitContext jctx(runtime_);
+    AutoEnterIonBackend enter;
+    status_ = compiler_.emitCode();
+  }
+
+  JSRuntime* rt = script()->runtimeFromAnyThread();
+  JitRuntime* jitRuntime = rt->jitRuntime();
+
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+  if (!HelperThreadState().baselineFinishedList(locked).append(this)) {
+    oomUnsafe.crash("BaselineCompileTask::runHelperThreadTask");
+  }
+  jitRuntime->numPendingBaselineTasksRef(locked)--;
+  size_t numFinished = ++jitRuntime->numFinishedBaselineTasksRef(locked);
+
+  // Ping the main thread once we have a batch of compilations to link, or if
+  // there are no other compilations to wait for.
+  if (numFinished >= JitOptions.baselineBatchSize ||
+      jitRuntime->numPendingBaselineTasks() == 0) {
+    rt->mainContextFromAnyThread()->requestInterrupt(
+        InterruptReason::AttachBaselineCompilations);
+  }
+}
+
+bool jit::CanBaselineCompileOffThread(JSContext* cx, JSScript* script) {
+  if (!JitOptions.baselineOffThreadCompilation) {
+    return false;
+  }
+
+  // Use the same conditions as off-thread Ion compilation.
+  if (!OffThreadCompilationAvailable(cx)) {
+    return false;
+  }
+
+  // Debug instrumentation and code coverage require the main thread.
+  if (script->isDebuggee() || script->hasScriptCounts() ||
+      cx->realm()->collectCoverageForDebug()) {
+    return false;
+  }
+
+  // The perf spewer records instructions while the code is emitted.
+  if (PerfDebugInfoEnabled()) {
+    return false;
+  }
+
+  // The compiler holds pointers to GC things until the code is linked. Major
+  // GCs cancel off-thread compilations when they start marking, so don't
+  // queue new ones while an incremental GC is in progress.
+  if (cx->runtime()->gc.isIncrementalGCInProgress()) {
+    return false;
+  }
+
+  return true;
+}
+
+MethodStatus jit::BaselineCompileOffThread(JSContext* cx,
+                                           HandleScript script) {
+  cx->check(script);
+  MOZ_ASSERT(!script->hasBaselineScript());
+  MOZ_ASSERT(script->canBaselineCompile());
+  MOZ_ASSERT(CanBaselineCompileOffThread(cx, script));
+  AutoGeckoProfilerEntry pseudoFrame(
+      cx, "Baseline script compilation",
+      JS::ProfilingCategoryPair::JS_BaselineCompilation);
+
+  JitContext jctx(cx);
+
+  UniquePtr<BaselineCompileTask> task =
+      cx->make_unique<BaselineCompileTask>(cx, script);
+  if (!task) {
+    return Method_Error;
+  }
+
+  BaselineCompiler& compiler = task->compiler();
+  if (!compiler.init()) {
+    ReportOutOfMemory(cx);
+    return Method_Error;
+  }
+
+  MethodStatus status;
+  {
+    AutoIncrementalTimer timer(cx->realm()->timers.baselineCompileTime);
+    status = compiler.prepare();
+  }
+  if (status != Method_Compiled) {
+    return status;
+  }
+
+  // Some of the objects we bake into the code can be moved by a minor GC while
+  // the helper thread emits code. Compile these scripts on the main thread.
+  if (!compiler.canEmitCodeOffThread()) {
+    task.reset();
+    return BaselineCompile(cx, script);
+  }
+
+  task->setQueuedTime(mozilla::TimeStamp::Now());
+  script->jitScript()->setIsBaselineCompilingOffThread();
+
+  {
+    AutoLockHelperThreadState lock;
+    if (StartOffThreadBaselineCompile(task.get(), lock)) {
+      (void)task.release();
+      return Method_Skipped;
+    }
+  }
+
+  // We couldn't queue the task. Compile on the main thread instead.
+  script->jitScript()->clearIsBaselineCompilingOffThread();
+  task.reset();
+  return BaselineCompile(cx, script);
+}
+
+void jit::DiscardBaselineCompileTask(BaselineCompileTask* task) {
+  JSScript* script = task->script();
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(script->runtimeFromAnyThread()));
+
+  if (script->jitScript()->isBaselineCompilingOffThread()) {
+    script->jitScript()->clearIsBaselineCompilingOffThread();
+  }
+  js_delete(task);
+}
+
+// Returns whether the task's code was installed.
+static bool LinkBaselineCompileTask(JSContext* cx, BaselineCompileTask* task) {
+  RootedScript script(cx, task->script());
+  script->jitScript()->clearIsBaselineCompilingOffThread();
+
+  // The helper thread ran out of memory. The script will be compiled again
+  // when it's entered.
+  if (task->status() != Method_Compiled) {
+    return false;
+  }
+
+  // The script may have changed while we were compiling. Discard the code if
+  // it was compiled synchronously in the meantime (for instance for the
+  // debugger) or if it now needs instrumentation we didn't emit.
+  if (script->hasBaselineScript() || !script->canBaselineCompile() ||
+      !IsBaselineJitEnabled(cx) || script->isDebuggee() ||
+      script->hasScriptCounts() || script->realm()->collectCoverageForDebug()) {
+    return false;
+  }
+
+  AutoRealm ar(cx, script);
+  AutoIncrementalTimer timer(cx->realm()->timers.baselineCompileTime);
+
+  MethodStatus status = task->compiler().link();
+  if (status != Method_Compiled) {
+    // Silently ignore OOM during linking. We're called from the interrupt
+    // handler, so it's not OK to throw a catchable exception from here.
+    cx->clearPendingException();
+    return false;
+  }
+
+  MOZ_ASSERT(script->hasBaselineScript());
+  return true;
+}
+
+void jit::AttachFinishedBaselineCompilations(JSContext* cx) {
+  JSRuntime* rt = cx->runtime();
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(rt));
+
+  if (!rt->jitRuntime() || !rt->jitRuntime()->numFinishedBaselineTasks()) {
+    return;
+  }
+
+  JitContext jctx(cx);
+
+  mozilla::TimeStamp now = mozilla::TimeStamp::Now();
+  mozilla::TimeDuration maxLatency;
+  mozilla::TimeDuration totalLatency;
+  size_t numTasks = 0;
+  size_t numLinked = 0;
+
+  while (true) {
+    BaselineCompileTask* task = nullptr;
+    {
+      AutoLockHelperThreadState lock;
+      GlobalHelperThreadState::BaselineCompileTaskVector& finished =
+          HelperThreadState().baselineFinishedList(lock);
+      for (size_t i = 0; i < finished.length(); i++) {
+        if (finished[i]->script()->runtimeFromAnyThread() == rt) {
+          task = finished[i];
+          HelperThreadState().remove(finished, &i);
+          rt->jitRuntime()->numFinishedBaselineTasksRef(lock)--;
+          break;
+        }
+      }
+    }
+    if (!task) {
+      break;
+    }
+
+    mozilla::TimeDuration latency = now - task->queuedTime();
+    maxLatency = std::max(maxLatency, latency);
+    totalLatency += latency;
+    numTasks++;
+
+    if (LinkBaselineCompileTask(cx, task)) {
+      numLinked++;
+    }
+    js_delete(task);
+  }
+
+  // Generate a profile marker
+  if (numTasks > 0 && rt->geckoProfiler().enabled()) {
+    char buf[128];
+    SprintfLiteral(buf,
+                   "Linked:%zu Discarded:%zu Pending:%zu MaxLatency:%.3fms "
+                   "MeanLatency:%.3fms",
+                   numLinked, numTasks - numLinked,
+                   size_t(rt->jitRuntime()->numPendingBaselineTasks()),
+                   maxLatency.ToMilliseconds(),
+                   totalLatency.ToMilliseconds() / double(numTasks));
+    rt->geckoProfiler().markEvent("BaselineBatch", buf);
+  }
+}
@@ -0,0 +1,82 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef jit_BaselineCompileTask_h
+#define jit_BaselineCompileTask_h
+
+#include "mozilla/TimeStamp.h"
+
+#include "ds/LifoAlloc.h"
+#include "jit/BaselineCodeGen.h"
+#include "jit/JitAllocPolicy.h"
+#include "js/Utility.h"
+#include "vm/HelperThreadTask.h"
+
+struct JS_PUBLIC_API JSContext;
+
+namespace js {
+namespace jit {
+
+class CompileRuntime;
+
+// BaselineCompileTask represents a single off-thread Baseline compilation.
+//
+// The compiler is prepared on the main thread (this can allocate GC things
+// and look up objects that are baked into the code), code is emitted on a
+// helper thread and the finished tasks are linked on the main thread in
+// batches of JitOptions.baselineBatchSize, see
+// AttachFinishedBaselineCompilations.
+//
+// The script's JitScript is marked with isBaselineCompilingOffThread while the
+// task exists. GC cancels off-thread Baseline compilations.
+class BaselineCompileTask final : public HelperThreadTask {
+  LifoAlloc lifo_;
+  TempAllocator temp_;
+  BaselineCompiler compiler_;
+  CompileRuntime* runtime_;
+
+  // Result of BaselineCompiler::emitCode.
+  MethodStatus status_ = Method_Skipped;
+
+  // When the task was added to the worklist, for profiler markers.
+  mozilla::TimeStamp queuedTime_;
+
+ public:
+  BaselineCompileTask(JSContext* cx, JSScript* script);
+
+  BaselineCompiler& compiler() { return compiler_; }
+  JSScript* script() const { return compiler_.script(); }
+
+  MethodStatus status() const { return status_; }
+
+  mozilla::TimeStamp queuedTime() const { return queuedTime_; }
+  void setQueuedTime(mozilla::TimeStamp time) { queuedTime_ = time; }
+
+  ThreadType threadType() override { return THREAD_TYPE_BASELINE; }
+  void runHelperThreadTask(AutoLockHelperThreadState& locked) override;
+
+  const char* getName() override { return "BaselineCompileTask"; }
+};
+
+// Whether Baseline code for |script| can be generated on a helper thread.
+bool CanBaselineCompileOffThread(JSContext* cx, JSScript* script);
+
+// Compile |script| with a helper thread emitting the code. Returns
+// Method_Skipped if the compilation was queued. If the script turns out to be
+// unsuitable for off-thread compilation, it's compiled on the main thread.
+MethodStatus BaselineCompileOffThread(JSContext* cx, HandleScript script);
+
+// Link the finished off-thread Baseline compilations for the runtime.
+void AttachFinishedBaselineCompilations(JSContext* cx);
+
+// Clear the script's pending compilation flag and destroy the task, without
+// linking it.
+void DiscardBaselineCompileTask(BaselineCompileTask* task);
+
+}  // namespace jit
+}  // namespace js
+
+#endif /* jit_BaselineCompileTask_h */
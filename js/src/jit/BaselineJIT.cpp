@@ -17,6 +17,7 @@
 #include "gc/PublicIterators.h"
 #include "jit/AutoWritableJitCode.h"
 #include "jit/BaselineCodeGen.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/BaselineIC.h"
 #include "jit/CalleeToken.h"
 #include "jit/JitCommon.h"
@@ -289,6 +290,13 @@ static MethodStatus CanEnterBaselineJIT(JSContext* cx, HandleScript script,
     return Method_Compiled;
   }
 
+  // Keep running in the interpreter until the pending off-thread compilation
+  // has been linked.
+  if (script->hasJitScript() &&
+      script->jitScript()->isBaselineCompilingOffThread()) {
+    return Method_Skipped;
+  }
+
   // If a hint is available, skip the warmup count threshold.
   bool mightHaveEagerBaselineHint = false;
   if (!JitOptions.disableJitHints && !script->noEagerBaselineHint() &&
@@ -327,6 +335,9 @@ static MethodStatus CanEnterBaselineJIT(JSContext* cx, HandleScript script,
   // Debugger.Frame.prototype.eval.
   bool forceDebugInstrumentation =
       osrSourceFrame && osrSourceFrame.isDebuggee();
+  if (!forceDebugInstrumentation && CanBaselineCompileOffThread(cx, script)) {
+    return BaselineCompileOffThread(cx, script);
+  }
   return BaselineCompile(cx, script, forceDebugInstrumentation);
 }
 
@@ -940,6 +951,10 @@ void jit::ToggleBaselineProfiling(JSContext* cx, bool enable) {
     return;
   }
 
+  // Make each page writable and executable again only once, instead of once
+  // per script.
+  AutoWritableJitCodeBatch batch(cx->runtime());
+
   jrt->baselineInterpreter().toggleProfilerInstrumentation(enable);
 
   for (ZonesIter zone(cx->runtime(), SkipAtoms); !zone.done(); zone.next()) {
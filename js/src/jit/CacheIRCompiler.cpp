@@ -9372,6 +9372,30 @@ bool CacheIRCompiler::emitGuardMultipleShapes(ObjOperandId objId,
   return true;
 }
 
+bool CacheIRCompiler::emitLoadSlotByShapeTableResult(ObjOperandId objId,
+                                                     uint32_t tableOffset) {
+  JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
+  AutoOutputRegister output(*this);
+  Register obj = allocator.useRegister(masm, objId);
+  AutoScratchRegister table(allocator, masm);
+  AutoScratchRegisterMaybeOutput entry(allocator, masm, output);
+  AutoScratchRegister scratch(allocator, masm);
+
+  FailurePath* failure;
+  if (!addFailurePath(&failure)) {
+    return false;
+  }
+
+  // The stub field contains a ShapeSlotTableObject.
+  StubFieldOffset tableField(tableOffset, StubField::Type::JSObject);
+  emitLoadStubField(tableField, table);
+
+  masm.loadSlotByShapeTable(obj, table, entry, scratch, output.valueReg(),
+                            JitOptions.spectreObjectMitigations,
+                            failure->label());
+  return true;
+}
+
 bool CacheIRCompiler::emitLoadObject(ObjOperandId resultId,
                                      uint32_t objOffset) {
   JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
@@ -4508,6 +4508,19 @@ void CodeGenerator::visitGuardMultipleShapes(LGuardMultipleShapes* guard) {
   bailoutFrom(&bail, guard->snapshot());
 }
 
+void CodeGenerator::visitLoadSlotByShapeTable(LLoadSlotByShapeTable* lir) {
+  Register obj = ToRegister(lir->object());
+  Register table = ToRegister(lir->table());
+  Register temp0 = ToRegister(lir->temp0());
+  Register temp1 = ToRegister(lir->temp1());
+  ValueOperand output = ToOutValue(lir);
+
+  Label bail;
+  masm.loadSlotByShapeTable(obj, table, temp0, temp1, output,
+                            JitOptions.spectreObjectMitigations, &bail);
+  bailoutFrom(&bail, lir->snapshot());
+}
+
 void CodeGenerator::visitGuardProto(LGuardProto* guard) {
   Register obj = ToRegister(guard->object());
   Register expected = ToRegister(guard->expected());
@@ -20760,6 +20773,22 @@ void CodeGenerator::visitIncrementWarmUpCounter(LIncrementWarmUpCounter* ins) {
   incrementWarmUpCounter(warmUpCount, ins->mir()->script(), tmp);
 }
 
+void CodeGenerator::visitRecompileCheck(LRecompileCheck* ins) {
+  Register tmp = ToRegister(ins->temp0());
+  JSScript* script = ins->mir()->script();
+
+  using Fn = bool (*)(JSContext*, HandleScript);
+  OutOfLineCode* ool = oolCallVM<Fn, IonRecompile>(
+      ins, ArgList(ImmGCPtr(script)), StoreNothing());
+
+  AbsoluteAddress warmUpCount = AbsoluteAddress(script->jitScript())
+                                    .offset(JitScript::offsetOfWarmUpCount());
+  incrementWarmUpCounter(warmUpCount, script, tmp);
+  masm.branch32(Assembler::AboveOrEqual, tmp,
+                Imm32(ins->mir()->recompileThreshold()), ool->entry());
+  masm.bind(ool->rejoin());
+}
+
 void CodeGenerator::visitLexicalCheck(LLexicalCheck* ins) {
   ValueOperand inputValue = ToValue(ins, LLexicalCheck::InputIndex);
   Label bail;
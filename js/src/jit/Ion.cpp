@@ -45,6 +45,7 @@
 #include "jit/LICM.h"
 #include "jit/Linker.h"
 #include "jit/LIR.h"
+#include "jit/LoopUnroller.h"
 #include "jit/Lowering.h"
 #include "jit/PerfSpewer.h"
 #include "jit/RangeAnalysis.h"
@@ -671,6 +672,13 @@ void JitCode::finalize(JS::GCContext* gcx) {
 
   MOZ_ASSERT(pool_);
 
+  // Releasing the pool may free memory that a live batch still has to make
+  // executable.
+  if (AutoWritableJitCodeBatch* batch =
+          gcx->runtime()->autoWritableJitCodeBatch()) {
+    batch->flush();
+  }
+
   // With W^X JIT code, reprotecting memory for each JitCode instance is
   // slow, so we record the ranges and poison them later all at once. It's
   // safe to ignore OOM here, it just means we won't poison the code.
@@ -684,8 +692,9 @@ void JitCode::finalize(JS::GCContext* gcx) {
   // Code buffers are stored inside ExecutablePools. Pools are refcounted.
   // Releasing the pool may free it. Horrible hack: if we are using perf
   // integration, we don't want to reuse code addresses, so we just leak the
-  // memory instead.
-  if (!PerfEnabled()) {
+  // memory instead. The perf map mode accepts stale entries for reused
+  // addresses, to keep its overhead low.
+  if (!PerfDebugInfoEnabled()) {
     pool_->release(headerSize_ + bufferSize_, CodeKind(kind_));
   }
 #else
@@ -1288,6 +1297,19 @@ bool OptimizeMIR(MIRGenerator* mir) {
       return false;
     }
 
+    if (mir->optimizationInfo().loopUnrollingEnabled()) {
+      JitSpewCont(JitSpew_Unrolling, "\n");
+      if (!UnrollLoops(mir, graph, r.iterationBounds())) {
+        return false;
+      }
+      gs.spewPass("Unroll Loops");
+      AssertExtendedGraphCoherency(graph);
+
+      if (mir->shouldCancel("Unroll Loops")) {
+        return false;
+      }
+    }
+
     if (mir->optimizationInfo().gvnEnabled()) {
       bool shouldRunUCE = false;
       if (!r.prepareForUCE(&shouldRunUCE)) {
@@ -1565,7 +1587,8 @@ LIRGraph* GenerateLIR(MIRGenerator* mir) {
 
     switch (allocator) {
       case RegisterAllocator_Backtracking:
-      case RegisterAllocator_Testbed: {
+      case RegisterAllocator_Testbed:
+      case RegisterAllocator_LinearScan: {
 #ifdef DEBUG
         if (JitOptions.fullDebugChecks) {
           if (!integrity.record()) {
@@ -1574,8 +1597,9 @@ LIRGraph* GenerateLIR(MIRGenerator* mir) {
         }
 #endif
 
-        BacktrackingAllocator regalloc(mir, &lirgen, *lir,
-                                       allocator == RegisterAllocator_Testbed);
+        BacktrackingAllocator regalloc(
+            mir, &lirgen, *lir, allocator == RegisterAllocator_Testbed,
+            allocator == RegisterAllocator_LinearScan);
         if (!regalloc.go()) {
           return nullptr;
         }
@@ -1588,7 +1612,9 @@ LIRGraph* GenerateLIR(MIRGenerator* mir) {
         }
 #endif
 
-        gs.spewPass("Allocate Registers [Backtracking]");
+        gs.spewPass(allocator == RegisterAllocator_LinearScan
+                        ? "Allocate Registers [Linear Scan]"
+                        : "Allocate Registers [Backtracking]");
         break;
       }
 
@@ -1663,7 +1689,8 @@ static AbortReasonOr<WarpSnapshot*> CreateWarpSnapshot(JSContext* cx,
 }
 
 static AbortReason IonCompile(JSContext* cx, HandleScript script,
-                              jsbytecode* osrPc) {
+                              jsbytecode* osrPc,
+                              OptimizationLevel optimizationLevel) {
   cx->check(script);
 
   auto alloc = cx->make_unique<LifoAlloc>(TempAllocator::PreferredLifoChunkSize,
@@ -1704,7 +1731,7 @@ static AbortReason IonCompile(JSContext* cx, HandleScript script,
   }
 
   const OptimizationInfo* optimizationInfo =
-      IonOptimizations.get(OptimizationLevel::Normal);
+      IonOptimizations.get(optimizationLevel);
   const JitCompileOptions options(cx);
 
   MIRGenerator* mirGen =
@@ -1714,6 +1741,16 @@ static AbortReason IonCompile(JSContext* cx, HandleScript script,
     return AbortReason::Alloc;
   }
 
+  // Code compiled at the Fast level keeps counting warm-up and asks to be
+  // recompiled at the Normal level if the script stays hot. See IonRecompile.
+  if (optimizationLevel == OptimizationLevel::Fast &&
+      JitOptions.ionRetierWarmUpThreshold > 0) {
+    uint64_t threshold = uint64_t(script->getWarmUpCount()) +
+                         JitOptions.ionRetierWarmUpThreshold;
+    mirGen->setRetierWarmUpThreshold(
+        uint32_t(std::min(threshold, uint64_t(UINT32_MAX))));
+  }
+
   auto clearDependencies =
       mozilla::MakeScopeExit([mirGen]() { mirGen->tracker.reset(); });
 
@@ -1910,7 +1947,10 @@ static MethodStatus Compile(JSContext* cx, HandleScript script,
     return Method_Skipped;
   }
 
+  // The warm-up threshold is the same for all optimization levels. Pick the
+  // level based on how expensive the compilation is likely to be.
   MOZ_ASSERT(optimizationLevel == OptimizationLevel::Normal);
+  optimizationLevel = SelectIonOptimizationLevel(cx, script);
 
   if (!CanLikelyAllocateMoreExecutableMemory()) {
     script->resetWarmUpCounterToDelayIonCompilation();
@@ -1919,7 +1959,7 @@ static MethodStatus Compile(JSContext* cx, HandleScript script,
 
   MOZ_ASSERT(!script->hasIonScript());
 
-  AbortReason reason = IonCompile(cx, script, osrPc);
+  AbortReason reason = IonCompile(cx, script, osrPc, optimizationLevel);
   if (reason == AbortReason::Error) {
     MOZ_ASSERT(cx->isExceptionPending());
     return Method_Error;
@@ -2206,6 +2246,27 @@ bool jit::IonCompileScriptForBaselineAtEntry(JSContext* cx,
   return IonCompileScriptForBaseline(cx, frame, script->code());
 }
 
+bool jit::IonRecompile(JSContext* cx, HandleScript script) {
+  // Only the first frame to reach the threshold has to do anything.
+  JitScript* jitScript = script->jitScript();
+  if (jitScript->needsFullIonCompile()) {
+    return true;
+  }
+  jitScript->setNeedsFullIonCompile();
+
+  JitSpew(JitSpew_IonScripts, "Recompiling %s:%u:%u at the Normal level",
+          script->filename(), script->lineno(),
+          script->column().oneOriginValue());
+
+  // Discard the Fast code. Ion frames for the script, including the caller,
+  // bail out to Baseline, and as the warm-up counter is past the Ion threshold
+  // the next warm-up check starts a Normal compilation.
+  if (script->hasIonScript()) {
+    Invalidate(cx, script, /* resetUses = */ false);
+  }
+  return true;
+}
+
 /* clang-format off */
 // The following data is kept in a temporary heap-allocated buffer, stored in
 // JitRuntime (high memory addresses at top, low at bottom):
@@ -2491,6 +2552,7 @@ void jit::InvalidateAll(JS::GCContext* gcx, Zone* zone) {
     return;
   }
   JSContext* cx = TlsContext.get();
+  AutoWritableJitCodeBatch batch(cx->runtime());
   for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
     if (iter->compartment()->zone() == zone) {
       JitSpew(JitSpew_IonInvalidate, "Invalidating all frames for GC");
@@ -2564,8 +2626,11 @@ void jit::Invalidate(JSContext* cx, const RecompileInfoVector& invalid,
   }
 
   JS::GCContext* gcx = cx->gcContext();
-  for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
-    InvalidateActivation(gcx, iter, false);
+  {
+    AutoWritableJitCodeBatch batch(cx->runtime());
+    for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
+      InvalidateActivation(gcx, iter, false);
+    }
   }
 
   // Drop the references added above. If a script was never active, its
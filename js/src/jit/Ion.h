@@ -60,6 +60,10 @@ struct IonOsrTempData {
                                                   jsbytecode* pc,
                                                   IonOsrTempData** infoPtr);
 
+// Called from Ion code compiled at OptimizationLevel::Fast once the script
+// reaches its re-tiering warm-up threshold.
+[[nodiscard]] bool IonRecompile(JSContext* cx, HandleScript script);
+
 MethodStatus CanEnterIon(JSContext* cx, RunState& state);
 
 class MIRGenerator;
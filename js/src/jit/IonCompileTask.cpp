@@ -6,10 +6,14 @@
 
 #include "jit/IonCompileTask.h"
 
+#include <algorithm>
+
 #include "jit/CodeGenerator.h"
 #include "jit/Ion.h"
 #include "jit/JitRuntime.h"
 #include "jit/JitScript.h"
+#include "jit/JitSpewer.h"
+#include "jit/TrialInlining.h"
 #include "jit/WarpSnapshot.h"
 #include "vm/HelperThreadState.h"
 #include "vm/JSScript.h"
@@ -80,6 +84,68 @@ size_t IonCompileTask::sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) {
   return result;
 }
 
+// Estimate how expensive an Ion compilation of |script| will be. The size of
+// the MIR graph, and with it the time spent in register allocation, grows with
+// the bytecode size of the script and of the scripts trial inlining chose to
+// inline into it. Deep inlining adds resume points and phis at every level, so
+// it's weighed as well.
+static size_t EstimateIonCompileCost(JSScript* script) {
+  JitScript* jitScript = script->jitScript();
+  if (!jitScript->hasInliningRoot()) {
+    return script->length();
+  }
+
+  InliningRoot* root = jitScript->inliningRoot();
+  uint32_t maxDepth = 0;
+  root->forEachInlinedScript([&](ICScript* icScript) {
+    maxDepth = std::max(maxDepth, icScript->depth());
+  });
+
+  size_t cost = root->totalBytecodeSize();
+  return cost + cost * maxDepth / 4;
+}
+
+OptimizationLevel jit::SelectIonOptimizationLevel(JSContext* cx,
+                                                  JSScript* script) {
+  if (!JitOptions.ionFastTier || JitOptions.eagerIonCompilation()) {
+    return OptimizationLevel::Normal;
+  }
+
+  // Code compiled at the Fast level asked to be recompiled.
+  if (script->jitScript()->needsFullIonCompile()) {
+    return OptimizationLevel::Normal;
+  }
+
+  // Main thread compilations are already limited to small scripts.
+  if (!OffThreadCompilationAvailable(cx)) {
+    return OptimizationLevel::Normal;
+  }
+
+  size_t cost = EstimateIonCompileCost(script);
+
+  OptimizationLevel level = OptimizationLevel::Normal;
+  if (cost >= JitOptions.ionFastTierCompileCost) {
+    level = OptimizationLevel::Fast;
+  } else if (cost >= JitOptions.ionFastTierBusyCompileCost) {
+    // If the compilations that are already queued will take all idle helper
+    // threads, this one would delay the ones queued behind it.
+    AutoLockHelperThreadState lock;
+    if (HelperThreadState().ionWorklist(lock).length() >=
+        HelperThreadState().idleThreadCount(lock)) {
+      level = OptimizationLevel::Fast;
+    }
+  }
+
+#ifdef JS_JITSPEW
+  JitSpew(JitSpew_IonScripts, "Compiling %s:%u:%u (cost %zu) at %s",
+          script->filename(), script->lineno(),
+          script->column().oneOriginValue(), cost,
+          OptimizationLevelString(level));
+#endif
+
+  return level;
+}
+
 static inline bool TooManyUnlinkedTasks(JSRuntime* rt) {
   static const size_t MaxUnlinkedTasks = 100;
   return rt->jitRuntime()->ionLazyLinkListSize() > MaxUnlinkedTasks;
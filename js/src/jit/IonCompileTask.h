@@ -10,6 +10,7 @@
 #include "mozilla/LinkedList.h"
 
 #include "jit/CompilationDependencyTracker.h"
+#include "jit/IonOptimizationLevels.h"
 #include "jit/MIRGenerator.h"
 
 #include "js/Utility.h"
@@ -85,6 +86,12 @@ class IonFreeTask : public HelperThreadTask {
   const char* getName() override { return "IonFreeTask"; }
 };
 
+// Pick the optimization level for an Ion compilation of |script|. Expensive
+// compilations use OptimizationLevel::Fast, so they don't keep a helper thread
+// busy for a long time while other hot scripts wait. The resulting code is
+// recompiled at OptimizationLevel::Normal if it stays hot.
+OptimizationLevel SelectIonOptimizationLevel(JSContext* cx, JSScript* script);
+
 void AttachFinishedCompilations(JSContext* cx);
 void FinishOffThreadTask(JSRuntime* runtime, AutoStartIonFreeTask& freeTask,
                          IonCompileTask* task);
@@ -19,16 +19,8 @@ using namespace js::jit;
 namespace js {
 namespace jit {
 
-uint32_t OptimizationInfo::compilerWarmUpThreshold(JSContext* cx,
-                                                   JSScript* script,
-                                                   jsbytecode* pc) const {
-  MOZ_ASSERT(pc == nullptr || pc == script->code() ||
-             JSOp(*pc) == JSOp::LoopHead);
-
-  // The script must not start with a LoopHead op or the code below would be
-  // wrong. See bug 1602681.
-  MOZ_ASSERT_IF(pc && JSOp(*pc) == JSOp::LoopHead, pc > script->code());
-
+uint32_t OptimizationInfo::scriptWarmUpThreshold(JSContext* cx,
+                                                 JSScript* script) const {
   uint32_t warmUpThreshold = baseCompilerWarmUpThreshold();
 
   // If an Ion counter hint is present, override the threshold.
@@ -40,6 +32,21 @@ uint32_t OptimizationInfo::compilerWarmUpThreshold(JSContext* cx,
     }
   }
 
+  return warmUpThreshold;
+}
+
+uint32_t OptimizationInfo::compilerWarmUpThreshold(uint32_t scriptThreshold,
+                                                   JSScript* script,
+                                                   jsbytecode* pc) const {
+  MOZ_ASSERT(pc == nullptr || pc == script->code() ||
+             JSOp(*pc) == JSOp::LoopHead);
+
+  // The script must not start with a LoopHead op or the code below would be
+  // wrong. See bug 1602681.
+  MOZ_ASSERT_IF(pc && JSOp(*pc) == JSOp::LoopHead, pc > script->code());
+
+  uint32_t warmUpThreshold = scriptThreshold;
+
   if (pc == script->code()) {
     pc = nullptr;
   }
@@ -17,7 +17,13 @@
 namespace js {
 namespace jit {
 
-enum class OptimizationLevel : uint8_t { Normal, Wasm, Count, DontCompile };
+enum class OptimizationLevel : uint8_t {
+  Normal,
+  Fast,
+  Wasm,
+  Count,
+  DontCompile
+};
 
 #ifdef JS_JITSPEW
 inline const char* OptimizationLevelString(OptimizationLevel level) {
@@ -26,6 +32,8 @@ inline const char* OptimizationLevelString(OptimizationLevel level) {
       return "Optimization_DontCompile";
     case OptimizationLevel::Normal:
       return "Optimization_Normal";
+    case OptimizationLevel::Fast:
+      return "Optimization_Fast";
     case OptimizationLevel::Wasm:
       return "Optimization_Wasm";
     case OptimizationLevel::Count:;
@@ -68,6 +76,9 @@ class OptimizationInfo {
   // Toggles whether loop invariant code motion is performed.
   bool licm_;
 
+  // Toggles whether loops over typed arrays are unrolled.
+  bool loopUnrolling_;
+
   // Toggles whether Range Analysis is used.
   bool rangeAnalysis_;
 
@@ -104,6 +115,7 @@ class OptimizationInfo {
         inlineNative_(false),
         gvn_(false),
         licm_(false),
+        loopUnrolling_(false),
         rangeAnalysis_(false),
         reordering_(false),
         autoTruncate_(false),
@@ -123,6 +135,7 @@ class OptimizationInfo {
     inlineInterpreted_ = true;
     inlineNative_ = true;
     licm_ = true;
+    loopUnrolling_ = true;
     gvn_ = true;
     rangeAnalysis_ = true;
     reordering_ = true;
@@ -131,6 +144,27 @@ class OptimizationInfo {
 
     registerAllocator_ = RegisterAllocator_Backtracking;
   }
+  constexpr void initFastOptimizationInfo() {
+    // The Fast optimization level
+    // Skips inlining and the more expensive analyses and uses the cheaper
+    // linear scan register allocation, for scripts that would otherwise keep a
+    // helper thread busy for a long time. See SelectIonOptimizationLevel.
+
+    // Take normal option values for not specified values.
+    initNormalOptimizationInfo();
+
+    level_ = OptimizationLevel::Fast;
+
+    autoTruncate_ = false;
+    eaa_ = false;
+    edgeCaseAnalysis_ = false;
+    inlineInterpreted_ = false;
+    rangeAnalysis_ = false;
+    reordering_ = false;
+    sink_ = false;
+
+    registerAllocator_ = RegisterAllocator_LinearScan;
+  }
   constexpr void initWasmOptimizationInfo() {
     // The Wasm optimization level
     // Disables some passes that don't work well with wasm.
@@ -146,6 +180,7 @@ class OptimizationInfo {
     eliminateRedundantChecks_ = false;
     eliminateRedundantShapeGuards_ = false;
     eliminateRedundantGCBarriers_ = false;
+    loopUnrolling_ = false;
     scalarReplacement_ = true;
     sink_ = false;
   }
@@ -160,8 +195,21 @@ class OptimizationInfo {
     return inlineNative_ && !JitOptions.disableInlining;
   }
 
+  // Returns the warm-up threshold for |script| before it's adjusted for the
+  // script's size and loop depth. This is the Ion counter hint if there is one.
+  uint32_t scriptWarmUpThreshold(JSContext* cx, JSScript* script) const;
+
   uint32_t compilerWarmUpThreshold(JSContext* cx, JSScript* script,
-                                   jsbytecode* pc = nullptr) const;
+                                   jsbytecode* pc = nullptr) const {
+    return compilerWarmUpThreshold(scriptWarmUpThreshold(cx, script), script,
+                                   pc);
+  }
+
+  // Like the above, but takes a threshold previously returned by
+  // scriptWarmUpThreshold. This doesn't need a JSContext, so it can be used by
+  // off-thread Baseline compilation.
+  uint32_t compilerWarmUpThreshold(uint32_t scriptThreshold, JSScript* script,
+                                   jsbytecode* pc) const;
 
   uint32_t recompileWarmUpThreshold(JSContext* cx, JSScript* script,
                                     jsbytecode* pc) const;
@@ -174,6 +222,12 @@ class OptimizationInfo {
     return rangeAnalysis_ && !JitOptions.disableRangeAnalysis;
   }
 
+  // Loop unrolling uses the iteration bounds computed by range analysis.
+  bool loopUnrollingEnabled() const {
+    return loopUnrolling_ && rangeAnalysisEnabled() &&
+           !JitOptions.disableLoopUnrolling;
+  }
+
   bool instructionReorderingEnabled() const {
     return reordering_ && !JitOptions.disableInstructionReordering;
   }
@@ -224,6 +278,7 @@ class OptimizationLevelInfo {
  public:
   constexpr OptimizationLevelInfo() {
     infos_[OptimizationLevel::Normal].initNormalOptimizationInfo();
+    infos_[OptimizationLevel::Fast].initFastOptimizationInfo();
     infos_[OptimizationLevel::Wasm].initWasmOptimizationInfo();
   }
 
@@ -6,7 +6,10 @@
 
 #include "jit/JitHints-inl.h"
 
+#include "mozilla/EndianUtils.h"
+
 #include "gc/Pretenuring.h"
+#include "jit/JitScript.h"
 
 #include "vm/BytecodeLocation-inl.h"
 #include "vm/JSScript-inl.h"
@@ -78,7 +81,16 @@ bool JitHintsMap::recordIonCompilation(JSScript* script) {
       script->jitScript()->hasPretenuredAllocSites());
 
   hint->initThreshold(threshold);
-  return true;
+
+  // Record the outer script's pretenured alloc sites. Sites belonging to
+  // inlined ICScripts are skipped as their offsets refer to other scripts.
+  bool ok = true;
+  script->jitScript()->icScript()->forEachAllocSite([&](gc::AllocSite* site) {
+    if (ok && site->initialHeap() == gc::Heap::Tenured) {
+      ok = hint->addLongLivedAllocSiteOffset(site->pcOffset());
+    }
+  });
+  return ok;
 }
 
 // static
@@ -177,3 +189,189 @@ bool JitHintsMap::hasMonomorphicInlineHintAtOffset(JSScript* script,
 
   return false;
 }
+
+bool JitHintsMap::hasLongLivedAllocSiteHintAtOffset(JSScript* script,
+                                                    uint32_t offset) {
+  ScriptKey key = getScriptKey(script);
+  if (!key) {
+    return false;
+  }
+
+  auto p = ionHintMap_.lookup(key);
+  if (p) {
+    return p->value()->hasLongLivedAllocSiteOffset(offset);
+  }
+
+  return false;
+}
+
+static bool EncodeUint32(JS::TranscodeBuffer& buffer, uint32_t value) {
+  uint8_t bytes[sizeof(uint32_t)];
+  mozilla::LittleEndian::writeUint32(bytes, value);
+  return buffer.append(bytes, sizeof(bytes));
+}
+
+namespace {
+
+class HintsReader {
+  const uint8_t* cur_;
+  const uint8_t* end_;
+
+ public:
+  explicit HintsReader(const JS::TranscodeRange& range)
+      : cur_(range.begin().get()), end_(range.end().get()) {}
+
+  [[nodiscard]] bool readUint32(uint32_t* valueOut) {
+    if (size_t(end_ - cur_) < sizeof(uint32_t)) {
+      return false;
+    }
+    *valueOut = mozilla::LittleEndian::readUint32(cur_);
+    cur_ += sizeof(uint32_t);
+    return true;
+  }
+};
+
+}  // namespace
+
+using OffsetVector = Vector<uint32_t, 0, SystemAllocPolicy>;
+
+static bool EncodeOffsets(JS::TranscodeBuffer& buffer,
+                          const OffsetVector& offsets) {
+  if (!EncodeUint32(buffer, offsets.length())) {
+    return false;
+  }
+  for (uint32_t offset : offsets) {
+    if (!EncodeUint32(buffer, offset)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns false if the data is malformed. |oomOut| is set if the failure was
+// caused by OOM instead.
+static bool DecodeOffsets(HintsReader& reader, uint32_t maxEntries,
+                          OffsetVector& offsets, bool* oomOut) {
+  uint32_t length;
+  if (!reader.readUint32(&length) || length > maxEntries) {
+    return false;
+  }
+  offsets.clear();
+  if (!offsets.reserve(length)) {
+    *oomOut = true;
+    return false;
+  }
+  for (uint32_t i = 0; i < length; i++) {
+    uint32_t offset;
+    if (!reader.readUint32(&offset)) {
+      return false;
+    }
+    offsets.infallibleAppend(offset);
+  }
+  return true;
+}
+
+bool JitHintsMap::IonHint::encode(JS::TranscodeBuffer& buffer) const {
+  return EncodeUint32(buffer, key_) && EncodeUint32(buffer, threshold_) &&
+         EncodeOffsets(buffer, monomorphicInlineOffsets) &&
+         EncodeOffsets(buffer, longLivedAllocSiteOffsets);
+}
+
+bool JitHintsMap::IonHint::mergeFrom(uint32_t threshold,
+                                     const OffsetVector& inlineOffsets,
+                                     const OffsetVector& allocOffsets) {
+  // Keep the threshold of an existing hint, as it reflects this process's own
+  // execution history.
+  if (threshold_ == 0) {
+    threshold_ = std::min(threshold, JitOptions.normalIonWarmUpThreshold);
+  }
+
+  for (uint32_t offset : inlineOffsets) {
+    if (!hasSpaceForMonomorphicInlineEntry()) {
+      break;
+    }
+    if (!addMonomorphicInlineOffset(offset)) {
+      return false;
+    }
+  }
+
+  for (uint32_t offset : allocOffsets) {
+    if (!addLongLivedAllocSiteOffset(offset)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool JitHintsMap::encode(JS::TranscodeBuffer& buffer) const {
+  if (!EncodeUint32(buffer, EncodingMagic) ||
+      !EncodeUint32(buffer, EncodingVersion) ||
+      !EncodeUint32(buffer, ionHintMap_.count())) {
+    return false;
+  }
+
+  // Encode from least to most recently used, so that decoding the buffer
+  // into an empty map recreates the same eviction order.
+  for (const IonHint* hint = ionHintQueue_.getFirst(); hint;
+       hint = hint->getNext()) {
+    if (!hint->encode(buffer)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool JitHintsMap::decode(const JS::TranscodeRange& range) {
+  HintsReader reader(range);
+
+  uint32_t magic, version, count;
+  if (!reader.readUint32(&magic) || magic != EncodingMagic ||
+      !reader.readUint32(&version) || version != EncodingVersion ||
+      !reader.readUint32(&count) || count > IonHintMaxEntries) {
+    return true;
+  }
+
+  OffsetVector inlineOffsets;
+  OffsetVector allocOffsets;
+  for (uint32_t i = 0; i < count; i++) {
+    ScriptKey key;
+    uint32_t threshold;
+    if (!reader.readUint32(&key) || !key || !reader.readUint32(&threshold)) {
+      return true;
+    }
+
+    bool oom = false;
+    if (!DecodeOffsets(reader, MonomorphicInlineMaxEntries, inlineOffsets,
+                       &oom) ||
+        !DecodeOffsets(reader, LongLivedAllocSiteMaxEntries, allocOffsets,
+                       &oom)) {
+      return !oom;
+    }
+
+    // Ion hints are only used for scripts with a Baseline hint.
+    if (!baselineHintMap_.mightContain(key)) {
+      incrementBaselineEntryCount();
+      baselineHintMap_.add(key);
+    }
+
+    auto p = ionHintMap_.lookupForAdd(key);
+    IonHint* hint = nullptr;
+    if (p) {
+      hint = p->value();
+      updateAsRecentlyUsed(hint);
+    } else {
+      hint = addIonHint(key, p);
+      if (!hint) {
+        return false;
+      }
+    }
+
+    if (!hint->mergeFrom(threshold, inlineOffsets, allocOffsets)) {
+      return false;
+    }
+  }
+
+  return true;
+}
@@ -11,6 +11,7 @@
 #include "mozilla/HashTable.h"
 #include "mozilla/LinkedList.h"
 #include "jit/JitOptions.h"
+#include "js/Transcoding.h"
 #include "vm/BytecodeLocation.h"
 #include "vm/JSScript.h"
 
@@ -27,6 +28,12 @@ namespace js::jit {
  * value, and if we ever encounter this script again later, e.g. during a
  * navigation, then we try to eagerly compile it into baseline and ion
  * based on its previous execution history.
+ *
+ * The Ion hints can also be encoded into a flat buffer and merged into the
+ * map of another runtime, so that an embedding can carry them over to a new
+ * process.  Since the ScriptKey only depends on the script's filename and
+ * source position, the hints remain valid across processes running the same
+ * build.  Every encoded Ion hint also implies a Baseline hint.
  */
 
 class JitHintsMap {
@@ -51,6 +58,10 @@ class JitHintsMap {
    * Each IonHint object also contains a list of bytecode offsets for locations
    * of monomorphic inline calls that is used as a hint for future compilations.
    *
+   * Similarly, the bytecode offsets of alloc sites that had been pretenured
+   * when the script was Ion compiled are recorded, so that these sites can
+   * start out allocating in the tenured heap when the script is seen again.
+   *
    */
   class IonHint : public mozilla::LinkedListElement<IonHint> {
     ScriptKey key_ = 0;
@@ -64,6 +75,9 @@ class JitHintsMap {
     // a state of monomorphic inline.
     Vector<uint32_t, 0, SystemAllocPolicy> monomorphicInlineOffsets;
 
+    // List of bytecode offsets of alloc sites in the long-lived state.
+    Vector<uint32_t, 0, SystemAllocPolicy> longLivedAllocSiteOffsets;
+
    public:
     explicit IonHint(ScriptKey key) { key_ = key; }
 
@@ -100,10 +114,32 @@ class JitHintsMap {
       return monomorphicInlineOffsets.append(newOffset);
     }
 
+    bool hasLongLivedAllocSiteOffset(uint32_t offset) {
+      for (uint32_t iterOffset : longLivedAllocSiteOffsets) {
+        if (iterOffset == offset) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool addLongLivedAllocSiteOffset(uint32_t newOffset) {
+      if (longLivedAllocSiteOffsets.length() >= LongLivedAllocSiteMaxEntries ||
+          hasLongLivedAllocSiteOffset(newOffset)) {
+        return true;
+      }
+      return longLivedAllocSiteOffsets.append(newOffset);
+    }
+
     ScriptKey key() {
       MOZ_ASSERT(key_ != 0, "Should have valid key.");
       return key_;
     }
+
+    bool encode(JS::TranscodeBuffer& buffer) const;
+    bool mergeFrom(uint32_t threshold,
+                   const Vector<uint32_t, 0, SystemAllocPolicy>& inlineOffsets,
+                   const Vector<uint32_t, 0, SystemAllocPolicy>& allocOffsets);
   };
 
   using ScriptToHintMap =
@@ -114,6 +150,10 @@ class JitHintsMap {
   static constexpr uint32_t InvalidationThresholdIncrement = 500;
   static constexpr uint32_t IonHintMaxEntries = 5000;
   static constexpr uint32_t MonomorphicInlineMaxEntries = 16;
+  static constexpr uint32_t LongLivedAllocSiteMaxEntries = 16;
+
+  static constexpr uint32_t EncodingMagic = 0x4a495448;  // 'JITH'
+  static constexpr uint32_t EncodingVersion = 1;
 
   static uint32_t IonHintEagerThresholdValue(uint32_t lastStubCounter,
                                              bool hasPretenuredAllocSites);
@@ -166,7 +206,18 @@ class JitHintsMap {
   bool addMonomorphicInlineLocation(JSScript* script, BytecodeLocation loc);
   bool hasMonomorphicInlineHintAtOffset(JSScript* script, uint32_t offset);
 
+  bool hasLongLivedAllocSiteHintAtOffset(JSScript* script, uint32_t offset);
+
   void recordInvalidation(JSScript* script);
+
+  // Append the Ion hints to |buffer|, least recently used first. Returns false
+  // on OOM.
+  bool encode(JS::TranscodeBuffer& buffer) const;
+
+  // Merge hints previously produced by |encode| into this map. Existing
+  // thresholds are kept. Malformed or incompatible data is ignored from the
+  // first inconsistency onwards. Returns false on OOM.
+  bool decode(const JS::TranscodeRange& range);
 };
 
 }  // namespace js::jit
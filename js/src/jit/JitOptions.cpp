@@ -93,6 +93,10 @@ DefaultJitOptions::DefaultJitOptions() {
   // Toggles whether loop invariant code motion is globally disabled.
   SET_DEFAULT(disableLicm, false);
 
+  // Toggles whether loop unrolling is globally disabled. It's off by default
+  // until it has test coverage, and can be enabled with --ion-loop-unrolling.
+  SET_DEFAULT(disableLoopUnrolling, true);
+
   // Toggle whether branch pruning is globally disabled.
   SET_DEFAULT(disablePruning, false);
 
@@ -155,6 +159,10 @@ DefaultJitOptions::DefaultJitOptions() {
   // Whether the Baseline JIT is enabled.
   SET_DEFAULT(baselineJit, true);
 
+  // Whether Baseline JIT code may be generated on helper threads. The code is
+  // installed on the main thread, in batches of baselineBatchSize scripts.
+  SET_DEFAULT(baselineOffThreadCompilation, false);
+
   // Whether the IonMonkey JIT is enabled.
   SET_DEFAULT(ion, true);
 
@@ -174,6 +182,10 @@ DefaultJitOptions::DefaultJitOptions() {
   // Toggles whether large scripts are rejected.
   SET_DEFAULT(limitScriptSize, true);
 
+  // Toggles whether expensive Ion compilations may use
+  // OptimizationLevel::Fast. See SelectIonOptimizationLevel.
+  SET_DEFAULT(ionFastTier, true);
+
   // Toggles whether functions may be entered at loop headers.
   SET_DEFAULT(osr, true);
 
@@ -199,6 +211,11 @@ DefaultJitOptions::DefaultJitOptions() {
   // Duplicated in all.js - ensure both match.
   SET_DEFAULT(baselineJitWarmUpThreshold, 100);
 
+  // How many off-thread Baseline compilations to accumulate before asking the
+  // main thread to install them. Finished compilations are also installed
+  // when no others are pending.
+  SET_DEFAULT(baselineBatchSize, 5);
+
   // Disable eager baseline jit hints
   SET_DEFAULT(disableJitHints, false);
 
@@ -275,6 +292,17 @@ DefaultJitOptions::DefaultJitOptions() {
   SET_DEFAULT(ionMaxLocalsAndArgs, 10 * 1000);
   SET_DEFAULT(ionMaxLocalsAndArgsMainThread, 256);
 
+  // Estimated compilation cost (roughly bytecode size, including inlined
+  // scripts) above which Ion compiles at OptimizationLevel::Fast, and the
+  // lower cost above which it does so when all helper threads are busy.
+  SET_DEFAULT(ionFastTierCompileCost, 20 * 1000);
+  SET_DEFAULT(ionFastTierBusyCompileCost, 4 * 1000);
+
+  // How many more invocations or loop iterations code compiled at
+  // OptimizationLevel::Fast runs before it's recompiled at the Normal level.
+  // Zero disables re-tiering.
+  SET_DEFAULT(ionRetierWarmUpThreshold, 10 * 1000);
+
   // Force the used register allocator instead of letting the optimization
   // pass decide.
   const char* forcedRegisterAllocatorEnv = "JIT_OPTION_forcedRegisterAllocator";
@@ -19,6 +19,7 @@ namespace jit {
 enum IonRegisterAllocator {
   RegisterAllocator_Backtracking,
   RegisterAllocator_Testbed,
+  RegisterAllocator_LinearScan,
 };
 
 // Which register to use as base register to access stack slots: frame pointer,
@@ -40,6 +41,9 @@ static inline mozilla::Maybe<IonRegisterAllocator> LookupRegisterAllocator(
   if (!strcmp(name, "testbed")) {
     return mozilla::Some(RegisterAllocator_Testbed);
   }
+  if (!strcmp(name, "linearscan")) {
+    return mozilla::Some(RegisterAllocator_LinearScan);
+  }
   return mozilla::Nothing();
 }
 
@@ -58,6 +62,7 @@ struct DefaultJitOptions {
   bool disableGvn;
   bool disableInlining;
   bool disableLicm;
+  bool disableLoopUnrolling;
   bool disablePruning;
   bool disableInstructionReordering;
   bool disableIteratorIndices;
@@ -75,6 +80,7 @@ struct DefaultJitOptions {
 #endif
   bool baselineInterpreter;
   bool baselineJit;
+  bool baselineOffThreadCompilation;
   bool ion;
   bool jitForTrustedPrincipals;
   bool nativeRegExp;
@@ -82,6 +88,7 @@ struct DefaultJitOptions {
   bool forceMegamorphicICs;
   bool fullDebugChecks;
   bool limitScriptSize;
+  bool ionFastTier;
   bool osr;
   bool wasmFoldOffsets;
   bool wasmDelayTier2;
@@ -98,6 +105,7 @@ struct DefaultJitOptions {
   bool emitInterpreterEntryTrampoline;
   uint32_t baselineInterpreterWarmUpThreshold;
   uint32_t baselineJitWarmUpThreshold;
+  uint32_t baselineBatchSize;
   uint32_t trialInliningWarmUpThreshold;
   uint32_t trialInliningInitialWarmUpCount;
   UseMonomorphicInlining monomorphicInlining = UseMonomorphicInlining::Default;
@@ -122,6 +130,9 @@ struct DefaultJitOptions {
   uint32_t ionMaxScriptSizeMainThread;
   uint32_t ionMaxLocalsAndArgs;
   uint32_t ionMaxLocalsAndArgsMainThread;
+  uint32_t ionFastTierCompileCost;
+  uint32_t ionFastTierBusyCompileCost;
+  uint32_t ionRetierWarmUpThreshold;
   uint32_t wasmBatchBaselineThreshold;
   uint32_t wasmBatchIonThreshold;
   mozilla::Maybe<IonRegisterAllocator> forcedRegisterAllocator;
@@ -232,6 +232,12 @@ class JitRuntime {
       mozilla::Atomic<size_t, mozilla::SequentiallyConsistent>;
   NumFinishedOffThreadTasksType numFinishedOffThreadTasks_{0};
 
+  // Number of off-thread Baseline compilations which are queued or running,
+  // and number which have finished and are waiting to be linked. These are
+  // only modified while holding the helper thread state lock.
+  NumFinishedOffThreadTasksType numPendingBaselineTasks_{0};
+  NumFinishedOffThreadTasksType numFinishedBaselineTasks_{0};
+
   // List of Ion compilation waiting to get linked.
   using IonCompileTaskList = mozilla::LinkedList<js::jit::IonCompileTask>;
   MainThreadData<IonCompileTaskList> ionLazyLinkList_;
@@ -360,6 +366,9 @@ class JitRuntime {
   JitCode* debugTrapHandler(JSContext* cx, DebugTrapHandlerKind kind);
 
   BaselineInterpreter& baselineInterpreter() { return baselineInterpreter_; }
+  const BaselineInterpreter& baselineInterpreter() const {
+    return baselineInterpreter_;
+  }
 
   TrampolinePtr getGenericBailoutHandler() const {
     return trampolineCode(bailoutHandlerOffset_);
@@ -503,6 +512,17 @@ class JitRuntime {
     return numFinishedOffThreadTasks_;
   }
 
+  size_t numPendingBaselineTasks() const { return numPendingBaselineTasks_; }
+  NumFinishedOffThreadTasksType& numPendingBaselineTasksRef(
+      const AutoLockHelperThreadState& locked) {
+    return numPendingBaselineTasks_;
+  }
+  size_t numFinishedBaselineTasks() const { return numFinishedBaselineTasks_; }
+  NumFinishedOffThreadTasksType& numFinishedBaselineTasksRef(
+      const AutoLockHelperThreadState& locked) {
+    return numFinishedBaselineTasks_;
+  }
+
   IonCompileTaskList& ionLazyLinkList(JSRuntime* rt);
 
   size_t ionLazyLinkListSize() const { return ionLazyLinkListSize_; }
@@ -16,6 +16,8 @@
 #include "jit/BytecodeAnalysis.h"
 #include "jit/IonScript.h"
 #include "jit/JitFrames.h"
+#include "jit/JitHints.h"
+#include "jit/JitRuntime.h"
 #include "jit/JitSpewer.h"
 #include "jit/ScriptFromCalleeToken.h"
 #include "jit/TrialInlining.h"
@@ -864,6 +866,16 @@ gc::AllocSite* ICScript::getOrCreateAllocSite(JSScript* outerScript,
 
   allocSites_.infallibleAppend(site);
 
+  // If this site was pretenured the last time this script ran, start it off in
+  // the tenured heap rather than re-learning that from nursery collections.
+  JitRuntime* jitRuntime = outerScript->runtimeFromMainThread()->jitRuntime();
+  if (this == outerScript->jitScript()->icScript() &&
+      jitRuntime->hasJitHintsMap() &&
+      jitRuntime->getJitHintsMap()->hasLongLivedAllocSiteHintAtOffset(
+          outerScript, pcOffset)) {
+    site->initLongLivedState();
+  }
+
   nursery.noteAllocSiteCreated();
 
   return site;
@@ -194,6 +194,13 @@ class alignas(uintptr_t) ICScript final : public TrailingArray<ICScript> {
 
   gc::AllocSite* getOrCreateAllocSite(JSScript* outerScript, uint32_t pcOffset);
 
+  template <typename F>
+  void forEachAllocSite(const F& f) const {
+    for (gc::AllocSite* site : allocSites_) {
+      f(site);
+    }
+  }
+
   void prepareForDestruction(Zone* zone);
 
   void trace(JSTracer* trc);
@@ -344,6 +351,14 @@ class alignas(uintptr_t) JitScript final
   struct Flags {
     // True if this script entered Ion via OSR at a loop header.
     bool hadIonOSR : 1;
+
+    // True if a Baseline compilation of this script is queued or running on
+    // a helper thread, or waiting to be linked.
+    bool baselineCompilingOffThread : 1;
+
+    // True if Ion code compiled at OptimizationLevel::Fast asked to be
+    // recompiled. Later Ion compilations use OptimizationLevel::Normal.
+    bool needsFullIonCompile : 1;
   };
   Flags flags_ = {};  // Zero-initialize flags.
 
@@ -384,6 +399,21 @@ class alignas(uintptr_t) JitScript final
   void setHadIonOSR() { flags_.hadIonOSR = true; }
   bool hadIonOSR() const { return flags_.hadIonOSR; }
 
+  void setNeedsFullIonCompile() { flags_.needsFullIonCompile = true; }
+  bool needsFullIonCompile() const { return flags_.needsFullIonCompile; }
+
+  bool isBaselineCompilingOffThread() const {
+    return flags_.baselineCompilingOffThread;
+  }
+  void setIsBaselineCompilingOffThread() {
+    MOZ_ASSERT(!isBaselineCompilingOffThread());
+    flags_.baselineCompilingOffThread = true;
+  }
+  void clearIsBaselineCompilingOffThread() {
+    MOZ_ASSERT(isBaselineCompilingOffThread());
+    flags_.baselineCompilingOffThread = false;
+  }
+
   uint32_t numICEntries() const { return icScript_.numICEntries(); }
 
 #ifdef DEBUG
@@ -348,6 +348,7 @@ static void PrintHelpAndExit(int status = 0) {
       "  alias-sum     Alias analysis: shows summaries for every block\n"
       "  gvn           Global Value Numbering\n"
       "  licm          Loop invariant code motion\n"
+      "  unroll        Loop unrolling\n"
       "  flac          Fold linear arithmetic constants\n"
       "  eaa           Effective address analysis\n"
       "  sink          Sink transformation\n"
@@ -440,6 +441,8 @@ void jit::CheckLogging() {
       EnableChannel(JitSpew_BranchHint);
     } else if (IsFlag(found, "licm")) {
       EnableChannel(JitSpew_LICM);
+    } else if (IsFlag(found, "unroll")) {
+      EnableChannel(JitSpew_Unrolling);
     } else if (IsFlag(found, "flac")) {
       EnableChannel(JitSpew_FLAC);
     } else if (IsFlag(found, "eaa")) {
@@ -41,6 +41,8 @@ namespace jit {
   _(Range)                                 \
   /* Information during LICM */            \
   _(LICM)                                  \
+  /* Information during loop unrolling */  \
+  _(Unrolling)                             \
   /* Information during Branch Hinting */  \
   _(BranchHint)                            \
   /* Info about fold linear constants */   \
@@ -11,6 +11,8 @@
 #include "mozilla/Maybe.h"
 #include "mozilla/ScopeExit.h"
 
+#include <algorithm>
+
 #include "gc/Marking.h"
 #include "gc/Zone.h"
 #include "jit/BaselineJIT.h"
@@ -234,6 +236,10 @@ const JitcodeGlobalEntry* JitcodeGlobalTable::lookupForSampler(
 }
 
 JitcodeGlobalEntry* JitcodeGlobalTable::lookupInternal(void* ptr) {
+  if (JitcodeGlobalEntry* entry = lookupInIndex(ptr)) {
+    return entry;
+  }
+
   // Search for an entry containing the one-byte range starting at |ptr|.
   JitCodeRange range(ptr, static_cast<uint8_t*>(ptr) + 1);
 
@@ -245,6 +251,89 @@ JitcodeGlobalEntry* JitcodeGlobalTable::lookupInternal(void* ptr) {
   return nullptr;
 }
 
+JitcodeGlobalEntry* JitcodeGlobalTable::lookupInIndex(void* ptr) {
+  if (indexEntries_.empty()) {
+    return nullptr;
+  }
+
+  // Find the first entry that ends above |ptr|. Each step goes to the left
+  // child if the element ends above |ptr| and to the right child otherwise,
+  // so when we fall off the tree, the bits of |k| record the path taken. The
+  // result is the element where the path last went left, which we get by
+  // stripping the trailing right turns and that left turn.
+  uintptr_t addr = uintptr_t(ptr);
+  const uintptr_t* ends = indexEnds_.begin();
+  size_t numIndexed = indexEnds_.length() - 1;
+  size_t k = 1;
+  while (k <= numIndexed) {
+    k = 2 * k + size_t(ends[k] <= addr);
+  }
+  k >>= mozilla::CountTrailingZeroes64(~uint64_t(k)) + 1;
+  if (k == 0) {
+    return nullptr;
+  }
+
+  JitcodeGlobalEntry* entry = indexEntries_[k];
+  if (!entry->containsPointer(ptr)) {
+    return nullptr;
+  }
+  return entry;
+}
+
+bool JitcodeGlobalTable::samplerIndexStale() const {
+  return numUnindexed_ >=
+         std::max(MIN_UNINDEXED_FOR_REBUILD, entries_.length() / 4);
+}
+
+void JitcodeGlobalTable::clearSamplerIndex() {
+  indexEnds_.clearAndFree();
+  indexEntries_.clearAndFree();
+  numUnindexed_ = entries_.length();
+}
+
+void JitcodeGlobalTable::rebuildSamplerIndex(JSRuntime* rt) {
+  // Callers must suppress sampling while the snapshot is modified.
+  MOZ_ASSERT(!rt->mainContextFromOwnThread()->isProfilerSamplingEnabled());
+
+  // The snapshot is only useful while the profiler is sampling.
+  if (!rt->geckoProfiler().enabled()) {
+    clearSamplerIndex();
+    return;
+  }
+
+  size_t length = entries_.length() + 1;
+  if (!indexEnds_.resize(length) || !indexEntries_.resize(length)) {
+    // The snapshot is only an optimization, so ignore OOM and use the tree.
+    clearSamplerIndex();
+    return;
+  }
+
+  indexEnds_[0] = 0;
+  indexEntries_[0] = nullptr;
+
+  EntryTree::Iter iter(&tree_);
+  fillSamplerIndex(iter, 1);
+  MOZ_ASSERT(!iter.hasMore());
+
+  numUnindexed_ = 0;
+}
+
+void JitcodeGlobalTable::fillSamplerIndex(EntryTree::Iter& iter, size_t k) {
+  // Visit the implicit tree in order, assigning the tree's entries in sorted
+  // order. The recursion depth is logarithmic in the number of entries.
+  if (k >= indexEntries_.length()) {
+    return;
+  }
+
+  fillSamplerIndex(iter, 2 * k);
+
+  auto* entry = static_cast<JitcodeGlobalEntry*>(iter.next());
+  indexEnds_[k] = uintptr_t(entry->nativeEndAddr());
+  indexEntries_[k] = entry;
+
+  fillSamplerIndex(iter, 2 * k + 1);
+}
+
 bool JitcodeGlobalTable::addEntry(UniqueJitcodeGlobalEntry entry) {
   MOZ_ASSERT(entry->isIon() || entry->isIonIC() || entry->isBaseline() ||
              entry->isBaselineInterpreter() || entry->isDummy());
@@ -255,7 +344,8 @@ bool JitcodeGlobalTable::addEntry(UniqueJitcodeGlobalEntry entry) {
   MOZ_ASSERT(!tree_.maybeLookup(entry.get()));
 
   // Suppress profiler sampling while data structures are being mutated.
-  AutoSuppressProfilerSampling suppressSampling(TlsContext.get());
+  JSContext* cx = TlsContext.get();
+  AutoSuppressProfilerSampling suppressSampling(cx);
 
   if (!entries_.append(std::move(entry))) {
     return false;
@@ -265,6 +355,11 @@ bool JitcodeGlobalTable::addEntry(UniqueJitcodeGlobalEntry entry) {
     return false;
   }
 
+  numUnindexed_++;
+  if (samplerIndexStale()) {
+    rebuildSamplerIndex(cx->runtime());
+  }
+
   return true;
 }
 
@@ -276,6 +371,12 @@ void JitcodeGlobalTable::setAllEntriesAsExpired() {
   }
 }
 
+void JitcodeGlobalTable::releaseSamplerIndex() {
+  // Called when the profiler stops: the snapshot is only used for sampling.
+  AutoSuppressProfilerSampling suppressSampling(TlsContext.get());
+  clearSamplerIndex();
+}
+
 bool JitcodeGlobalTable::markIteratively(GCMarker* marker) {
   // JitcodeGlobalTable must keep entries that are in the sampler buffer
   // alive. This conditionality is akin to holding the entries weakly.
@@ -341,6 +442,7 @@ bool JitcodeGlobalTable::markIteratively(GCMarker* marker) {
 void JitcodeGlobalTable::traceWeak(JSRuntime* rt, JSTracer* trc) {
   AutoSuppressProfilerSampling suppressSampling(rt->mainContextFromOwnThread());
 
+  bool removedAny = false;
   entries_.eraseIf([&](auto& entry) {
     if (!entry->zone()->isCollecting() || entry->zone()->isGCFinished()) {
       return false;
@@ -359,10 +461,17 @@ void JitcodeGlobalTable::traceWeak(JSRuntime* rt, JSTracer* trc) {
     MOZ_ASSERT_IF(rangeStart, !entry->isSampled(*rangeStart));
 #endif
     tree_.remove(entry.get());
+    removedAny = true;
     return true;
   });
 
   MOZ_ASSERT(tree_.empty() == entries_.empty());
+
+  // The snapshot must not refer to removed entries. This is also a good time
+  // to add the entries compiled since the last rebuild.
+  if (removedAny || numUnindexed_ > 0) {
+    rebuildSamplerIndex(rt);
+  }
 }
 
 bool JitcodeGlobalEntry::traceJitcode(JSTracer* trc) {
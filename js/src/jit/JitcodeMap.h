@@ -448,6 +448,34 @@ class JitcodeGlobalTable {
   LifoAlloc alloc_;
   EntryTree tree_;
 
+  // Sorted snapshot of the tree, used to speed up lookups while the Gecko
+  // profiler is sampling. The sampler looks up every JIT frame of every
+  // sample, and walking the AVL tree's pointer-linked nodes is a significant
+  // part of that.
+  //
+  // The snapshot is an implicit binary search tree in Eytzinger (breadth
+  // first) order: the children of element k are 2k and 2k+1, and element 0 is
+  // unused. |indexEnds_| holds the end addresses of the entries, as the lookup
+  // searches for the first entry that ends above the address, and is kept
+  // separate from |indexEntries_| so the top levels of the search share a few
+  // cache lines.
+  //
+  // The snapshot either contains exactly the entries in the tree that were
+  // added before it was built, or is empty. It's rebuilt on the main thread
+  // with sampling suppressed, after enough code has been added or when entries
+  // are removed, so samples never see it in an inconsistent state. Entries
+  // added since the last rebuild are found in the tree.
+  using IndexEndVector = Vector<uintptr_t, 0, SystemAllocPolicy>;
+  using IndexEntryVector = Vector<JitcodeGlobalEntry*, 0, SystemAllocPolicy>;
+  IndexEndVector indexEnds_;
+  IndexEntryVector indexEntries_;
+  size_t numUnindexed_ = 0;
+
+  // Don't bother with the snapshot until this many entries are missing from
+  // it. Past that, rebuild it when a quarter of the entries are missing, to
+  // keep the cost of the rebuilds linear in the number of added entries.
+  static const size_t MIN_UNINDEXED_FOR_REBUILD = 16;
+
  public:
   JitcodeGlobalTable()
       : alloc_(LIFO_CHUNK_SIZE, js::BackgroundMallocArena), tree_(&alloc_) {}
@@ -465,11 +493,18 @@ class JitcodeGlobalTable {
   [[nodiscard]] bool addEntry(UniqueJitcodeGlobalEntry entry);
 
   void setAllEntriesAsExpired();
+  void releaseSamplerIndex();
   [[nodiscard]] bool markIteratively(GCMarker* marker);
   void traceWeak(JSRuntime* rt, JSTracer* trc);
 
  private:
   JitcodeGlobalEntry* lookupInternal(void* ptr);
+  JitcodeGlobalEntry* lookupInIndex(void* ptr);
+
+  bool samplerIndexStale() const;
+  void clearSamplerIndex();
+  void rebuildSamplerIndex(JSRuntime* rt);
+  void fillSamplerIndex(EntryTree::Iter& iter, size_t k);
 };
 
 // clang-format off
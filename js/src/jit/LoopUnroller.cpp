@@ -0,0 +1,520 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/LoopUnroller.h"
+
+#include "jit/IonAnalysis.h"
+#include "jit/JitSpewer.h"
+#include "jit/MIR.h"
+#include "jit/MIRGenerator.h"
+#include "jit/MIRGraph.h"
+#include "js/HashTable.h"
+#include "util/CheckedArithmetic.h"
+
+using namespace js;
+using namespace js::jit;
+
+// Loop unrolling for simple counted loops over typed arrays, like:
+//
+//   for (var i = 0; i < n; i++) {
+//     a[i] = b[i] * c;
+//   }
+//
+// Once range analysis has hoisted the bounds checks out of such a loop, the
+// body is a short sequence of typed array loads, arithmetic and stores, and
+// most of the remaining cost per iteration is the loop test, the increment
+// and the interrupt check. The loop is transformed into:
+//
+//   preheader:
+//     ...
+//   unrolledHeader:
+//     phis, interrupt check
+//     if (bound - iterations - UnrollCount >= 0) goto unrolledBody
+//     else goto newPreheader
+//   unrolledBody:
+//     UnrollCount copies of the original header and body
+//     goto unrolledHeader
+//   newPreheader:
+//     goto header
+//   header:
+//     original loop, which runs the remaining iterations
+//
+// The iteration bound ensures each copy in the unrolled body executes exactly
+// when the original loop would have executed the same iteration, so the
+// ranges computed by range analysis remain valid for the copies.
+
+// For now we always unroll loops the same number of times.
+static constexpr size_t UnrollCount = 4;
+
+// Don't unroll loops with more than this many instructions in their header
+// and body, to limit the growth in code size.
+static constexpr size_t MaxLoopInstructions = 50;
+
+namespace {
+
+class LoopUnroller {
+  using DefinitionMap =
+      HashMap<MDefinition*, MDefinition*, DefaultHasher<MDefinition*>,
+              SystemAllocPolicy>;
+
+  MIRGraph& graph;
+  TempAllocator& alloc;
+
+  // Header and body of the original loop.
+  MBasicBlock* header = nullptr;
+  MBasicBlock* backedge = nullptr;
+
+  // Header and body of the unrolled loop.
+  MBasicBlock* unrolledHeader = nullptr;
+  MBasicBlock* unrolledBackedge = nullptr;
+
+  // Old and new preheaders. The old preheader starts the unrolled loop, after
+  // which the new preheader starts the original loop.
+  MBasicBlock* oldPreheader = nullptr;
+  MBasicBlock* newPreheader = nullptr;
+
+  // Map terms in the original loop to terms in the current unrolled iteration.
+  DefinitionMap unrolledDefinitions;
+
+  MDefinition* getReplacementDefinition(MDefinition* def);
+  [[nodiscard]] bool makeReplacementInstruction(MInstruction* ins);
+  MResumePoint* makeReplacementResumePoint(MBasicBlock* block,
+                                           MResumePoint* rp);
+  [[nodiscard]] bool replaceEntryResumePointOperands(MBasicBlock* block);
+  MBasicBlock* makeBlock(MResumePoint* rp);
+
+  bool canUnroll(const LoopIterationBound* bound, LinearSum* remaining);
+
+ public:
+  explicit LoopUnroller(MIRGraph& graph)
+      : graph(graph), alloc(graph.alloc()) {}
+
+  [[nodiscard]] bool go(const LoopIterationBound* bound, bool* unrolled);
+};
+
+}  // namespace
+
+MDefinition* LoopUnroller::getReplacementDefinition(MDefinition* def) {
+  if (def->block()->id() < header->id()) {
+    // The definition is loop invariant.
+    return def;
+  }
+
+  DefinitionMap::Ptr p = unrolledDefinitions.lookup(def);
+  if (!p) {
+    // After phi analysis (TypeAnalyzer::replaceRedundantPhi) the resume
+    // point at the start of a block can contain definitions from within
+    // the block itself.
+    MOZ_ASSERT(def->isConstant());
+
+    MConstant* constant = MConstant::Copy(alloc, def->toConstant());
+    oldPreheader->insertBefore(oldPreheader->lastIns(), constant);
+    return constant;
+  }
+
+  return p->value();
+}
+
+bool LoopUnroller::makeReplacementInstruction(MInstruction* ins) {
+  MDefinitionVector inputs(alloc);
+  for (size_t i = 0; i < ins->numOperands(); i++) {
+    MDefinition* old = ins->getOperand(i);
+    MDefinition* replacement = getReplacementDefinition(old);
+    if (!inputs.append(replacement)) {
+      return false;
+    }
+  }
+
+  MInstruction* clone;
+  if (ins->isConstant()) {
+    clone = MConstant::Copy(alloc, ins->toConstant());
+  } else {
+    clone = ins->clone(alloc, inputs);
+  }
+
+  unrolledBackedge->add(clone);
+
+  if (!unrolledDefinitions.putNew(ins, clone)) {
+    return false;
+  }
+
+  if (MResumePoint* old = ins->resumePoint()) {
+    MResumePoint* rp = makeReplacementResumePoint(unrolledBackedge, old);
+    if (!rp) {
+      return false;
+    }
+    clone->setResumePoint(rp);
+  }
+
+  return true;
+}
+
+MResumePoint* LoopUnroller::makeReplacementResumePoint(MBasicBlock* block,
+                                                       MResumePoint* rp) {
+  MDefinitionVector inputs(alloc);
+  for (size_t i = 0; i < rp->numOperands(); i++) {
+    MDefinition* old = rp->getOperand(i);
+    MDefinition* replacement = getReplacementDefinition(old);
+    if (!inputs.append(replacement)) {
+      return nullptr;
+    }
+  }
+
+  return MResumePoint::New(alloc, block, rp, inputs);
+}
+
+bool LoopUnroller::replaceEntryResumePointOperands(MBasicBlock* block) {
+  MResumePoint* rp = block->entryResumePoint();
+  for (size_t i = 0; i < rp->numOperands(); i++) {
+    if (!alloc.ensureBallast()) {
+      return false;
+    }
+    rp->replaceOperand(i, getReplacementDefinition(rp->getOperand(i)));
+  }
+  return true;
+}
+
+MBasicBlock* LoopUnroller::makeBlock(MResumePoint* rp) {
+  // The new blocks resume at the start of the original loop header. The entry
+  // resume point is a copy of the header's, and its operands are replaced
+  // with their values at the start of the unrolled iteration.
+  MBasicBlock* block = MBasicBlock::NewInternal(graph, header, rp);
+  if (!block || !replaceEntryResumePointOperands(block)) {
+    return nullptr;
+  }
+  return block;
+}
+
+bool LoopUnroller::canUnroll(const LoopIterationBound* bound,
+                             LinearSum* remaining) {
+  if (header->numPredecessors() != 2) {
+    return false;
+  }
+
+  MOZ_ASSERT(oldPreheader->numSuccessors() == 1);
+  MOZ_ASSERT(oldPreheader->lastIns()->isGoto());
+
+  // Only unroll loops with two blocks: an initial one ending with the
+  // bound's test, and the body ending with the backedge.
+  const MTest* test = bound->test;
+  MOZ_ASSERT(header->lastIns() == test);
+  if (test->ifTrue() == backedge) {
+    if (test->ifFalse()->id() <= backedge->id()) {
+      return false;
+    }
+  } else if (test->ifFalse() == backedge) {
+    if (test->ifTrue()->id() <= backedge->id()) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+  if (backedge->numPredecessors() != 1 || backedge->numSuccessors() != 1) {
+    return false;
+  }
+  MOZ_ASSERT(backedge->phisEmpty());
+
+  if (!header->entryResumePoint()) {
+    return false;
+  }
+
+  // All instructions in the header and body must be clonable. The loop must
+  // access a typed array, and any bounds checks must have been hoisted out of
+  // the loop by range analysis.
+  MBasicBlock* bodyBlocks[] = {header, backedge};
+  size_t numInstructions = 0;
+  bool accessesTypedArray = false;
+  for (MBasicBlock* block : bodyBlocks) {
+    for (MInstructionIterator iter(block->begin()); iter != block->end();
+         iter++) {
+      MInstruction* ins = *iter;
+      if (++numInstructions > MaxLoopInstructions) {
+        JitSpew(JitSpew_Unrolling, "Aborting: loop is too large");
+        return false;
+      }
+      if (ins->isLoadUnboxedScalar() || ins->isStoreUnboxedScalar()) {
+        accessesTypedArray = true;
+      }
+      if (ins->isBoundsCheck()) {
+        JitSpew(JitSpew_Unrolling, "Aborting: loop has a bounds check");
+        return false;
+      }
+      if (ins->canClone() || ins->isConstant()) {
+        continue;
+      }
+      if (ins->isTest() || ins->isGoto() || ins->isInterruptCheck()) {
+        continue;
+      }
+#ifdef JS_JITSPEW
+      JitSpew(JitSpew_Unrolling, "Aborting: can't clone instruction %s",
+              ins->opName());
+#endif
+      return false;
+    }
+  }
+  if (!accessesTypedArray) {
+    JitSpew(JitSpew_Unrolling, "Aborting: loop doesn't access a typed array");
+    return false;
+  }
+
+  // Compute the linear inequality we will use for exiting the unrolled loop:
+  //
+  // iterationBound - iterationCount - UnrollCount >= 0
+  //
+  if (!remaining->add(bound->currentSum, -1)) {
+    return false;
+  }
+  if (!remaining->add(-int32_t(UnrollCount))) {
+    return false;
+  }
+
+  // Terms in the inequality need to be either loop invariant or phis from
+  // the original header.
+  for (size_t i = 0; i < remaining->numTerms(); i++) {
+    MDefinition* def = remaining->term(i).term;
+    if (def->isDiscarded()) {
+      return false;
+    }
+    if (def->block()->id() < header->id()) {
+      continue;
+    }
+    if (def->block() == header && def->isPhi()) {
+      continue;
+    }
+    return false;
+  }
+
+  return true;
+}
+
+bool LoopUnroller::go(const LoopIterationBound* bound, bool* unrolled) {
+  *unrolled = false;
+
+  JitSpew(JitSpew_Unrolling, "Attempting to unroll loop");
+
+  // Only loops whose header ends with the bound's test can be unrolled.
+  header = bound->test->block();
+  if (!header->isLoopHeader() || header->lastIns() != bound->test) {
+    return true;
+  }
+  backedge = header->backedge();
+  oldPreheader = header->loopPredecessor();
+
+  LinearSum remainingIterations(bound->boundSum);
+  if (!canUnroll(bound, &remainingIterations)) {
+    return true;
+  }
+
+  // The exit test compares the non-constant terms against the negated
+  // constant.
+  int32_t minimumTerms;
+  if (!SafeSub(0, remainingIterations.constant(), &minimumTerms)) {
+    return true;
+  }
+
+  // OK, we've checked everything, now unroll the loop.
+
+  JitSpew(JitSpew_Unrolling, "Unrolling loop");
+
+  if (!unrolledDefinitions.reserve(MaxLoopInstructions)) {
+    return false;
+  }
+
+  // Add phis to the unrolled loop header which correspond to the phis in the
+  // original loop header.
+  MOZ_ASSERT(header->getPredecessor(0) == oldPreheader);
+  MDefinitionVector unrolledPhis(alloc);
+  for (MPhiIterator iter(header->phisBegin()); iter != header->phisEnd();
+       iter++) {
+    MPhi* old = *iter;
+    MOZ_ASSERT(old->numOperands() == 2);
+    MPhi* phi = MPhi::New(alloc, old->type());
+    phi->setRange(old->range());
+    if (!phi->reserveLength(2)) {
+      return false;
+    }
+
+    // Set the first input for the phi for now. We'll set the second after
+    // finishing the unroll.
+    phi->addInput(old->getOperand(0));
+
+    if (!unrolledPhis.append(phi) || !unrolledDefinitions.putNew(old, phi)) {
+      return false;
+    }
+  }
+
+  // The loop condition can bail out on e.g. integer overflow, so the unrolled
+  // header and body get a copy of the original header's resume point. The
+  // unrolled header does not have side effects on stack values, even if the
+  // original loop header does, so the same resume point is used for the
+  // unrolled body. The new preheader has no instructions which use its resume
+  // point, but every block needs one.
+  MResumePoint* headerResumePoint = header->entryResumePoint();
+  unrolledHeader = makeBlock(headerResumePoint);
+  if (!unrolledHeader) {
+    return false;
+  }
+  unrolledBackedge = makeBlock(headerResumePoint);
+  if (!unrolledBackedge) {
+    return false;
+  }
+  newPreheader = makeBlock(headerResumePoint);
+  if (!newPreheader) {
+    return false;
+  }
+  newPreheader->setLoopDepth(oldPreheader->loopDepth());
+
+  // Insert new blocks at their RPO position.
+  graph.insertBlockAfter(oldPreheader, unrolledHeader);
+  graph.insertBlockAfter(unrolledHeader, unrolledBackedge);
+  graph.insertBlockAfter(unrolledBackedge, newPreheader);
+
+  size_t phiIndex = 0;
+  for (MPhiIterator iter(header->phisBegin()); iter != header->phisEnd();
+       iter++) {
+    MPhi* phi = unrolledPhis[phiIndex++]->toPhi();
+    unrolledHeader->addPhi(phi);
+
+    // The old phi will now take the value produced by the unrolled loop.
+    iter->replaceOperand(0, phi);
+  }
+
+  // Perform an interrupt check at the start of the unrolled loop.
+  unrolledHeader->add(MInterruptCheck::New(alloc));
+
+  // Generate code for the test in the unrolled loop. Like the checks hoisted
+  // by range analysis, a bailout from this arithmetic marks the script as
+  // having failed a bounds check, which disables unrolling on recompilation.
+  for (size_t i = 0; i < remainingIterations.numTerms(); i++) {
+    MDefinition* def = remainingIterations.term(i).term;
+    remainingIterations.replaceTerm(i, getReplacementDefinition(def));
+  }
+  MDefinition* terms = ConvertLinearSum(alloc, unrolledHeader,
+                                        remainingIterations,
+                                        BailoutKind::HoistBoundsCheck);
+  MConstant* minimum = MConstant::New(alloc, Int32Value(minimumTerms));
+  unrolledHeader->add(minimum);
+  MCompare* compare = MCompare::New(alloc, terms, minimum, JSOp::Ge,
+                                    MCompare::Compare_Int32);
+  unrolledHeader->add(compare);
+  unrolledHeader->end(
+      MTest::New(alloc, compare, unrolledBackedge, newPreheader));
+
+  // Generate the unrolled code.
+  MBasicBlock* bodyBlocks[] = {header, backedge};
+  MDefinitionVector phiValues(alloc);
+  for (size_t unrollIndex = 0; unrollIndex < UnrollCount; unrollIndex++) {
+    // Clone the contents of the original loop into the unrolled loop body.
+    for (MBasicBlock* block : bodyBlocks) {
+      for (MInstructionIterator iter(block->begin()); iter != block->end();
+           iter++) {
+        MInstruction* ins = *iter;
+        if (ins->isTest() || ins->isGoto() || ins->isInterruptCheck()) {
+          // Control instructions are handled separately.
+          continue;
+        }
+        if (!alloc.ensureBallast()) {
+          return false;
+        }
+        if (!makeReplacementInstruction(ins)) {
+          return false;
+        }
+      }
+    }
+
+    // Compute the value of each loop header phi after the execution of
+    // this unrolled iteration.
+    phiValues.clear();
+    MOZ_ASSERT(header->getPredecessor(1) == backedge);
+    for (MPhiIterator iter(header->phisBegin()); iter != header->phisEnd();
+         iter++) {
+      MDefinition* oldInput = iter->getOperand(1);
+      if (!phiValues.append(getReplacementDefinition(oldInput))) {
+        return false;
+      }
+    }
+
+    // Update the map for the phis in the next iteration.
+    unrolledDefinitions.clear();
+    phiIndex = 0;
+    for (MPhiIterator iter(header->phisBegin()); iter != header->phisEnd();
+         iter++) {
+      if (!unrolledDefinitions.putNew(*iter, phiValues[phiIndex++])) {
+        return false;
+      }
+    }
+  }
+
+  // We're at the end of the last unrolled iteration, set the backedge input
+  // for the unrolled loop phis.
+  phiIndex = 0;
+  for (MPhiIterator iter(unrolledHeader->phisBegin());
+       iter != unrolledHeader->phisEnd(); iter++) {
+    iter->addInput(phiValues[phiIndex++]);
+  }
+  MOZ_ASSERT(phiIndex == phiValues.length());
+
+  unrolledBackedge->end(MGoto::New(alloc, unrolledHeader));
+
+  // Place the old preheader before the unrolled loop.
+  oldPreheader->discardLastIns();
+  oldPreheader->end(MGoto::New(alloc, unrolledHeader));
+
+  // Place the new preheader before the original loop.
+  newPreheader->end(MGoto::New(alloc, header));
+
+  // Cleanup the MIR graph.
+  if (!unrolledHeader->addPredecessorWithoutPhis(oldPreheader) ||
+      !unrolledHeader->addPredecessorWithoutPhis(unrolledBackedge) ||
+      !unrolledBackedge->addPredecessorWithoutPhis(unrolledHeader) ||
+      !newPreheader->addPredecessorWithoutPhis(unrolledHeader)) {
+    return false;
+  }
+  header->replacePredecessor(oldPreheader, newPreheader);
+  oldPreheader->setSuccessorWithPhis(unrolledHeader, 0);
+  newPreheader->setSuccessorWithPhis(header, 0);
+  unrolledHeader->setLoopHeader(unrolledBackedge);
+
+  // Keep the block ids in RPO, as we compare them to find loop invariant
+  // definitions when unrolling the next loop.
+  RenumberBlocks(graph);
+
+  *unrolled = true;
+  return true;
+}
+
+bool jit::UnrollLoops(const MIRGenerator* mir, MIRGraph& graph,
+                      const LoopIterationBoundVector& bounds) {
+  if (bounds.empty() || mir->compilingWasm() ||
+      mir->outerInfo().hadBoundsCheckBailout()) {
+    return true;
+  }
+
+  JitSpew(JitSpew_Unrolling, "Beginning loop unrolling pass");
+
+  bool anyUnrolled = false;
+  for (const LoopIterationBound* bound : bounds) {
+    if (mir->shouldCancel("Unroll Loops")) {
+      return false;
+    }
+
+    LoopUnroller unroller(graph);
+    bool unrolled;
+    if (!unroller.go(bound, &unrolled)) {
+      return false;
+    }
+    anyUnrolled |= unrolled;
+  }
+
+  if (!anyUnrolled) {
+    return true;
+  }
+
+  // The MIR graph is valid, but now has several new blocks. Recompute the
+  // dominator tree, and the alias analysis dependencies of the cloned loads,
+  // which still refer to stores in the original loop.
+  return AccountForCFGChanges(mir, graph, /* updateAliasAnalysis = */ true);
+}
@@ -0,0 +1,26 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef jit_LoopUnroller_h
+#define jit_LoopUnroller_h
+
+#include "jit/RangeAnalysis.h"
+
+namespace js {
+namespace jit {
+
+class MIRGenerator;
+class MIRGraph;
+
+// Unroll simple counted loops over typed arrays, using the iteration bounds
+// computed by range analysis.
+[[nodiscard]] bool UnrollLoops(const MIRGenerator* mir, MIRGraph& graph,
+                               const LoopIterationBoundVector& bounds);
+
+}  // namespace jit
+}  // namespace js
+
+#endif /* jit_LoopUnroller_h */
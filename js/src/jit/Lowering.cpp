@@ -5569,6 +5569,16 @@ void LIRGenerator::visitGuardMultipleShapes(MGuardMultipleShapes* ins) {
   }
 }
 
+void LIRGenerator::visitLoadSlotByShapeTable(MLoadSlotByShapeTable* ins) {
+  MOZ_ASSERT(ins->object()->type() == MIRType::Object);
+  MOZ_ASSERT(ins->table()->type() == MIRType::Object);
+
+  auto* lir = new (alloc()) LLoadSlotByShapeTable(
+      useRegister(ins->object()), useRegister(ins->table()), temp(), temp());
+  assignSnapshot(lir, ins->bailoutKind());
+  defineBox(lir, ins);
+}
+
 void LIRGenerator::visitGuardProto(MGuardProto* ins) {
   MOZ_ASSERT(ins->object()->type() == MIRType::Object);
   MOZ_ASSERT(ins->expected()->type() == MIRType::Object);
@@ -7083,6 +7093,12 @@ void LIRGenerator::visitIncrementWarmUpCounter(MIncrementWarmUpCounter* ins) {
   add(lir, ins);
 }
 
+void LIRGenerator::visitRecompileCheck(MRecompileCheck* ins) {
+  LRecompileCheck* lir = new (alloc()) LRecompileCheck(temp());
+  add(lir, ins);
+  assignSafepoint(lir, ins);
+}
+
 void LIRGenerator::visitLexicalCheck(MLexicalCheck* ins) {
   MDefinition* input = ins->input();
   MOZ_ASSERT(input->type() == MIRType::Value);
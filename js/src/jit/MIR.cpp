@@ -4101,6 +4101,23 @@ MResumePoint* MResumePoint::New(TempAllocator& alloc, MBasicBlock* block,
   return resume;
 }
 
+MResumePoint* MResumePoint::New(TempAllocator& alloc, MBasicBlock* block,
+                                MResumePoint* model,
+                                const MDefinitionVector& operands) {
+  MOZ_ASSERT(operands.length() == model->numAllocatedOperands());
+
+  MResumePoint* resume =
+      new (alloc) MResumePoint(block, model->pc(), model->mode());
+  if (!resume->operands_.init(alloc, model->numAllocatedOperands())) {
+    block->discardPreAllocatedResumePoint(resume);
+    return nullptr;
+  }
+  for (size_t i = 0; i < operands.length(); i++) {
+    resume->initOperand(i, operands[i]);
+  }
+  return resume;
+}
+
 MResumePoint::MResumePoint(MBasicBlock* block, jsbytecode* pc, ResumeMode mode)
     : MNode(block, Kind::ResumePoint),
       pc_(pc),
@@ -6783,6 +6800,13 @@ AliasSet MGuardMultipleShapes::getAliasSet() const {
   return AliasSet::Load(AliasSet::ObjectFields);
 }
 
+AliasSet MLoadSlotByShapeTable::getAliasSet() const {
+  // Like MGuardMultipleShapes, the ShapeSlotTableObject is internal and
+  // doesn't have to be in the alias set.
+  return AliasSet::Load(AliasSet::ObjectFields | AliasSet::FixedSlot |
+                        AliasSet::DynamicSlot);
+}
+
 AliasSet MGuardGlobalGeneration::getAliasSet() const {
   return AliasSet::Load(AliasSet::GlobalGenerationCounter);
 }
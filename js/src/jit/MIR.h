@@ -2972,6 +2972,8 @@ class MCompare : public MBinaryInstruction, public ComparePolicy::Data {
     extras->add(buf);
   }
 #endif
+
+  ALLOW_CLONE(MCompare)
 };
 
 // Takes a typed value and returns an untyped value.
@@ -3552,6 +3554,8 @@ class MInt32ToIntPtr : public MUnaryInstruction,
     return congruentIfOperandsEqual(ins);
   }
   AliasSet getAliasSet() const override { return AliasSet::None(); }
+
+  ALLOW_CLONE(MInt32ToIntPtr)
 };
 
 // Converts an IntPtr value >= 0 to Int32. Bails out if the value > INT32_MAX.
@@ -8837,6 +8841,12 @@ class MResumePoint final : public MNode
   static MResumePoint* New(TempAllocator& alloc, MBasicBlock* block,
                            jsbytecode* pc, ResumeMode mode);
 
+  // Create a resume point in |block| for the same pc and mode as |model|, but
+  // with its operands taken from |operands| instead of the block's slots.
+  static MResumePoint* New(TempAllocator& alloc, MBasicBlock* block,
+                           MResumePoint* model,
+                           const MDefinitionVector& operands);
+
   MBasicBlock* block() const { return resumePointBlock(); }
 
   size_t numAllocatedOperands() const { return operands_.length(); }
@@ -155,11 +155,20 @@ class MIRGenerator final {
 
   bool disableLICM_ = false;
 
+  // The warm-up count at which code compiled at OptimizationLevel::Fast asks
+  // to be recompiled at OptimizationLevel::Normal, or zero.
+  uint32_t retierWarmUpThreshold_ = 0;
+
  public:
   void disableLICM() { disableLICM_ = true; }
   bool licmEnabled() const;
   bool branchHintingEnabled() const;
 
+  void setRetierWarmUpThreshold(uint32_t threshold) {
+    retierWarmUpThreshold_ = threshold;
+  }
+  uint32_t retierWarmUpThreshold() const { return retierWarmUpThreshold_; }
+
  private:
   uint64_t minWasmMemory0Length_;
 
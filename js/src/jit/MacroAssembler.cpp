@@ -18,6 +18,7 @@
 #include "jit/AtomicOp.h"
 #include "jit/AtomicOperations.h"
 #include "jit/Bailouts.h"
+#include "jit/BaselineCacheIRCompiler.h"
 #include "jit/BaselineFrame.h"
 #include "jit/BaselineJIT.h"
 #include "jit/JitFrames.h"
@@ -4425,6 +4426,11 @@ IonHeapMacroAssembler::IonHeapMacroAssembler(TempAllocator& alloc,
   MOZ_ASSERT(CurrentThreadIsIonCompiling());
 }
 
+BaselineHeapMacroAssembler::BaselineHeapMacroAssembler(JSContext* cx,
+                                                       TempAllocator& alloc)
+    : MacroAssembler(alloc, CompileRuntime::get(cx->runtime()),
+                     CompileRealm::get(cx->realm())) {}
+
 WasmMacroAssembler::WasmMacroAssembler(TempAllocator& alloc, bool limitedSize)
     : MacroAssembler(alloc) {
 #if defined(JS_CODEGEN_ARM64)
@@ -5532,6 +5538,67 @@ void MacroAssembler::branchTestObjShapeList(
   bind(&done);
 }
 
+void MacroAssembler::loadSlotByShapeTable(Register obj, Register table,
+                                          Register entry, Register scratch,
+                                          ValueOperand output,
+                                          bool spectreMitigations,
+                                          Label* miss) {
+  MOZ_ASSERT(obj != entry && obj != scratch);
+  MOZ_ASSERT(table != entry && table != scratch);
+  MOZ_ASSERT(entry != scratch);
+
+  // Hash the object's shape to an index in the first half of the table, see
+  // ShapeSlotTableObject. The table stores 2 * capacity entries of two Values
+  // each, so the mask is |length / 4 - 1|.
+  loadPtr(Address(obj, JSObject::offsetOfShape()), entry);
+  rshiftPtr(Imm32(ShapeSlotTableObject::HashShift), entry);
+  loadPtr(Address(table, NativeObject::offsetOfElements()), scratch);
+  load32(Address(scratch, ObjectElements::offsetOfInitializedLength()),
+         scratch);
+  rshift32(Imm32(2), scratch);
+  sub32(Imm32(1), scratch);
+  and32(scratch, entry);
+
+  // Compute a pointer to the entry. Each entry is a pair of Values.
+  lshift32(Imm32(1), entry);
+  loadPtr(Address(table, NativeObject::offsetOfElements()), scratch);
+  computeEffectiveAddress(BaseObjectElementIndex(scratch, entry), entry);
+
+  // Probe linearly until we find the shape or an empty entry. The table is at
+  // most half full, so we never run past the end. As in branchTestObjShapeList
+  // we compare the shape with the PrivateValue directly.
+  Label loop, found;
+  bind(&loop);
+  loadPtr(Address(obj, JSObject::offsetOfShape()), scratch);
+  branchPtr(Assembler::Equal, Address(entry, 0), scratch, &found);
+  branchPtr(Assembler::Equal, Address(entry, 0), ImmWord(0), miss);
+  addPtr(Imm32(2 * sizeof(Value)), entry);
+  jump(&loop);
+
+  bind(&found);
+  if (spectreMitigations) {
+    // If we speculatively get here for a shape that isn't in the table, zero
+    // the entry pointer so we don't load from an arbitrary slot offset.
+    spectreZeroRegister(Assembler::NotEqual, scratch, entry);
+  }
+
+  // Load the encoded slot offset and then the slot.
+  unboxInt32(Address(entry, sizeof(Value)), entry);
+
+  Label dynamicSlot, done;
+  branchTest32(Assembler::NonZero, entry,
+               Imm32(ShapeSlotTableObject::DynamicSlotFlag), &dynamicSlot);
+  loadValue(BaseIndex(obj, entry, TimesOne), output);
+  jump(&done);
+
+  bind(&dynamicSlot);
+  static_assert(ShapeSlotTableObject::DynamicSlotFlag == 1);
+  loadPtr(Address(obj, NativeObject::offsetOfSlots()), scratch);
+  loadValue(BaseIndex(scratch, entry, TimesOne, -1), output);
+
+  bind(&done);
+}
+
 void MacroAssembler::branchTestObjCompartment(Condition cond, Register obj,
                                               const Address& compartment,
                                               Register scratch, Label* label) {
@@ -7219,17 +7286,24 @@ void MacroAssembler::wasmNewStructObject(Register instance, Register result,
   branch32(Assembler::NotEqual, temp1, Imm32(0), fail);
 #endif
 
-  // If the alloc site is long lived, immediately fall back to the OOL path,
-  // which will handle that.
-  loadPtr(Address(typeDefData, wasm::TypeDefInstanceData::offsetOfAllocSite()),
-          temp1);
+  // If the alloc site is long lived, allocate directly in the tenured heap.
+  // The alloc site is stored inline in the TypeDefInstanceData.
+  Label tenured, allocated;
   branchTestPtr(Assembler::NonZero,
-                Address(temp1, gc::AllocSite::offsetOfScriptAndState()),
-                Imm32(gc::AllocSite::LONG_LIVED_BIT), fail);
+                Address(typeDefData,
+                        wasm::TypeDefInstanceData::offsetOfAllocSite() +
+                            gc::AllocSite::offsetOfScriptAndState()),
+                Imm32(gc::AllocSite::LONG_LIVED_BIT), &tenured);
 
   size_t sizeBytes = gc::Arena::thingSize(allocKind);
   wasmBumpPointerAllocate(instance, result, typeDefData, temp1, temp2, fail,
                           sizeBytes);
+  jump(&allocated);
+
+  bind(&tenured);
+  wasmFreeListAllocate(instance, result, temp1, temp2, fail, allocKind);
+
+  bind(&allocated);
   loadPtr(Address(typeDefData, wasm::TypeDefInstanceData::offsetOfShape()),
           temp1);
   loadPtr(Address(typeDefData,
@@ -7268,11 +7342,12 @@ void MacroAssembler::wasmNewArrayObject(Register instance, Register result,
 #endif
 
   // If the alloc site is long lived, immediately fall back to the OOL path,
-  // which will handle that.
-  loadPtr(Address(typeDefData, wasm::TypeDefInstanceData::offsetOfAllocSite()),
-          temp);
+  // which will handle that. The alloc site is stored inline in the
+  // TypeDefInstanceData.
   branchTestPtr(Assembler::NonZero,
-                Address(temp, gc::AllocSite::offsetOfScriptAndState()),
+                Address(typeDefData,
+                        wasm::TypeDefInstanceData::offsetOfAllocSite() +
+                            gc::AllocSite::offsetOfScriptAndState()),
                 Imm32(gc::AllocSite::LONG_LIVED_BIT), fail);
 
   // Ensure that the numElements is small enough to fit in inline storage.
@@ -7425,18 +7500,25 @@ void MacroAssembler::wasmNewArrayObjectFixed(Register instance, Register result,
   branch32(Assembler::NotEqual, temp1, Imm32(0), fail);
 #endif
 
-  // If the alloc site is long lived, immediately fall back to the OOL path,
-  // which will handle that.
-  loadPtr(Address(typeDefData, wasm::TypeDefInstanceData::offsetOfAllocSite()),
-          temp1);
+  // If the alloc site is long lived, allocate directly in the tenured heap.
+  // The alloc site is stored inline in the TypeDefInstanceData.
+  Label tenured, allocated;
   branchTestPtr(Assembler::NonZero,
-                Address(temp1, gc::AllocSite::offsetOfScriptAndState()),
-                Imm32(gc::AllocSite::LONG_LIVED_BIT), fail);
+                Address(typeDefData,
+                        wasm::TypeDefInstanceData::offsetOfAllocSite() +
+                            gc::AllocSite::offsetOfScriptAndState()),
+                Imm32(gc::AllocSite::LONG_LIVED_BIT), &tenured);
 
   gc::AllocKind allocKind = WasmArrayObject::allocKindForIL(storageBytes);
   uint32_t totalSize = gc::Arena::thingSize(allocKind);
   wasmBumpPointerAllocate(instance, result, typeDefData, temp1, temp2, fail,
                           totalSize);
+  jump(&allocated);
+
+  bind(&tenured);
+  wasmFreeListAllocate(instance, result, temp1, temp2, fail, allocKind);
+
+  bind(&allocated);
   loadPtr(Address(typeDefData, wasm::TypeDefInstanceData::offsetOfShape()),
           temp1);
   loadPtr(Address(typeDefData,
@@ -7571,6 +7653,46 @@ void MacroAssembler::wasmBumpPointerAllocateDynamic(
   storePtr(temp1, Address(result, -js::Nursery::nurseryCellHeaderSize()));
 }
 
+void MacroAssembler::wasmFreeListAllocate(Register instance, Register result,
+                                          Register temp1, Register temp2,
+                                          Label* fail,
+                                          gc::AllocKind allocKind) {
+  int thingSize = int(gc::Arena::thingSize(allocKind));
+
+  Label fallback;
+  Label success;
+
+  // Load the zone's free span for |allocKind| into temp1. This is the last use
+  // of |instance|, which may alias |result|.
+  loadPtr(Address(instance, wasm::Instance::offsetOfAddressOfFreeLists()),
+          temp1);
+  loadPtr(Address(temp1, int32_t(size_t(allocKind) * sizeof(gc::FreeSpan*))),
+          temp1);
+
+  // If there is no room remaining in the span, fall back to get the next one.
+  load16ZeroExtend(Address(temp1, js::gc::FreeSpan::offsetOfFirst()), result);
+  load16ZeroExtend(Address(temp1, js::gc::FreeSpan::offsetOfLast()), temp2);
+  branch32(Assembler::AboveOrEqual, result, temp2, &fallback);
+
+  // Bump the offset for the next allocation.
+  add32(Imm32(thingSize), result);
+  store16(result, Address(temp1, js::gc::FreeSpan::offsetOfFirst()));
+  sub32(Imm32(thingSize), result);
+  addPtr(temp1, result);  // Turn the offset into a pointer.
+  jump(&success);
+
+  bind(&fallback);
+  // If there are no free spans left, we bail to the instance call which will
+  // set up a new arena to allocate from.
+  branchTest32(Assembler::Zero, result, result, fail);
+  addPtr(temp1, result);  // Turn the offset into a pointer.
+  // Update the free list to point to the next span (which may be empty).
+  load32(Address(result, 0), temp2);
+  store32(temp2, Address(temp1, js::gc::FreeSpan::offsetOfFirst()));
+
+  bind(&success);
+}
+
 // Unboxing is branchy and contorted because of Spectre mitigations - we don't
 // have enough scratch registers.  Were it not for the spectre mitigations in
 // branchTestObjClass, the branch nest below would be restructured significantly
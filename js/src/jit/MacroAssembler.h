@@ -1863,6 +1863,13 @@ class MacroAssembler : public MacroAssemblerSpecific {
                               Register endScratch, Register spectreScratch,
                               Label* label);
 
+  // Look up the object's shape in the ShapeSlotTableObject |table| and load
+  // the corresponding slot into |output|. Jumps to |miss| if the shape isn't
+  // in the table.
+  void loadSlotByShapeTable(Register obj, Register table, Register entry,
+                            Register scratch, ValueOperand output,
+                            bool spectreMitigations, Label* miss);
+
   inline void branchTestClassIsFunction(Condition cond, Register clasp,
                                         Label* label);
   inline void branchTestObjIsFunction(Condition cond, Register obj,
@@ -4245,6 +4252,14 @@ class MacroAssembler : public MacroAssemblerSpecific {
   void wasmBumpPointerAllocateDynamic(Register instance, Register result,
                                       Register typeDefData, Register size,
                                       Register temp1, Label* fail);
+  // This function handles tenured allocations for wasm, used when the alloc
+  // site is long lived. For JS, see MacroAssembler::freeListAllocate.
+  //
+  // `instance` and `result` may be the same register, in which case `instance`
+  // will be clobbered.
+  void wasmFreeListAllocate(Register instance, Register result, Register temp1,
+                            Register temp2, Label* fail,
+                            gc::AllocKind allocKind);
 
   // Compute ptr += (indexTemp32 << shift) where shift can be any value < 32.
   // May destroy indexTemp32.  The value of indexTemp32 must be positive, and it
@@ -6154,6 +6169,14 @@ class IonHeapMacroAssembler : public MacroAssembler {
   IonHeapMacroAssembler(TempAllocator& alloc, CompileRealm* realm);
 };
 
+// Heap-allocated MacroAssembler used by the Baseline compiler. It's created on
+// the main thread but code may be emitted on a helper thread, see
+// BaselineCompileTask. GC cancels off-thread compilations.
+class BaselineHeapMacroAssembler : public MacroAssembler {
+ public:
+  BaselineHeapMacroAssembler(JSContext* cx, TempAllocator& alloc);
+};
+
 //{{{ check_macroassembler_style
 inline uint32_t MacroAssembler::framePushed() const { return framePushed_; }
 
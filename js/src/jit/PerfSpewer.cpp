@@ -14,6 +14,15 @@
 #  include <unistd.h>
 #endif
 
+// The perf map mode doesn't need the rest of the jitdump support, so it's
+// available without JS_ION_PERF.
+#if defined(XP_LINUX) && !defined(ANDROID)
+#  define JS_ION_PERF_MAP
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
 #if defined(JS_ION_PERF) && defined(XP_LINUX) && !defined(ANDROID) && \
     defined(__GLIBC__)
 #  include <dlfcn.h>
@@ -61,6 +70,7 @@ pid_t gettid_pthread() {
 
 #include "jit/PerfSpewer.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "jit/Jitdump.h"
@@ -97,7 +107,7 @@ static std::atomic<bool> etwCollection = false;
 using namespace js;
 using namespace js::jit;
 
-enum class PerfModeType { None, Function, Source, IR, IROperands };
+enum class PerfModeType { None, Function, Source, IR, IROperands, Map };
 
 static std::atomic<bool> geckoProfiling = false;
 static std::atomic<PerfModeType> PerfMode = PerfModeType::None;
@@ -118,6 +128,27 @@ static void* mmap_address = nullptr;
 static bool IsPerfProfiling() { return JitDumpFilePtr != nullptr; }
 #endif
 
+#ifdef JS_ION_PERF_MAP
+// The perf map mode writes a /tmp/perf-<pid>.map file, with one
+// "START SIZE name" line for each piece of JIT code. This is the format perf
+// uses to symbolize JIT frames without injecting a jitdump file, and unlike
+// the jitdump modes it doesn't copy the code or record debug info, so it's
+// cheap enough to leave enabled on production hosts.
+//
+// The file has a fixed size and is mapped into memory, so adding a record is
+// a copy into the mapping. When the file is full, new records wrap around and
+// replace the oldest ones. Unused bytes and the remains of partially
+// overwritten records are newlines, which perf skips as empty lines.
+static constexpr size_t DefaultPerfMapSizeMB = 8;
+static constexpr size_t MaxPerfMapRecordLength = 512;
+
+static char* perfMapBuffer = nullptr;
+static size_t perfMapSize = 0;
+static size_t perfMapCursor = 0;
+
+static bool IsPerfMapProfiling() { return PerfMode == PerfModeType::Map; }
+#endif
+
 AutoLockPerfSpewer::AutoLockPerfSpewer() { PerfMutex.lock(); }
 
 AutoLockPerfSpewer::~AutoLockPerfSpewer() { PerfMutex.unlock(); }
@@ -281,6 +312,9 @@ static void CheckPerf() {
       fprintf(stderr,
               "Use IONPERF=src to record and annotate assembly with source, if "
               "available locally\n");
+      fprintf(stderr,
+              "Use IONPERF=map to write a low overhead perf map, without "
+              "jitdump\n");
       exit(0);
     }
 
@@ -298,6 +332,97 @@ static void CheckPerf() {
 }
 #endif
 
+#ifdef JS_ION_PERF_MAP
+static bool OpenPerfMap(AutoLockPerfSpewer& lock) {
+  if (perfMapBuffer) {
+    return true;
+  }
+
+  size_t sizeMB = DefaultPerfMapSizeMB;
+  if (const char* env = getenv("IONPERF_MAP_SIZE")) {
+    sizeMB = std::clamp<size_t>(strtoul(env, nullptr, 10), 1, 1024);
+  }
+  size_t size = sizeMB * 1024 * 1024;
+
+  // perf looks for the map at this path. /tmp is shared with other users, so
+  // remove any stale file left by an earlier process with our pid and create
+  // a new one, readable only by us. O_EXCL also refuses to follow a symlink
+  // planted at this path.
+  char filename[64];
+  snprintf(filename, sizeof(filename), "/tmp/perf-%d.map", getpid());
+  unlink(filename);
+
+  int fd = open(filename, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return false;
+  }
+  if (ftruncate(fd, off_t(size)) != 0) {
+    close(fd);
+    return false;
+  }
+  void* buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (buffer == MAP_FAILED) {
+    return false;
+  }
+
+  perfMapBuffer = static_cast<char*>(buffer);
+  perfMapSize = size;
+  perfMapCursor = 0;
+  memset(perfMapBuffer, '\n', perfMapSize);
+  return true;
+}
+
+static void WritePerfMapRecord(const void* code_addr, uint64_t code_size,
+                               const char* name, AutoLockPerfSpewer& lock) {
+  MOZ_ASSERT(perfMapBuffer);
+
+  char record[MaxPerfMapRecordLength];
+  int rv = snprintf(record, sizeof(record), "%" PRIxPTR " %" PRIx64 " %s\n",
+                    uintptr_t(code_addr), code_size, name);
+  if (rv <= 0) {
+    return;
+  }
+
+  // Long names are truncated, but the record must still end with a newline.
+  size_t length = std::min(size_t(rv), sizeof(record) - 1);
+  record[length - 1] = '\n';
+
+  if (perfMapCursor + length > perfMapSize) {
+    // Wrap around, and clear the partial record left at the end.
+    memset(perfMapBuffer + perfMapCursor, '\n', perfMapSize - perfMapCursor);
+    perfMapCursor = 0;
+  }
+
+  memcpy(perfMapBuffer + perfMapCursor, record, length);
+  perfMapCursor += length;
+
+  // Clear the rest of any older record we overwrote part of.
+  for (size_t i = perfMapCursor; i < perfMapSize && perfMapBuffer[i] != '\n';
+       i++) {
+    perfMapBuffer[i] = '\n';
+  }
+}
+
+// Returns whether IONPERF=map requested the perf map mode.
+static bool CheckPerfMap() {
+  const char* env = getenv("IONPERF");
+  if (!env || strcmp(env, "map") != 0) {
+    return false;
+  }
+
+  AutoLockPerfSpewer lock;
+  if (PerfMode == PerfModeType::None) {
+    if (OpenPerfMap(lock)) {
+      PerfMode = PerfModeType::Map;
+    } else {
+      fprintf(stderr, "Failed to open perf map file.  Disabling IONPERF.\n");
+    }
+  }
+  return true;
+}
+#endif
+
 #ifdef XP_WIN
 void NTAPI ETWEnableCallback(LPCGUID aSourceId, ULONG aIsEnabled, UCHAR aLevel,
                              ULONGLONG aMatchAnyKeyword,
@@ -328,6 +453,11 @@ void RegisterETW() {
 
 /* static */
 void PerfSpewer::Init() {
+#ifdef JS_ION_PERF_MAP
+  if (CheckPerfMap()) {
+    return;
+  }
+#endif
 #ifdef JS_ION_PERF
   CheckPerf();
 #endif
@@ -345,10 +475,39 @@ static void DisablePerfSpewer(AutoLockPerfSpewer& lock) {
 #endif
   PerfMode = PerfModeType::None;
 #ifdef JS_ION_PERF
-  long page_size = sysconf(_SC_PAGESIZE);
-  munmap(mmap_address, page_size);
-  fclose(JitDumpFilePtr);
-  JitDumpFilePtr = nullptr;
+  if (JitDumpFilePtr) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    munmap(mmap_address, page_size);
+    fclose(JitDumpFilePtr);
+    JitDumpFilePtr = nullptr;
+  }
+#endif
+}
+
+JS_PUBLIC_API bool JS::SetJitPerfMapEnabled(bool enabled) {
+#ifdef JS_ION_PERF_MAP
+  AutoLockPerfSpewer lock;
+
+  if (!enabled) {
+    // Keep the file mapped, so the records stay available to perf.
+    if (IsPerfMapProfiling()) {
+      PerfMode = PerfModeType::None;
+    }
+    return true;
+  }
+
+  // The jitdump modes can't be combined with the perf map.
+  if (PerfMode != PerfModeType::None) {
+    return IsPerfMapProfiling();
+  }
+
+  if (!OpenPerfMap(lock)) {
+    return false;
+  }
+  PerfMode = PerfModeType::Map;
+  return true;
+#else
+  return false;
 #endif
 }
 
@@ -457,10 +616,14 @@ static bool PerfFuncEnabled() {
   return PerfMode == PerfModeType::Function || geckoProfiling;
 }
 
-bool js::jit::PerfEnabled() {
+bool js::jit::PerfDebugInfoEnabled() {
   return PerfSrcEnabled() || PerfIREnabled() || PerfFuncEnabled();
 }
 
+bool js::jit::PerfEnabled() {
+  return PerfDebugInfoEnabled() || PerfMode == PerfModeType::Map;
+}
+
 void InlineCachePerfSpewer::recordInstruction(MacroAssembler& masm,
                                               CacheOp op) {
   if (!PerfIREnabled()) {
@@ -661,6 +824,11 @@ void PerfSpewer::CollectJitCodeInfo(UniqueChars& function_name, void* code_addr,
                                     uint64_t code_size,
                                     JS::JitCodeRecord* profilerRecord,
                                     AutoLockPerfSpewer& lock) {
+#ifdef JS_ION_PERF_MAP
+  if (IsPerfMapProfiling()) {
+    WritePerfMapRecord(code_addr, code_size, function_name.get(), lock);
+  }
+#endif
 #ifdef JS_ION_PERF
   static uint64_t codeIndex = 1;
 
@@ -33,8 +33,14 @@ struct AutoLockPerfSpewer {
 class MBasicBlock;
 class MacroAssembler;
 
+// Whether any perf or profiler support is recording JIT code.
 bool PerfEnabled();
 
+// Like PerfEnabled, but false for the perf map mode, which only records the
+// name and address range of each piece of code. The other modes want
+// per-instruction information, and need code addresses not to be reused.
+bool PerfDebugInfoEnabled();
+
 class PerfSpewer {
  protected:
   struct OpcodeEntry {
@@ -2134,6 +2134,7 @@ LoopIterationBound* RangeAnalysis::analyzeLoopIterationCount(
   }
 
   LinearSum iterationBound(alloc());
+  LinearSum currentIteration(alloc());
 
   if (lhsModified.constant == 1 && !lessEqual) {
     // The value of lhs is 'initial(lhs) + iterCount' and this will end
@@ -2159,6 +2160,14 @@ LoopIterationBound* RangeAnalysis::analyzeLoopIterationCount(
     if (!iterationBound.add(lhsConstant)) {
       return nullptr;
     }
+
+    // The number of iterations executed so far is 'lhs - initial(lhs)'.
+    if (!currentIteration.add(lhs.term, 1)) {
+      return nullptr;
+    }
+    if (!currentIteration.add(lhsInitial, -1)) {
+      return nullptr;
+    }
   } else if (lhsModified.constant == -1 && lessEqual) {
     // The value of lhs is 'initial(lhs) - iterCount'. Similar to the above
     // case, an upper bound on the number of backedges executed is:
@@ -2177,11 +2186,20 @@ LoopIterationBound* RangeAnalysis::analyzeLoopIterationCount(
     if (!iterationBound.add(lhs.constant)) {
       return nullptr;
     }
+
+    // The number of iterations executed so far is 'initial(lhs) - lhs'.
+    if (!currentIteration.add(lhsInitial, 1)) {
+      return nullptr;
+    }
+    if (!currentIteration.add(lhs.term, -1)) {
+      return nullptr;
+    }
   } else {
     return nullptr;
   }
 
-  return new (alloc()) LoopIterationBound(test, iterationBound);
+  return new (alloc())
+      LoopIterationBound(test, iterationBound, currentIteration);
 }
 
 void RangeAnalysis::analyzeLoopPhi(const LoopIterationBound* loopBound,
@@ -56,8 +56,13 @@ struct LoopIterationBound : public TempObject {
   // in this bound are all loop invariant.
   LinearSum boundSum;
 
-  LoopIterationBound(const MTest* test, const LinearSum& boundSum)
-      : test(test), boundSum(boundSum) {}
+  // Linear sum for the number of iterations already executed, at the start
+  // of the loop header. This will use loop invariant terms and header phis.
+  LinearSum currentSum;
+
+  LoopIterationBound(const MTest* test, const LinearSum& boundSum,
+                     const LinearSum& currentSum)
+      : test(test), boundSum(boundSum), currentSum(currentSum) {}
 };
 
 using LoopIterationBoundVector =
@@ -110,6 +115,10 @@ class RangeAnalysis {
   [[nodiscard]] bool truncate();
   [[nodiscard]] bool removeUnnecessaryBitops();
 
+  const LoopIterationBoundVector& iterationBounds() const {
+    return loopIterationBounds;
+  }
+
  private:
   bool canTruncate(const MDefinition* def, TruncateKind kind) const;
   void adjustTruncatedInputs(MDefinition* def);
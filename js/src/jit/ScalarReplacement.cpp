@@ -114,6 +114,10 @@ static inline bool IsOptimizableObjectInstruction(MInstruction* ins) {
          ins->isNewCallObject() || ins->isNewIterator();
 }
 
+static inline bool IsOptimizableArrayInstruction(MInstruction* ins) {
+  return ins->isNewArray() || ins->isNewArrayObject();
+}
+
 static bool PhiOperandEqualTo(MDefinition* operand, MInstruction* newObject) {
   if (operand == newObject) {
     return true;
@@ -132,6 +136,10 @@ static bool PhiOperandEqualTo(MDefinition* operand, MInstruction* newObject) {
     case MDefinition::Opcode::Unbox:
       return PhiOperandEqualTo(operand->toUnbox()->input(), newObject);
 
+    case MDefinition::Opcode::GuardArrayIsPacked:
+      return PhiOperandEqualTo(operand->toGuardArrayIsPacked()->array(),
+                               newObject);
+
     default:
       return false;
   }
@@ -139,7 +147,8 @@ static bool PhiOperandEqualTo(MDefinition* operand, MInstruction* newObject) {
 
 // Return true if all phi operands are equal to |newObject|.
 static bool PhiOperandsEqualTo(MPhi* phi, MInstruction* newObject) {
-  MOZ_ASSERT(IsOptimizableObjectInstruction(newObject));
+  MOZ_ASSERT(IsOptimizableObjectInstruction(newObject) ||
+             IsOptimizableArrayInstruction(newObject));
 
   for (size_t i = 0, e = phi->numOperands(); i < e; i++) {
     if (!PhiOperandEqualTo(phi->getOperand(i), newObject)) {
@@ -973,7 +982,8 @@ void ObjectMemoryView::visitAssertCanElidePostWriteBarrier(
 }
 
 static bool IndexOf(MDefinition* ins, int32_t* res) {
-  MOZ_ASSERT(ins->isLoadElement() || ins->isStoreElement());
+  MOZ_ASSERT(ins->isLoadElement() || ins->isLoadElementHole() ||
+             ins->isStoreElement());
   MDefinition* indexDef = ins->getOperand(1);  // ins->index();
   if (indexDef->isSpectreMaskIndex()) {
     indexDef = indexDef->toSpectreMaskIndex()->index();
@@ -992,10 +1002,6 @@ static bool IndexOf(MDefinition* ins, int32_t* res) {
   return true;
 }
 
-static inline bool IsOptimizableArrayInstruction(MInstruction* ins) {
-  return ins->isNewArray() || ins->isNewArrayObject();
-}
-
 // We don't support storing holes when doing scalar replacement, so any
 // optimizable MNewArrayObject instruction is guaranteed to be packed.
 static inline bool IsPackedArray(MInstruction* ins) {
@@ -1037,6 +1043,28 @@ static bool IsElementEscaped(MDefinition* def, MInstruction* newArray,
         break;
       }
 
+      case MDefinition::Opcode::LoadElementHole: {
+        MOZ_ASSERT(access->toLoadElementHole()->elements() == def);
+
+        // Out-of-bounds reads are replaced by undefined. This is fine because
+        // MLoadElementHole is only used when the prototype chain doesn't have
+        // indexed properties.
+        int32_t index;
+        if (!IndexOf(access, &index)) {
+          JitSpewDef(JitSpew_Escape,
+                     "has a load element hole with a non-trivial index\n",
+                     access);
+          return true;
+        }
+        if (index < 0) {
+          JitSpewDef(JitSpew_Escape,
+                     "has a load element hole with a negative index\n",
+                     access);
+          return true;
+        }
+        break;
+      }
+
       case MDefinition::Opcode::StoreElement: {
         MStoreElement* storeElem = access->toStoreElement();
         MOZ_ASSERT(storeElem->elements() == def);
@@ -1116,8 +1144,8 @@ static bool IsElementEscaped(MDefinition* def, MInstruction* newArray,
 //
 // For the moment, this code is dumb as it only supports arrays which are not
 // changing length, with only access with known constants.
-static bool IsArrayEscaped(MInstruction* ins, MInstruction* newArray) {
-  MOZ_ASSERT(ins->type() == MIRType::Object);
+static bool IsArrayEscaped(MDefinition* ins, MInstruction* newArray) {
+  MOZ_ASSERT(ins->type() == MIRType::Object || ins->isPhi());
   MOZ_ASSERT(IsOptimizableArrayInstruction(newArray));
 
   JitSpewDef(JitSpew_Escape, "Check array\n", ins);
@@ -1223,6 +1251,21 @@ static bool IsArrayEscaped(MInstruction* ins, MInstruction* newArray) {
         break;
       }
 
+      // Phis are created when the array flows through a join, for example
+      // when an inlined call returns the same array from multiple exits.
+      case MDefinition::Opcode::Phi: {
+        auto* phi = def->toPhi();
+        if (!PhiOperandsEqualTo(phi, newArray)) {
+          JitSpewDef(JitSpew_Escape, "has different phi operands\n", def);
+          return true;
+        }
+        if (IsArrayEscaped(phi, newArray)) {
+          JitSpewDef(JitSpew_Escape, "is indirectly escaped by\n", def);
+          return true;
+        }
+        break;
+      }
+
       // This instruction is supported for |JSOp::OptimizeSpreadCall|.
       case MDefinition::Opcode::Compare: {
         bool canFold;
@@ -1303,6 +1346,7 @@ class ArrayMemoryView : public MDefinitionVisitorDefaultNoop {
   void visitArrayState(MArrayState* ins);
   void visitStoreElement(MStoreElement* ins);
   void visitLoadElement(MLoadElement* ins);
+  void visitLoadElementHole(MLoadElementHole* ins);
   void visitSetInitializedLength(MSetInitializedLength* ins);
   void visitInitializedLength(MInitializedLength* ins);
   void visitArrayLength(MArrayLength* ins);
@@ -1312,6 +1356,7 @@ class ArrayMemoryView : public MDefinitionVisitorDefaultNoop {
   void visitGuardToClass(MGuardToClass* ins);
   void visitGuardArrayIsPacked(MGuardArrayIsPacked* ins);
   void visitUnbox(MUnbox* ins);
+  void visitPhi(MPhi* ins);
   void visitCompare(MCompare* ins);
   void visitApplyArray(MApplyArray* ins);
   void visitConstructArray(MConstructArray* ins);
@@ -1532,6 +1577,34 @@ void ArrayMemoryView::visitLoadElement(MLoadElement* ins) {
   discardInstruction(ins, elements);
 }
 
+void ArrayMemoryView::visitLoadElementHole(MLoadElementHole* ins) {
+  // Skip other array objects.
+  MDefinition* elements = ins->elements();
+  if (!isArrayStateElements(elements)) {
+    return;
+  }
+
+  int32_t index;
+  MOZ_ALWAYS_TRUE(IndexOf(ins, &index));
+  MOZ_ASSERT(index >= 0);
+
+  // Replace by the value contained at the index, or undefined if the index is
+  // past the initialized length.
+  MDefinition* element = undefinedVal_;
+  if (uint32_t(index) < state_->numElements()) {
+    MConstant* initLength = state_->initializedLength()->maybeConstantValue();
+    if (!initLength || index < initLength->toInt32()) {
+      element = state_->getElement(index);
+    }
+  }
+  MOZ_ASSERT(element->type() != MIRType::MagicHole);
+
+  ins->replaceAllUsesWith(element);
+
+  // Remove original instruction.
+  discardInstruction(ins, elements);
+}
+
 void ArrayMemoryView::visitSetInitializedLength(MSetInitializedLength* ins) {
   // Skip other array objects.
   MDefinition* elements = ins->elements();
@@ -1665,6 +1738,19 @@ void ArrayMemoryView::visitUnbox(MUnbox* ins) {
   ins->block()->discard(ins);
 }
 
+void ArrayMemoryView::visitPhi(MPhi* ins) {
+  // Skip phis on other objects.
+  if (!PhiOperandsEqualTo(ins, arr_)) {
+    return;
+  }
+
+  // Replace the phi by its array.
+  ins->replaceAllUsesWith(arr_);
+
+  // Remove original instruction.
+  ins->block()->discardPhi(ins);
+}
+
 void ArrayMemoryView::visitCompare(MCompare* ins) {
   // Skip unrelated comparisons.
   if (ins->lhs() != arr_ && ins->rhs() != arr_) {
@@ -467,6 +467,10 @@ bool WarpBuilder::buildPrologue() {
     return false;
   }
 
+  if (uint32_t threshold = mirGen().retierWarmUpThreshold()) {
+    current->add(MRecompileCheck::New(alloc(), script_, threshold));
+  }
+
 #ifdef JS_CACHEIR_SPEW
   if (snapshot().needsFinalWarmUpCount()) {
     MIncrementWarmUpCounter* ins =
@@ -657,7 +661,7 @@ bool WarpBuilder::buildBody() {
       return false;
     }
 #endif
-    bool wantPreciseLineNumbers = js::jit::PerfEnabled();
+    bool wantPreciseLineNumbers = js::jit::PerfDebugInfoEnabled();
     if (wantPreciseLineNumbers && !hasTerminatedBlock()) {
       current->updateTrackedSite(newBytecodeSite(loc));
     }
@@ -1270,6 +1274,13 @@ bool WarpBuilder::build_LoopHead(BytecodeLocation loc) {
   MInterruptCheck* check = MInterruptCheck::New(alloc());
   current->add(check);
 
+  // Inlined scripts have their own warm-up counters, so only count loop
+  // iterations of the outer script.
+  if (uint32_t threshold = mirGen().retierWarmUpThreshold();
+      threshold && !callerBuilder()) {
+    current->add(MRecompileCheck::New(alloc(), script_, threshold));
+  }
+
 #ifdef JS_CACHEIR_SPEW
   if (snapshot().needsFinalWarmUpCount()) {
     MIncrementWarmUpCounter* ins =
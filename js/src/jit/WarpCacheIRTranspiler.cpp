@@ -1793,6 +1793,21 @@ bool WarpCacheIRTranspiler::emitLoadDynamicSlotResult(ObjOperandId objId,
   return true;
 }
 
+bool WarpCacheIRTranspiler::emitLoadSlotByShapeTableResult(
+    ObjOperandId objId, uint32_t tableOffset) {
+  MDefinition* obj = getOperand(objId);
+  MInstruction* table = objectStubField(tableOffset);
+
+  auto* ins = MLoadSlotByShapeTable::New(alloc(), obj, table);
+  if (builder_->info().inlineScriptTree()->hasSharedICScript()) {
+    ins->setBailoutKind(BailoutKind::MonomorphicInlinedStubFolding);
+  }
+  add(ins);
+
+  pushResult(ins);
+  return true;
+}
+
 bool WarpCacheIRTranspiler::emitLoadFixedSlot(ValOperandId resultId,
                                               ObjOperandId objId,
                                               uint32_t offsetOffset) {
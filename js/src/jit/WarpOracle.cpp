@@ -16,6 +16,7 @@
 #include "jit/CacheIRReader.h"
 #include "jit/CompileInfo.h"
 #include "jit/InlineScriptTree.h"
+#include "jit/IonOptimizationLevels.h"
 #include "jit/JitHints.h"
 #include "jit/JitRuntime.h"
 #include "jit/JitScript.h"
@@ -1000,6 +1001,10 @@ AbortReasonOr<Ok> WarpScriptOracle::maybeInlineIC(WarpOpSnapshotList& snapshots,
 AbortReasonOr<bool> WarpScriptOracle::maybeInlineCall(
     WarpOpSnapshotList& snapshots, BytecodeLocation loc, ICCacheIRStub* stub,
     ICFallbackStub* fallbackStub, uint8_t* stubDataCopy) {
+  if (!mirGen_.optimizationInfo().inlineInterpreted()) {
+    return false;
+  }
+
   Maybe<InlinableOpData> inlineData = FindInlinableOpData(stub, loc);
   if (inlineData.isNothing()) {
     return false;
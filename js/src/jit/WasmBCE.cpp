@@ -6,9 +6,14 @@
 
 #include "jit/WasmBCE.h"
 
+#include "mozilla/Maybe.h"
+
+#include <algorithm>
+
 #include "jit/JitSpewer.h"
 #include "jit/MIRGenerator.h"
 #include "jit/MIRGraph.h"
+#include "wasm/WasmMemory.h"
 
 using namespace js;
 using namespace js::jit;
@@ -24,10 +29,127 @@ using LastSeenMap = js::HashMap<uint32_t, MDefinition*, DefaultHasher<uint32_t>,
 // can ONLY GROW. If we allow SHRINKING the heap, this pass should be
 // RECONSIDERED.
 //
+// For memory64, a check on `base + c` is also redundant if `base` has already
+// been checked and `c` is a small non-negative constant, see
+// CheckedByConstantAddition.
+//
 // TODO (dbounov): Are there a lot of cases where there is no single dominating
 // check, but a set of checks that together dominate a redundant check?
+
+#ifdef JS_64BIT
+// Returns the largest offset of the memory accesses using `index` as their
+// base, or Nothing() if not all uses of `index` are known.
+static mozilla::Maybe<uint64_t> MaxAccessOffset(MDefinition* index) {
+  uint64_t maxOffset = 0;
+  for (MUseIterator i(index->usesBegin()); i != index->usesEnd(); i++) {
+    if (!(*i)->consumer()->isDefinition()) {
+      return mozilla::Nothing();
+    }
+    MDefinition* use = (*i)->consumer()->toDefinition();
+
+    const wasm::MemoryAccessDesc* access = nullptr;
+    MDefinition* base = nullptr;
+    switch (use->op()) {
+      case MDefinition::Opcode::WasmLoad:
+        access = &use->toWasmLoad()->access();
+        base = use->toWasmLoad()->base();
+        break;
+      case MDefinition::Opcode::WasmStore:
+        access = &use->toWasmStore()->access();
+        base = use->toWasmStore()->base();
+        break;
+      case MDefinition::Opcode::WasmLoadLaneSimd128:
+        access = &use->toWasmLoadLaneSimd128()->access();
+        base = use->toWasmLoadLaneSimd128()->base();
+        break;
+      case MDefinition::Opcode::WasmStoreLaneSimd128:
+        access = &use->toWasmStoreLaneSimd128()->access();
+        base = use->toWasmStoreLaneSimd128()->base();
+        break;
+      case MDefinition::Opcode::WasmCompareExchangeHeap:
+        access = &use->toWasmCompareExchangeHeap()->access();
+        base = use->toWasmCompareExchangeHeap()->base();
+        break;
+      case MDefinition::Opcode::WasmAtomicExchangeHeap:
+        access = &use->toWasmAtomicExchangeHeap()->access();
+        base = use->toWasmAtomicExchangeHeap()->base();
+        break;
+      case MDefinition::Opcode::WasmAtomicBinopHeap:
+        access = &use->toWasmAtomicBinopHeap()->access();
+        base = use->toWasmAtomicBinopHeap()->base();
+        break;
+      default:
+        // Not a memory access, or `index` isn't used as an address.
+        continue;
+    }
+
+    if (base != index) {
+      continue;
+    }
+    maxOffset = std::max(maxOffset, access->offset64());
+  }
+  return mozilla::Some(maxOffset);
+}
+#endif
+
+// If `bc` checks `base + c` for a small constant `c` and `base` has a
+// dominating check, returns the dominating check (or checked phi) for
+// `base` and sets `*addend` to `c`.
 //
-// TODO (dbounov): Generalize to constant additions relative to one base
+// Memory64 limits are far below 2^63, so `base + c` can't wrap once `base`
+// is known to be in bounds. An access at `base + c + offset` then lands below
+// `limit + c + offset`, which is inside the guard region as long as
+// `c + offset` is below the offset guard limit, just like an access at `base`
+// with a folded offset.
+static MDefinition* CheckedByConstantAddition(MWasmBoundsCheck* bc,
+                                              const LastSeenMap& lastSeen,
+                                              MConstant** addend) {
+#ifndef JS_64BIT
+  // Memory64 indices are wrapped to 32 bits after the check on 32-bit
+  // platforms, which hides the accesses from MaxAccessOffset.
+  return nullptr;
+#else
+  MDefinition* index = bc->index();
+  if (index->type() != MIRType::Int64 || !index->isAdd()) {
+    return nullptr;
+  }
+
+  MAdd* add = index->toAdd();
+  MDefinition* base;
+  MDefinition* constant;
+  if (add->rhs()->isConstant()) {
+    base = add->lhs();
+    constant = add->rhs();
+  } else if (add->lhs()->isConstant()) {
+    base = add->rhs();
+    constant = add->lhs();
+  } else {
+    return nullptr;
+  }
+
+  int64_t c = constant->toConstant()->toInt64();
+  uint64_t offsetGuardLimit = wasm::GetMaxOffsetGuardLimit(false);
+  if (c < 0 || uint64_t(c) >= offsetGuardLimit) {
+    return nullptr;
+  }
+
+  LastSeenMap::Ptr ptr = lastSeen.lookup(base->id());
+  if (!ptr || !ptr->value()->block()->dominates(bc->block())) {
+    return nullptr;
+  }
+
+  // All accesses through this check must stay within the guard region.
+  MDefinition* checked = JitOptions.spectreIndexMasking ? bc : index;
+  mozilla::Maybe<uint64_t> maxOffset = MaxAccessOffset(checked);
+  if (!maxOffset || *maxOffset >= offsetGuardLimit - uint64_t(c)) {
+    return nullptr;
+  }
+
+  *addend = constant->toConstant();
+  return ptr->value();
+#endif
+}
+
 bool jit::EliminateBoundsChecks(const MIRGenerator* mir, MIRGraph& graph) {
   JitSpew(JitSpew_WasmBCE, "Begin");
   // Map for dominating block where a given definition was checked
@@ -70,6 +192,7 @@ bool jit::EliminateBoundsChecks(const MIRGenerator* mir, MIRGraph& graph) {
               MOZ_ASSERT(!bc->hasUses());
             }
           } else {
+            MConstant* addend = nullptr;
             LastSeenMap::AddPtr ptr = lastSeen.lookupForAdd(addr->id());
             if (ptr) {
               MDefinition* prevCheckOrPhi = ptr->value();
@@ -81,6 +204,24 @@ bool jit::EliminateBoundsChecks(const MIRGenerator* mir, MIRGraph& graph) {
                   MOZ_ASSERT(!bc->hasUses());
                 }
               }
+            } else if (MDefinition* prevBase =
+                           CheckedByConstantAddition(bc, lastSeen, &addend)) {
+              bc->setRedundant();
+              MDefinition* checked = bc;
+              if (JitOptions.spectreIndexMasking) {
+                // Recompute the index from the masked base, so the accesses
+                // still depend on a bounds check.
+                MAdd* masked = MAdd::NewWasm(graph.alloc(), prevBase, addend,
+                                             MIRType::Int64);
+                block->insertBefore(bc, masked);
+                bc->replaceAllUsesWith(masked);
+                checked = masked;
+              } else {
+                MOZ_ASSERT(!bc->hasUses());
+              }
+              if (!lastSeen.add(ptr, addr->id(), checked)) {
+                return false;
+              }
             } else {
               if (!lastSeen.add(ptr, addr->id(), def)) {
                 return false;
@@ -0,0 +1,56 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi.h"  // JS_{Get,Set}GlobalJitCompilerOption
+
+#include "jsapi-tests/tests.h"
+
+// The off-thread Baseline compilation options set by the embedding, as done
+// from the javascript.options.baselinejit.* prefs, are applied.
+BEGIN_TEST(testBaselineOffThreadCompile_options) {
+  uint32_t enabled;
+  uint32_t batchSize;
+  CHECK(JS_GetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE, &enabled));
+  CHECK(JS_GetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+                                      &batchSize));
+
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE, 1);
+  uint32_t value;
+  CHECK(JS_GetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE, &value));
+  CHECK_EQUAL(value, 1u);
+
+  // -1 selects the default batch size, and batches hold at least one script.
+  JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+                                uint32_t(-1));
+  CHECK(JS_GetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+                                      &value));
+  CHECK_EQUAL(value, 5u);
+  JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE, 0);
+  CHECK(JS_GetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+                                      &value));
+  CHECK_EQUAL(value, 1u);
+
+  // Scripts warming up while off-thread compilation is enabled keep running
+  // correctly, whether or not their Baseline code has been linked yet.
+  JS::RootedValue result(cx);
+  EVAL(
+      "function f(x) { return x + 1; }\n"
+      "var sum = 0;\n"
+      "for (var i = 0; i < 10000; i++) sum = f(sum);\n"
+      "sum;\n",
+      &result);
+  CHECK(result.isInt32(10000));
+
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE, enabled);
+  JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+                                batchSize);
+  return true;
+}
+END_TEST(testBaselineOffThreadCompile_options)
@@ -766,3 +766,40 @@ inline bool RadixOutOfRange(uint8_t radix) {
   return true;
 }
 END_TEST(testBigIntToString_RadixOutOfRange)
+
+// Large operands are multiplied with the Karatsuba algorithm. Check the
+// products against products with small chunks of one operand, which use the
+// schoolbook algorithm, for balanced and unbalanced operands.
+BEGIN_TEST(testBigIntMultiplyLarge) {
+  EXEC(
+      "function check(cond) { if (!cond) throw new Error('check failed'); }\n"
+      "function random(bits, seed) {\n"
+      "  var x = 0n;\n"
+      "  for (var i = 0; i < bits; i += 30) {\n"
+      "    seed = (seed * 1103515245 + 12345) % 2147483648;\n"
+      "    x = (x << 30n) | BigInt(seed & 0x3fffffff);\n"
+      "  }\n"
+      "  return x;\n"
+      "}\n"
+      "function chunkedMul(a, b) {\n"
+      "  var r = 0n;\n"
+      "  for (var shift = 0n; b; shift += 16n, b >>= 16n) {\n"
+      "    r += (a * (b & 0xffffn)) << shift;\n"
+      "  }\n"
+      "  return r;\n"
+      "}\n"
+      "var sizes = [2048, 2176, 4096, 4160, 9000, 20000];\n"
+      "for (var i = 0; i < sizes.length; i++) {\n"
+      "  for (var j = 0; j < sizes.length; j++) {\n"
+      "    var a = random(sizes[i], i + 1);\n"
+      "    var b = random(sizes[j], j + 100);\n"
+      "    check(a * b === chunkedMul(a, b));\n"
+      "    check(-a * b === -chunkedMul(a, b));\n"
+      "    var m = (1n << BigInt(sizes[j])) - 1n;\n"
+      "    check(m * m === (1n << BigInt(2 * sizes[j])) -\n"
+      "                    (1n << BigInt(sizes[j] + 1)) + 1n);\n"
+      "  }\n"
+      "}\n");
+  return true;
+}
+END_TEST(testBigIntMultiplyLarge)
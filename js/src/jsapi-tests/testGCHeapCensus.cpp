@@ -0,0 +1,69 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "js/Array.h"  // JS::NewArrayObject
+#include "js/GCAPI.h"
+#include "jsapi-tests/tests.h"
+
+struct HeapCensusTotals {
+  JS::Zone* zone = nullptr;
+  size_t kindCount = 0;
+  size_t arenaCount = 0;
+  size_t histogramCount = 0;
+  size_t usedCellCount = 0;
+  bool consistent = true;
+};
+
+static void CensusCallback(void* data, JS::Zone* zone,
+                           const char* allocKindName,
+                           const JS::HeapCensusKindInfo& info) {
+  auto* totals = static_cast<HeapCensusTotals*>(data);
+  if (zone != totals->zone) {
+    return;
+  }
+
+  totals->kindCount++;
+  totals->arenaCount += info.arenaCount;
+  totals->usedCellCount += info.usedCellCount();
+  for (size_t count : info.occupancyHistogram) {
+    totals->histogramCount += count;
+  }
+
+  if (!allocKindName || !info.thingSize || !info.arenaCount ||
+      info.freeCellCount > info.cellCount ||
+      info.cellCount % info.arenaCount != 0) {
+    totals->consistent = false;
+  }
+}
+
+BEGIN_TEST(testGCHeapCensus) {
+  JS::RootedObject array(cx, JS::NewArrayObject(cx, 0));
+  CHECK(array);
+
+  const size_t ObjectCount = 1000;
+  for (size_t i = 0; i < ObjectCount; i++) {
+    JS::RootedObject obj(cx, JS_NewPlainObject(cx));
+    CHECK(obj);
+    CHECK(JS_SetElement(cx, array, i, obj));
+  }
+
+  // Tenure everything so that the objects are counted.
+  JS_GC(cx);
+
+  HeapCensusTotals totals;
+  totals.zone = js::GetContextZone(cx);
+  JS::CollectHeapCensus(cx, CensusCallback, &totals);
+
+  CHECK(totals.consistent);
+  CHECK(totals.kindCount > 0);
+  CHECK(totals.arenaCount > 0);
+  CHECK_EQUAL(totals.histogramCount, totals.arenaCount);
+  CHECK(totals.usedCellCount >= ObjectCount);
+
+  return true;
+}
+END_TEST(testGCHeapCensus)
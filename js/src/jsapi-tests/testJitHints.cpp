@@ -0,0 +1,98 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "mozilla/EndianUtils.h"
+
+#include "jsapi.h"
+
+#include "jsapi-tests/tests.h"
+
+static const uint32_t JitHintsMagic = 0x4a495448;
+static const uint32_t JitHintsVersion = 1;
+
+static bool AppendWords(JS::TranscodeBuffer& buffer,
+                        std::initializer_list<uint32_t> words) {
+  for (uint32_t word : words) {
+    uint8_t bytes[sizeof(uint32_t)];
+    mozilla::LittleEndian::writeUint32(bytes, word);
+    if (!buffer.append(bytes, sizeof(bytes))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static uint32_t ReadWord(const JS::TranscodeBuffer& buffer, size_t index) {
+  return mozilla::LittleEndian::readUint32(buffer.begin() +
+                                           index * sizeof(uint32_t));
+}
+
+static JS::TranscodeRange AsRange(const JS::TranscodeBuffer& buffer) {
+  return JS::TranscodeRange(buffer.begin(), buffer.length());
+}
+
+BEGIN_TEST(testJitHints_encodeDecode) {
+  JS::TranscodeBuffer initial;
+  CHECK(JS::EncodeJitHints(cx, initial));
+  if (initial.empty()) {
+    // JIT hints are disabled.
+    return true;
+  }
+
+  CHECK(initial.length() >= 3 * sizeof(uint32_t));
+  CHECK_EQUAL(ReadWord(initial, 0), JitHintsMagic);
+  CHECK_EQUAL(ReadWord(initial, 1), JitHintsVersion);
+  uint32_t initialCount = ReadWord(initial, 2);
+
+  // Key, threshold, two monomorphic inline offsets and one alloc site offset.
+  JS::TranscodeBuffer hint;
+  CHECK(AppendWords(hint, {0x12345678, 42, 2, 3, 7, 1, 11}));
+
+  JS::TranscodeBuffer input;
+  CHECK(AppendWords(input, {JitHintsMagic, JitHintsVersion, 1}));
+  CHECK(input.appendAll(hint));
+
+  // Truncated and incompatible data is ignored.
+  CHECK(JS::DecodeJitHints(
+      cx, JS::TranscodeRange(input.begin(), input.length() - 1)));
+  JS::TranscodeBuffer badVersion;
+  CHECK(AppendWords(badVersion, {JitHintsMagic, JitHintsVersion + 1, 1}));
+  CHECK(badVersion.appendAll(hint));
+  CHECK(JS::DecodeJitHints(cx, AsRange(badVersion)));
+
+  JS::TranscodeBuffer unchanged;
+  CHECK(JS::EncodeJitHints(cx, unchanged));
+  CHECK_EQUAL(ReadWord(unchanged, 2), initialCount);
+
+  // The decoded hint is the most recently used one, so it's encoded last.
+  CHECK(JS::DecodeJitHints(cx, AsRange(input)));
+  JS::TranscodeBuffer output;
+  CHECK(JS::EncodeJitHints(cx, output));
+  CHECK_EQUAL(ReadWord(output, 2), initialCount + 1);
+  CHECK(output.length() >= hint.length());
+  CHECK(memcmp(output.end() - hint.length(), hint.begin(), hint.length()) ==
+        0);
+
+  // Merging keeps the existing threshold and adds new offsets.
+  JS::TranscodeBuffer merge;
+  CHECK(AppendWords(merge, {JitHintsMagic, JitHintsVersion, 1, 0x12345678,
+                            1000, 1, 5, 0}));
+  CHECK(JS::DecodeJitHints(cx, AsRange(merge)));
+
+  JS::TranscodeBuffer merged;
+  CHECK(JS::EncodeJitHints(cx, merged));
+  CHECK_EQUAL(ReadWord(merged, 2), initialCount + 1);
+
+  JS::TranscodeBuffer expected;
+  CHECK(AppendWords(expected, {0x12345678, 42, 3, 3, 7, 5, 1, 11}));
+  CHECK(merged.length() >= expected.length());
+  CHECK(memcmp(merged.end() - expected.length(), expected.begin(),
+               expected.length()) == 0);
+
+  return true;
+}
+END_TEST(testJitHints_encodeDecode)
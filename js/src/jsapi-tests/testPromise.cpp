@@ -168,3 +168,48 @@ BEGIN_TEST(testPromise_PromiseCatch) {
   return true;
 }
 END_TEST(testPromise_PromiseCatch)
+
+static int unhandledRejections = 0;
+
+static void TrackRejections(JSContext* cx, bool mutedErrors,
+                            JS::HandleObject promise,
+                            JS::PromiseRejectionHandlingState state,
+                            void* data) {
+  if (state == JS::PromiseRejectionHandlingState::Unhandled) {
+    unhandledRejections++;
+  } else {
+    unhandledRejections--;
+  }
+}
+
+// Awaiting an already rejected promise from the last job may skip the
+// microtask queue.  The reason must still be thrown at the await, and the
+// promise must be reported as handled.
+BEGIN_TEST(testPromise_AwaitRejected) {
+  JS::SetPromiseRejectionTrackerCallback(cx, TrackRejections);
+
+  EXEC(
+      "var log = [];\n"
+      "async function f() {\n"
+      "  await null;\n"
+      "  for (var i = 0; i < 3; i++) {\n"
+      "    try {\n"
+      "      await Promise.reject(i);\n"
+      "      log.push('fulfilled');\n"
+      "    } catch (e) {\n"
+      "      log.push(e);\n"
+      "    }\n"
+      "  }\n"
+      "  log.push(await Promise.resolve('done'));\n"
+      "}\n"
+      "f();\n");
+  js::RunJobs(cx);
+
+  EXEC(
+      "if (log.join() !== '0,1,2,done') throw new Error(log.join());\n");
+  CHECK_EQUAL(unhandledRejections, 0);
+
+  JS::SetPromiseRejectionTrackerCallback(cx, nullptr);
+  return true;
+}
+END_TEST(testPromise_AwaitRejected)
@@ -0,0 +1,60 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+
+#include "js/RegExpFlags.h"  // JS::RegExpFlag, JS::RegExpFlags
+#include "jsapi-tests/tests.h"
+#include "vm/Caches.h"       // js::RegExpBytecodeCache
+#include "vm/JSAtomUtils.h"  // js::Atomize
+#include "vm/JSContext.h"
+#include "vm/Runtime.h"
+
+// Regexps compiled to bytecode in one zone are reused by identical regexps of
+// other zones. Check that the regexps still produce the same results,
+// including their named captures, when their bytecode comes from the cache.
+BEGIN_TEST(testRegExpBytecodeCache) {
+  static const char Pattern[] = "(?<year>\\d{4})-(?<month>\\d\\d)";
+  static const char Script[] =
+      "var re = /(?<year>\\d{4})-(?<month>\\d\\d)/g;\n"
+      "var out = [];\n"
+      "for (var m of 'from 2023-04 to 2024-11'.matchAll(re)) {\n"
+      "  out.push(m.groups.year + '/' + m.groups.month + '@' + m.index);\n"
+      "}\n"
+      "for (var m of 'de 2023-04 \\u00e0 2024-11 \\u2026'.matchAll(re)) {\n"
+      "  out.push(m.groups.year + '/' + m.groups.month + '@' + m.index);\n"
+      "}\n"
+      "out.join(',');\n";
+  static const char Expected[] = "2023/04@5,2024/11@16,2023/04@3,2024/11@13";
+
+  js::RegExpBytecodeCache& cache = cx->runtime()->caches().regExpBytecodeCache;
+  cache.purge();
+
+  JS::Rooted<JSAtom*> source(cx, js::Atomize(cx, Pattern, strlen(Pattern)));
+  CHECK(source);
+  JS::RegExpFlags flags(JS::RegExpFlag::Global);
+
+  for (size_t i = 0; i < 2; i++) {
+    JS::RootedObject newGlobal(cx, createGlobal());
+    CHECK(newGlobal);
+    JSAutoRealm ar(cx, newGlobal);
+
+    JS::RootedValue rval(cx);
+    EVAL(Script, &rval);
+    CHECK(rval.isString());
+
+    bool match;
+    CHECK(JS_StringEqualsAscii(cx, rval.toString(), Expected, &match));
+    CHECK(match);
+
+    // The first zone added the bytecode for both encodings to the cache.
+    uint32_t maxRegisters = 0;
+    CHECK(cache.lookup(source, flags, true, &maxRegisters));
+    CHECK(maxRegisters > 0);
+    CHECK(cache.lookup(source, flags, false, &maxRegisters));
+  }
+
+  return true;
+}
+END_TEST(testRegExpBytecodeCache)
@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+// String.prototype.indexOf and includes search the leaves of ropes without
+// flattening them. Check matches within and across leaves, with Latin-1 and
+// TwoByte leaves, and with start positions in any leaf.
+BEGIN_TEST(testStringRopeSearch) {
+  JS::Rooted<JS::Value> rval(cx);
+  EVAL(
+      "var ok = true;\n"
+      "function naiveIndexOf(text, pat, start) {\n"
+      "  for (var i = start; i + pat.length <= text.length; i++) {\n"
+      "    if (text.substr(i, pat.length) === pat) return i;\n"
+      "  }\n"
+      "  return -1;\n"
+      "}\n"
+      "var leaves = ['y'.repeat(100), 'abcabcabcabcabcabcabc', 'xyz',\n"
+      "              'ab\\u0101c', '',\n"
+      "              'cabxyzab', '\\u0101\\u0102abc', 'zzzzzzzzzzzzzzzzzz'];\n"
+      "var patterns = ['abc', 'cx', 'zab', 'c\\u0101', '\\u0101\\u0102',\n"
+      "                'bxyza', 'abzzz', 'zzzzzzzzzz', 'q', 'c'];\n"
+      "function makeRope(n) {\n"
+      "  var rope = leaves[0];\n"
+      "  for (var i = 1; i < n; i++) rope = rope + leaves[i];\n"
+      "  return rope;\n"
+      "}\n"
+      "for (var n = 1; n <= leaves.length; n++) {\n"
+      "  var flat = Array.from(makeRope(n)).join('');\n"
+      "  for (var pat of patterns) {\n"
+      "    for (var start = 0; start <= flat.length + 1; start++) {\n"
+      "      var r = makeRope(n);\n"
+      "      var expected = naiveIndexOf(flat, pat, start);\n"
+      "      if (r.indexOf(pat, start) !== expected) ok = false;\n"
+      "      if (r.includes(pat, start) !== (expected !== -1)) ok = false;\n"
+      "    }\n"
+      "  }\n"
+      "}\n"
+      "ok;\n",
+      &rval);
+  CHECK(rval.isTrue());
+  return true;
+}
+END_TEST(testStringRopeSearch)
@@ -9,6 +9,7 @@
 #include "js/StructuredClone.h"
 
 #include "jsapi-tests/tests.h"
+#include "vm/JSObject.h"  // JSObject::shape
 
 using namespace js;
 
@@ -363,3 +364,91 @@ BEGIN_TEST(testStructuredClone_SavedFrame) {
   return true;
 }
 END_TEST(testStructuredClone_SavedFrame)
+
+// Plain objects with the same shape are written with a shape template. Check
+// that they are read back with their properties in order, and that the
+// objects read from the same template share their shape.
+BEGIN_TEST(testStructuredClone_shapeTemplates) {
+  CHECK(testShapeTemplates(JS::StructuredCloneScope::SameProcess));
+  CHECK(testShapeTemplates(JS::StructuredCloneScope::DifferentProcess));
+  CHECK(testShapeTemplates(
+      JS::StructuredCloneScope::DifferentProcessForIndexedDB));
+  return true;
+}
+
+bool testShapeTemplates(JS::StructuredCloneScope scope) {
+  JS::RootedValue v1(cx);
+  EVAL(
+      "var records = [];\n"
+      "for (var i = 0; i < 100; i++) {\n"
+      "  var r = {id: i, name: 'r' + i, pos: {x: i, y: -i}};\n"
+      "  if (i % 10 == 0) r.self = r;\n"
+      "  records.push(r);\n"
+      "}\n"
+      "records.push({get id() { return 1; }, name: 'accessor'});\n"
+      "records.push({1: 'index', name: 'indexed'});\n"
+      "records;\n",
+      &v1);
+
+  JS::RootedValue v2(cx);
+  JSAutoStructuredCloneBuffer clonedBuffer(scope, nullptr, nullptr);
+  CHECK(clonedBuffer.write(cx, v1));
+  CHECK(clonedBuffer.read(cx, &v2));
+  CHECK(v2.isObject());
+  CHECK(JS_SetProperty(cx, global, "copy", v2));
+
+  EXEC(
+      "function check(cond) { if (!cond) throw new Error('check failed'); }\n"
+      "check(copy.length == records.length);\n"
+      "for (var i = 0; i < 100; i++) {\n"
+      "  var keys = i % 10 == 0 ? 'id,name,pos,self' : 'id,name,pos';\n"
+      "  check(Object.keys(copy[i]).join() == keys);\n"
+      "  check(copy[i].id === i && copy[i].name === 'r' + i);\n"
+      "  check(copy[i].pos.x === i && copy[i].pos.y === -i);\n"
+      "  check(i % 10 != 0 || copy[i].self === copy[i]);\n"
+      "}\n"
+      "check(copy[100].id === 1 && copy[100].name == 'accessor');\n"
+      "check(Object.keys(copy[101]).join() == '1,name');\n");
+
+  JS::RootedValue first(cx);
+  JS::RootedValue second(cx);
+  JS::RootedObject copy(cx, &v2.toObject());
+  CHECK(JS_GetElement(cx, copy, 1, &first));
+  CHECK(JS_GetElement(cx, copy, 2, &second));
+  CHECK(first.toObject().shape() == second.toObject().shape());
+
+  return true;
+}
+END_TEST(testStructuredClone_shapeTemplates)
+
+// The values of template objects are looked up as they are written, so that
+// getters run while writing earlier values can modify or delete them.
+BEGIN_TEST(testStructuredClone_shapeTemplatesMutation) {
+  JS::RootedValue v1(cx);
+  EVAL(
+      "var records = [];\n"
+      "for (var i = 0; i < 3; i++) {\n"
+      "  let r = {a: null, b: 1, c: 2};\n"
+      "  r.a = {get g() { r.b = 10; delete r.c; return 0; }};\n"
+      "  records.push(r);\n"
+      "}\n"
+      "records;\n",
+      &v1);
+
+  JS::RootedValue v2(cx);
+  JSAutoStructuredCloneBuffer clonedBuffer(
+      JS::StructuredCloneScope::SameProcess, nullptr, nullptr);
+  CHECK(clonedBuffer.write(cx, v1));
+  CHECK(clonedBuffer.read(cx, &v2));
+  CHECK(JS_SetProperty(cx, global, "copy", v2));
+
+  EXEC(
+      "function check(cond) { if (!cond) throw new Error('check failed'); }\n"
+      "for (var i = 0; i < 3; i++) {\n"
+      "  check(Object.keys(copy[i]).join() == 'a,b');\n"
+      "  check(copy[i].a.g === 0 && copy[i].b === 10);\n"
+      "}\n");
+
+  return true;
+}
+END_TEST(testStructuredClone_shapeTemplatesMutation)
@@ -0,0 +1,125 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "mozilla/Utf8.h"
+
+#include <string>
+#include <type_traits>
+
+#include "js/CompilationAndEvaluation.h"  // JS::Evaluate
+#include "js/SourceText.h"
+#include "jsapi-tests/tests.h"
+
+// The token stream skips runs of comments, string literals, identifiers and
+// spaces a word at a time.  Check that tokens are still correctly split, and
+// line numbers are still correctly counted, whatever the alignment of these
+// runs, in both UTF-8 and UTF-16 sources.
+BEGIN_TEST(testTokenStreamScanning) {
+  for (size_t n = 0; n < 20; n++) {
+    CHECK(testScanning<char>(n));
+    CHECK(testScanning<char16_t>(n));
+  }
+
+  return true;
+}
+
+template <typename CharT>
+static void append(std::basic_string<CharT>& str, const char* ascii) {
+  while (*ascii) {
+    str.push_back(CharT(*ascii++));
+  }
+}
+
+template <typename CharT>
+static void appendRepeated(std::basic_string<CharT>& str, char c, size_t n) {
+  str.append(n, CharT(c));
+}
+
+// Append U+00E9 LATIN SMALL LETTER E WITH ACUTE.
+static void appendNonAscii(std::string& str) { str.append("\xC3\xA9"); }
+static void appendNonAscii(std::u16string& str) { str.push_back(0xE9); }
+
+static bool initSource(JSContext* cx, JS::SourceText<mozilla::Utf8Unit>& srcBuf,
+                       const std::string& str) {
+  return srcBuf.init(cx, str.data(), str.length(),
+                     JS::SourceOwnership::Borrowed);
+}
+static bool initSource(JSContext* cx, JS::SourceText<char16_t>& srcBuf,
+                       const std::u16string& str) {
+  return srcBuf.init(cx, str.data(), str.length(),
+                     JS::SourceOwnership::Borrowed);
+}
+
+template <typename CharT>
+bool testScanning(size_t n) {
+  std::basic_string<CharT> source;
+
+  // Line 1: A multi-line comment with directive-like and non-ASCII code units,
+  // followed by a single-line comment.
+  append(source, "/*");
+  appendRepeated(source, 'x', n);
+  append(source, "@ * #");
+  appendNonAscii(source);
+  appendRepeated(source, 'x', n);
+  append(source, "*/ //");
+  appendRepeated(source, 'y', n);
+  appendNonAscii(source);
+  appendRepeated(source, 'y', n);
+  append(source, "\n");
+
+  // Line 2: Long identifiers, and string and template literals with escapes,
+  // '$' and the other delimiters.
+  append(source, "var id");
+  appendRepeated(source, 'a', n);
+  append(source, " = '");
+  appendRepeated(source, 'b', n);
+  append(source, "\\'$\"`");
+  appendRepeated(source, 'c', n);
+  append(source, "' + `");
+  appendRepeated(source, 'd', n);
+  append(source, "$'\"${1}");
+  appendRepeated(source, 'e', n);
+  append(source, "`;\n");
+
+  // Lines 3 and 4: Indentation and a multi-line comment spanning a CRLF.
+  appendRepeated(source, ' ', n);
+  append(source, "\t/*");
+  appendRepeated(source, 'z', n);
+  append(source, "\r\n");
+  appendRepeated(source, 'z', n);
+  append(source, "*/\n");
+
+  // Line 5: Report the result.
+  appendRepeated(source, ' ', n);
+  append(source, "id");
+  appendRepeated(source, 'a', n);
+  append(source, " + '|' + new Error().lineNumber;\n");
+
+  std::string expected;
+  appendRepeated(expected, 'b', n);
+  append(expected, "'$\"`");
+  appendRepeated(expected, 'c', n);
+  appendRepeated(expected, 'd', n);
+  append(expected, "$'\"1");
+  appendRepeated(expected, 'e', n);
+  append(expected, "|5");
+
+  JS::CompileOptions options(cx);
+  options.setFileAndLine(__FILE__, 1);
+
+  using Unit =
+      std::conditional_t<std::is_same_v<CharT, char>, mozilla::Utf8Unit, CharT>;
+  JS::SourceText<Unit> srcBuf;
+  CHECK(initSource(cx, srcBuf, source));
+
+  JS::Rooted<JS::Value> rval(cx);
+  CHECK(JS::Evaluate(cx, options, srcBuf, &rval));
+  CHECK(rval.isString());
+
+  bool match;
+  CHECK(JS_StringEqualsAscii(cx, rval.toString(), expected.c_str(), &match));
+  CHECK(match);
+  return true;
+}
+END_TEST(testTokenStreamScanning)
@@ -0,0 +1,53 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+// Sorting without a comparator uses a radix sort for large typed arrays. Check
+// it agrees with sorting with an explicit comparator, including for columns
+// which are skipped because all values share the same byte.
+BEGIN_TEST(testTypedArraySort) {
+  JS::Rooted<JS::Value> rval(cx);
+  EVAL(
+      "var ok = true;\n"
+      "var compare = (x, y) => x < y ? -1 : x > y ? 1 : 0;\n"
+      "var compareFloat = (x, y) => {\n"
+      "  if (x !== y) return x < y ? -1 : 1;\n"
+      "  return Object.is(x, -0) && !Object.is(y, -0) ? -1 :\n"
+      "         Object.is(y, -0) && !Object.is(x, -0) ? 1 : 0;\n"
+      "};\n"
+      "function check(ctor, values, cmp) {\n"
+      "  for (var length of [100, 1000, 5000]) {\n"
+      "    var ta = new ctor(length);\n"
+      "    for (var i = 0; i < length; i++) ta[i] = values(i);\n"
+      "    var expected = Array.from(ta).sort(cmp);\n"
+      "    ta.sort();\n"
+      "    for (var i = 0; i < length; i++) {\n"
+      "      if (!Object.is(ta[i], expected[i])) ok = false;\n"
+      "    }\n"
+      "  }\n"
+      "}\n"
+      "var seed = 1;\n"
+      "function random() {\n"
+      "  seed = (seed * 1103515245 + 12345) % 2147483648;\n"
+      "  return seed / 2147483648;\n"
+      "}\n"
+      "check(Float64Array, () => (random() - 0.5) * 1e300, compareFloat);\n"
+      "check(Float64Array, () => Math.floor(random() * 16) - 8, compareFloat);\n"
+      "check(Float64Array, i => [-0, 0, -Infinity, Infinity][i % 4],\n"
+      "      compareFloat);\n"
+      "check(Float32Array, () => (random() - 0.5) * 1e30, compareFloat);\n"
+      "check(Int32Array, () => Math.floor(random() * 100) - 50, compare);\n"
+      "check(BigInt64Array, () => BigInt(Math.floor((random() - 0.5) * 1e15)),\n"
+      "      compare);\n"
+      "check(BigInt64Array, () => BigInt(Math.floor(random() * 256) - 128),\n"
+      "      compare);\n"
+      "check(BigUint64Array, () => BigInt(Math.floor(random() * 1e15)) << 10n,\n"
+      "      compare);\n"
+      "ok;\n",
+      &rval);
+  CHECK(rval.isTrue());
+  return true;
+}
+END_TEST(testTypedArraySort)
@@ -9,6 +9,7 @@
 #include "js/GlobalObject.h"              // JS_NewGlobalObject
 #include "js/SourceText.h"                // JS::Source{Ownership,Text}
 #include "js/UbiNode.h"
+#include "js/UbiNodeBreadthFirst.h"
 #include "js/UbiNodeDominatorTree.h"
 #include "js/UbiNodePostOrder.h"
 #include "js/UbiNodeShortestPaths.h"
@@ -425,6 +426,55 @@ BEGIN_TEST(test_ubiPostOrder) {
 }
 END_TEST(test_ubiPostOrder)
 
+// BreadthFirst visits wide and deep frontiers in order.
+struct BreadthFirstRecorder {
+  js::Vector<FakeNode*, 0, js::SystemAllocPolicy> reached;
+
+  class NodeData {};
+  using Traversal = JS::ubi::BreadthFirst<BreadthFirstRecorder>;
+  bool operator()(Traversal& traversal, JS::ubi::Node origin,
+                  const JS::ubi::Edge& edge, NodeData*, bool first) {
+    return !first || reached.append(edge.referent.as<FakeNode>());
+  }
+};
+
+BEGIN_TEST(test_ubiBreadthFirst) {
+  // Construct a root with an edge to each of many children, and an edge from
+  // each child to its own grandchild, such that the frontier of the traversal
+  // spans many segments of its queue.
+  const size_t count = 3000;
+
+  FakeNode r('r');
+  js::Vector<FakeNode, 0, js::SystemAllocPolicy> children;
+  js::Vector<FakeNode, 0, js::SystemAllocPolicy> grandchildren;
+  CHECK(children.reserve(count));
+  CHECK(grandchildren.reserve(count));
+  for (size_t i = 0; i < count; i++) {
+    children.infallibleEmplaceBack('c');
+    grandchildren.infallibleEmplaceBack('g');
+    CHECK(r.addEdgeTo(children[i]));
+    CHECK(children[i].addEdgeTo(grandchildren[i]));
+    CHECK(children[i].addEdgeTo(r));
+  }
+
+  BreadthFirstRecorder recorder;
+  {
+    JS::AutoCheckCannotGC nogc(cx);
+    BreadthFirstRecorder::Traversal traversal(cx, recorder, nogc);
+    CHECK(traversal.addStartVisited(&r));
+    CHECK(traversal.traverse());
+  }
+
+  CHECK(recorder.reached.length() == 2 * count);
+  for (size_t i = 0; i < count; i++) {
+    CHECK(recorder.reached[i] == &children[i]);
+    CHECK(recorder.reached[count + i] == &grandchildren[i]);
+  }
+
+  return true;
+}
+END_TEST(test_ubiBreadthFirst)
+
 BEGIN_TEST(test_JS_ubi_DominatorTree) {
   // Construct the following graph:
   //
@@ -30,6 +30,21 @@ static bool checkSize(JSContext* cx, JS::HandleObject map, uint32_t expected) {
   return length == expected;
 }
 
+static void performIncrementalGC(JSContext* cx) {
+  JSRuntime* rt = cx->runtime();
+  JS::SliceBudget budget(JS::WorkBudget(1000));
+  rt->gc.startDebugGC(JS::GCOptions::Normal, budget);
+
+  // Wait until we've started marking before finishing the GC
+  // non-incrementally.
+  while (rt->gc.state() == gc::State::Prepare) {
+    rt->gc.debugGCSlice(budget);
+  }
+  if (JS::IsIncrementalGCInProgress(cx)) {
+    rt->gc.finishGC(JS::GCReason::DEBUG_GC);
+  }
+}
+
 JSObject* keyDelegate = nullptr;
 
 BEGIN_TEST(testWeakMap_basicOperations) {
@@ -177,7 +192,7 @@ BEGIN_TEST(testWeakMap_keyDelegates) {
    * zone to finish marking before the delegate zone.
    */
   CHECK(newCCW(map, delegateRoot));
-  performIncrementalGC();
+  performIncrementalGC(cx);
 #ifdef DEBUG
   CHECK(map->zone()->lastSweepGroupIndex() <
         delegateRoot->zone()->lastSweepGroupIndex());
@@ -195,7 +210,7 @@ BEGIN_TEST(testWeakMap_keyDelegates) {
   key = nullptr;
   keyVal.setUndefined();
   CHECK(newCCW(map, delegateRoot));
-  performIncrementalGC();
+  performIncrementalGC(cx);
   CHECK(checkSize(cx, map, 1));
 
   /*
@@ -308,19 +323,45 @@ JSObject* newDelegate() {
   JS_SetReservedSlot(global, 0, JS::Int32Value(42));
   return global;
 }
+END_TEST(testWeakMap_keyDelegates)
 
-void performIncrementalGC() {
-  JSRuntime* rt = cx->runtime();
-  JS::SliceBudget budget(JS::WorkBudget(1000));
-  rt->gc.startDebugGC(JS::GCOptions::Normal, budget);
+BEGIN_TEST(testWeakMap_ephemeronChain) {
+  AutoLeaveZeal nozeal(cx);
 
-  // Wait until we've started marking before finishing the GC
-  // non-incrementally.
-  while (rt->gc.state() == gc::State::Prepare) {
-    rt->gc.debugGCSlice(budget);
-  }
-  if (JS::IsIncrementalGCInProgress(cx)) {
-    rt->gc.finishGC(JS::GCReason::DEBUG_GC);
+  AutoGCParameter param(cx, JSGC_INCREMENTAL_GC_ENABLED, true);
+  JS_GC(cx);
+
+  JS::RootedObject map(cx, JS::NewWeakMapObject(cx));
+  CHECK(map);
+
+  // Build a chain of entries where each value is the key of the next entry,
+  // starting from the end of the chain. Only the first key is reachable, so
+  // marking must follow the chain through the ephemeron edge table.
+  const uint32_t ChainLength = 100000;
+  JS::RootedObject head(cx, JS_NewPlainObject(cx));
+  CHECK(head);
+  JS::RootedValue key(cx);
+  JS::RootedValue value(cx);
+  for (uint32_t i = 0; i < ChainLength; i++) {
+    value.setObject(*head);
+    head = JS_NewPlainObject(cx);
+    CHECK(head);
+    key.setObject(*head);
+    CHECK(SetWeakMapEntry(cx, map, key, value));
   }
+  key.setUndefined();
+  value.setUndefined();
+
+  CHECK(checkSize(cx, map, ChainLength));
+
+  performIncrementalGC(cx);
+  CHECK(checkSize(cx, map, ChainLength));
+
+  // Dropping the head of the chain frees every entry.
+  head = nullptr;
+  JS_GC(cx);
+  CHECK(checkSize(cx, map, 0));
+
+  return true;
 }
-END_TEST(testWeakMap_keyDelegates)
+END_TEST(testWeakMap_ephemeronChain)
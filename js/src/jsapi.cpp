@@ -39,6 +39,8 @@
 #include "gc/GCContext.h"
 #include "gc/Marking.h"
 #include "gc/PublicIterators.h"
+#include "jit/JitHints.h"
+#include "jit/JitRuntime.h"
 #include "jit/JitSpewer.h"
 #include "jit/TrampolineNatives.h"
 #include "js/CallAndConstruct.h"  // JS::IsCallable
@@ -4379,6 +4381,16 @@ JS_PUBLIC_API void JS_SetGlobalJitCompilerOption(JSContext* cx,
         JitSpew(js::jit::JitSpew_BaselineScripts, "Disable baseline");
       }
       break;
+    case JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE:
+      jit::JitOptions.baselineOffThreadCompilation = !!value;
+      break;
+    case JSJITCOMPILER_BASELINE_BATCH_SIZE:
+      if (value == uint32_t(-1)) {
+        jit::DefaultJitOptions defaultValues;
+        value = defaultValues.baselineBatchSize;
+      }
+      jit::JitOptions.baselineBatchSize = std::max(value, uint32_t(1));
+      break;
     case JSJITCOMPILER_NATIVE_REGEXP_ENABLE:
       jit::JitOptions.nativeRegExp = !!value;
       break;
@@ -4501,6 +4513,12 @@ JS_PUBLIC_API bool JS_GetGlobalJitCompilerOption(JSContext* cx,
     case JSJITCOMPILER_BASELINE_ENABLE:
       *valueOut = jit::JitOptions.baselineJit;
       break;
+    case JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE:
+      *valueOut = jit::JitOptions.baselineOffThreadCompilation;
+      break;
+    case JSJITCOMPILER_BASELINE_BATCH_SIZE:
+      *valueOut = jit::JitOptions.baselineBatchSize;
+      break;
     case JSJITCOMPILER_NATIVE_REGEXP_ENABLE:
       *valueOut = jit::JitOptions.nativeRegExp;
       break;
@@ -4559,6 +4577,39 @@ JS_PUBLIC_API bool JS_GetGlobalJitCompilerOption(JSContext* cx,
   return true;
 }
 
+JS_PUBLIC_API bool JS::EncodeJitHints(JSContext* cx, TranscodeBuffer& buffer) {
+  AssertHeapIsIdle();
+  CHECK_THREAD(cx);
+
+  JSRuntime* rt = cx->runtime();
+  if (!rt->hasJitRuntime() || !rt->jitRuntime()->hasJitHintsMap()) {
+    return true;
+  }
+
+  if (!rt->jitRuntime()->getJitHintsMap()->encode(buffer)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  return true;
+}
+
+JS_PUBLIC_API bool JS::DecodeJitHints(JSContext* cx,
+                                      const TranscodeRange& range) {
+  AssertHeapIsIdle();
+  CHECK_THREAD(cx);
+
+  JSRuntime* rt = cx->runtime();
+  if (!rt->hasJitRuntime() || !rt->jitRuntime()->hasJitHintsMap()) {
+    return true;
+  }
+
+  if (!rt->jitRuntime()->getJitHintsMap()->decode(range)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  return true;
+}
+
 JS_PUBLIC_API void JS::DisableSpectreMitigationsAfterInit() {
   // This is used to turn off Spectre mitigations in pre-allocated child
   // processes used for isolated web content. Assert there's a single runtime
@@ -844,6 +844,8 @@ extern JS_PUBLIC_API void JS_SetOffthreadIonCompilationEnabled(JSContext* cx,
   Register(INLINING_BYTECODE_MAX_LENGTH, "inlining.bytecode-max-length") \
   Register(BASELINE_INTERPRETER_ENABLE, "blinterp.enable") \
   Register(BASELINE_ENABLE, "baseline.enable") \
+  Register(BASELINE_OFFTHREAD_COMPILATION_ENABLE, "baseline.offthread-compilation.enable") \
+  Register(BASELINE_BATCH_SIZE, "baseline.batch-size") \
   Register(PORTABLE_BASELINE_ENABLE, "pbl.enable") \
   Register(PORTABLE_BASELINE_WARMUP_THRESHOLD, "pbl.warmup.threshold") \
   Register(OFFTHREAD_COMPILATION_ENABLE, "offthread-compilation.enable")  \
@@ -887,6 +889,25 @@ namespace JS {
 // JSContext. Must be called on this context's thread.
 extern JS_PUBLIC_API void DisableSpectreMitigationsAfterInit();
 
+/**
+ * Append the JIT hints collected by this context's runtime to |buffer|. The
+ * hints record which scripts were previously compiled with Baseline and Ion,
+ * keyed by their filename and source position, so that they can be loaded
+ * into another runtime running the same build, e.g. in a newly created
+ * process, with DecodeJitHints. The buffer is left untouched if JIT hints are
+ * disabled.
+ */
+extern JS_PUBLIC_API bool EncodeJitHints(JSContext* cx,
+                                         TranscodeBuffer& buffer);
+
+/**
+ * Merge JIT hints produced by EncodeJitHints into this context's runtime.
+ * Hints already present in the runtime take precedence. Malformed data is
+ * ignored. Returns false and reports OOM on allocation failure.
+ */
+extern JS_PUBLIC_API bool DecodeJitHints(JSContext* cx,
+                                         const TranscodeRange& range);
+
 };  // namespace JS
 
 /**
@@ -12764,6 +12764,9 @@ bool InitOptionParser(OptionParser& op) {
       !op.addStringOption(
           '\0', "ion-licm", "on/off",
           "Loop invariant code motion (default: on, off to disable)") ||
+      !op.addStringOption('\0', "ion-loop-unrolling", "on/off",
+                          "Unroll loops over typed arrays (default: off, on "
+                          "to enable)") ||
       !op.addStringOption('\0', "ion-edgecase-analysis", "on/off",
                           "Find edge cases where Ion can avoid bailouts "
                           "(default: on, off to disable)") ||
@@ -12807,6 +12810,10 @@ bool InitOptionParser(OptionParser& op) {
       !op.addStringOption(
           '\0', "ion-limit-script-size", "on/off",
           "Don't compile very large scripts (default: on, off to disable)") ||
+      !op.addStringOption(
+          '\0', "ion-fast-tier", "on/off",
+          "Compile expensive scripts with fewer optimizations first "
+          "(default: on, off to disable)") ||
       !op.addIntOption('\0', "ion-warmup-threshold", "COUNT",
                        "Wait for COUNT calls or iterations before compiling "
                        "at the normal optimization level (default: 1000)",
@@ -12817,7 +12824,8 @@ bool InitOptionParser(OptionParser& op) {
           "  backtracking: Priority based backtracking register allocation "
           "(default)\n"
           "  testbed: Backtracking allocator with experimental features\n"
-          "  stupid: Simple block local register allocation") ||
+          "  linearscan: Backtracking allocator in linear scan order, "
+          "cheaper but with more spills") ||
       !op.addBoolOption(
           '\0', "ion-eager",
           "Always ion-compile methods (implies --baseline-eager)") ||
@@ -12833,6 +12841,12 @@ bool InitOptionParser(OptionParser& op) {
       !op.addBoolOption('\0', "no-baseline", "Disable baseline compiler") ||
       !op.addBoolOption('\0', "baseline-eager",
                         "Always baseline-compile methods") ||
+      !op.addStringOption('\0', "baseline-offthread-compile", "on/off",
+                          "Emit Baseline code off thread (default: off)") ||
+      !op.addIntOption('\0', "baseline-batch-size", "COUNT",
+                       "Number of finished off-thread Baseline compilations "
+                       "to link at once (default: 5)",
+                       -1) ||
 #ifdef ENABLE_PORTABLE_BASELINE_INTERP
       !op.addBoolOption('\0', "portable-baseline-eager",
                         "Always use the porbale baseline interpreter") ||
@@ -13020,7 +13034,8 @@ bool InitOptionParser(OptionParser& op) {
           '\0', "delazification-mode", "[option]",
           "Select one of the delazification mode for scripts given on the "
           "command line, valid options are: "
-          "'on-demand', 'concurrent-df', 'eager', 'concurrent-df+on-demand'. "
+          "'on-demand', 'concurrent-df', 'concurrent-parallel', 'eager', "
+          "'concurrent-df+on-demand'. "
           "Choosing 'concurrent-df+on-demand' will run both concurrent-df and "
           "on-demand delazification mode, and compare compilation outcome. ") ||
       !op.addBoolOption('\0', "wasm-compile-and-serialize",
@@ -13426,6 +13441,8 @@ bool SetContextOptions(JSContext* cx, const OptionParser& op) {
     } else if (strcmp(mode, "concurrent-df") == 0) {
       defaultDelazificationMode =
           JS::DelazificationOption::ConcurrentDepthFirst;
+    } else if (strcmp(mode, "concurrent-parallel") == 0) {
+      defaultDelazificationMode = JS::DelazificationOption::ConcurrentParallel;
     } else if (strcmp(mode, "eager") == 0) {
       defaultDelazificationMode =
           JS::DelazificationOption::ParseEverythingEagerly;
@@ -13637,6 +13654,16 @@ bool SetContextJITOptions(JSContext* cx, const OptionParser& op) {
     }
   }
 
+  if (const char* str = op.getStringOption("ion-loop-unrolling")) {
+    if (strcmp(str, "on") == 0) {
+      jit::JitOptions.disableLoopUnrolling = false;
+    } else if (strcmp(str, "off") == 0) {
+      jit::JitOptions.disableLoopUnrolling = true;
+    } else {
+      return OptionFailure("ion-loop-unrolling", str);
+    }
+  }
+
   if (const char* str = op.getStringOption("ion-edgecase-analysis")) {
     if (strcmp(str, "on") == 0) {
       jit::JitOptions.disableEdgeCaseAnalysis = false;
@@ -13745,6 +13772,16 @@ bool SetContextJITOptions(JSContext* cx, const OptionParser& op) {
     }
   }
 
+  if (const char* str = op.getStringOption("ion-fast-tier")) {
+    if (strcmp(str, "on") == 0) {
+      jit::JitOptions.ionFastTier = true;
+    } else if (strcmp(str, "off") == 0) {
+      jit::JitOptions.ionFastTier = false;
+    } else {
+      return OptionFailure("ion-fast-tier", str);
+    }
+  }
+
   int32_t warmUpThreshold = op.getIntOption("ion-warmup-threshold");
   if (warmUpThreshold >= 0) {
     jit::JitOptions.setNormalIonWarmUpThreshold(warmUpThreshold);
@@ -13870,6 +13907,22 @@ bool SetContextJITOptions(JSContext* cx, const OptionParser& op) {
   }
   cx->runtime()->setOffthreadIonCompilationEnabled(offthreadCompilation);
 
+  if (const char* str = op.getStringOption("baseline-offthread-compile")) {
+    if (strcmp(str, "on") == 0) {
+      jit::JitOptions.baselineOffThreadCompilation = true;
+    } else if (strcmp(str, "off") == 0) {
+      jit::JitOptions.baselineOffThreadCompilation = false;
+    } else {
+      return OptionFailure("baseline-offthread-compile", str);
+    }
+  }
+
+  int32_t baselineBatchSize = op.getIntOption("baseline-batch-size");
+  if (baselineBatchSize >= 0) {
+    jit::JitOptions.baselineBatchSize =
+        std::max(uint32_t(baselineBatchSize), uint32_t(1));
+  }
+
   if (op.getStringOption("ion-parallel-compile")) {
     fprintf(stderr,
             "--ion-parallel-compile is deprecated. Please use "
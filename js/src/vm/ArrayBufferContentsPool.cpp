@@ -0,0 +1,83 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "vm/ArrayBufferContentsPool.h"
+
+#include "mozilla/Assertions.h"  // MOZ_ASSERT
+
+#include "js/Utility.h"           // js_free
+#include "threading/LockGuard.h"  // js::LockGuard
+#include "vm/MutexIDs.h"          // mutexid
+
+using namespace js;
+
+ArrayBufferContentsPool::ArrayBufferContentsPool()
+    : lock_(mutexid::ArrayBufferContentsPool) {}
+
+ArrayBufferContentsPool::~ArrayBufferContentsPool() { purge(); }
+
+uint8_t* ArrayBufferContentsPool::take(size_t nbytes) {
+  MOZ_ASSERT(isPoolableSize(nbytes));
+
+  // Don't hand out contents much larger than requested, as the buffer only
+  // accounts for |nbytes| of them.
+  size_t maxBytes = nbytes + nbytes / 4;
+
+  LockGuard<Mutex> guard(lock_);
+
+  size_t best = count_;
+  for (size_t i = 0; i < count_; i++) {
+    size_t size = entries_[i].nbytes;
+    if (size >= nbytes && size <= maxBytes &&
+        (best == count_ || size < entries_[best].nbytes)) {
+      best = i;
+    }
+  }
+  if (best == count_) {
+    return nullptr;
+  }
+
+  uint8_t* data = entries_[best].data;
+  pooledBytes_ -= entries_[best].nbytes;
+  entries_[best] = entries_[--count_];
+  return data;
+}
+
+bool ArrayBufferContentsPool::put(uint8_t* data, size_t nbytes) {
+  MOZ_ASSERT(data);
+  MOZ_ASSERT(isPoolableSize(nbytes));
+
+  LockGuard<Mutex> guard(lock_);
+
+  if (count_ == MaxEntries || pooledBytes_ + nbytes > MaxPooledBytes) {
+    return false;
+  }
+
+  entries_[count_++] = Entry{data, nbytes};
+  pooledBytes_ += nbytes;
+  return true;
+}
+
+void ArrayBufferContentsPool::purge() {
+  LockGuard<Mutex> guard(lock_);
+
+  for (size_t i = 0; i < count_; i++) {
+    js_free(entries_[i].data);
+  }
+  count_ = 0;
+  pooledBytes_ = 0;
+}
+
+size_t ArrayBufferContentsPool::sizeOfExcludingThis(
+    mozilla::MallocSizeOf mallocSizeOf) {
+  LockGuard<Mutex> guard(lock_);
+
+  size_t size = 0;
+  for (size_t i = 0; i < count_; i++) {
+    size += mallocSizeOf(entries_[i].data);
+  }
+  return size;
+}
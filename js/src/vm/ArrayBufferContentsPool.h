@@ -0,0 +1,78 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef vm_ArrayBufferContentsPool_h
+#define vm_ArrayBufferContentsPool_h
+
+#include "mozilla/MemoryReporting.h"  // mozilla::MallocSizeOf
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t
+
+#include "threading/Mutex.h"  // js::Mutex
+
+namespace js {
+
+// A pool of the contents of recently finalized large ArrayBuffers.
+//
+// Code which streams data through ArrayBuffers allocates and drops buffers of
+// the same few sizes over and over. Each large allocation is mapped separately
+// by the allocator, and faulting in and zeroing the fresh pages dominates the
+// cost of the allocation. Reusing the contents of buffers which were freed by
+// the last GC avoids this.
+//
+// The contents are only retained until the start of the next major GC, so the
+// pool holds memory for at most one GC cycle. Buffers which reuse pooled
+// contents are accounted for the memory like any other malloced buffer.
+//
+// Contents can be returned to the pool from background finalization, so the
+// pool is protected by a mutex.
+class ArrayBufferContentsPool {
+ public:
+  // Only contents within these sizes are pooled.
+  static constexpr size_t MinPooledSize = 1024 * 1024;
+  static constexpr size_t MaxPooledSize = 32 * 1024 * 1024;
+
+  // Limits on what the pool can hold.
+  static constexpr size_t MaxEntries = 8;
+  static constexpr size_t MaxPooledBytes = 64 * 1024 * 1024;
+
+  ArrayBufferContentsPool();
+  ~ArrayBufferContentsPool();
+
+  static bool isPoolableSize(size_t nbytes) {
+    return nbytes >= MinPooledSize && nbytes <= MaxPooledSize;
+  }
+
+  // Remove and return pooled contents of at least |nbytes|, or nullptr if
+  // there are none of about that size. The contents are uninitialized.
+  uint8_t* take(size_t nbytes);
+
+  // Retain |data|, which was allocated in js::ArrayBufferContentsArena with at
+  // least |nbytes|. Returns false if the pool is full, in which case the caller
+  // still owns |data|.
+  bool put(uint8_t* data, size_t nbytes);
+
+  // Free all the pooled contents.
+  void purge();
+
+  size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
+
+ private:
+  struct Entry {
+    uint8_t* data;
+    size_t nbytes;
+  };
+
+  Mutex lock_;
+  Entry entries_[MaxEntries] = {};
+  size_t count_ = 0;
+  size_t pooledBytes_ = 0;
+};
+
+}  // namespace js
+
+#endif /* vm_ArrayBufferContentsPool_h */
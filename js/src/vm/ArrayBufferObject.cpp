@@ -817,8 +817,22 @@ bool ArrayBufferObject::class_constructor(JSContext* cx, unsigned argc,
 
 using ArrayBufferContents = UniquePtr<uint8_t[], JS::FreePolicy>;
 
+// Take the contents of a buffer finalized by the last GC, if there are some of
+// about |nbytes|. This is only done for large buffers.
+static uint8_t* MaybeTakePooledArrayBufferContents(JSContext* cx,
+                                                   size_t nbytes) {
+  if (!ArrayBufferContentsPool::isPoolableSize(nbytes)) {
+    return nullptr;
+  }
+  return cx->runtime()->arrayBufferContentsPool.take(nbytes);
+}
+
 static ArrayBufferContents AllocateUninitializedArrayBufferContents(
     JSContext* cx, size_t nbytes) {
+  if (uint8_t* p = MaybeTakePooledArrayBufferContents(cx, nbytes)) {
+    return ArrayBufferContents(p);
+  }
+
   // First attempt a normal allocation.
   uint8_t* p =
       cx->maybe_pod_arena_malloc<uint8_t>(js::ArrayBufferContentsArena, nbytes);
@@ -839,6 +853,12 @@ static ArrayBufferContents AllocateUninitializedArrayBufferContents(
 
 static ArrayBufferContents AllocateArrayBufferContents(JSContext* cx,
                                                        size_t nbytes) {
+  // Zeroing reused contents is cheaper than faulting in fresh pages.
+  if (uint8_t* p = MaybeTakePooledArrayBufferContents(cx, nbytes)) {
+    memset(p, 0, nbytes);
+    return ArrayBufferContents(p);
+  }
+
   // First attempt a normal allocation.
   uint8_t* p =
       cx->maybe_pod_arena_calloc<uint8_t>(js::ArrayBufferContentsArena, nbytes);
@@ -1436,6 +1456,15 @@ void ArrayBufferObject::releaseData(JS::GCContext* gcx) {
       // Inline data doesn't require releasing.
       break;
     case MALLOCED_ARRAYBUFFER_CONTENTS_ARENA:
+      // Keep large contents for reuse by new buffers.
+      if (ArrayBufferContentsPool::isPoolableSize(associatedBytes()) &&
+          gcx->runtimeFromAnyThread()->arrayBufferContentsPool.put(
+              dataPointer(), associatedBytes())) {
+        gcx->removeCellMemory(this, associatedBytes(),
+                              MemoryUse::ArrayBufferContents);
+        break;
+      }
+      [[fallthrough]];
     case MALLOCED_UNKNOWN_ARENA:
       gcx->free_(this, dataPointer(), associatedBytes(),
                  MemoryUse::ArrayBufferContents);
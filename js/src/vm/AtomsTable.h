@@ -20,6 +20,12 @@
 /*
  * The atoms table is a mapping from strings to JSAtoms that supports
  * incremental sweeping.
+ *
+ * Each runtime has its own atoms table, which is only used from the runtime's
+ * main thread and is not locked. Off-thread compilation produces ParserAtoms,
+ * which are only atomized when the stencil is instantiated on the main thread,
+ * and workers have their own runtimes. Permanent atoms are shared between
+ * runtimes in a FrozenAtomSet, which can be read from any thread.
  */
 
 namespace js {
@@ -92,6 +92,7 @@
 #include "mozilla/Try.h"
 #include "mozilla/WrappingOperations.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -456,15 +457,22 @@ void BigInt::multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
                                 unsigned accumulatorIndex) {
   MOZ_ASSERT(accumulator->digitLength() >
              multiplicand->digitLength() + accumulatorIndex);
+  multiplyAccumulate(multiplicand->digits(), multiplier,
+                     accumulator->digits().From(accumulatorIndex));
+}
+
+void BigInt::multiplyAccumulate(ConstDigits multiplicand, Digit multiplier,
+                                Digits accumulator) {
+  MOZ_ASSERT(accumulator.Length() > multiplicand.Length());
   if (!multiplier) {
     return;
   }
 
   Digit carry = 0;
   Digit high = 0;
-  for (unsigned i = 0; i < multiplicand->digitLength();
-       i++, accumulatorIndex++) {
-    Digit acc = accumulator->digit(accumulatorIndex);
+  size_t accumulatorIndex = 0;
+  for (size_t i = 0; i < multiplicand.Length(); i++, accumulatorIndex++) {
+    Digit acc = accumulator[accumulatorIndex];
     Digit newCarry = 0;
 
     // Add last round's carryovers.
@@ -472,28 +480,216 @@ void BigInt::multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
     acc = digitAdd(acc, carry, &newCarry);
 
     // Compute this round's multiplication.
-    Digit multiplicandDigit = multiplicand->digit(i);
+    Digit multiplicandDigit = multiplicand[i];
     Digit low = digitMul(multiplier, multiplicandDigit, &high);
     acc = digitAdd(acc, low, &newCarry);
 
     // Store result and prepare for next round.
-    accumulator->setDigit(accumulatorIndex, acc);
+    accumulator[accumulatorIndex] = acc;
     carry = newCarry;
   }
 
   while (carry || high) {
-    MOZ_ASSERT(accumulatorIndex < accumulator->digitLength());
-    Digit acc = accumulator->digit(accumulatorIndex);
+    MOZ_ASSERT(accumulatorIndex < accumulator.Length());
+    Digit acc = accumulator[accumulatorIndex];
     Digit newCarry = 0;
     acc = digitAdd(acc, high, &newCarry);
     high = 0;
     acc = digitAdd(acc, carry, &newCarry);
-    accumulator->setDigit(accumulatorIndex, acc);
+    accumulator[accumulatorIndex] = acc;
     carry = newCarry;
     accumulatorIndex++;
   }
 }
 
+BigInt::Digit BigInt::inplaceAddDigits(Digits x, ConstDigits y) {
+  MOZ_ASSERT(x.Length() >= y.Length());
+  Digit carry = 0;
+  size_t i = 0;
+  for (; i < y.Length(); i++) {
+    Digit newCarry = 0;
+    Digit sum = digitAdd(x[i], y[i], &newCarry);
+    x[i] = digitAdd(sum, carry, &newCarry);
+    carry = newCarry;
+  }
+  for (; carry && i < x.Length(); i++) {
+    Digit newCarry = 0;
+    x[i] = digitAdd(x[i], carry, &newCarry);
+    carry = newCarry;
+  }
+  return carry;
+}
+
+BigInt::Digit BigInt::inplaceSubDigits(Digits x, ConstDigits y) {
+  MOZ_ASSERT(x.Length() >= y.Length());
+  Digit borrow = 0;
+  size_t i = 0;
+  for (; i < y.Length(); i++) {
+    Digit newBorrow = 0;
+    Digit difference = digitSub(x[i], y[i], &newBorrow);
+    x[i] = digitSub(difference, borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  for (; borrow && i < x.Length(); i++) {
+    Digit newBorrow = 0;
+    x[i] = digitSub(x[i], borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  return borrow;
+}
+
+bool BigInt::absoluteDifferenceDigits(ConstDigits x, ConstDigits y,
+                                      Digits result) {
+  MOZ_ASSERT(result.Length() >= x.Length());
+  MOZ_ASSERT(result.Length() >= y.Length());
+
+  // Compare the operands, ignoring their leading zeroes.
+  size_t i = std::max(x.Length(), y.Length());
+  Digit xDigit = 0;
+  Digit yDigit = 0;
+  while (i > 0) {
+    i--;
+    xDigit = i < x.Length() ? x[i] : 0;
+    yDigit = i < y.Length() ? y[i] : 0;
+    if (xDigit != yDigit) {
+      break;
+    }
+  }
+  bool xIsSmaller = xDigit < yDigit;
+  if (xIsSmaller) {
+    std::swap(x, y);
+  }
+
+  std::fill(std::copy(x.begin(), x.end(), result.begin()), result.end(), 0);
+  MOZ_ALWAYS_FALSE(inplaceSubDigits(result, y));
+  return xIsSmaller;
+}
+
+void BigInt::schoolbookMultiply(ConstDigits x, ConstDigits y, Digits result) {
+  MOZ_ASSERT(result.Length() == x.Length() + y.Length());
+  std::fill(result.begin(), result.end(), 0);
+  for (size_t i = 0; i < x.Length(); i++) {
+    multiplyAccumulate(y, x[i], result.From(i));
+  }
+}
+
+size_t BigInt::karatsubaScratchLength(size_t length) {
+  if (length < KaratsubaThreshold) {
+    return 0;
+  }
+  size_t highLength = length - length / 2;
+  return 4 * highLength +
+         std::max(karatsubaScratchLength(highLength), 2 * highLength + 1);
+}
+
+size_t BigInt::multiplyScratchLength(size_t xLength, size_t yLength) {
+  if (xLength < yLength) {
+    std::swap(xLength, yLength);
+  }
+  if (yLength < KaratsubaThreshold) {
+    return 0;
+  }
+  if (xLength == yLength) {
+    return karatsubaScratchLength(yLength);
+  }
+
+  // See multiplyDigits for the use of the scratch space of unbalanced
+  // operands.
+  size_t scratchLength = karatsubaScratchLength(yLength);
+  if (size_t lastChunkLength = xLength % yLength) {
+    scratchLength = std::max(scratchLength,
+                             multiplyScratchLength(yLength, lastChunkLength));
+  }
+  return 2 * yLength + scratchLength;
+}
+
+void BigInt::multiplyDigits(ConstDigits x, ConstDigits y, Digits result,
+                            Digits scratch) {
+  MOZ_ASSERT(result.Length() == x.Length() + y.Length());
+  MOZ_ASSERT(scratch.Length() >= multiplyScratchLength(x.Length(), y.Length()));
+
+  if (x.Length() < y.Length()) {
+    std::swap(x, y);
+  }
+  if (y.Length() < KaratsubaThreshold) {
+    schoolbookMultiply(x, y, result);
+    return;
+  }
+  if (x.Length() == y.Length()) {
+    karatsubaMultiply(x, y, result, scratch);
+    return;
+  }
+
+  // Split the longer operand in chunks as long as the shorter one, and add the
+  // product of each chunk with the shorter operand to the result.
+  size_t chunkLength = y.Length();
+  Digits product = scratch.To(2 * chunkLength);
+  Digits productScratch = scratch.From(2 * chunkLength);
+  std::fill(result.begin(), result.end(), 0);
+  for (size_t offset = 0; offset < x.Length(); offset += chunkLength) {
+    ConstDigits chunk =
+        x.Subspan(offset, std::min(chunkLength, x.Length() - offset));
+    Digits chunkProduct = product.To(chunk.Length() + chunkLength);
+    multiplyDigits(chunk, y, chunkProduct, productScratch);
+    MOZ_ALWAYS_FALSE(inplaceAddDigits(result.From(offset), chunkProduct));
+  }
+}
+
+// Karatsuba multiplication of operands of the same length, split in a low
+// half `x0`, `y0` and a high half `x1`, `y1`:
+//
+//   x * y = x1 * y1 * B^2k + (x0 * y1 + x1 * y0) * B^k + x0 * y0
+//
+// where the middle term is computed from the other two with a single
+// multiplication, as `(x0 - x1) * (y1 - y0) + x0 * y0 + x1 * y1`.
+void BigInt::karatsubaMultiply(ConstDigits x, ConstDigits y, Digits result,
+                               Digits scratch) {
+  MOZ_ASSERT(x.Length() == y.Length());
+  MOZ_ASSERT(result.Length() == 2 * x.Length());
+
+  size_t length = x.Length();
+  if (length < KaratsubaThreshold) {
+    schoolbookMultiply(x, y, result);
+    return;
+  }
+  MOZ_ASSERT(scratch.Length() >= karatsubaScratchLength(length));
+
+  size_t lowLength = length / 2;
+  size_t highLength = length - lowLength;
+  ConstDigits x0 = x.To(lowLength);
+  ConstDigits x1 = x.From(lowLength);
+  ConstDigits y0 = y.To(lowLength);
+  ConstDigits y1 = y.From(lowLength);
+
+  // The low and high products are stored in place in the result.
+  Digits low = result.To(2 * lowLength);
+  Digits high = result.From(2 * lowLength);
+  karatsubaMultiply(x0, y0, low, scratch);
+  karatsubaMultiply(x1, y1, high, scratch);
+
+  Digits xDifference = scratch.To(highLength);
+  Digits yDifference = scratch.Subspan(highLength, highLength);
+  Digits product = scratch.Subspan(2 * highLength, 2 * highLength);
+  Digits productScratch = scratch.From(4 * highLength);
+  bool xNegative = absoluteDifferenceDigits(x0, x1, xDifference);
+  bool yNegative = absoluteDifferenceDigits(y1, y0, yDifference);
+  karatsubaMultiply(xDifference, yDifference, product, productScratch);
+
+  // The middle term is non-negative, and fits in one more digit than the high
+  // product.
+  Digits middle = productScratch.To(2 * highLength + 1);
+  std::fill(std::copy(low.begin(), low.end(), middle.begin()), middle.end(),
+            0);
+  MOZ_ALWAYS_FALSE(inplaceAddDigits(middle, high));
+  if (xNegative == yNegative) {
+    MOZ_ALWAYS_FALSE(inplaceAddDigits(middle, product));
+  } else {
+    MOZ_ALWAYS_FALSE(inplaceSubDigits(middle, product));
+  }
+
+  MOZ_ALWAYS_FALSE(inplaceAddDigits(result.From(lowLength), middle));
+}
+
 inline int8_t BigInt::absoluteCompare(const BigInt* x, const BigInt* y) {
   MOZ_ASSERT(!HasLeadingZeroes(x));
   MOZ_ASSERT(!HasLeadingZeroes(y));
@@ -1878,14 +2074,27 @@ BigInt* BigInt::mul(JSContext* cx, HandleBigInt x, HandleBigInt y) {
   }
 
   unsigned resultLength = x->digitLength() + y->digitLength();
-  BigInt* result = createUninitialized(cx, resultLength, resultNegative);
+  Rooted<BigInt*> result(cx,
+                         createUninitialized(cx, resultLength, resultNegative));
   if (!result) {
     return nullptr;
   }
-  result->initializeDigitsToZero();
 
-  for (size_t i = 0; i < x->digitLength(); i++) {
-    multiplyAccumulate(y, x->digit(i), result, i);
+  size_t scratchLength =
+      multiplyScratchLength(x->digitLength(), y->digitLength());
+  if (scratchLength == 0) {
+    result->initializeDigitsToZero();
+
+    for (size_t i = 0; i < x->digitLength(); i++) {
+      multiplyAccumulate(y, x->digit(i), result, i);
+    }
+  } else {
+    auto scratch = cx->make_pod_array<Digit>(scratchLength);
+    if (!scratch) {
+      return nullptr;
+    }
+    multiplyDigits(x->digits(), y->digits(), result->digits(),
+                   Digits(scratch.get(), scratchLength));
   }
 
   return destructivelyTrimHighZeroDigits(cx, result);
@@ -327,6 +327,35 @@ class BigInt final : public js::gc::CellWithLengthAndFlags {
   static void multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
                                  BigInt* accumulator,
                                  unsigned accumulatorIndex);
+  static void multiplyAccumulate(ConstDigits multiplicand, Digit multiplier,
+                                 Digits accumulator);
+
+  // Operands with at least this many digits are multiplied with the Karatsuba
+  // algorithm instead of the schoolbook algorithm.
+  static constexpr size_t KaratsubaThreshold = 34;
+
+  // Return the number of scratch digits used by multiplyDigits and
+  // karatsubaMultiply.
+  static size_t multiplyScratchLength(size_t xLength, size_t yLength);
+  static size_t karatsubaScratchLength(size_t length);
+
+  // Compute `x * y` into `result`, which has `x.Length() + y.Length()` digits,
+  // using `scratch` for intermediate results.
+  static void multiplyDigits(ConstDigits x, ConstDigits y, Digits result,
+                             Digits scratch);
+  static void schoolbookMultiply(ConstDigits x, ConstDigits y, Digits result);
+  static void karatsubaMultiply(ConstDigits x, ConstDigits y, Digits result,
+                                Digits scratch);
+
+  // Add `y` to `x`, or subtract it from `x`, in place, with the precondition
+  // that `x.Length() >= y.Length()`. Return the carry or borrow.
+  static Digit inplaceAddDigits(Digits x, ConstDigits y);
+  static Digit inplaceSubDigits(Digits x, ConstDigits y);
+
+  // Compute `|x - y|` into `result`, which is at least as long as `x` and `y`.
+  // Return whether `x < y`.
+  static bool absoluteDifferenceDigits(ConstDigits x, ConstDigits y,
+                                       Digits result);
   static bool absoluteDivWithBigIntDivisor(
       JSContext* cx, Handle<BigInt*> dividend, Handle<BigInt*> divisor,
       const mozilla::Maybe<MutableHandle<BigInt*>>& quotient,
@@ -19,6 +19,7 @@
 #include "js/RootingAPI.h"
 #include "js/TypeDecls.h"
 #include "vm/JSScript.h"
+#include "vm/RegExpBytecodeCache.h"
 #include "vm/Shape.h"
 #include "vm/StencilCache.h"  // js::DelazificationCache
 #include "vm/StringType.h"
@@ -619,6 +620,10 @@ class RuntimeCaches {
   EvalCache evalCache;
   StringToAtomCache stringToAtomCache;
 
+  // This cache doesn't contain any GC pointer, and it is only purged on
+  // shrinking GCs, see GCRuntime::purgeRuntime.
+  RegExpBytecodeCache regExpBytecodeCache;
+
 #ifdef MOZ_EXECUTION_TRACING
   TracingCaches tracingCaches;
 #endif
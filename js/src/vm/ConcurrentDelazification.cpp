@@ -11,8 +11,9 @@
 #include "mozilla/ReverseIterator.h"  // mozilla::Reversed
 #include "mozilla/ScopeExit.h"        // mozilla::MakeScopeExit
 
-#include <stddef.h>  // size_t
-#include <utility>   // std::swap, std::move, std::pair
+#include <algorithm>  // std::sort
+#include <stddef.h>   // size_t
+#include <utility>    // std::swap, std::move, std::pair
 
 #include "ds/LifoAlloc.h"  // LifoAlloc
 #include "frontend/BytecodeCompiler.h"  // DelazifyCanonicalScriptedFunction, DelazifyFailureReason
@@ -142,8 +143,64 @@ bool LargeFirstDelazification::insert(ScriptIndex index,
   return true;
 }
 
+bool PartitionedDelazification::insert(ScriptIndex index,
+                                       frontend::ScriptStencilRef& ref) {
+  if (partitioned) {
+    return stack.append(index);
+  }
+
+  const frontend::ScriptStencilExtra& extra = ref.scriptExtra();
+  SourceSize size = extra.extent.sourceEnd - extra.extent.sourceStart;
+  return pending.append(std::pair(size, index));
+}
+
+bool PartitionedDelazification::partition(size_t taskIndex, size_t numTasks) {
+  MOZ_ASSERT(!partitioned);
+  MOZ_ASSERT(taskIndex < numTasks);
+  partitioned = true;
+
+  // Assign the largest functions first, each to the task which has the least
+  // amount of source so far. Every task computes the same assignment.
+  Vector<size_t, 0, SystemAllocPolicy> order;
+  Vector<uint64_t, 0, SystemAllocPolicy> loads;
+  Vector<bool, 0, SystemAllocPolicy> owned;
+  if (!order.resize(pending.length()) || !owned.resize(pending.length()) ||
+      !loads.appendN(0, numTasks)) {
+    return false;
+  }
+  for (size_t i = 0; i < order.length(); i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (pending[a].first != pending[b].first) {
+      return pending[a].first > pending[b].first;
+    }
+    return a < b;
+  });
+  for (size_t i : order) {
+    size_t task = 0;
+    for (size_t t = 1; t < numTasks; t++) {
+      if (loads[t] < loads[task]) {
+        task = t;
+      }
+    }
+    loads[task] += pending[i].first;
+    owned[i] = task == taskIndex;
+  }
+
+  // Keep the insertion order, such that our share is popped in source order.
+  for (size_t i = 0; i < pending.length(); i++) {
+    if (owned[i] && !stack.append(pending[i].second)) {
+      return false;
+    }
+  }
+  pending.clearAndFree();
+  return true;
+}
+
 bool DelazificationContext::init(const JS::ReadOnlyCompileOptions& options,
-                                 const frontend::CompilationStencil& stencil) {
+                                 const frontend::CompilationStencil& stencil,
+                                 size_t taskIndex, size_t numTasks) {
   using namespace js::frontend;
 
   RefPtr<ScriptSource> source(stencil.source);
@@ -183,6 +240,11 @@ bool DelazificationContext::init(const JS::ReadOnlyCompileOptions& options,
       // largest function first.
       strategy_ = fc_.getAllocator()->make_unique<LargeFirstDelazification>();
       break;
+    case JS::DelazificationOption::ConcurrentParallel:
+      // ConcurrentParallel visit a share of the functions to be delazified,
+      // while other contexts are visiting the rest.
+      strategy_ = fc_.getAllocator()->make_unique<PartitionedDelazification>();
+      break;
     case JS::DelazificationOption::ParseEverythingEagerly:
       // ParseEverythingEagerly parse all functions eagerly, thus leaving no
       // functions to be parsed on demand.
@@ -198,7 +260,23 @@ bool DelazificationContext::init(const JS::ReadOnlyCompileOptions& options,
   // Queue functions from the top-level to be delazify.
   BorrowingCompilationStencil borrow(merger_.getResult());
   ScriptIndex topLevel{0};
-  return strategy_->add(&fc_, borrow, topLevel);
+  if (!strategy_->add(&fc_, borrow, topLevel)) {
+    return false;
+  }
+
+  if (options.eagerDelazificationStrategy() ==
+      JS::DelazificationOption::ConcurrentParallel) {
+    auto* partitioned =
+        static_cast<PartitionedDelazification*>(strategy_.get());
+    if (!partitioned->partition(taskIndex, numTasks)) {
+      ReportOutOfMemory(&fc_);
+      return false;
+    }
+  } else {
+    MOZ_ASSERT(taskIndex == 0 && numTasks == 1);
+  }
+
+  return true;
 }
 
 bool DelazificationContext::delazify() {
@@ -100,6 +100,38 @@ struct LargeFirstDelazification final : public DelazifyStrategy {
   bool insert(ScriptIndex, frontend::ScriptStencilRef&) override;
 };
 
+// Delazify a share of the functions, such that multiple helper threads can
+// delazify the same script in parallel.
+//
+// The functions inserted while adding the top-level script are held back
+// until `partition` is called. They are then divided between the tasks,
+// balancing the source size given to each task, and every task would visit
+// its own share depth first, in source order. Inner functions are never
+// shared, as delazifying them requires the enclosing function to be merged
+// in the same CompilationStencilMerger.
+//
+// Hypothesis: Large bundles are mostly made of independent top-level
+// functions, such that spreading them over all cores reduces the time to
+// delazify the whole script.
+struct PartitionedDelazification final : public DelazifyStrategy {
+  using SourceSize = uint32_t;
+  Vector<std::pair<SourceSize, ScriptIndex>, 0, SystemAllocPolicy> pending;
+  Vector<ScriptIndex, 0, SystemAllocPolicy> stack;
+  bool partitioned = false;
+
+  bool done() const override { return stack.empty(); }
+  ScriptIndex next() override { return stack.popCopy(); }
+  void clear() override {
+    pending.clear();
+    stack.clear();
+  }
+  bool insert(ScriptIndex index, frontend::ScriptStencilRef& ref) override;
+
+  // Keep the share of the pending functions given to the task `taskIndex` out
+  // of `numTasks`.
+  [[nodiscard]] bool partition(size_t taskIndex, size_t numTasks);
+};
+
 class DelazificationContext {
   const JS::PrefableCompileOptions initialPrefableOptions_;
 
@@ -124,8 +156,12 @@ class DelazificationContext {
       : initialPrefableOptions_(initialPrefableOptions),
         stackQuota_(stackQuota) {}
 
+  // With the ConcurrentParallel strategy, the functions to delazify are
+  // divided between `numTasks` contexts, and this one handles the share of
+  // `taskIndex`.
   bool init(const JS::ReadOnlyCompileOptions& options,
-            const frontend::CompilationStencil& stencil);
+            const frontend::CompilationStencil& stencil, size_t taskIndex,
+            size_t numTasks);
   bool delazify();
 
   // This function is called by `delazify` function to know whether the
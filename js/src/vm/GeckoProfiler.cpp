@@ -88,7 +88,11 @@ void GeckoProfilerRuntime::enable(bool enabled) {
   // (and thus, a new circular buffer). Set all current entries in the
   // JitcodeGlobalTable as expired and reset the buffer range start.
   if (rt->hasJitRuntime() && rt->jitRuntime()->hasJitcodeGlobalTable()) {
-    rt->jitRuntime()->getJitcodeGlobalTable()->setAllEntriesAsExpired();
+    jit::JitcodeGlobalTable* table = rt->jitRuntime()->getJitcodeGlobalTable();
+    table->setAllEntriesAsExpired();
+    if (!enabled) {
+      table->releaseSamplerIndex();
+    }
   }
   rt->setProfilerSampleBufferRangeStart(0);
 
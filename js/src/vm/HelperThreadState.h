@@ -59,6 +59,7 @@ struct PromiseHelperTask;
 class PromiseObject;
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 }  // namespace jit
@@ -119,6 +120,8 @@ class GlobalHelperThreadState {
       Vector<jit::IonCompileTask*, 0, SystemAllocPolicy>;
   using IonFreeTaskVector =
       Vector<js::UniquePtr<jit::IonFreeTask>, 0, SystemAllocPolicy>;
+  using BaselineCompileTaskVector =
+      Vector<jit::BaselineCompileTask*, 0, SystemAllocPolicy>;
   using DelazifyTaskList = mozilla::LinkedList<DelazifyTask>;
   using FreeDelazifyTaskVector =
       Vector<js::UniquePtr<FreeDelazifyTask>, 1, SystemAllocPolicy>;
@@ -148,6 +151,9 @@ class GlobalHelperThreadState {
   IonCompileTaskVector ionWorklist_, ionFinishedList_;
   IonFreeTaskVector ionFreeList_;
 
+  // Baseline compilation worklist and finished jobs.
+  BaselineCompileTaskVector baselineWorklist_, baselineFinishedList_;
+
   // wasm worklists.
   wasm::CompileTaskPtrFifo wasmWorklist_tier1_;
   wasm::CompileTaskPtrFifo wasmWorklist_tier2_;
@@ -219,6 +225,7 @@ class GlobalHelperThreadState {
 
   size_t maxIonCompilationThreads() const;
   size_t maxIonFreeThreads() const;
+  size_t maxBaselineCompilationThreads() const;
   size_t maxWasmCompilationThreads() const;
   size_t maxWasmCompleteTier2GeneratorThreads() const;
   size_t maxWasmPartialTier2CompileThreads() const;
@@ -227,6 +234,12 @@ class GlobalHelperThreadState {
   size_t maxCompressionThreads() const;
   size_t maxGCParallelThreads() const;
 
+  // The number of helper threads that aren't running a task.
+  size_t idleThreadCount(const AutoLockHelperThreadState& lock) const {
+    MOZ_ASSERT(threadCount >= totalCountRunningTasks);
+    return threadCount - totalCountRunningTasks;
+  }
+
   GlobalHelperThreadState();
 
   bool isInitialized(const AutoLockHelperThreadState& lock) const {
@@ -289,6 +302,15 @@ class GlobalHelperThreadState {
     return ionFreeList_;
   }
 
+  BaselineCompileTaskVector& baselineWorklist(
+      const AutoLockHelperThreadState&) {
+    return baselineWorklist_;
+  }
+  BaselineCompileTaskVector& baselineFinishedList(
+      const AutoLockHelperThreadState&) {
+    return baselineFinishedList_;
+  }
+
   wasm::CompileTaskPtrFifo& wasmWorklist(const AutoLockHelperThreadState&,
                                          wasm::CompileState state) {
     switch (state) {
@@ -372,6 +394,7 @@ class GlobalHelperThreadState {
   bool canStartPromiseHelperTask(const AutoLockHelperThreadState& lock);
   bool canStartIonCompileTask(const AutoLockHelperThreadState& lock);
   bool canStartIonFreeTask(const AutoLockHelperThreadState& lock);
+  bool canStartBaselineCompileTask(const AutoLockHelperThreadState& lock);
   bool canStartFreeDelazifyTask(const AutoLockHelperThreadState& lock);
   bool canStartDelazifyTask(const AutoLockHelperThreadState& lock);
   bool canStartCompressionTask(const AutoLockHelperThreadState& lock);
@@ -395,6 +418,8 @@ class GlobalHelperThreadState {
   HelperThreadTask* maybeGetLowPrioIonCompileTask(
       const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetIonFreeTask(const AutoLockHelperThreadState& lock);
+  HelperThreadTask* maybeGetBaselineCompileTask(
+      const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetFreeDelazifyTask(
       const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetDelazifyTask(const AutoLockHelperThreadState& lock);
@@ -438,6 +463,13 @@ class GlobalHelperThreadState {
 #endif
 
   void cancelOffThreadIonCompile(const CompilationSelector& selector);
+
+  // Remove the Baseline tasks matching |selector| from the lists (waiting for
+  // running ones to finish) and append them to |cancelled|. The caller must
+  // destroy them on the main thread after releasing the lock.
+  void cancelOffThreadBaselineCompile(const CompilationSelector& selector,
+                                      BaselineCompileTaskVector& cancelled,
+                                      AutoLockHelperThreadState& lock);
   void cancelOffThreadWasmCompleteTier2Generator(
       AutoLockHelperThreadState& lock);
   void cancelOffThreadWasmPartialTier2Compile(AutoLockHelperThreadState& lock);
@@ -461,6 +493,8 @@ class GlobalHelperThreadState {
                   const AutoLockHelperThreadState& lock);
   bool submitTask(jit::IonCompileTask* task,
                   const AutoLockHelperThreadState& locked);
+  bool submitTask(jit::BaselineCompileTask* task,
+                  const AutoLockHelperThreadState& locked);
   bool submitTask(UniquePtr<SourceCompressionTask> task,
                   const AutoLockHelperThreadState& locked);
   void submitTask(DelazifyTask* task, const AutoLockHelperThreadState& locked);
@@ -475,13 +509,35 @@ class GlobalHelperThreadState {
 
  private:
   HelperThreadTask* findHighestPriorityTask(
-      const AutoLockHelperThreadState& locked);
+      const AutoLockHelperThreadState& locked,
+      JS::HelperThreadTaskPriority* priority);
+
+  bool canStartBackgroundTask(const AutoLockHelperThreadState& lock) const;
 
   void runTaskLocked(HelperThreadTask* task, AutoLockHelperThreadState& lock);
 
   using Selector = HelperThreadTask* (
       GlobalHelperThreadState::*)(const AutoLockHelperThreadState&);
-  static const Selector selectors[];
+  struct SelectorEntry {
+    Selector selector;
+    JS::HelperThreadTaskPriority priority;
+  };
+  static const SelectorEntry selectors[];
+
+  // Number of running tasks which were dispatched with background priority.
+  // These are limited so that a thread is left for other tasks.
+  size_t runningBackgroundTaskCount = 0;
+
+  // Time tasks waited in the thread pool before running, by thread type.
+  mozilla::EnumeratedArray<ThreadType, JS::HelperThreadTaskWaitTimes,
+                           size_t(ThreadType::THREAD_TYPE_MAX)>
+      taskWaitTimes_;
+
+ public:
+  JS::HelperThreadTaskWaitTimes taskWaitTimes(
+      ThreadType threadType, const AutoLockHelperThreadState& lock) const {
+    return taskWaitTimes_[threadType];
+  }
 };
 
 static inline bool IsHelperThreadStateInitialized() {
@@ -515,21 +571,25 @@ struct DelazifyTask : public mozilla::LinkedListElement<DelazifyTask>,
 
   DelazificationContext delazificationCx;
 
-  // Create a new DelazifyTask and initialize it.
+  // Create a new DelazifyTask and initialize it. The task handles the share
+  // `taskIndex` of the functions divided between `numTasks` tasks, see
+  // DelazificationContext::init.
   //
   // In case of early failure, no errors are reported, as a DelazifyTask is an
   // optimization and the VM should remain working even without this
   // optimization in place.
   static UniquePtr<DelazifyTask> Create(
       JSRuntime* maybeRuntime, const JS::ReadOnlyCompileOptions& options,
-      const frontend::CompilationStencil& stencil);
+      const frontend::CompilationStencil& stencil, size_t taskIndex,
+      size_t numTasks);
 
   DelazifyTask(JSRuntime* maybeRuntime,
                const JS::PrefableCompileOptions& initialPrefableOptions);
   ~DelazifyTask();
 
   [[nodiscard]] bool init(const JS::ReadOnlyCompileOptions& options,
-                          const frontend::CompilationStencil& stencil);
+                          const frontend::CompilationStencil& stencil,
+                          size_t taskIndex, size_t numTasks);
 
   bool runtimeMatchesOrNoRuntime(JSRuntime* rt) {
     return !maybeRuntime || maybeRuntime == rt;
@@ -9,6 +9,7 @@
 
 #include "mozilla/TimeStamp.h"
 
+#include "js/HelperThreadAPI.h"
 #include "js/Utility.h"
 
 namespace js {
@@ -21,6 +22,7 @@ class GlobalHelperThreadState;
 class SourceCompressionTask;
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 }  // namespace jit
@@ -37,6 +39,11 @@ struct MapTypeToThreadType<jit::IonCompileTask> {
   static const ThreadType threadType = THREAD_TYPE_ION;
 };
 
+template <>
+struct MapTypeToThreadType<jit::BaselineCompileTask> {
+  static const ThreadType threadType = THREAD_TYPE_BASELINE;
+};
+
 template <>
 struct MapTypeToThreadType<wasm::CompleteTier2GeneratorTask> {
   static const ThreadType threadType =
@@ -75,6 +82,11 @@ class HelperThreadTask {
 
   virtual const char* getName() = 0;
 
+  // The priority this task was last dispatched with.
+  HelperThreadTaskPriority dispatchPriority() const {
+    return dispatchPriority_;
+  }
+
   template <typename T>
   bool is() {
     return js::MapTypeToThreadType<T>::threadType == threadType();
@@ -90,6 +102,13 @@ class HelperThreadTask {
   // Called when this task is dispatched to the thread pool.
   virtual void onThreadPoolDispatch() {}
   friend class js::AutoHelperTaskQueue;
+
+ private:
+  // The priority this task was dispatched with, and when it was dispatched.
+  // These are set by GlobalHelperThreadState::dispatch.
+  HelperThreadTaskPriority dispatchPriority_ = HelperThreadTaskPriority::Normal;
+  mozilla::TimeStamp dispatchTime_;
+  friend class js::GlobalHelperThreadState;
 };
 
 }  // namespace JS
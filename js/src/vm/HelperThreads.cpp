@@ -15,6 +15,7 @@
 #include "frontend/CompilationStencil.h"  // frontend::CompilationStencil
 #include "gc/GC.h"
 #include "gc/Zone.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/Ion.h"
 #include "jit/IonCompileTask.h"
 #include "jit/JitRuntime.h"
@@ -36,6 +37,7 @@
 using namespace js;
 
 using mozilla::TimeDuration;
+using mozilla::TimeStamp;
 
 static void CancelOffThreadWasmCompleteTier2GeneratorLocked(
     AutoLockHelperThreadState& lock);
@@ -142,6 +144,23 @@ JS_PUBLIC_API MOZ_NEVER_INLINE const char* JS::GetHelperThreadTaskName(
   return task->getName();
 }
 
+JS_PUBLIC_API MOZ_NEVER_INLINE JS::HelperThreadTaskPriority
+JS::GetHelperThreadTaskPriority(HelperThreadTask* task) {
+  return task->dispatchPriority();
+}
+
+JS_PUBLIC_API JS::HelperThreadTaskWaitTimes JS::GetHelperThreadTaskWaitTimes(
+    ThreadType threadType) {
+  MOZ_ASSERT(threadType < THREAD_TYPE_MAX);
+
+  AutoLockHelperThreadState lock;
+  if (!gHelperThreadState) {
+    return HelperThreadTaskWaitTimes();
+  }
+
+  return HelperThreadState().taskWaitTimes(threadType, lock);
+}
+
 void GlobalHelperThreadState::setDispatchTaskCallback(
     JS::HelperThreadTaskCallback callback, size_t threadCount, size_t stackSize,
     const AutoLockHelperThreadState& lock) {
@@ -258,12 +277,22 @@ void GlobalHelperThreadState::assertIsLockedByCurrentThread() const {
 }
 #endif  // DEBUG
 
+// Whether |task| counts against the limit on running background tasks. The
+// complete tier-2 generator is not counted, as it spends its time waiting on
+// the tier-2 compilation tasks it submits, which are themselves limited.
+static bool IsLimitedBackgroundTask(HelperThreadTask* task,
+                                    JS::HelperThreadTaskPriority priority) {
+  return priority == JS::HelperThreadTaskPriority::Background &&
+         !task->is<wasm::CompleteTier2GeneratorTask>();
+}
+
 void GlobalHelperThreadState::dispatch(const AutoLockHelperThreadState& lock) {
   if (helperTasks_.length() >= threadCount) {
     return;
   }
 
-  HelperThreadTask* task = findHighestPriorityTask(lock);
+  JS::HelperThreadTaskPriority priority;
+  HelperThreadTask* task = findHighestPriorityTask(lock, &priority);
   if (!task) {
     return;
   }
@@ -277,7 +306,12 @@ void GlobalHelperThreadState::dispatch(const AutoLockHelperThreadState& lock) {
   helperTasks(lock).infallibleEmplaceBack(task);
   runningTaskCount[task->threadType()]++;
   totalCountRunningTasks++;
+  if (IsLimitedBackgroundTask(task, priority)) {
+    runningBackgroundTaskCount++;
+  }
 
+  task->dispatchPriority_ = priority;
+  task->dispatchTime_ = TimeStamp::Now();
   lock.queueTaskToDispatch(task);
 }
 
@@ -328,6 +362,7 @@ void GlobalHelperThreadState::waitForAllTasksLocked(
   MOZ_ASSERT(promiseHelperTasks(lock).empty());
   MOZ_ASSERT(compressionWorklist(lock).empty());
   MOZ_ASSERT(ionFreeList(lock).empty());
+  MOZ_ASSERT(baselineWorklist(lock).empty());
   MOZ_ASSERT(wasmWorklist(lock, wasm::CompileState::EagerTier2).empty());
   MOZ_ASSERT(wasmCompleteTier2GeneratorWorklist(lock).empty());
   MOZ_ASSERT(wasmPartialTier2CompileWorklist(lock).empty());
@@ -401,6 +436,8 @@ void GlobalHelperThreadState::addSizeOfIncludingThis(
       ionWorklist_.sizeOfExcludingThis(mallocSizeOf) +
       ionFinishedList_.sizeOfExcludingThis(mallocSizeOf) +
       ionFreeList_.sizeOfExcludingThis(mallocSizeOf) +
+      baselineWorklist_.sizeOfExcludingThis(mallocSizeOf) +
+      baselineFinishedList_.sizeOfExcludingThis(mallocSizeOf) +
       wasmWorklist_tier1_.sizeOfExcludingThis(mallocSizeOf) +
       wasmWorklist_tier2_.sizeOfExcludingThis(mallocSizeOf) +
       wasmCompleteTier2GeneratorWorklist_.sizeOfExcludingThis(mallocSizeOf) +
@@ -453,6 +490,13 @@ size_t GlobalHelperThreadState::maxIonFreeThreads() const {
   return 1;
 }
 
+size_t GlobalHelperThreadState::maxBaselineCompilationThreads() const {
+  if (IsHelperThreadSimulatingOOM(js::THREAD_TYPE_BASELINE)) {
+    return 1;
+  }
+  return threadCount;
+}
+
 size_t GlobalHelperThreadState::maxPromiseHelperThreads() const {
   if (IsHelperThreadSimulatingOOM(js::THREAD_TYPE_PROMISE_TASK)) {
     return 1;
@@ -556,24 +600,49 @@ void GlobalHelperThreadState::trace(JSTracer* trc) {
 
 // Definition of helper thread tasks.
 //
-// Priority is determined by the order they're listed here.
-const GlobalHelperThreadState::Selector GlobalHelperThreadState::selectors[] = {
-    &GlobalHelperThreadState::maybeGetGCParallelTask,
-    &GlobalHelperThreadState::maybeGetIonCompileTask,
-    &GlobalHelperThreadState::maybeGetWasmTier1CompileTask,
-    &GlobalHelperThreadState::maybeGetPromiseHelperTask,
-    &GlobalHelperThreadState::maybeGetFreeDelazifyTask,
-    &GlobalHelperThreadState::maybeGetDelazifyTask,
-    &GlobalHelperThreadState::maybeGetCompressionTask,
-    &GlobalHelperThreadState::maybeGetLowPrioIonCompileTask,
-    &GlobalHelperThreadState::maybeGetIonFreeTask,
-    &GlobalHelperThreadState::maybeGetWasmPartialTier2CompileTask,
-    &GlobalHelperThreadState::maybeGetWasmTier2CompileTask,
-    &GlobalHelperThreadState::maybeGetWasmCompleteTier2GeneratorTask};
+// Priority is determined by the order they're listed here. The priority given
+// with each task is passed on to the thread pool. Background tasks are listed
+// last, and are only started if they leave a thread for other tasks.
+const GlobalHelperThreadState::SelectorEntry
+    GlobalHelperThreadState::selectors[] = {
+        {&GlobalHelperThreadState::maybeGetGCParallelTask,
+         JS::HelperThreadTaskPriority::High},
+        {&GlobalHelperThreadState::maybeGetIonCompileTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetBaselineCompileTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetWasmTier1CompileTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetPromiseHelperTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetFreeDelazifyTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetDelazifyTask,
+         JS::HelperThreadTaskPriority::Normal},
+        {&GlobalHelperThreadState::maybeGetCompressionTask,
+         JS::HelperThreadTaskPriority::Background},
+        {&GlobalHelperThreadState::maybeGetLowPrioIonCompileTask,
+         JS::HelperThreadTaskPriority::Background},
+        {&GlobalHelperThreadState::maybeGetIonFreeTask,
+         JS::HelperThreadTaskPriority::Background},
+        {&GlobalHelperThreadState::maybeGetWasmPartialTier2CompileTask,
+         JS::HelperThreadTaskPriority::Background},
+        {&GlobalHelperThreadState::maybeGetWasmTier2CompileTask,
+         JS::HelperThreadTaskPriority::Background},
+        {&GlobalHelperThreadState::maybeGetWasmCompleteTier2GeneratorTask,
+         JS::HelperThreadTaskPriority::Background}};
+
+bool GlobalHelperThreadState::canStartBackgroundTask(
+    const AutoLockHelperThreadState& lock) const {
+  // Keep a thread for tasks which are needed sooner, so that a batch of
+  // background work cannot delay them until it completes.
+  return threadCount <= 1 || runningBackgroundTaskCount < threadCount - 1;
+}
 
 bool GlobalHelperThreadState::canStartTasks(
     const AutoLockHelperThreadState& lock) {
   return canStartGCParallelTask(lock) || canStartIonCompileTask(lock) ||
+         canStartBaselineCompileTask(lock) ||
          canStartWasmTier1CompileTask(lock) ||
          canStartPromiseHelperTask(lock) || canStartFreeDelazifyTask(lock) ||
          canStartDelazifyTask(lock) || canStartCompressionTask(lock) ||
@@ -609,11 +678,17 @@ void GlobalHelperThreadState::runOneTask(HelperThreadTask* task,
 }
 
 HelperThreadTask* GlobalHelperThreadState::findHighestPriorityTask(
-    const AutoLockHelperThreadState& locked) {
+    const AutoLockHelperThreadState& locked,
+    JS::HelperThreadTaskPriority* priority) {
   // Return the highest priority task that is ready to start, or nullptr.
 
-  for (const auto& selector : selectors) {
-    if (auto* task = (this->*(selector))(locked)) {
+  for (const auto& entry : selectors) {
+    if (entry.priority == JS::HelperThreadTaskPriority::Background &&
+        !canStartBackgroundTask(locked)) {
+      break;
+    }
+    if (auto* task = (this->*(entry.selector))(locked)) {
+      *priority = entry.priority;
       return task;
     }
   }
@@ -643,6 +718,15 @@ void GlobalHelperThreadState::runTaskLocked(HelperThreadTask* task,
   MOZ_ASSERT(totalCountRunningTasks != 0);
   MOZ_ASSERT(runningTaskCount[threadType] != 0);
 
+  bool limitedBackgroundTask =
+      IsLimitedBackgroundTask(task, task->dispatchPriority());
+
+  JS::HelperThreadTaskWaitTimes& waitTimes = taskWaitTimes_[threadType];
+  TimeDuration waitTime = TimeStamp::Now() - task->dispatchTime_;
+  waitTimes.count++;
+  waitTimes.total += waitTime;
+  waitTimes.max = std::max(waitTimes.max, waitTime);
+
   js::oom::SetThreadType(threadType);
 
   {
@@ -655,6 +739,10 @@ void GlobalHelperThreadState::runTaskLocked(HelperThreadTask* task,
   helperTasks(locked).eraseIfEqual(task);
   totalCountRunningTasks--;
   runningTaskCount[threadType]--;
+  if (limitedBackgroundTask) {
+    MOZ_ASSERT(runningBackgroundTaskCount != 0);
+    runningBackgroundTaskCount--;
+  }
 }
 
 void AutoHelperTaskQueue::queueTaskToDispatch(
@@ -805,10 +893,11 @@ static JSRuntime* GetSelectorRuntime(const CompilationSelector& selector) {
   return selector.match(Matcher());
 }
 
-static bool IonCompileTaskMatches(const CompilationSelector& selector,
-                                  jit::IonCompileTask* task) {
+template <typename Task>
+static bool CompileTaskMatches(const CompilationSelector& selector,
+                               Task* task) {
   struct TaskMatches {
-    jit::IonCompileTask* task_;
+    Task* task_;
 
     bool operator()(JSScript* script) { return script == task_->script(); }
     bool operator()(Zone* zone) {
@@ -847,6 +936,9 @@ void GlobalHelperThreadState::cancelOffThreadIonCompile(
 
   AutoStartIonFreeTask freeTask(jitRuntime, ShouldForceIonFreeTask(selector));
 
+  // Baseline tasks are destroyed on the main thread after releasing the lock.
+  BaselineCompileTaskVector cancelledBaselineTasks;
+
   {
     AutoLockHelperThreadState lock;
     if (!isInitialized(lock)) {
@@ -857,7 +949,7 @@ void GlobalHelperThreadState::cancelOffThreadIonCompile(
     GlobalHelperThreadState::IonCompileTaskVector& worklist = ionWorklist(lock);
     for (size_t i = 0; i < worklist.length(); i++) {
       jit::IonCompileTask* task = worklist[i];
-      if (IonCompileTaskMatches(selector, task)) {
+      if (CompileTaskMatches(selector, task)) {
         // Once finished, tasks are added to a Linked list which is
         // allocated with the IonCompileTask class. The IonCompileTask is
         // allocated in the LifoAlloc so we need the LifoAlloc to be mutable.
@@ -878,7 +970,7 @@ void GlobalHelperThreadState::cancelOffThreadIonCompile(
         }
 
         jit::IonCompileTask* ionCompileTask = helper->as<jit::IonCompileTask>();
-        if (IonCompileTaskMatches(selector, ionCompileTask)) {
+        if (CompileTaskMatches(selector, ionCompileTask)) {
           ionCompileTask->alloc().lifoAlloc()->setReadWrite();
           ionCompileTask->mirGen().cancel();
           cancelled = true;
@@ -889,12 +981,14 @@ void GlobalHelperThreadState::cancelOffThreadIonCompile(
       }
     } while (cancelled);
 
+    cancelOffThreadBaselineCompile(selector, cancelledBaselineTasks, lock);
+
     /* Cancel code generation for any completed entries. */
     GlobalHelperThreadState::IonCompileTaskVector& finished =
         ionFinishedList(lock);
     for (size_t i = 0; i < finished.length(); i++) {
       jit::IonCompileTask* task = finished[i];
-      if (IonCompileTaskMatches(selector, task)) {
+      if (CompileTaskMatches(selector, task)) {
         JSRuntime* rt = task->script()->runtimeFromAnyThread();
         jitRuntime->numFinishedOffThreadTasksRef(lock)--;
         jit::FinishOffThreadTask(rt, freeTask, task);
@@ -903,18 +997,74 @@ void GlobalHelperThreadState::cancelOffThreadIonCompile(
     }
   }
 
+  for (jit::BaselineCompileTask* task : cancelledBaselineTasks) {
+    jit::DiscardBaselineCompileTask(task);
+  }
+
   /* Cancel lazy linking for pending tasks (attached to the ionScript). */
   JSRuntime* runtime = GetSelectorRuntime(selector);
   jit::IonCompileTask* task = jitRuntime->ionLazyLinkList(runtime).getFirst();
   while (task) {
     jit::IonCompileTask* next = task->getNext();
-    if (IonCompileTaskMatches(selector, task)) {
+    if (CompileTaskMatches(selector, task)) {
       jit::FinishOffThreadTask(runtime, freeTask, task);
     }
     task = next;
   }
 }
 
+void GlobalHelperThreadState::cancelOffThreadBaselineCompile(
+    const CompilationSelector& selector,
+    BaselineCompileTaskVector& cancelled, AutoLockHelperThreadState& lock) {
+  jit::JitRuntime* jitRuntime = GetSelectorRuntime(selector)->jitRuntime();
+
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+
+  /* Cancel any pending entries for which processing hasn't started. */
+  BaselineCompileTaskVector& worklist = baselineWorklist(lock);
+  for (size_t i = 0; i < worklist.length(); i++) {
+    jit::BaselineCompileTask* task = worklist[i];
+    if (CompileTaskMatches(selector, task)) {
+      if (!cancelled.append(task)) {
+        oomUnsafe.crash("cancelOffThreadBaselineCompile");
+      }
+      jitRuntime->numPendingBaselineTasksRef(lock)--;
+      remove(worklist, &i);
+    }
+  }
+
+  /* Wait for in progress entries to finish up. Baseline code generation can't
+   * be interrupted, but it's fast. */
+  bool inProgress;
+  do {
+    inProgress = false;
+    for (auto* helper : helperTasks(lock)) {
+      if (helper->is<jit::BaselineCompileTask>() &&
+          CompileTaskMatches(selector,
+                             helper->as<jit::BaselineCompileTask>())) {
+        inProgress = true;
+        break;
+      }
+    }
+    if (inProgress) {
+      wait(lock);
+    }
+  } while (inProgress);
+
+  /* Cancel linking for any completed entries. */
+  BaselineCompileTaskVector& finished = baselineFinishedList(lock);
+  for (size_t i = 0; i < finished.length(); i++) {
+    jit::BaselineCompileTask* task = finished[i];
+    if (CompileTaskMatches(selector, task)) {
+      if (!cancelled.append(task)) {
+        oomUnsafe.crash("cancelOffThreadBaselineCompile");
+      }
+      jitRuntime->numFinishedBaselineTasksRef(lock)--;
+      remove(finished, &i);
+    }
+  }
+}
+
 static bool JitDataStructuresExist(const CompilationSelector& selector) {
   struct Matcher {
     bool operator()(JSScript* script) { return !!script->zone()->jitZone(); }
@@ -989,6 +1139,50 @@ bool js::HasOffThreadIonCompile(Zone* zone) {
 }
 #endif
 
+//== BaselineCompileTask ==================================================
+
+bool GlobalHelperThreadState::canStartBaselineCompileTask(
+    const AutoLockHelperThreadState& lock) {
+  return !baselineWorklist(lock).empty() &&
+         checkTaskThreadLimit(THREAD_TYPE_BASELINE,
+                              maxBaselineCompilationThreads(), lock);
+}
+
+HelperThreadTask* GlobalHelperThreadState::maybeGetBaselineCompileTask(
+    const AutoLockHelperThreadState& lock) {
+  if (!canStartBaselineCompileTask(lock)) {
+    return nullptr;
+  }
+
+  // Baseline tasks are cheap and are started in the order they were queued.
+  auto& worklist = baselineWorklist(lock);
+  jit::BaselineCompileTask* task = worklist[0];
+  worklist.erase(worklist.begin());
+  return task;
+}
+
+bool GlobalHelperThreadState::submitTask(
+    jit::BaselineCompileTask* task, const AutoLockHelperThreadState& locked) {
+  MOZ_ASSERT(isInitialized(locked));
+
+  if (!baselineWorklist(locked).append(task)) {
+    return false;
+  }
+
+  task->script()
+      ->runtimeFromMainThread()
+      ->jitRuntime()
+      ->numPendingBaselineTasksRef(locked)++;
+
+  dispatch(locked);
+  return true;
+}
+
+bool js::StartOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                       const AutoLockHelperThreadState& lock) {
+  return HelperThreadState().submitTask(task, lock);
+}
+
 //== IonFreeTask ==========================================================
 
 bool GlobalHelperThreadState::canStartIonFreeTask(
@@ -1113,30 +1307,40 @@ void js::StartOffThreadDelazification(
     return;
   }
 
-  JSRuntime* maybeRuntime = maybeCx ? maybeCx->runtime() : nullptr;
-  UniquePtr<DelazifyTask> task;
-  task = DelazifyTask::Create(maybeRuntime, options, stencil);
-  if (!task) {
-    return;
+  // With ConcurrentParallel, spread the functions over one task per thread
+  // which can run delazification tasks.
+  size_t numTasks = 1;
+  if (strategy == JS::DelazificationOption::ConcurrentParallel) {
+    numTasks = HelperThreadState().maxDelazifyThreads();
   }
 
-  // Schedule delazification task if there is any function to delazify.
-  if (!task->done()) {
-    AutoLockHelperThreadState lock;
-    HelperThreadState().submitTask(task.release(), lock);
+  JSRuntime* maybeRuntime = maybeCx ? maybeCx->runtime() : nullptr;
+  for (size_t i = 0; i < numTasks; i++) {
+    UniquePtr<DelazifyTask> task;
+    task = DelazifyTask::Create(maybeRuntime, options, stencil, i, numTasks);
+    if (!task) {
+      return;
+    }
+
+    // Schedule delazification task if there is any function to delazify.
+    if (!task->done()) {
+      AutoLockHelperThreadState lock;
+      HelperThreadState().submitTask(task.release(), lock);
+    }
   }
 }
 
 UniquePtr<DelazifyTask> DelazifyTask::Create(
     JSRuntime* maybeRuntime, const JS::ReadOnlyCompileOptions& options,
-    const frontend::CompilationStencil& stencil) {
+    const frontend::CompilationStencil& stencil, size_t taskIndex,
+    size_t numTasks) {
   UniquePtr<DelazifyTask> task;
   task.reset(js_new<DelazifyTask>(maybeRuntime, options.prefableOptions()));
   if (!task) {
     return nullptr;
   }
 
-  if (!task->init(options, stencil)) {
+  if (!task->init(options, stencil, taskIndex, numTasks)) {
     // In case of errors, skip this and delazify on-demand.
     return nullptr;
   }
@@ -1158,8 +1362,9 @@ DelazifyTask::~DelazifyTask() {
 }
 
 bool DelazifyTask::init(const JS::ReadOnlyCompileOptions& options,
-                        const frontend::CompilationStencil& stencil) {
-  return delazificationCx.init(options, stencil);
+                        const frontend::CompilationStencil& stencil,
+                        size_t taskIndex, size_t numTasks) {
+  return delazificationCx.init(options, stencil, taskIndex, numTasks);
 }
 
 size_t DelazifyTask::sizeOfExcludingThis(
@@ -50,6 +50,7 @@ class GCRuntime;
 }
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 class JitRuntime;
@@ -184,6 +185,12 @@ bool StartOffThreadIonCompile(jit::IonCompileTask* task,
 void FinishOffThreadIonCompile(jit::IonCompileTask* task,
                                const AutoLockHelperThreadState& lock);
 
+/*
+ * Schedule an off-thread Baseline compilation for a script, given a task.
+ */
+bool StartOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                   const AutoLockHelperThreadState& lock);
+
 // RAII class to handle batching compile tasks and starting an IonFreeTask.
 class MOZ_RAII AutoStartIonFreeTask {
   jit::JitRuntime* jitRuntime_;
@@ -208,7 +215,9 @@ using CompilationSelector =
     mozilla::Variant<JSScript*, JS::Zone*, ZonesInState, JSRuntime*>;
 
 /*
- * Cancel scheduled or in progress Ion compilations.
+ * Cancel scheduled or in progress Ion compilations. This also cancels
+ * off-thread Baseline compilations. For ZonesInState selectors (used by the GC)
+ * all Baseline compilations for the runtime are cancelled.
  */
 void CancelOffThreadIonCompile(const CompilationSelector& selector);
 
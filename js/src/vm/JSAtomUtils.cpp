@@ -441,6 +441,8 @@ template <typename CharT>
 MOZ_ALWAYS_INLINE JSAtom* AtomsTable::atomizeAndCopyCharsNonStaticValidLength(
     JSContext* cx, const CharT* chars, size_t length,
     const Maybe<uint32_t>& indexValue, const AtomHasher::Lookup& lookup) {
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(cx->runtime()));
+
   AtomSet::AddPtr p;
 
   if (!atomsAddedWhileSweeping) {
@@ -142,6 +142,7 @@ enum class InterruptReason : uint32_t {
   AttachIonCompilations = 1 << 2,
   CallbackUrgent = 1 << 3,
   CallbackCanWait = 1 << 4,
+  AttachBaselineCompilations = 1 << 5,
 };
 
 enum class ShouldCaptureStack { Maybe, Always };
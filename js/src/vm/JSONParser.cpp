@@ -15,7 +15,8 @@
 #include "mozilla/TextUtils.h"  // mozilla::AsciiAlphanumericToNumber, mozilla::IsAsciiDigit, mozilla::IsAsciiHexDigit
 
 #include <stddef.h>  // size_t
-#include <stdint.h>  // uint32_t
+#include <stdint.h>  // uint32_t, uint64_t
+#include <string.h>  // memcpy
 #include <utility>   // std::move
 
 #include "jsnum.h"  // ParseDecimalNumber, GetFullInteger, FullStringToDouble
@@ -24,7 +25,7 @@
 #include "builtin/ParseRecordObject.h"  // js::ParseRecordObject
 #include "ds/IdValuePair.h"             // IdValuePair
 #include "gc/GCEnum.h"                  // CanGC
-#include "gc/Tracer.h"                  // JS::TraceRoot
+#include "gc/Tracer.h"                  // JS::TraceRoot, TraceNullableRoot
 #include "js/AllocPolicy.h"             // ReportOutOfMemory
 #include "js/CharacterEncoding.h"       // JS::ConstUTF8CharsZ
 #include "js/ColumnNumber.h"            // JS::ColumnNumberOneOrigin
@@ -56,6 +57,48 @@ using mozilla::IsAsciiDigit;
 using mozilla::IsAsciiHexDigit;
 using mozilla::RangedPtr;
 
+// Return a pointer to the first of |chars[0..limit]| which is '"', '\\' or a
+// control character, or |limit| if there's no such character.
+//
+// Characters are tested 64 bits at a time.  For each lane |v|,
+// |(v - n) & ~v & HighBits| sets the lane's high bit iff |v < n|, and borrows
+// only propagate out of matching lanes, so the test is exact for the word as a
+// whole.  Words containing a match are then scanned one character at a time.
+template <typename CharT>
+static MOZ_ALWAYS_INLINE const CharT* FindSpecialStringChar(
+    const CharT* chars, const CharT* limit) {
+  static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2,
+                "expected Latin-1 or two-byte characters");
+
+  constexpr size_t CharsPerWord = sizeof(uint64_t) / sizeof(CharT);
+  constexpr uint64_t Ones =
+      sizeof(CharT) == 1 ? 0x0101'0101'0101'0101 : 0x0001'0001'0001'0001;
+  constexpr uint64_t HighBits = Ones << (8 * sizeof(CharT) - 1);
+
+  while (size_t(limit - chars) >= CharsPerWord) {
+    uint64_t word;
+    memcpy(&word, chars, sizeof(word));
+
+    uint64_t quote = word ^ (Ones * '"');
+    uint64_t backslash = word ^ (Ones * '\\');
+    uint64_t found = ((word - Ones * 0x20) & ~word) |
+                     ((quote - Ones) & ~quote) |
+                     ((backslash - Ones) & ~backslash);
+    if (found & HighBits) {
+      break;
+    }
+
+    chars += CharsPerWord;
+  }
+
+  for (; chars < limit; chars++) {
+    if (*chars == '"' || *chars == '\\' || *chars <= 0x001F) {
+      break;
+    }
+  }
+  return chars;
+}
+
 template <typename CharT, typename ParserT>
 void JSONTokenizer<CharT, ParserT>::getTextPosition(uint32_t* column,
                                                     uint32_t* line) {
@@ -369,6 +412,7 @@ JSONToken JSONTokenizer<CharT, ParserT>::readString() {
    * string directly from the source text.
    */
   CharPtr start = current;
+  current += FindSpecialStringChar(current.get(), end.get()) - current.get();
   for (; current < end; current++) {
     if (*current == '"') {
       size_t length = current - start;
@@ -480,11 +524,7 @@ JSONToken JSONTokenizer<CharT, ParserT>::readString() {
     }
 
     start = current;
-    for (; current < end; current++) {
-      if (*current == '"' || *current == '\\' || *current <= 0x001F) {
-        break;
-      }
-    }
+    current += FindSpecialStringChar(current.get(), end.get()) - current.get();
   } while (current < end);
 
   error("unterminated string");
@@ -618,7 +658,11 @@ static void ReportJSONSyntaxError(FrontendContext* fc, ErrorMetadata&& metadata,
 // collections then at least half of it will end up tenured.
 
 JSONFullParseHandlerAnyChar::JSONFullParseHandlerAnyChar(JSContext* cx)
-    : cx(cx), gcHeap(cx, 1), freeElements(cx), freeProperties(cx) {}
+    : cx(cx),
+      gcHeap(cx, 1),
+      freeElements(cx),
+      freeProperties(cx),
+      objectShapes(cx) {}
 
 JSONFullParseHandlerAnyChar::JSONFullParseHandlerAnyChar(
     JSONFullParseHandlerAnyChar&& other) noexcept
@@ -627,7 +671,8 @@ JSONFullParseHandlerAnyChar::JSONFullParseHandlerAnyChar(
       parseType(other.parseType),
       gcHeap(cx, 1),
       freeElements(std::move(other.freeElements)),
-      freeProperties(std::move(other.freeProperties)) {}
+      freeProperties(std::move(other.freeProperties)),
+      objectShapes(std::move(other.objectShapes)) {}
 
 JSONFullParseHandlerAnyChar::~JSONFullParseHandlerAnyChar() {
   for (size_t i = 0; i < freeElements.length(); i++) {
@@ -699,9 +744,16 @@ inline bool JSONFullParseHandlerAnyChar::finishObject(
   if (gcHeap == gc::Heap::Tenured) {
     newKind = TenuredObject;
   }
+  size_t depth = stack.length() - 1;
+  if (depth >= objectShapes.length() &&
+      !objectShapes.appendN(nullptr, depth + 1 - objectShapes.length())) {
+    return false;
+  }
+
   // properties is traced in the parser; see JSONParser<CharT>::trace()
   JSObject* obj = NewPlainObjectWithMaybeDuplicateKeys(
-      cx, Handle<IdValueVector>::fromMarkedLocation(properties), newKind);
+      cx, Handle<IdValueVector>::fromMarkedLocation(properties), newKind,
+      MutableHandle<SharedShape*>::fromMarkedLocation(&objectShapes[depth]));
   if (!obj) {
     return false;
   }
@@ -773,6 +825,9 @@ inline void JSONFullParseHandlerAnyChar::freeStackEntry(StackEntry& entry) {
 
 void JSONFullParseHandlerAnyChar::trace(JSTracer* trc) {
   JS::TraceRoot(trc, &v, "JSONFullParseHandlerAnyChar current value");
+  for (SharedShape*& shape : objectShapes) {
+    TraceNullableRoot(trc, &shape, "JSONFullParseHandlerAnyChar object shape");
+  }
 }
 
 template <typename CharT>
@@ -33,6 +33,7 @@ class JSTracer;
 namespace js {
 
 class FrontendContext;
+class SharedShape;
 
 enum class JSONToken {
   String,
@@ -225,6 +226,11 @@ class MOZ_STACK_CLASS JSONFullParseHandlerAnyChar {
   Vector<ElementVector*, 5> freeElements;
   Vector<PropertyVector*, 5> freeProperties;
 
+  // Shape of the last object created at each nesting depth. Arrays of records
+  // usually repeat the same keys, so try this shape before the realm's cache.
+  // These shapes are traced in trace().
+  Vector<SharedShape*, 5> objectShapes;
+
  public:
   explicit JSONFullParseHandlerAnyChar(JSContext* cx);
   ~JSONFullParseHandlerAnyChar();
@@ -3328,9 +3328,11 @@ void JSObject::addSizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf,
     info->objectsMallocHeapMisc +=
         as<ArgumentsObject>().sizeOfMisc(mallocSizeOf);
   } else if (is<MapObject>()) {
-    info->objectsMallocHeapMisc += as<MapObject>().sizeOfData(mallocSizeOf);
+    info->objectsMallocHeapMapSetData +=
+        as<MapObject>().sizeOfData(mallocSizeOf);
   } else if (is<SetObject>()) {
-    info->objectsMallocHeapMisc += as<SetObject>().sizeOfData(mallocSizeOf);
+    info->objectsMallocHeapMapSetData +=
+        as<SetObject>().sizeOfData(mallocSizeOf);
   } else if (is<PropertyIteratorObject>()) {
     info->objectsMallocHeapMisc +=
         as<PropertyIteratorObject>().sizeOfMisc(mallocSizeOf);
@@ -484,9 +484,10 @@ static void StatsCellCallback(JSRuntime* rt, void* data, JS::GCCellPtr cellptr,
         MOZ_ASSERT(map->isNormal());
         zStats->normalPropMapsGCHeap += thingSize;
       }
+      size_t* tables = map->isDictionary() ? &zStats->dictPropMapTables
+                                           : &zStats->propMapTables;
       map->addSizeOfExcludingThis(rtStats->mallocSizeOf_,
-                                  &zStats->propMapChildren,
-                                  &zStats->propMapTables);
+                                  &zStats->propMapChildren, tables);
       break;
     }
 
@@ -49,6 +49,7 @@
   _(ProcessExecutableRegion, 500)     \
   _(BufferStreamState, 500)           \
   _(SharedArrayGrow, 500)             \
+  _(ArrayBufferContentsPool, 500)     \
   _(SharedImmutableScriptData, 500)   \
   _(WasmTypeIdSet, 500)               \
   _(WasmCodeProfilingLabels, 500)     \
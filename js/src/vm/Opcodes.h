@@ -2284,8 +2284,8 @@
      *
      * If re-entering the microtask loop is skippable (as checked by CanSkipAwait)
      * if can_skip is true,  `MaybeExtractAwaitValue` replaces `value` with the result of the
-     * `await` expression (unwrapping the resolved promise, if any). Otherwise, value remains
-     * as is.
+     * `await` expression (unwrapping the resolved promise, if any), or throws the reason of the
+     * rejected promise. Otherwise, value remains as is.
      *
      * In both cases, can_skip remains the same.
      *
@@ -237,14 +237,25 @@ SharedShape* js::NewPlainObjectWithPropsCache::lookup(
 
 enum class KeysKind { UniqueNames, Unknown };
 
+// If |shapeHint| is not null, it must point to a traced location.
 template <KeysKind Kind>
 static PlainObject* NewPlainObjectWithProperties(
-    JSContext* cx, Handle<IdValueVector> properties, NewObjectKind newKind) {
+    JSContext* cx, Handle<IdValueVector> properties, NewObjectKind newKind,
+    SharedShape** shapeHint = nullptr) {
   auto& cache = cx->realm()->newPlainObjectWithPropsCache;
 
   // If we recently created an object with these properties, we can use that
   // Shape directly.
-  if (SharedShape* shape = cache.lookup(properties)) {
+  SharedShape* shape = nullptr;
+  if (shapeHint && *shapeHint && ShapeMatches(properties, *shapeHint)) {
+    shape = *shapeHint;
+  } else {
+    shape = cache.lookup(properties);
+    if (shape && shapeHint) {
+      *shapeHint = shape;
+    }
+  }
+  if (shape) {
     Rooted<SharedShape*> shapeRoot(cx, shape);
     PlainObject* obj = PlainObject::createWithShape(cx, shapeRoot, newKind);
     if (!obj) {
@@ -313,6 +324,9 @@ static PlainObject* NewPlainObjectWithProperties(
     MOZ_ASSERT(obj->getDenseInitializedLength() == 0);
     MOZ_ASSERT(obj->slotSpan() == properties.length());
     cache.add(obj->sharedShape());
+    if (shapeHint) {
+      *shapeHint = obj->sharedShape();
+    }
   }
 
   return obj;
@@ -330,3 +344,10 @@ PlainObject* js::NewPlainObjectWithMaybeDuplicateKeys(
   return NewPlainObjectWithProperties<KeysKind::Unknown>(cx, properties,
                                                          newKind);
 }
+
+PlainObject* js::NewPlainObjectWithMaybeDuplicateKeys(
+    JSContext* cx, Handle<IdValueVector> properties, NewObjectKind newKind,
+    MutableHandle<SharedShape*> shapeHint) {
+  return NewPlainObjectWithProperties<KeysKind::Unknown>(
+      cx, properties, newKind, shapeHint.address());
+}
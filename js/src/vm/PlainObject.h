@@ -108,6 +108,13 @@ extern PlainObject* NewPlainObjectWithMaybeDuplicateKeys(
     JSContext* cx, Handle<IdValueVector> properties,
     NewObjectKind newKind = GenericObject);
 
+// Like NewPlainObjectWithMaybeDuplicateKeys, but try |shapeHint| before the
+// realm's cache. |shapeHint| is then set to the shape of the new object if
+// objects with the same properties can be created with it.
+extern PlainObject* NewPlainObjectWithMaybeDuplicateKeys(
+    JSContext* cx, Handle<IdValueVector> properties, NewObjectKind newKind,
+    MutableHandle<SharedShape*> shapeHint);
+
 }  // namespace js
 
 #endif  // vm_PlainObject_h
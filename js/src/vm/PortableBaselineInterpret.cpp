@@ -3079,6 +3079,35 @@ static EnvironmentObject& getEnvironmentFromCoordinate(
 #  define PREDICT_NEXT(op)
 #endif
 
+// Fuse a comparison with a following conditional jump: branch on |result|
+// directly, without pushing it and dispatching the jump. This skips the IC
+// entries of both ops, like their fast paths do. Frames of debuggees take the
+// unfused path so that the jump can be stepped on.
+#if !defined(TRACE_INTERP)
+#  define FUSE_COMPARE_AND_JUMP(op, result)                               \
+    {                                                                     \
+      static_assert(JSOpLength_JumpIfFalse == JSOpLength_JumpIfTrue);     \
+      JSOp nextOp = JSOp(pc[JSOpLength_##op]);                            \
+      if ((nextOp == JSOp::JumpIfFalse || nextOp == JSOp::JumpIfTrue) &&  \
+          !frame->isDebuggee()) {                                         \
+        POPN(2);                                                          \
+        NEXT_IC();                                                        \
+        NEXT_IC();                                                        \
+        ADVANCE(JSOpLength_##op);                                         \
+        if ((result) == (nextOp == JSOp::JumpIfTrue)) {                   \
+          ADVANCE(GET_JUMP_OFFSET(pc));                                   \
+          PREDICT_NEXT(JumpTarget);                                       \
+          PREDICT_NEXT(LoopHead);                                         \
+        } else {                                                          \
+          ADVANCE(JSOpLength_JumpIfFalse);                                \
+        }                                                                 \
+        DISPATCH();                                                       \
+      }                                                                   \
+    }
+#else
+#  define FUSE_COMPARE_AND_JUMP(op, result)
+#endif
+
 #define COUNT_COVERAGE_PC(PC)                        \
   if (script->hasScriptCounts()) {                   \
     PCCounts* counts = script->maybeGetPCCounts(PC); \
@@ -3822,6 +3851,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Eq) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[0].asValue().toInt32() == sp[1].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Eq, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3831,6 +3861,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         double lhs = sp[1].asValue().toNumber();
         double rhs = sp[0].asValue().toNumber();
         bool result = lhs == rhs;
+        FUSE_COMPARE_AND_JUMP(Eq, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3838,6 +3869,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
       }
       if (sp[0].asValue().isNumber() && sp[1].asValue().isNumber()) {
         bool result = sp[0].asValue().toNumber() == sp[1].asValue().toNumber();
+        FUSE_COMPARE_AND_JUMP(Eq, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3849,6 +3881,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Ne) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[0].asValue().toInt32() != sp[1].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Ne, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3858,6 +3891,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         double lhs = sp[1].asValue().toNumber();
         double rhs = sp[0].asValue().toNumber();
         bool result = lhs != rhs;
+        FUSE_COMPARE_AND_JUMP(Ne, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3865,6 +3899,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
       }
       if (sp[0].asValue().isNumber() && sp[1].asValue().isNumber()) {
         bool result = sp[0].asValue().toNumber() != sp[1].asValue().toNumber();
+        FUSE_COMPARE_AND_JUMP(Ne, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3876,6 +3911,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Lt) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[1].asValue().toInt32() < sp[0].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Lt, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3888,6 +3924,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         if (std::isnan(lhs) || std::isnan(rhs)) {
           result = false;
         }
+        FUSE_COMPARE_AND_JUMP(Lt, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3898,6 +3935,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Le) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[1].asValue().toInt32() <= sp[0].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Le, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3910,6 +3948,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         if (std::isnan(lhs) || std::isnan(rhs)) {
           result = false;
         }
+        FUSE_COMPARE_AND_JUMP(Le, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3920,6 +3959,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Gt) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[1].asValue().toInt32() > sp[0].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Gt, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3932,6 +3972,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         if (std::isnan(lhs) || std::isnan(rhs)) {
           result = false;
         }
+        FUSE_COMPARE_AND_JUMP(Gt, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3942,6 +3983,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
     CASE(Ge) {
       if (sp[0].asValue().isInt32() && sp[1].asValue().isInt32()) {
         bool result = sp[1].asValue().toInt32() >= sp[0].asValue().toInt32();
+        FUSE_COMPARE_AND_JUMP(Ge, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -3954,6 +3996,7 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
         if (std::isnan(lhs) || std::isnan(rhs)) {
           result = false;
         }
+        FUSE_COMPARE_AND_JUMP(Ge, result);
         POP();
         sp[0] = StackVal(BooleanValue(result));
         NEXT_IC();
@@ -5578,7 +5621,9 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
       } else {
         PUSH(StackVal(frame->unaliasedFormal(i)));
       }
-      END_OP(GetArg);
+      ADVANCE(JSOpLength_GetArg);
+      PREDICT_NEXT(GetProp);
+      DISPATCH();
     }
 
     CASE(GetFrameArg) {
@@ -5591,7 +5636,9 @@ PBIResult PortableBaselineInterpret(JSContext* cx_, State& state, Stack& stack,
       uint32_t i = GET_LOCALNO(pc);
       TRACE_PRINTF(" -> local: %d\n", int(i));
       PUSH(StackVal(frame->unaliasedLocal(i)));
-      END_OP(GetLocal);
+      ADVANCE(JSOpLength_GetLocal);
+      PREDICT_NEXT(GetProp);
+      DISPATCH();
     }
 
     CASE(ArgumentsLength) {
@@ -0,0 +1,154 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "vm/RegExpBytecodeCache.h"
+
+#include "mozilla/HashFunctions.h"  // mozilla::AddToHash
+
+#include <string.h>  // memcpy
+
+#include "js/Utility.h"    // js_malloc, js_new, js_delete
+#include "util/Text.h"     // js::EqualChars
+#include "vm/StringType.h"  // JSAtom, js::CopyChars
+
+using namespace js;
+
+RegExpBytecodeCache::Lookup::Lookup(const JSAtom* source,
+                                    JS::RegExpFlags flags, bool latin1)
+    : source(source),
+      flags(flags),
+      latin1(latin1),
+      hash(mozilla::AddToHash(source->hash(), flags.value(), latin1)) {}
+
+/* static */
+bool RegExpBytecodeCache::EntryHasher::match(const Entry* entry,
+                                             const Lookup& l) {
+  if (l.entry) {
+    return entry == l.entry;
+  }
+
+  if (entry->hash != l.hash || entry->flags != l.flags ||
+      entry->latin1 != l.latin1 || entry->sourceLength != l.source->length()) {
+    return false;
+  }
+
+  JS::AutoCheckCannotGC nogc;
+  return l.source->hasLatin1Chars()
+             ? EqualChars(l.source->latin1Chars(nogc), entry->source.get(),
+                          entry->sourceLength)
+             : EqualChars(l.source->twoByteChars(nogc), entry->source.get(),
+                          entry->sourceLength);
+}
+
+static RegExpBytecodeCache::UniqueByteCode CopyByteCode(
+    RegExpBytecodeCache::ByteCode* byteCode) {
+  size_t size = sizeof(RegExpBytecodeCache::ByteCode) + byteCode->length();
+  RegExpBytecodeCache::UniqueByteCode copy(
+      static_cast<RegExpBytecodeCache::ByteCode*>(js_malloc(size)));
+  if (copy) {
+    memcpy(copy.get(), byteCode, size);
+  }
+  return copy;
+}
+
+RegExpBytecodeCache::UniqueByteCode RegExpBytecodeCache::lookup(
+    const JSAtom* source, JS::RegExpFlags flags, bool latin1,
+    uint32_t* maxRegisters) {
+  if (source->length() > MaxSourceLength) {
+    return nullptr;
+  }
+
+  EntrySet::Ptr p = entries_.lookup(Lookup(source, flags, latin1));
+  if (!p) {
+    return nullptr;
+  }
+
+  Entry* entry = *p;
+  UniqueByteCode copy = CopyByteCode(entry->byteCode.get());
+  if (!copy) {
+    return nullptr;
+  }
+
+  entry->remove();
+  lru_.insertFront(entry);
+
+  *maxRegisters = entry->maxRegisters;
+  return copy;
+}
+
+void RegExpBytecodeCache::put(const JSAtom* source, JS::RegExpFlags flags,
+                              bool latin1, ByteCode* byteCode,
+                              uint32_t maxRegisters) {
+  size_t sourceLength = source->length();
+  if (sourceLength > MaxSourceLength) {
+    return;
+  }
+
+  size_t bytes = sizeof(Entry) + sourceLength * sizeof(char16_t) +
+                 sizeof(ByteCode) + byteCode->length();
+  if (bytes > MaxTotalBytes) {
+    return;
+  }
+
+  Lookup lookup(source, flags, latin1);
+  if (entries_.has(lookup)) {
+    return;
+  }
+
+  UniquePtr<Entry> entry(js_new<Entry>());
+  if (!entry) {
+    return;
+  }
+  entry->hash = lookup.hash;
+  entry->flags = flags;
+  entry->latin1 = latin1;
+  entry->maxRegisters = maxRegisters;
+  entry->sourceLength = uint32_t(sourceLength);
+  entry->source.reset(js_pod_malloc<char16_t>(sourceLength));
+  entry->byteCode = CopyByteCode(byteCode);
+  entry->bytes = bytes;
+  if (!entry->source || !entry->byteCode) {
+    return;
+  }
+  CopyChars(entry->source.get(), *source);
+
+  while (totalBytes_ + bytes > MaxTotalBytes) {
+    MOZ_ASSERT(!lru_.isEmpty());
+    remove(lru_.getLast());
+  }
+
+  if (!entries_.putNew(lookup, entry.get())) {
+    return;
+  }
+
+  totalBytes_ += bytes;
+  lru_.insertFront(entry.release());
+}
+
+void RegExpBytecodeCache::remove(Entry* entry) {
+  MOZ_ASSERT(totalBytes_ >= entry->bytes);
+  totalBytes_ -= entry->bytes;
+  entries_.remove(Lookup(entry));
+  js_delete(entry);
+}
+
+void RegExpBytecodeCache::purge() {
+  entries_.clearAndCompact();
+  while (Entry* entry = lru_.popFirst()) {
+    js_delete(entry);
+  }
+  totalBytes_ = 0;
+}
+
+size_t RegExpBytecodeCache::sizeOfExcludingThis(
+    mozilla::MallocSizeOf mallocSizeOf) const {
+  size_t n = entries_.shallowSizeOfExcludingThis(mallocSizeOf);
+  for (const Entry* entry : lru_) {
+    n += mallocSizeOf(entry) + mallocSizeOf(entry->source.get()) +
+         mallocSizeOf(entry->byteCode.get());
+  }
+  return n;
+}
@@ -0,0 +1,121 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef vm_RegExpBytecodeCache_h
+#define vm_RegExpBytecodeCache_h
+
+#include "mozilla/LinkedList.h"       // mozilla::LinkedList
+#include "mozilla/MemoryReporting.h"  // mozilla::MallocSizeOf
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t
+
+#include "irregexp/RegExpTypes.h"  // js::irregexp::ByteArrayData
+#include "js/AllocPolicy.h"        // js::SystemAllocPolicy
+#include "js/HashTable.h"          // js::HashSet
+#include "js/RegExpFlags.h"        // JS::RegExpFlags
+#include "js/UniquePtr.h"          // js::UniquePtr
+
+class JSAtom;
+
+namespace js {
+
+// Cache of the irregexp bytecode of regular expressions, shared by all the
+// zones of a runtime.
+//
+// The bytecode of a regexp only depends on its source, its flags and the
+// encoding of the input, and it doesn't contain any pointer. A RegExpShared of
+// any zone can use a copy of it, instead of parsing and compiling the same
+// pattern again. This is common for pages which create the same validation
+// regexps in each of their iframes.
+//
+// Native code is not cached, as it is owned by the zone of its RegExpShared
+// and refers to tables owned by the RegExpShared.
+//
+// Entries are evicted in least recently used order when the cache reaches its
+// size limit, and the whole cache is purged on shrinking GCs.
+class RegExpBytecodeCache {
+ public:
+  using ByteCode = irregexp::ByteArrayData;
+  using UniqueByteCode = UniquePtr<ByteCode, JS::FreePolicy>;
+
+  // Patterns longer than this are not cached.
+  static constexpr size_t MaxSourceLength = 1024;
+
+  // Limit on the memory used by the entries of the cache.
+  static constexpr size_t MaxTotalBytes = 2 * 1024 * 1024;
+
+ private:
+  struct Entry : public mozilla::LinkedListElement<Entry> {
+    HashNumber hash = 0;
+    JS::RegExpFlags flags;
+    bool latin1 = false;
+    uint32_t maxRegisters = 0;
+    uint32_t sourceLength = 0;
+    UniquePtr<char16_t[], JS::FreePolicy> source;
+    UniqueByteCode byteCode;
+
+    // Memory accounted for this entry in |totalBytes_|.
+    size_t bytes = 0;
+  };
+
+  // Either the pattern of a regexp, or an entry of the cache when removing it.
+  struct Lookup {
+    const JSAtom* source = nullptr;
+    const Entry* entry = nullptr;
+    JS::RegExpFlags flags;
+    bool latin1;
+    HashNumber hash;
+
+    Lookup(const JSAtom* source, JS::RegExpFlags flags, bool latin1);
+    explicit Lookup(const Entry* entry)
+        : entry(entry),
+          flags(entry->flags),
+          latin1(entry->latin1),
+          hash(entry->hash) {}
+  };
+
+  struct EntryHasher {
+    using Lookup = RegExpBytecodeCache::Lookup;
+
+    static HashNumber hash(const Lookup& l) { return l.hash; }
+    static bool match(const Entry* entry, const Lookup& l);
+  };
+
+  using EntrySet = HashSet<Entry*, EntryHasher, SystemAllocPolicy>;
+
+  EntrySet entries_;
+
+  // All entries, most recently used first.
+  mozilla::LinkedList<Entry> lru_;
+
+  size_t totalBytes_ = 0;
+
+  void remove(Entry* entry);
+
+ public:
+  RegExpBytecodeCache() = default;
+  ~RegExpBytecodeCache() { purge(); }
+
+  // Return a copy of the bytecode compiled for |source| and |flags| on inputs
+  // with the given encoding, and its number of registers, or nullptr if the
+  // cache doesn't contain it. Failing to allocate the copy is not reported.
+  UniqueByteCode lookup(const JSAtom* source, JS::RegExpFlags flags,
+                        bool latin1, uint32_t* maxRegisters);
+
+  // Add a copy of |byteCode| to the cache, evicting least recently used
+  // entries if needed. Failures are not reported, as the cache is optional.
+  void put(const JSAtom* source, JS::RegExpFlags flags, bool latin1,
+           ByteCode* byteCode, uint32_t maxRegisters);
+
+  void purge();
+
+  size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) const;
+};
+
+}  // namespace js
+
+#endif /* vm_RegExpBytecodeCache_h */
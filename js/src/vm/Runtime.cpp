@@ -24,6 +24,7 @@
 #include "frontend/ParserAtom.h"  // frontend::WellKnownParserAtoms
 #include "gc/GC.h"
 #include "gc/PublicIterators.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/IonCompileTask.h"
 #include "jit/JitRuntime.h"
 #include "jit/Simulator.h"
@@ -114,6 +115,8 @@ JSRuntime::JSRuntime(JSRuntime* parentRuntime)
       ctypesActivityCallback(nullptr),
       windowProxyClass_(nullptr),
       numRealms(0),
+      ropeSearchesWithoutFlattening(0),
+      ropeSearchesFlattened(0),
       numDebuggeeRealms_(0),
       numDebuggeeRealmsObservingCoverage_(0),
       localeCallbacks(nullptr),
@@ -143,6 +146,7 @@ JSRuntime::JSRuntime(JSRuntime* parentRuntime)
       offthreadIonCompilationEnabled_(true),
       parallelParsingEnabled_(true),
       autoWritableJitCodeActive_(false),
+      autoWritableJitCodeBatch_(nullptr),
       oomCallback(nullptr),
       debuggerMallocSizeOf(ReturnZeroSize),
       stackFormat_(parentRuntime ? js::StackFormat::Default
@@ -323,6 +327,9 @@ void JSRuntime::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
         selfHostScriptMap.ref().shallowSizeOfExcludingThis(mallocSizeOf);
   }
 
+  rtSizes->ropeSearchesWithoutFlattening += ropeSearchesWithoutFlattening;
+  rtSizes->ropeSearchesFlattened += ropeSearchesFlattened;
+
   JSContext* cx = mainContextFromAnyThread();
   rtSizes->contexts += cx->sizeOfIncludingThis(mallocSizeOf);
   rtSizes->temporary += cx->tempLifoAlloc().sizeOfExcludingThis(mallocSizeOf);
@@ -330,6 +337,10 @@ void JSRuntime::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
       cx->interpreterStack().sizeOfExcludingThis(mallocSizeOf);
   rtSizes->uncompressedSourceCache +=
       caches().uncompressedSourceCache.sizeOfExcludingThis(mallocSizeOf);
+  rtSizes->regExpBytecodeCache +=
+      caches().regExpBytecodeCache.sizeOfExcludingThis(mallocSizeOf);
+  rtSizes->arrayBufferContentsPool +=
+      arrayBufferContentsPool.sizeOfExcludingThis(mallocSizeOf);
 
   rtSizes->gc.nurseryCommitted += gc.nursery().totalCommitted();
   rtSizes->gc.nurseryMallocedBuffers +=
@@ -404,10 +415,12 @@ static bool HandleInterrupt(JSContext* cx, bool invokeCallback) {
   cx->runtime()->gc.gcIfRequested();
 
   // A worker thread may have requested an interrupt after finishing an Ion
-  // compilation.
+  // or Baseline compilation.
   jit::AttachFinishedCompilations(cx);
+  jit::AttachFinishedBaselineCompilations(cx);
 
-  // Don't call the interrupt callback if we only interrupted for GC or Ion.
+  // Don't call the interrupt callback if we only interrupted for GC or
+  // compilations.
   if (!invokeCallback) {
     return true;
   }
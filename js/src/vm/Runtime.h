@@ -47,7 +47,8 @@
 #include "js/WaitCallbacks.h"
 #include "js/Warnings.h"  // JS::WarningReporter
 #include "js/Zone.h"
-#include "vm/Caches.h"  // js::RuntimeCaches
+#include "vm/ArrayBufferContentsPool.h"  // js::ArrayBufferContentsPool
+#include "vm/Caches.h"                   // js::RuntimeCaches
 #include "vm/CodeCoverage.h"
 #include "vm/GeckoProfiler.h"
 #include "vm/InvalidatingFuse.h"
@@ -97,6 +98,7 @@ class Shape;
 class SourceHook;
 
 namespace jit {
+class AutoWritableJitCodeBatch;
 class JitRuntime;
 class JitActivation;
 struct PcScriptCache;
@@ -638,6 +640,11 @@ struct JSRuntime {
   js::MainThreadData<JS::RecordAllocationsCallback> recordAllocationCallback;
   js::MainThreadData<double> allocationSamplingProbability;
 
+  // How many string searches in ropes were done on their leaves, and how many
+  // had to flatten the rope first. These are reported by memory reporters.
+  js::MainThreadData<uint64_t> ropeSearchesWithoutFlattening;
+  js::MainThreadData<uint64_t> ropeSearchesFlattened;
+
  private:
   // Number of debuggee realms in the runtime.
   js::MainThreadData<size_t> numDebuggeeRealms_;
@@ -959,6 +966,8 @@ struct JSRuntime {
       parallelParsingEnabled_;
 
   js::MainThreadData<bool> autoWritableJitCodeActive_;
+  js::MainThreadData<js::jit::AutoWritableJitCodeBatch*>
+      autoWritableJitCodeBatch_;
 
  public:
   // Note: these values may be toggled dynamically (in response to about:config
@@ -980,6 +989,15 @@ struct JSRuntime {
     autoWritableJitCodeActive_ = b;
   }
 
+  js::jit::AutoWritableJitCodeBatch* autoWritableJitCodeBatch() const {
+    return autoWritableJitCodeBatch_;
+  }
+  void setAutoWritableJitCodeBatch(js::jit::AutoWritableJitCodeBatch* batch) {
+    MOZ_ASSERT(!autoWritableJitCodeBatch_ != !batch,
+               "AutoWritableJitCodeBatch should not be nested.");
+    autoWritableJitCodeBatch_ = batch;
+  }
+
   /* See comment for JS::SetOutOfMemoryCallback in js/MemoryCallbacks.h. */
   js::MainThreadData<JS::OutOfMemoryCallback> oomCallback;
   js::MainThreadData<void*> oomCallbackData;
@@ -1024,6 +1042,10 @@ struct JSRuntime {
  public:
   js::RuntimeCaches& caches() { return caches_.ref(); }
 
+  // Contents of large ArrayBuffers freed since the last major GC, for reuse by
+  // new buffers. Contents are added from background finalization.
+  js::ArrayBufferContentsPool arrayBufferContentsPool;
+
   // List of all the live wasm::Instances in the runtime. Equal to the union
   // of all instances registered in all JS::Realms. Accessed from watchdog
   // threads for purposes of wasm::InterruptRunningCode().
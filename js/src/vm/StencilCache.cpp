@@ -35,7 +35,8 @@ js::StencilCache::AccessKey js::StencilCache::isSourceCached(
 
 bool js::StencilCache::startCaching(RefPtr<ScriptSource>&& src) {
   auto guard = cache.lock();
-  if (!guard->watched.putNew(std::move(src))) {
+  // Multiple delazification tasks can share the same source.
+  if (!guard->watched.put(std::move(src))) {
     return false;
   }
   enabled = true;
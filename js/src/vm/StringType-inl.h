@@ -295,7 +295,10 @@ inline size_t JSLinearString::maybeMallocCharsOnPromotion(
     chars = reinterpret_cast<const void**>(&d.s.u2.nonInlineCharsLatin1);
   }
 
-  size_t nbytes = length() * sizeof(CharT);
+  // Extensible strings may have chars past their length that can be appended
+  // to in place, so move the whole capacity.
+  size_t count = isExtensible() ? asExtensible().capacity() : length();
+  size_t nbytes = count * sizeof(CharT);
   if (nursery->maybeMoveBufferOnPromotion(const_cast<void**>(chars), this,
                                           nbytes, js::MemoryUse::StringContents,
                                           js::StringBufferArena) ==
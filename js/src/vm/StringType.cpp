@@ -629,6 +629,20 @@ static MOZ_ALWAYS_INLINE bool AllocCharsForFlatten(Nursery& nursery,
     *capacity = calcCapacity(length, JSString::MAX_LENGTH);
     MOZ_ASSERT(length <= *capacity);
     MOZ_ASSERT(*capacity <= JSString::MAX_LENGTH);
+    *hasStringBuffer = false;
+
+    // Short-lived flattened strings are common, so try to allocate the chars
+    // of a nursery string in the nursery. This avoids a malloc/free pair if
+    // the string dies before the next minor GC. The chars are moved to the
+    // malloc heap if the string is promoted.
+    if (!str->isTenured()) {
+      void* buffer = nursery.tryAllocateNurseryBuffer(
+          str->zone(), *capacity * sizeof(CharT), js::StringBufferArena);
+      if (buffer) {
+        *chars = static_cast<CharT*>(buffer);
+        return true;
+      }
+    }
 
     auto buffer = str->zone()->make_pod_arena_array<CharT>(
         js::StringBufferArena, *capacity);
@@ -642,7 +656,6 @@ static MOZ_ALWAYS_INLINE bool AllocCharsForFlatten(Nursery& nursery,
       }
     }
     *chars = buffer.release();
-    *hasStringBuffer = false;
     return true;
   }
 
@@ -969,14 +982,20 @@ static bool UpdateNurseryBuffersOnTransfer(js::Nursery& nursery,
   return true;
 }
 
-static bool CanReuseLeftmostBuffer(JSString* leftmostChild, size_t wholeLength,
-                                   bool hasTwoByteChars) {
+static bool CanReuseLeftmostBuffer(JSString* leftmostChild, JSRope* root,
+                                   size_t wholeLength, bool hasTwoByteChars) {
   if (!leftmostChild->isExtensible()) {
     return false;
   }
 
   JSExtensibleString& str = leftmostChild->asExtensible();
 
+  // Chars allocated in the nursery can't be given to a tenured string.
+  if (root->isTenured() && !str.isTenured() && !str.hasStringBuffer() &&
+      !str.ownsMallocedChars()) {
+    return false;
+  }
+
   // Don't mutate the StringBuffer if there are other references to it, possibly
   // on other threads.
   if (str.hasStringBuffer() && str.stringBuffer()->IsReadonly()) {
@@ -1099,7 +1118,7 @@ JSLinearString* JSRope::flattenInternal(JSRope* root) {
   JSString* leftmostChild = leftmostRope->leftChild();
 
   bool reuseLeftmostBuffer = CanReuseLeftmostBuffer(
-      leftmostChild, wholeLength, std::is_same_v<CharT, char16_t>);
+      leftmostChild, root, wholeLength, std::is_same_v<CharT, char16_t>);
 
   bool hasStringBuffer = false;
   if (reuseLeftmostBuffer) {
@@ -1221,13 +1240,18 @@ finish_root:
   root->setLengthAndFlags(wholeLength, flags);
   root->setNonInlineChars(wholeChars, hasStringBuffer);
   root->d.s.u3.capacity = wholeCapacity;
-  AddCellMemory(root, root->asLinear().allocSize(), MemoryUse::StringContents);
+  if (root->isTenured()) {
+    AddCellMemory(root, root->asLinear().allocSize(),
+                  MemoryUse::StringContents);
+  }
 
   if (reuseLeftmostBuffer) {
     // Remove memory association for left node we're about to make into a
     // dependent string.
     JSString& left = *leftmostChild;
-    RemoveCellMemory(&left, left.allocSize(), MemoryUse::StringContents);
+    if (left.isTenured()) {
+      RemoveCellMemory(&left, left.allocSize(), MemoryUse::StringContents);
+    }
 
     // Inherit NON_DEDUP_BIT from the leftmost string.
     newRootFlags |= left.flags() & NON_DEDUP_BIT;
@@ -77,6 +77,7 @@
 #include "vm/JSObject-inl.h"
 #include "vm/NativeObject-inl.h"
 #include "vm/ObjectOperations-inl.h"
+#include "vm/PlainObject-inl.h"
 #include "vm/Realm-inl.h"
 
 using namespace js;
@@ -150,6 +151,14 @@ enum StructuredDataType : uint32_t {
   SCTAG_RESIZABLE_ARRAY_BUFFER_OBJECT,
   SCTAG_GROWABLE_SHARED_ARRAY_BUFFER_OBJECT,
 
+  // The shape template tags are new data types, which don't require bumping
+  // JS_STRUCTURED_CLONE_VERSION: older readers reject them as an unsupported
+  // type, and data written before them is read as before. They are never
+  // written for IndexedDB.
+  SCTAG_SHAPE_TEMPLATE_DEFINITION,
+  SCTAG_SHAPE_TEMPLATE_OBJECT,
+  SCTAG_SHAPE_TEMPLATE_HOLE,
+
   SCTAG_TYPED_ARRAY_V1_MIN = 0xFFFF0100,
   SCTAG_TYPED_ARRAY_V1_INT8 = SCTAG_TYPED_ARRAY_V1_MIN + Scalar::Int8,
   SCTAG_TYPED_ARRAY_V1_UINT8 = SCTAG_TYPED_ARRAY_V1_MIN + Scalar::Uint8,
@@ -491,6 +500,15 @@ struct JSStructuredCloneReader {
 
   [[nodiscard]] bool readObjectField(HandleObject obj, HandleValue key);
 
+  // Objects written with a shape template contain the values of the keys of
+  // the template, in order.
+  [[nodiscard]] bool readShapeTemplate(uint32_t numKeys);
+  [[nodiscard]] bool readTemplateObject(uint32_t templateIndex,
+                                        MutableHandleValue vp);
+  [[nodiscard]] bool readTemplateField(Handle<PlainObject*> obj,
+                                       size_t stateIdx);
+  [[nodiscard]] bool finishTemplateObject(Handle<PlainObject*> obj);
+
   [[nodiscard]] bool startRead(
       MutableHandleValue vp,
       ShouldAtomizeStrings atomizeStrings = DontAtomizeStrings);
@@ -524,6 +542,50 @@ struct JSStructuredCloneReader {
   // have been read yet.
   Rooted<GCVector<std::pair<HeapPtr<JSObject*>, bool>, 8>> objState;
 
+  // The shape templates read so far, indexed by template id. The keys of all
+  // templates are stored in `templateKeys`. Once an object has been built from
+  // a template, its shape is used to allocate the next objects of the same
+  // template with all their properties.
+  struct ShapeTemplate {
+    uint32_t keysStart;
+    uint32_t numKeys;
+    HeapPtr<SharedShape*> shape;
+
+    ShapeTemplate(uint32_t keysStart, uint32_t numKeys)
+        : keysStart(keysStart), numKeys(numKeys) {}
+
+    void trace(JSTracer* trc) {
+      TraceNullableEdge(trc, &shape, "structured clone shape template");
+    }
+  };
+  Rooted<GCVector<ShapeTemplate>> shapeTemplates;
+  RootedIdVector templateKeys;
+
+  // Stack of the objects of `objs` which are read with a shape template, and
+  // the number of values read for each of them. As with `objState`, the top
+  // of this stack is the top of `objs` iff that object uses a template.
+  struct TemplateState {
+    HeapPtr<PlainObject*> obj;
+    uint32_t templateIndex;
+    uint32_t numValues = 0;
+
+    // Bit i is set if the i-th key of the template was deleted from the
+    // source object before its value was written. There are at most
+    // MaxShapeTemplateKeys keys.
+    uint64_t holes = 0;
+
+    // Whether the object was allocated with the shape of the template.
+    bool hasShape;
+
+    TemplateState(PlainObject* obj, uint32_t templateIndex, bool hasShape)
+        : obj(obj), templateIndex(templateIndex), hasShape(hasShape) {}
+
+    void trace(JSTracer* trc) {
+      TraceEdge(trc, &obj, "structured clone template object");
+    }
+  };
+  Rooted<GCVector<TemplateState, 8>> templateState;
+
   // Array of all objects read during this deserialization, for resolving
   // backreferences.
   //
@@ -583,6 +645,10 @@ struct JSStructuredCloneWriter {
         counts(cx),
         objectEntries(cx),
         otherEntries(cx),
+        templateObjs(cx),
+        templateObjIndices(cx),
+        shapeTemplates(cx, GCVector<Shape*>(cx)),
+        lastShapeTemplate(0),
         memory(cx),
         transferable(cx, tVal),
         transferableObjects(cx, TransferableObjectsList(cx)),
@@ -623,6 +689,8 @@ struct JSStructuredCloneWriter {
   bool writePrimitive(HandleValue v);
   bool startWrite(HandleValue v);
   bool traverseObject(HandleObject obj, ESClass cls);
+  bool traverseTemplateObject(Handle<PlainObject*> obj, uint32_t templateIndex);
+  bool writeTemplateField(Handle<PlainObject*> obj);
   bool traverseMap(HandleObject obj);
   bool traverseSet(HandleObject obj);
   bool traverseSavedFrame(HandleObject obj);
@@ -664,6 +732,17 @@ struct JSStructuredCloneWriter {
   // For Error: cause, errors, stack
   RootedValueVector otherEntries;
 
+  // Stack of the objects of `objs` which are written with a shape template,
+  // and the template id of each. The top of this stack is the top of `objs`
+  // iff that object uses a template.
+  RootedObjectVector templateObjs;
+  Vector<uint32_t> templateObjIndices;
+
+  // Shapes whose keys have been written, indexed by template id, and the last
+  // template used.
+  Rooted<GCVector<Shape*>> shapeTemplates;
+  uint32_t lastShapeTemplate;
+
   // The "memory" list described in the HTML5 internal structured cloning
   // algorithm.  memory is a superset of objs; items are never removed from
   // Memory until a serialization operation is finished
@@ -1632,6 +1711,38 @@ static bool TryAppendNativeProperties(JSContext* cx, HandleObject obj,
   return true;
 }
 
+// Limits on the shape templates of a single serialization. The reader checks
+// them too, such that corrupt data cannot make it allocate unbounded state.
+static constexpr uint32_t MaxShapeTemplates = 64;
+static constexpr uint32_t MaxShapeTemplateKeys = 64;
+
+// Plain objects whose properties are all enumerable, string-keyed data
+// properties can be written with a shape template: the keys of their shape are
+// written once, with the first such object, and the following objects with the
+// same shape only refer to the template and write their values.
+static bool CanUseShapeTemplate(JSObject* obj) {
+  if (!obj->is<PlainObject>()) {
+    return false;
+  }
+
+  PlainObject* nobj = &obj->as<PlainObject>();
+  if (nobj->inDictionaryMode() || nobj->isIndexed() ||
+      nobj->getDenseInitializedLength() != 0) {
+    return false;
+  }
+
+  uint32_t count = 0;
+  for (ShapePropertyIter<NoGC> iter(nobj->shape()); !iter.done(); iter++) {
+    if (!iter->enumerable() || !iter->isDataProperty() ||
+        iter->key().isSymbol()) {
+      return false;
+    }
+    count++;
+  }
+
+  return count > 0 && count <= MaxShapeTemplateKeys;
+}
+
 // Objects are written as a "preorder" traversal of the object graph: object
 // "headers" (the class tag and any data needed for initial construction) are
 // visited first, then the children are recursed through (where children are
@@ -1657,7 +1768,43 @@ static bool TryAppendNativeProperties(JSContext* cx, HandleObject obj,
 // This nests nicely (ie, an entire recursive value starts with its tag and
 // ends with its end-of-children marker) and so it can be presented indented.
 // But see traverseMap below for how this looks different for Maps.
+//
+// Objects written with a shape template store their values without keys, in
+// the order of the properties of the template:
+//
+//     <Shape template definition tag, number of keys>
+//       <key1 data>
+//       <key2 data>
+//       <val1 data>
+//       <val2 data>
+//     <end-of-children marker>
+//     <Shape template object tag, template id>
+//       <val1 data>
+//       <val2 data>
+//     <end-of-children marker>
+//
+// This encoding is not used for IndexedDB, whose data is persisted.
 bool JSStructuredCloneWriter::traverseObject(HandleObject obj, ESClass cls) {
+  if (cls == ESClass::Object && !js::SupportDifferentialTesting() &&
+      output().scope() !=
+          JS::StructuredCloneScope::DifferentProcessForIndexedDB &&
+      CanUseShapeTemplate(obj)) {
+    Shape* shape = obj->shape();
+    uint32_t templateIndex = lastShapeTemplate;
+    if (templateIndex >= shapeTemplates.length() ||
+        shapeTemplates[templateIndex] != shape) {
+      templateIndex = 0;
+      while (templateIndex < shapeTemplates.length() &&
+             shapeTemplates[templateIndex] != shape) {
+        templateIndex++;
+      }
+    }
+
+    if (templateIndex < MaxShapeTemplates) {
+      return traverseTemplateObject(obj.as<PlainObject>(), templateIndex);
+    }
+  }
+
   size_t count;
   bool optimized = false;
   if (!js::SupportDifferentialTesting()) {
@@ -1716,6 +1863,88 @@ bool JSStructuredCloneWriter::traverseObject(HandleObject obj, ESClass cls) {
   return out.writePair(SCTAG_OBJECT_OBJECT, 0);
 }
 
+bool JSStructuredCloneWriter::traverseTemplateObject(Handle<PlainObject*> obj,
+                                                     uint32_t templateIndex) {
+  bool isDefinition = templateIndex == shapeTemplates.length();
+
+  // The values are read as each of them is written, see writeTemplateField.
+  RootedIdVector keys(context());
+  size_t count = 0;
+  for (ShapePropertyIter<NoGC> iter(obj->shape()); !iter.done(); iter++) {
+    if (isDefinition && !keys.append(iter->key())) {
+      return false;
+    }
+    count++;
+  }
+
+  if (!objs.append(ObjectValue(*obj)) || !counts.append(count) ||
+      !templateObjs.append(obj.get()) ||
+      !templateObjIndices.append(templateIndex)) {
+    return false;
+  }
+
+  checkStack();
+
+  lastShapeTemplate = templateIndex;
+  if (!isDefinition) {
+    return out.writePair(SCTAG_SHAPE_TEMPLATE_OBJECT, templateIndex);
+  }
+
+  if (!shapeTemplates.append(obj->shape())) {
+    return false;
+  }
+
+  // The property iterator goes from the last to the first property, so the
+  // keys are written backwards.
+  if (!out.writePair(SCTAG_SHAPE_TEMPLATE_DEFINITION, uint32_t(count))) {
+    return false;
+  }
+  for (size_t i = keys.length(); i > 0; --i) {
+    if (!writeString(SCTAG_STRING, keys[i - 1].toString())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Write the value of the next key of the template of `obj`. Writing the
+// previous values may have run getters, which can modify or delete this
+// property, so as for other objects the value is looked up now.
+bool JSStructuredCloneWriter::writeTemplateField(Handle<PlainObject*> obj) {
+  Shape* shape = shapeTemplates[templateObjIndices.back()];
+
+  // The values are written in property order, and the properties of a shared
+  // shape of a plain object use consecutive slots in that same order.
+  uint32_t numKeys = shape->asShared().slotSpan();
+  uint32_t index = numKeys - uint32_t(counts.back()) - 1;
+
+  RootedValue val(context());
+  if (obj->shape() == shape) {
+    val = obj->getSlot(index);
+    return startWrite(val);
+  }
+
+  // The shape changed: use the generic lookup for the key of the template,
+  // and write a hole if the property has been deleted.
+  RootedId id(context());
+  for (ShapePropertyIter<NoGC> iter(shape); !iter.done(); iter++) {
+    if (iter->slot() == index) {
+      id = iter->key();
+      break;
+    }
+  }
+  MOZ_ASSERT(!id.isVoid());
+
+  bool found;
+  if (!HasOwnProperty(context(), obj, id, &found)) {
+    return false;
+  }
+  if (!found) {
+    return out.writePair(SCTAG_SHAPE_TEMPLATE_HOLE, 0);
+  }
+  return GetProperty(context(), obj, obj, id, &val) && startWrite(val);
+}
+
 // Use the same basic setup as for traverseObject, but now keys can themselves
 // be complex objects. Keys and values are visited first via startWrite(), then
 // the key's children (if any) are handled, then the value's children.
@@ -2437,9 +2666,19 @@ bool JSStructuredCloneWriter::write(HandleValue v) {
   while (!counts.empty()) {
     obj = &objs.back().toObject();
     context()->check(obj);
+    bool usesTemplate =
+        !templateObjs.empty() && templateObjs.back() == obj.get();
     if (counts.back()) {
       counts.back()--;
 
+      if (usesTemplate) {
+        Rooted<PlainObject*> plainObj(context(), &obj->as<PlainObject>());
+        if (!writeTemplateField(plainObj)) {
+          return false;
+        }
+        continue;
+      }
+
       ESClass cls;
       if (!GetBuiltinClass(context(), obj, &cls)) {
         return false;
@@ -2519,6 +2758,10 @@ bool JSStructuredCloneWriter::write(HandleValue v) {
       }
       objs.popBack();
       counts.popBack();
+      if (usesTemplate) {
+        templateObjs.popBack();
+        templateObjIndices.popBack();
+      }
     }
   }
 
@@ -2535,6 +2778,9 @@ JSStructuredCloneReader::JSStructuredCloneReader(
       cloneDataPolicy(cloneDataPolicy),
       objs(in.context()),
       objState(in.context(), in.context()),
+      shapeTemplates(in.context(), in.context()),
+      templateKeys(in.context()),
+      templateState(in.context(), in.context()),
       allObjs(in.context()),
       numItemsRead(0),
       callbacks(cb),
@@ -3202,6 +3448,21 @@ bool JSStructuredCloneReader::startRead(MutableHandleValue vp,
       break;
     }
 
+    case SCTAG_SHAPE_TEMPLATE_DEFINITION:
+    case SCTAG_SHAPE_TEMPLATE_OBJECT: {
+      uint32_t templateIndex = data;
+      if (tag == SCTAG_SHAPE_TEMPLATE_DEFINITION) {
+        templateIndex = shapeTemplates.length();
+        if (!readShapeTemplate(data)) {
+          return false;
+        }
+      }
+      if (!readTemplateObject(templateIndex, vp)) {
+        return false;
+      }
+      break;
+    }
+
     case SCTAG_BACK_REFERENCE_OBJECT: {
       if (data >= allObjs.length() || !allObjs[data].isObject()) {
         JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
@@ -3923,6 +4184,171 @@ bool JSStructuredCloneReader::readObjectField(HandleObject obj,
   return DefineDataProperty(context(), obj, id, val);
 }
 
+bool JSStructuredCloneReader::readShapeTemplate(uint32_t numKeys) {
+  if (shapeTemplates.length() >= MaxShapeTemplates || numKeys == 0 ||
+      numKeys > MaxShapeTemplateKeys) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "invalid shape template");
+    return false;
+  }
+
+  uint32_t keysStart = templateKeys.length();
+  RootedId id(context());
+  for (uint32_t i = 0; i < numKeys; i++) {
+    uint32_t tag, data;
+    if (!in.readPair(&tag, &data)) {
+      return false;
+    }
+    if (tag != SCTAG_STRING) {
+      JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                                JSMSG_SC_BAD_SERIALIZED_DATA,
+                                "property key expected");
+      return false;
+    }
+
+    JSString* str = readString(data, AtomizeStrings);
+    if (!str) {
+      return false;
+    }
+
+    // Templates only contain named properties.
+    id = AtomToId(&str->asAtom());
+    if (!id.isString()) {
+      JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                                JSMSG_SC_BAD_SERIALIZED_DATA,
+                                "invalid shape template key");
+      return false;
+    }
+    if (!templateKeys.append(id)) {
+      return false;
+    }
+  }
+
+  return shapeTemplates.append(ShapeTemplate(keysStart, numKeys));
+}
+
+bool JSStructuredCloneReader::readTemplateObject(uint32_t templateIndex,
+                                                 MutableHandleValue vp) {
+  if (templateIndex >= shapeTemplates.length()) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "invalid shape template");
+    return false;
+  }
+
+  NewObjectKind kind =
+      gcHeap == gc::Heap::Tenured ? TenuredObject : GenericObject;
+  Rooted<SharedShape*> shape(context(), shapeTemplates[templateIndex].shape);
+  PlainObject* obj;
+  if (shape) {
+    // All the slots are initialized to undefined, and set as the values are
+    // read.
+    obj = PlainObject::createWithShape(context(), shape, kind);
+  } else {
+    obj = NewPlainObject(context(), kind);
+  }
+  if (!obj || !objs.append(ObjectValue(*obj)) ||
+      !templateState.append(TemplateState(obj, templateIndex, !!shape))) {
+    return false;
+  }
+
+  vp.setObject(*obj);
+  return true;
+}
+
+bool JSStructuredCloneReader::readTemplateField(Handle<PlainObject*> obj,
+                                                size_t stateIdx) {
+  // Reading the value may append templates and template objects, so don't
+  // keep references to them across startRead().
+  uint32_t templateIndex = templateState[stateIdx].templateIndex;
+  uint32_t valueIndex = templateState[stateIdx].numValues;
+  bool hasShape = templateState[stateIdx].hasShape;
+  if (valueIndex >= shapeTemplates[templateIndex].numKeys) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "too many values for shape template");
+    return false;
+  }
+  RootedId id(context(),
+              templateKeys[shapeTemplates[templateIndex].keysStart +
+                           valueIndex]);
+
+  // The property was deleted from the source object while it was written.
+  uint32_t tag, data;
+  if (!in.getPair(&tag, &data)) {
+    return false;
+  }
+  if (tag == SCTAG_SHAPE_TEMPLATE_HOLE) {
+    MOZ_ALWAYS_TRUE(in.readPair(&tag, &data));
+    templateState[stateIdx].holes |= uint64_t(1) << valueIndex;
+    templateState[stateIdx].numValues++;
+    return true;
+  }
+
+  RootedValue val(context());
+  if (!startRead(&val)) {
+    return false;
+  }
+  templateState[stateIdx].numValues++;
+
+  // The properties of a shared shape are stored in the order they were added.
+  if (hasShape) {
+    obj->setSlot(valueIndex, val);
+    return true;
+  }
+
+  // Guard against duplicate keys in corrupt or malicious data.
+  if (MOZ_UNLIKELY(obj->contains(context(), id))) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "duplicate shape template key");
+    return false;
+  }
+  return AddDataPropertyToPlainObject(context(), obj, id, val);
+}
+
+bool JSStructuredCloneReader::finishTemplateObject(Handle<PlainObject*> obj) {
+  MOZ_ASSERT(templateState.back().obj.get() == obj.get());
+  uint32_t templateIndex = templateState.back().templateIndex;
+  uint32_t numValues = templateState.back().numValues;
+  uint64_t holes = templateState.back().holes;
+  bool hasShape = templateState.back().hasShape;
+  templateState.popBack();
+
+  ShapeTemplate& shapeTemplate = shapeTemplates[templateIndex];
+  if (numValues != shapeTemplate.numKeys) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "missing values for shape template");
+    return false;
+  }
+
+  if (holes) {
+    // Objects allocated with the shape of the template have all its keys;
+    // remove the deleted ones now that their slots are no longer needed.
+    if (hasShape) {
+      RootedId id(context());
+      for (uint32_t i = 0; i < numValues; i++) {
+        if (holes & (uint64_t(1) << i)) {
+          id = templateKeys[shapeTemplate.keysStart + i];
+          ObjectOpResult result;
+          if (!NativeDeleteProperty(context(), obj, id, result)) {
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  if (!shapeTemplate.shape && !obj->inDictionaryMode() &&
+      obj->slotSpan() == numValues) {
+    shapeTemplate.shape = obj->sharedShape();
+  }
+  return true;
+}
+
 // Perform the whole recursive reading procedure.
 bool JSStructuredCloneReader::read(MutableHandleValue vp, size_t nbytes) {
   auto startTime = mozilla::TimeStamp::Now();
@@ -3951,6 +4377,8 @@ bool JSStructuredCloneReader::read(MutableHandleValue vp, size_t nbytes) {
   while (objs.length() != 0) {
     // What happens depends on the top obj on the objs stack.
     RootedObject obj(context(), &objs.back().toObject());
+    bool usesTemplate =
+        !templateState.empty() && templateState.back().obj.get() == obj.get();
 
     uint32_t tag, data;
     if (!in.getPair(&tag, &data)) {
@@ -3965,6 +4393,20 @@ bool JSStructuredCloneReader::read(MutableHandleValue vp, size_t nbytes) {
       if (objState.back().first == obj) {
         objState.popBack();
       }
+      if (usesTemplate) {
+        Rooted<PlainObject*> plainObj(context(), &obj->as<PlainObject>());
+        if (!finishTemplateObject(plainObj)) {
+          return false;
+        }
+      }
+      continue;
+    }
+
+    if (usesTemplate) {
+      Rooted<PlainObject*> plainObj(context(), &obj->as<PlainObject>());
+      if (!readTemplateField(plainObj, templateState.length() - 1)) {
+        return false;
+      }
       continue;
     }
 
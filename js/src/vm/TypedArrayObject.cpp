@@ -4053,15 +4053,15 @@ static bool TypedArrayCountingSort(JSContext* cx, TypedArrayObject* typedArray,
   return true;
 }
 
-template <typename T, typename U, typename Ops>
-static void SortByColumn(SharedMem<U*> data, size_t length, SharedMem<U*> aux,
-                         uint8_t col) {
-  static_assert(std::is_unsigned_v<U>, "SortByColumn sorts on unsigned values");
-  static_assert(std::is_same_v<Ops, UnsharedOps>,
-                "SortByColumn only works on unshared data");
-
-  // |counts| is used to compute the starting index position for each key.
-  // Letting counts[0] always be 0, simplifies the transform step below.
+template <typename T, typename U>
+static void SortByColumns(SharedMem<U*> data, size_t length,
+                          SharedMem<U*> aux) {
+  static_assert(std::is_unsigned_v<U>,
+                "SortByColumns sorts on unsigned values");
+
+  // |counts[col]| is used to compute the starting index position for each key
+  // of the column |col|. Letting counts[col][0] always be 0, simplifies the
+  // transform step below.
   // Example:
   //
   // Computing frequency counts for the input [1 2 1] gives:
@@ -4073,44 +4073,72 @@ static void SortByColumn(SharedMem<U*> data, size_t length, SharedMem<U*> aux,
   //      0 0 2 3     (indexes)
 
   constexpr size_t R = 256;
+  constexpr size_t Columns = sizeof(U);
 
   // Initialize all entries to zero.
-  size_t counts[R + 1] = {};
+  size_t counts[Columns][R + 1] = {};
 
-  const auto ByteAtCol = [col](U x) {
+  const auto ByteAtCol = [](U x, size_t col) {
     U y = UnsignedSortValue<T, U>(x);
     return static_cast<uint8_t>(y >> (col * 8));
   };
 
-  // Compute frequency counts.
+  // Compute frequency counts of all columns in a single pass.
   for (size_t i = 0; i < length; i++) {
-    U val = Ops::load(data + i);
-    uint8_t b = ByteAtCol(val);
-    counts[b + 1]++;
+    U val = UnsharedOps::load(data + i);
+    for (size_t col = 0; col < Columns; col++) {
+      counts[col][ByteAtCol(val, col) + 1]++;
+    }
   }
 
-  // Transform counts to indices.
-  std::partial_sum(std::begin(counts), std::end(counts), std::begin(counts));
+  // Each pass distributes the values from |src| into |dst|, then the buffers
+  // are swapped for the next pass.
+  SharedMem<U*> src = data;
+  SharedMem<U*> dst = aux;
+  bool sortedInAux = false;
 
-  // Distribute
-  for (size_t i = 0; i < length; i++) {
-    U val = Ops::load(data + i);
-    uint8_t b = ByteAtCol(val);
-    size_t j = counts[b]++;
-    MOZ_ASSERT(j < length,
-               "index is in bounds when |data| can't be modified concurrently");
-    UnsharedOps::store(aux + j, val);
+  for (size_t col = 0; col < Columns; col++) {
+    size_t* colCounts = counts[col];
+
+    // Distributing a column in which all values have the same key doesn't
+    // change their order. This is common for the upper bytes of small
+    // integers, and for the exponent bytes of floating point values of
+    // similar magnitude.
+    if (colCounts[ByteAtCol(UnsharedOps::load(src), col) + 1] == length) {
+      continue;
+    }
+
+    // Transform counts to indices.
+    std::partial_sum(colCounts, colCounts + R + 1, colCounts);
+
+    // Distribute
+    for (size_t i = 0; i < length; i++) {
+      U val = UnsharedOps::load(src + i);
+      uint8_t b = ByteAtCol(val, col);
+      size_t j = colCounts[b]++;
+      MOZ_ASSERT(j < length,
+                 "index is in bounds when |data| can't be modified "
+                 "concurrently");
+      UnsharedOps::store(dst + j, val);
+    }
+
+    std::swap(src, dst);
+    sortedInAux = !sortedInAux;
   }
 
   // Copy back
-  Ops::podCopy(data, aux, length);
+  if (sortedInAux) {
+    UnsharedOps::podCopy(data, aux, length);
+  }
 }
 
 template <typename T, typename Ops>
 static bool TypedArrayRadixSort(JSContext* cx, TypedArrayObject* typedArray,
                                 size_t length) {
-  // Determined by performance testing.
-  constexpr size_t StdSortMinCutoff = sizeof(T) == 2 ? 64 : 256;
+  // Determined by performance testing. Eight byte values need twice as many
+  // passes as four byte values, so only use radix sort for larger arrays.
+  constexpr size_t StdSortMinCutoff =
+      sizeof(T) == 2 ? 64 : sizeof(T) == 4 ? 256 : 1024;
 
   // Radix sort uses O(n) additional space, limit this space to 64 MB.
   constexpr size_t StdSortMaxCutoff = (64 * 1024 * 1024) / sizeof(T);
@@ -4166,9 +4194,7 @@ static bool TypedArrayRadixSort(JSContext* cx, TypedArrayObject* typedArray,
     data = unshared;
   }
 
-  for (uint8_t col = 0; col < sizeof(UnsignedT); col++) {
-    SortByColumn<T, UnsignedT, UnsharedOps>(data, length, aux, col);
-  }
+  SortByColumns<T, UnsignedT>(data, length, aux);
 
   if constexpr (std::is_same_v<Ops, SharedOps>) {
     Ops::podCopy(shared, unshared, length);
@@ -4186,18 +4212,11 @@ TypedArraySort() {
 }
 
 template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 2 || sizeof(T) == 4,
-                                           TypedArraySortFn>
+static constexpr typename std::enable_if_t<sizeof(T) != 1, TypedArraySortFn>
 TypedArraySort() {
   return TypedArrayRadixSort<T, Ops>;
 }
 
-template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 8, TypedArraySortFn>
-TypedArraySort() {
-  return TypedArrayStdSort<T, Ops>;
-}
-
 static bool TypedArraySortWithoutComparator(JSContext* cx,
                                             TypedArrayObject* typedArray,
                                             size_t len) {
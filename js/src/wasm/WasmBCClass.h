@@ -312,6 +312,26 @@ struct BaseCompiler final {
   // Locals that have been bounds checked and not updated since
   BCESet bceSafe_;
 
+  ///////////////////////////////////////////////////////////////////////////
+  //
+  // State for caching i32 locals in registers.
+
+  // A few i32 locals whose current value is also held in an allocated
+  // register, so that reading them does not have to go to the frame.  The
+  // cache is filled by local.set, which would otherwise free the register.
+  //
+  // Locals are always written through to the frame, so an entry can be dropped
+  // at any time without emitting code.  The cache is emptied by sync(), before
+  // any opcode that is not straight-line code (see PreservesLocalCache()),
+  // and when the register allocator runs out of registers.
+  struct CachedLocal {
+    uint32_t slot;
+    RegI32 reg;
+  };
+  static constexpr size_t MaxCachedLocals = 2;
+  CachedLocal cachedLocals_[MaxCachedLocals];
+  size_t numCachedLocals_;
+
   ///////////////////////////////////////////////////////////////////////////
   //
   // State for boolean-evaluation-for-control.
@@ -463,6 +483,15 @@ struct BaseCompiler final {
   [[nodiscard]] inline RegI64 needI64Pair();
 #endif
 
+  // Cached i32 locals, see cachedLocals_.  cacheLocal() takes ownership of
+  // |r|, which must hold the value just stored to the local.
+  inline bool findCachedLocal(uint32_t slot, RegI32* reg) const;
+  inline void cacheLocal(uint32_t slot, RegI32 r);
+  inline void uncacheLocal(uint32_t slot);
+  inline void uncacheLocalRegister(Register r);
+  inline void invalidateLocalCache();
+  inline void removeCachedLocal(size_t index);
+
   inline void freeAny(AnyReg r);
   inline void freeI32(RegI32 r);
   inline void freeI64(RegI64 r);
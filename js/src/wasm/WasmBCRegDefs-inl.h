@@ -26,8 +26,14 @@ namespace js {
 namespace wasm {
 // TODO / OPTIMIZE (Bug 1316802): Do not sync everything on allocation
 // failure, only as much as we need.
+//
+// Registers holding cached locals are given up before resorting to sync(),
+// see BaseCompiler::cachedLocals_.
 
 RegI32 BaseRegAlloc::needI32() {
+  if (!hasGPR()) {
+    bc->invalidateLocalCache();
+  }
   if (!hasGPR()) {
     bc->sync();
   }
@@ -35,6 +41,9 @@ RegI32 BaseRegAlloc::needI32() {
 }
 
 void BaseRegAlloc::needI32(RegI32 specific) {
+  if (!isAvailableI32(specific)) {
+    bc->uncacheLocalRegister(specific);
+  }
   if (!isAvailableI32(specific)) {
     bc->sync();
   }
@@ -42,6 +51,9 @@ void BaseRegAlloc::needI32(RegI32 specific) {
 }
 
 RegI64 BaseRegAlloc::needI64() {
+  if (!hasGPR64()) {
+    bc->invalidateLocalCache();
+  }
   if (!hasGPR64()) {
     bc->sync();
   }
@@ -49,6 +61,9 @@ RegI64 BaseRegAlloc::needI64() {
 }
 
 void BaseRegAlloc::needI64(RegI64 specific) {
+  if (!isAvailableI64(specific)) {
+    bc->invalidateLocalCache();
+  }
   if (!isAvailableI64(specific)) {
     bc->sync();
   }
@@ -56,6 +71,9 @@ void BaseRegAlloc::needI64(RegI64 specific) {
 }
 
 RegRef BaseRegAlloc::needRef() {
+  if (!hasGPR()) {
+    bc->invalidateLocalCache();
+  }
   if (!hasGPR()) {
     bc->sync();
   }
@@ -63,6 +81,9 @@ RegRef BaseRegAlloc::needRef() {
 }
 
 void BaseRegAlloc::needRef(RegRef specific) {
+  if (!isAvailableRef(specific)) {
+    bc->uncacheLocalRegister(specific);
+  }
   if (!isAvailableRef(specific)) {
     bc->sync();
   }
@@ -70,6 +91,9 @@ void BaseRegAlloc::needRef(RegRef specific) {
 }
 
 RegPtr BaseRegAlloc::needPtr() {
+  if (!hasGPR()) {
+    bc->invalidateLocalCache();
+  }
   if (!hasGPR()) {
     bc->sync();
   }
@@ -77,6 +101,9 @@ RegPtr BaseRegAlloc::needPtr() {
 }
 
 void BaseRegAlloc::needPtr(RegPtr specific) {
+  if (!isAvailablePtr(specific)) {
+    bc->uncacheLocalRegister(specific);
+  }
   if (!isAvailablePtr(specific)) {
     bc->sync();
   }
@@ -84,6 +111,9 @@ void BaseRegAlloc::needPtr(RegPtr specific) {
 }
 
 RegPtr BaseRegAlloc::needTempPtr(RegPtr fallback, bool* saved) {
+  if (!hasGPR()) {
+    bc->invalidateLocalCache();
+  }
   if (hasGPR()) {
     *saved = false;
     return RegPtr(allocGPR());
@@ -165,6 +195,9 @@ void BaseRegAlloc::freeTempPtr(RegPtr r, bool saved) {
 
 #ifdef JS_CODEGEN_ARM
 RegI64 BaseRegAlloc::needI64Pair() {
+  if (!hasGPRPair()) {
+    bc->invalidateLocalCache();
+  }
   if (!hasGPRPair()) {
     bc->sync();
   }
@@ -197,6 +197,70 @@ void BaseCompiler::needI32NoSync(RegI32 r) {
   needI32(r);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Cached i32 locals.
+
+bool BaseCompiler::findCachedLocal(uint32_t slot, RegI32* reg) const {
+  for (size_t i = 0; i < numCachedLocals_; i++) {
+    if (cachedLocals_[i].slot == slot) {
+      *reg = cachedLocals_[i].reg;
+      return true;
+    }
+  }
+  return false;
+}
+
+void BaseCompiler::removeCachedLocal(size_t index) {
+  MOZ_ASSERT(index < numCachedLocals_);
+  freeI32(cachedLocals_[index].reg);
+  for (size_t i = index + 1; i < numCachedLocals_; i++) {
+    cachedLocals_[i - 1] = cachedLocals_[i];
+  }
+  numCachedLocals_--;
+}
+
+void BaseCompiler::cacheLocal(uint32_t slot, RegI32 r) {
+  MOZ_ASSERT(!isAvailableI32(r));
+  uncacheLocal(slot);
+
+  // The debugger can change locals in the frame behind our back.
+  if (compilerEnv_.debugEnabled()) {
+    freeI32(r);
+    return;
+  }
+
+  // Evict the oldest entry.
+  if (numCachedLocals_ == MaxCachedLocals) {
+    removeCachedLocal(0);
+  }
+  cachedLocals_[numCachedLocals_++] = CachedLocal{slot, r};
+}
+
+void BaseCompiler::uncacheLocal(uint32_t slot) {
+  for (size_t i = 0; i < numCachedLocals_; i++) {
+    if (cachedLocals_[i].slot == slot) {
+      removeCachedLocal(i);
+      return;
+    }
+  }
+}
+
+void BaseCompiler::uncacheLocalRegister(Register r) {
+  for (size_t i = 0; i < numCachedLocals_; i++) {
+    if (cachedLocals_[i].reg == r) {
+      removeCachedLocal(i);
+      return;
+    }
+  }
+}
+
+void BaseCompiler::invalidateLocalCache() {
+  while (numCachedLocals_ > 0) {
+    removeCachedLocal(numCachedLocals_ - 1);
+  }
+}
+
 // TODO / OPTIMIZE: need2xI32() can be optimized along with needI32()
 // to avoid sync(). (Bug 1316802)
 
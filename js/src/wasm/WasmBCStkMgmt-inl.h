@@ -57,6 +57,11 @@ void BaseCompiler::loadMemI32(const Stk& src, RegI32 dest) {
 }
 
 void BaseCompiler::loadLocalI32(const Stk& src, RegI32 dest) {
+  RegI32 cached;
+  if (findCachedLocal(src.slot(), &cached)) {
+    masm.move32(cached, dest);
+    return;
+  }
   fr.loadLocalI32(localFromSlot(src.slot(), MIRType::Int32), dest);
 }
 
@@ -452,6 +457,8 @@ void BaseCompiler::sync() {
       }
     }
   }
+
+  invalidateLocalCache();
 }
 
 // This is an optimization used to avoid calling sync() for
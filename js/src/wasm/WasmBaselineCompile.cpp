@@ -6022,8 +6022,9 @@ bool BaseCompiler::emitSetOrTeeLocal(uint32_t slot) {
       syncLocal(slot);
       fr.storeLocalI32(rv, localFromSlot(slot, MIRType::Int32));
       if (isSetLocal) {
-        freeI32(rv);
+        cacheLocal(slot, rv);
       } else {
+        uncacheLocal(slot);
         pushI32(rv);
       }
       break;
@@ -10214,6 +10215,34 @@ bool BaseCompiler::emitCallBuiltinModuleFunc() {
 //
 // Function bodies - main opcode dispatch loop.
 
+// Whether cached locals can be kept across |op|.  These are the straight-line
+// opcodes that don't bind labels or call out, so the registers holding cached
+// locals are unchanged after them.  See BaseCompiler::cachedLocals_.
+static bool PreservesLocalCache(const OpBytes& op) {
+  uint16_t b0 = op.b0;
+  if (b0 == uint16_t(Op::Nop) || b0 == uint16_t(Op::Drop)) {
+    return true;
+  }
+  // local.get, local.set and local.tee.
+  if (b0 >= uint16_t(Op::LocalGet) && b0 <= uint16_t(Op::LocalTee)) {
+    return true;
+  }
+  // Memory loads and stores.
+  if (b0 >= uint16_t(Op::I32Load) && b0 <= uint16_t(Op::I64Store32)) {
+    return true;
+  }
+  // Constants and integer comparisons.
+  if (b0 >= uint16_t(Op::I32Const) && b0 <= uint16_t(Op::I64GeU)) {
+    return true;
+  }
+  // Integer arithmetic, except division and remainder, which may call out.
+  if (b0 >= uint16_t(Op::I32Clz) && b0 <= uint16_t(Op::I64Rotr)) {
+    return !(b0 >= uint16_t(Op::I32DivS) && b0 <= uint16_t(Op::I32RemU)) &&
+           !(b0 >= uint16_t(Op::I64DivS) && b0 <= uint16_t(Op::I64RemU));
+  }
+  return false;
+}
+
 bool BaseCompiler::emitBody() {
   AutoCreatedBy acb(masm, "(wasm)BaseCompiler::emitBody");
 
@@ -10390,6 +10419,10 @@ bool BaseCompiler::emitBody() {
     MOZ_ASSERT(
         stackMapGenerator_.framePushedExcludingOutboundCallArgs.isNothing());
 
+    if (numCachedLocals_ > 0 && !PreservesLocalCache(op)) {
+      invalidateLocalCache();
+    }
+
     switch (op.b0) {
       case uint16_t(Op::End):
         if (!emitEnd()) {
@@ -12135,6 +12168,9 @@ void BaseCompiler::restoreTempPtr(const RegPtr& r) {
 #ifdef DEBUG
 void BaseCompiler::performRegisterLeakCheck() {
   BaseRegAlloc::LeakCheck check(ra);
+  for (size_t i = 0; i < numCachedLocals_; i++) {
+    check.addKnownI32(cachedLocals_[i].reg);
+  }
   for (auto& item : stk_) {
     switch (item.kind_) {
       case Stk::RegisterI32:
@@ -12260,6 +12296,7 @@ BaseCompiler::BaseCompiler(const CodeMetadata& codeMeta,
       // Init value is selected to ensure proper logic in finishTryNote.
       mostRecentFinishedTryNoteIndex_(0),
       bceSafe_(0),
+      numCachedLocals_(0),
       latentOp_(LatentOp::None),
       latentType_(ValType::I32),
       latentIntCmp_(Assembler::Equal),
@@ -925,6 +925,56 @@ bool wasm::CompileCompleteTier2(const Bytes& bytecode, const Module& module,
   return mg.finishTier2(module);
 }
 
+bool wasm::CompileOptimizedEncoding(const ShareableBytes& bytecode,
+                                    const Module& module,
+                                    JS::OptimizedEncodingListener* listener,
+                                    UniqueChars* error,
+                                    UniqueCharsVector* warnings,
+                                    Atomic<bool>* cancelled) {
+  MOZ_ASSERT(module.code().mode() == CompileMode::LazyTiering);
+  MOZ_ASSERT(listener);
+
+  const CompileArgs& args = *module.codeMeta().compileArgs;
+  Decoder d(bytecode.bytes, 0, error, warnings);
+
+  MutableModuleMetadata moduleMeta = js_new<ModuleMetadata>();
+  if (!moduleMeta || !moduleMeta->init(args)) {
+    return false;
+  }
+
+  if (!DecodeModuleEnvironment(d, moduleMeta->codeMeta.get(), moduleMeta)) {
+    return false;
+  }
+
+  CompilerEnvironment compilerEnv(CompileMode::Once, Tier::Optimized,
+                                  DebugEnabled::False);
+  compilerEnv.computeParameters();
+  if (!moduleMeta->prepareForCompile(compilerEnv.mode())) {
+    return false;
+  }
+
+  ModuleGenerator mg(*moduleMeta->codeMeta, compilerEnv,
+                     compilerEnv.initialState(), cancelled, error, warnings);
+  if (!mg.initializeCompleteTier()) {
+    return false;
+  }
+
+  if (!DecodeCodeSection(*moduleMeta->codeMeta, d, mg)) {
+    return false;
+  }
+
+  if (!DecodeModuleTail(d, moduleMeta->codeMeta, moduleMeta)) {
+    return false;
+  }
+
+  if (cancelled && *cancelled) {
+    return false;
+  }
+
+  // Finishing the module stores its serialization with the listener.
+  return !!mg.finishModule(bytecode, moduleMeta, listener);
+}
+
 bool wasm::CompilePartialTier2(const Code& code, uint32_t funcIndex,
                                UniqueChars* error) {
   CompilerEnvironment compilerEnv(CompileMode::LazyTiering, Tier::Optimized,
@@ -59,6 +59,17 @@ bool CompileCompleteTier2(const Bytes& bytecode, const Module& module,
                           UniqueChars* error, UniqueCharsVector* warnings,
                           mozilla::Atomic<bool>* cancelled);
 
+// Attempt to compile the given wasm::Module, which uses lazy tiering, again
+// with only the optimizing tier, and pass the serialized result to |listener|.
+// The code itself is discarded. Lazily tiered modules can't be serialized, so
+// this lets later loads from the embedder's cache start with optimized code.
+
+bool CompileOptimizedEncoding(const ShareableBytes& bytecode,
+                              const Module& module,
+                              JS::OptimizedEncodingListener* listener,
+                              UniqueChars* error, UniqueCharsVector* warnings,
+                              mozilla::Atomic<bool>* cancelled);
+
 // Attempt to compile the second tier for the given functions of a wasm::Module.
 
 bool CompilePartialTier2(const Code& code, uint32_t funcIndex,
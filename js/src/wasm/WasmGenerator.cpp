@@ -1098,6 +1098,7 @@ bool ModuleGenerator::startCompleteTier() {
          (uint32_t)codeMeta_->numFuncImports,
          (uint32_t)codeMeta_->numFuncs() - (uint32_t)codeMeta_->numFuncImports);
 #endif
+  compileStartTime_ = mozilla::TimeStamp::Now();
 
   if (!startCodeBlock(CodeBlock::kindFromTier(tier()))) {
     return false;
@@ -1409,6 +1410,13 @@ SharedModule ModuleGenerator::finishModule(
 
   if (compileState_ == CompileState::EagerTier1) {
     module->startTier2(bytecode, maybeCompleteTier2Listener);
+  } else if (compileState_ == CompileState::LazyTier1 &&
+             maybeCompleteTier2Listener && !isAsmJS() && !debugEnabled() &&
+             codeMeta_->features().builtinModules.hasNone()) {
+    // Lazily tiered code can't be serialized. Compile an optimized encoding
+    // in the background for the embedder's cache, while hot functions keep
+    // tiering up individually.
+    module->startTier2(bytecode, maybeCompleteTier2Listener);
   } else if (tier() == Tier::Serialized && maybeCompleteTier2Listener &&
              module->canSerialize()) {
     Bytes bytes;
@@ -1419,10 +1427,23 @@ SharedModule ModuleGenerator::finishModule(
   }
 
 #ifdef JS_JITSPEW
+  // Report the compile throughput over the code section, so that regressions
+  // on large modules are easy to spot. This is wall clock time, including
+  // the time spent waiting for helper threads.
+  size_t codeSectionSize =
+      codeMeta_->codeSection ? codeMeta_->codeSection->size : 0;
+  double compileMs =
+      (mozilla::TimeStamp::Now() - compileStartTime_).ToMilliseconds();
+  double megabytesPerSecond =
+      compileMs > 0 ? (double(codeSectionSize) / (1024 * 1024)) /
+                          (compileMs / 1000)
+                    : 0;
   JS_LOG(wasmCodeMetaStats, mozilla::LogLevel::Info,
-         "CM=..%06lx  MG::finishModule      (%s, complete tier)",
+         "CM=..%06lx  MG::finishModule      (%s, complete tier, %zu bytes, "
+         "%.2fms, %.1f MB/s)",
          (unsigned long)(uintptr_t(codeMeta_) & 0xFFFFFFL),
-         tier() == Tier::Baseline ? "BL" : "OPT");
+         tier() == Tier::Baseline ? "BL" : "OPT", codeSectionSize, compileMs,
+         megabytesPerSecond);
 #endif
 
   return module;
@@ -22,6 +22,7 @@
 #include "mozilla/Attributes.h"
 #include "mozilla/Maybe.h"
 #include "mozilla/MemoryReporting.h"
+#include "mozilla/TimeStamp.h"
 
 #include "jit/MacroAssembler.h"
 #include "threading/ProtectedData.h"
@@ -247,6 +248,9 @@ class MOZ_STACK_CLASS ModuleGenerator {
   CompileTask* currentTask_;
   uint32_t batchedBytecode_;
 
+  // When startCompleteTier() was called, for reporting compile throughput.
+  mozilla::TimeStamp compileStartTime_;
+
   // Assertions
   mozilla::DebugOnly<bool> finishedFuncDefs_;
 
@@ -2334,6 +2334,8 @@ bool Instance::init(JSContext* cx, const JSObjectVector& funcImports,
   addressOfNeedsIncrementalBarrier_ =
       cx->compartment()->zone()->addressOfNeedsIncrementalBarrier();
   addressOfNurseryPosition_ = cx->nursery().addressOfPosition();
+  addressOfFreeLists_ = cx->compartment()->zone()->arenas.addressOfFreeList(
+      gc::AllocKind::FIRST);
 #ifdef JS_GC_ZEAL
   addressOfGCZealModeBits_ = cx->runtime()->gc.addressOfZealModeBits();
 #endif
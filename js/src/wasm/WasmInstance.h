@@ -210,6 +210,9 @@ class alignas(16) Instance {
   // Fields from the JS context for memory allocation, stashed on the instance
   // so it can be accessed from JIT code.
   const void* addressOfNurseryPosition_;
+  // The free lists of the instance's zone, indexed by AllocKind. Used for
+  // tenured allocation of GC objects whose alloc site is long lived.
+  const void* addressOfFreeLists_;
 #ifdef JS_GC_ZEAL
   const void* addressOfGCZealModeBits_;
 #endif
@@ -349,6 +352,9 @@ class alignas(16) Instance {
   static constexpr size_t offsetOfAddressOfNurseryPosition() {
     return offsetof(Instance, addressOfNurseryPosition_);
   }
+  static constexpr size_t offsetOfAddressOfFreeLists() {
+    return offsetof(Instance, addressOfFreeLists_);
+  }
 #ifdef JS_GC_ZEAL
   static constexpr size_t offsetOfAddressOfGCZealModeBits() {
     return offsetof(Instance, addressOfGCZealModeBits_);
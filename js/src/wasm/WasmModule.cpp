@@ -20,6 +20,7 @@
 
 #include <chrono>
 
+#include "jit/JitOptions.h"
 #include "js/BuildId.h"                 // JS::BuildIdCharVector
 #include "js/experimental/TypedData.h"  // JS_NewUint8Array
 #include "js/friend/ErrorMessages.h"    // js::GetErrorMessage, JSMSG_*
@@ -121,10 +122,20 @@ class Module::CompleteTier2GeneratorTaskImpl
       // and being cancelled may race with each other, but the only observable
       // race should be being cancelled after a warning/error is set, and
       // that's okay.
+      //
+      // Lazily tiered modules only get here when the embedder wants to cache
+      // the optimized code, see ModuleGenerator::finishModule.
       UniqueChars error;
       UniqueCharsVector warnings;
-      bool success = CompileCompleteTier2(bytecode_->bytes, *module_, &error,
-                                          &warnings, &cancelled_);
+      bool success;
+      if (module_->code().mode() == CompileMode::LazyTiering) {
+        success = CompileOptimizedEncoding(
+            *bytecode_, *module_, module_->completeTier2Listener_.get(), &error,
+            &warnings, &cancelled_);
+      } else {
+        success = CompileCompleteTier2(bytecode_->bytes, *module_, &error,
+                                       &warnings, &cancelled_);
+      }
       if (!cancelled_) {
         // We could try to dispatch a runnable to the thread that started this
         // compilation, so as to report the warning/error using a JSContext*.
@@ -228,8 +239,10 @@ JSObject* Module::createObjectForAsmJS(JSContext* cx) const {
 
 bool wasm::GetOptimizedEncodingBuildId(JS::BuildIdCharVector* buildId) {
   // From a JS API perspective, the "build id" covers everything that can
-  // cause machine code to become invalid, so include both the actual build-id
-  // and cpu-id.
+  // cause machine code to become invalid, so include the actual build-id, the
+  // cpu-id and the JIT options that change the generated code. Embedders
+  // compute the build id once (Gecko uses it as the alt-data type of cached
+  // wasm responses), so these options must not change afterwards.
 
   if (!GetBuildId || !GetBuildId(buildId)) {
     return false;
@@ -238,7 +251,7 @@ bool wasm::GetOptimizedEncodingBuildId(JS::BuildIdCharVector* buildId) {
   uint32_t cpu = ObservedCPUFeatures();
 
   if (!buildId->reserve(buildId->length() +
-                        13 /* "()" + 8 nibbles + "m[+-][+-]" */)) {
+                        15 /* "()" + 8 nibbles + "m[+-][+-]" + "s[+-]" */)) {
     return false;
   }
 
@@ -255,6 +268,10 @@ bool wasm::GetOptimizedEncodingBuildId(JS::BuildIdCharVector* buildId) {
   buildId->infallibleAppend(wasm::IsHugeMemoryEnabled(IndexType::I64) ? '+'
                                                                       : '-');
 
+  // Spectre index masking adds code to bounds checked memory accesses.
+  buildId->infallibleAppend('s');
+  buildId->infallibleAppend(jit::JitOptions.spectreIndexMasking ? '+' : '-');
+
   return true;
 }
 
@@ -171,6 +171,11 @@ class Module : public JS::WasmModule {
   // most once. When tier-2 compilation completes, ModuleGenerator calls
   // finishTier2() from a helper thread, passing tier-variant data which will
   // be installed and made visible.
+  //
+  // Lazily tiered modules tier up per function instead, and only call
+  // startTier2() when |listener| wants an optimized encoding. The module is
+  // then compiled again with only the optimizing tier for serialization, and
+  // finishTier2() isn't called.
 
   void startTier2(const ShareableBytes& bytecode,
                   JS::OptimizedEncodingListener* listener);
@@ -66,6 +66,14 @@ struct Matcher {
 
 using namespace mozilla::loader;
 
+// The ScriptPreloader records the stencils of the scripts and system modules
+// used during startup, and writes them to a cache file at the end of startup.
+// On the next startup, the cache file is memory-mapped and decoded off-thread.
+//
+// The parent process gives content processes a read-only file descriptor on
+// the content process cache file, which they map as well. Stencils are decoded
+// with borrowBuffer, such that their bytecode and other immutable data refer to
+// the mapped pages, which are shared by all processes mapping the same file.
 class ScriptPreloader : public nsIObserver,
                         public nsIMemoryReporter,
                         public nsIRunnable,
@@ -41,16 +41,23 @@ nsresult ReadCachedStencil(StartupCache* cache, nsACString& cachePath,
   MOZ_ASSERT(options.borrowBuffer);
   MOZ_ASSERT(!options.usePinnedBytecode);
 
+  // The pinned buffer outlives the JS engine, so the decoded stencil can use
+  // the bytecode in place instead of copying it.
   const char* buf;
   uint32_t len;
   nsresult rv =
-      cache->GetBuffer(PromiseFlatCString(cachePath).get(), &buf, &len);
+      cache->GetPinnedBuffer(PromiseFlatCString(cachePath).get(), &buf, &len);
   if (NS_FAILED(rv)) {
     return rv;  // don't warn since NOT_AVAILABLE is an ok error
   }
 
+  JS::OwningDecodeOptions pinnedOptions;
+  pinnedOptions.infallibleCopy(options);
+  pinnedOptions.usePinnedBytecode = true;
+
   JS::TranscodeRange range(AsBytes(mozilla::Span(buf, len)));
-  JS::TranscodeResult code = JS::DecodeStencil(cx, options, range, stencilOut);
+  JS::TranscodeResult code =
+      JS::DecodeStencil(cx, pinnedOptions, range, stencilOut);
   return HandleTranscodeResult(cx, code);
 }
 
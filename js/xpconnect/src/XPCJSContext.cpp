@@ -53,6 +53,7 @@
 #include "mozilla/dom/ContentChild.h"
 #include "mozilla/dom/Document.h"
 #include "mozilla/dom/Element.h"
+#include "mozilla/dom/FetchUtil.h"
 #include "mozilla/dom/ScriptLoader.h"
 #include "mozilla/dom/WindowBinding.h"
 #include "mozilla/dom/WakeLockBinding.h"
@@ -907,6 +908,14 @@ static void LoadStartupJSPrefs(XPCJSContext* xpccx) {
       cx, JSJITCOMPILER_INLINING_BYTECODE_MAX_LENGTH,
       StaticPrefs::
           javascript_options_inlining_bytecode_max_length_DoNotUseDirectly());
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_OFFTHREAD_COMPILATION_ENABLE,
+      Preferences::GetBool(
+          JS_OPTIONS_DOT_STR "baselinejit.offthread_compilation", false));
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_BATCH_SIZE,
+      uint32_t(Preferences::GetInt(JS_OPTIONS_DOT_STR "baselinejit.batch_size",
+                                   -1)));
 
 #ifdef DEBUG
   JS_SetGlobalJitCompilerOption(
@@ -1115,15 +1124,27 @@ CycleCollectedJSRuntime* XPCJSContext::CreateRuntime(JSContext* aCx) {
   return new XPCJSRuntime(aCx);
 }
 
+static EventQueuePriority HelperThreadTaskEventQueuePriority(
+    JS::HelperThreadTask* aTask) {
+  switch (JS::GetHelperThreadTaskPriority(aTask)) {
+    case JS::HelperThreadTaskPriority::High:
+      return EventQueuePriority::MediumHigh;
+    case JS::HelperThreadTaskPriority::Normal:
+      return EventQueuePriority::Normal;
+    case JS::HelperThreadTaskPriority::Background:
+      return EventQueuePriority::Low;
+  }
+  MOZ_CRASH("Unexpected helper thread task priority");
+}
+
 class HelperThreadTaskHandler : public Task {
   JS::HelperThreadTask* mTask;
 
  public:
   explicit HelperThreadTaskHandler(JS::HelperThreadTask* aTask)
-      : Task(Kind::OffMainThreadOnly, EventQueuePriority::Normal),
-        mTask(aTask) {
-    // Bug 1703185: Currently all tasks are run at the same priority.
-  }
+      : Task(Kind::OffMainThreadOnly,
+             HelperThreadTaskEventQueuePriority(aTask)),
+        mTask(aTask) {}
 
   TaskResult Run() override {
     JS::RunHelperThreadTask(mTask);
@@ -1340,6 +1361,10 @@ nsresult XPCJSContext::Initialize() {
 
   LoadStartupJSPrefs(this);
 
+  // The wasm build id includes JIT options that change the generated code,
+  // so compute the alt-data type for cached wasm code after setting them.
+  FetchUtil::InitWasmAltDataType();
+
   // Watch for the JS boolean options.
   ReloadPrefsCallback(nullptr, this);
   Preferences::RegisterPrefixCallback(ReloadPrefsCallback, JS_OPTIONS_DOT_STR,
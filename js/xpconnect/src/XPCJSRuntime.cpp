@@ -63,7 +63,6 @@
 #include "mozilla/dom/GeneratedAtomList.h"
 #include "mozilla/dom/BindingUtils.h"
 #include "mozilla/dom/Element.h"
-#include "mozilla/dom/FetchUtil.h"
 #include "mozilla/dom/WindowBinding.h"
 #include "mozilla/Atomics.h"
 #include "mozilla/Attributes.h"
@@ -1449,7 +1448,11 @@ static void ReportZoneStats(const JS::ZoneStats& zStats,
                  zStats.propMapChildren, "Tables for PropMap children.");
 
   ZRREPORT_BYTES(pathPrefix + "property-maps/malloc-heap/tables"_ns,
-                 zStats.propMapTables, "HashTables for PropMaps.");
+                 zStats.propMapTables, "HashTables for shared PropMaps.");
+
+  ZRREPORT_BYTES(pathPrefix + "property-maps/malloc-heap/dict-tables"_ns,
+                 zStats.dictPropMapTables,
+                 "HashTables for dictionary mode object properties.");
 
   ZRREPORT_GC_BYTES(pathPrefix + "scopes/gc-heap"_ns, zStats.scopesGCHeap,
                     "Scope information for scripts.");
@@ -1717,6 +1720,12 @@ static void ReportClassStats(const ClassInfo& classInfo, const nsACString& path,
                  "Set of global names.");
   }
 
+  if (classInfo.objectsMallocHeapMapSetData > 0) {
+    REPORT_BYTES(path + "objects/malloc-heap/map-set-data"_ns, KIND_HEAP,
+                 classInfo.objectsMallocHeapMapSetData,
+                 "Hash tables and nursery keys of Map and Set objects.");
+  }
+
   if (classInfo.objectsMallocHeapMisc > 0) {
     REPORT_BYTES(path + "objects/malloc-heap/misc"_ns, KIND_HEAP,
                  classInfo.objectsMallocHeapMisc, "Miscellaneous object data.");
@@ -1944,6 +1953,15 @@ void ReportJSRuntimeExplicitTreeStats(const JS::RuntimeStats& rtStats,
                 rtStats.runtime.uncompressedSourceCache,
                 "The uncompressed source code cache.");
 
+  RREPORT_BYTES(rtPath + "runtime/regexp-bytecode-cache"_ns, KIND_HEAP,
+                rtStats.runtime.regExpBytecodeCache,
+                "The cache of regexp bytecode shared by all zones.");
+
+  RREPORT_BYTES(rtPath + "runtime/array-buffer-contents-pool"_ns, KIND_HEAP,
+                rtStats.runtime.arrayBufferContentsPool,
+                "The contents of large ArrayBuffers freed by the last GC, "
+                "kept for reuse by new ArrayBuffers.");
+
   RREPORT_BYTES(rtPath + "runtime/script-data"_ns, KIND_HEAP,
                 rtStats.runtime.scriptData,
                 "The table holding script data shared in the runtime.");
@@ -2258,6 +2276,37 @@ class XPCJSRuntimeStats : public JS::RuntimeStats {
   }
 };
 
+struct HeapCensusEntry {
+  const char* allocKindName;
+  JS::HeapCensusKindInfo info;
+};
+
+static void HeapCensusZoneCallback(void* data, JS::Zone* zone,
+                                   const char* allocKindName,
+                                   const JS::HeapCensusKindInfo& info) {
+  // Sum the per-zone census into a single entry per alloc kind.
+  auto* entries = static_cast<nsTArray<HeapCensusEntry>*>(data);
+
+  HeapCensusEntry* entry = nullptr;
+  for (auto& e : *entries) {
+    if (strcmp(e.allocKindName, allocKindName) == 0) {
+      entry = &e;
+      break;
+    }
+  }
+  if (!entry) {
+    entry = entries->AppendElement(HeapCensusEntry{allocKindName, {}});
+    entry->info.thingSize = info.thingSize;
+  }
+
+  entry->info.arenaCount += info.arenaCount;
+  entry->info.cellCount += info.cellCount;
+  entry->info.freeCellCount += info.freeCellCount;
+  for (size_t i = 0; i < JS::HeapCensusKindInfo::OccupancyBins; i++) {
+    entry->info.occupancyHistogram[i] += info.occupancyHistogram[i];
+  }
+}
+
 void JSReporter::CollectReports(WindowPaths* windowPaths,
                                 WindowPaths* topWindowPaths,
                                 nsIHandleReportCallback* handleReport,
@@ -2285,6 +2334,9 @@ void JSReporter::CollectReports(WindowPaths* windowPaths,
     return;
   }
 
+  nsTArray<HeapCensusEntry> heapCensus;
+  JS::CollectHeapCensus(cx, HeapCensusZoneCallback, &heapCensus);
+
   size_t xpcJSRuntimeSize = xpcrt->SizeOfIncludingThis(JSMallocSizeOf);
 
   size_t wrappedJSSize =
@@ -2323,6 +2375,18 @@ void JSReporter::CollectReports(WindowPaths* windowPaths,
       "js-main-runtime/runtime"_ns, KIND_OTHER, rtTotal,
       "The sum of all measurements under 'explicit/js-non-window/runtime/'.");
 
+  // Report the number of string searches in ropes.
+
+  REPORT("js-main-runtime-rope-searches/without-flattening"_ns, KIND_OTHER,
+         UNITS_COUNT_CUMULATIVE, rtStats.runtime.ropeSearchesWithoutFlattening,
+         "The number of string searches done on the leaves of ropes, without "
+         "flattening them.");
+
+  REPORT("js-main-runtime-rope-searches/flattened"_ns, KIND_OTHER,
+         UNITS_COUNT_CUMULATIVE, rtStats.runtime.ropeSearchesFlattened,
+         "The number of string searches in ropes which flattened them first, "
+         "because they have too many leaves.");
+
   // Report the number of HelperThread
 
   REPORT("js-helper-threads/idle"_ns, KIND_OTHER, UNITS_COUNT,
@@ -2359,6 +2423,35 @@ void JSReporter::CollectReports(WindowPaths* windowPaths,
                rtStats.gcHeapUnusedArenas,
                "The same as 'explicit/js-non-window/gc-heap/unused-arenas'.");
 
+  // Report the tenured heap census, summed over all zones.
+
+  for (const auto& entry : heapCensus) {
+    nsPrintfCString kindPath("js-main-runtime-gc-heap-census/%s/",
+                             entry.allocKindName);
+    const JS::HeapCensusKindInfo& info = entry.info;
+
+    REPORT(kindPath + "arenas"_ns, KIND_OTHER, UNITS_COUNT, info.arenaCount,
+           "The number of arenas allocated for this kind of GC thing.");
+    REPORT(kindPath + "used-cells"_ns, KIND_OTHER, UNITS_COUNT,
+           info.usedCellCount(),
+           "The number of cells in use in arenas of this kind.");
+    REPORT(kindPath + "free-cells"_ns, KIND_OTHER, UNITS_COUNT,
+           info.freeCellCount,
+           "The number of free cells in arenas of this kind.");
+
+    constexpr size_t Bins = JS::HeapCensusKindInfo::OccupancyBins;
+    for (size_t i = 0; i < Bins; i++) {
+      if (!info.occupancyHistogram[i]) {
+        continue;
+      }
+      nsPrintfCString binPath("%soccupancy/%02zu-%02zu%%", kindPath.get(),
+                              i * 100 / Bins, (i + 1) * 100 / Bins);
+      REPORT(binPath, KIND_OTHER, UNITS_COUNT, info.occupancyHistogram[i],
+             "The number of arenas of this kind with this fraction of their "
+             "cells in use.");
+    }
+  }
+
   REPORT_BYTES("js-main-runtime/gc-heap/chunk-admin"_ns, KIND_OTHER,
                rtStats.gcHeapChunkAdmin,
                "The same as 'explicit/js-non-window/gc-heap/chunk-admin'.");
@@ -2942,9 +3035,10 @@ void XPCJSRuntime::Initialize(JSContext* cx) {
   JS::SetProcessLargeAllocationFailureCallback(
       OnLargeAllocationFailureCallback);
 
-  // The WasmAltDataType is build by the JS engine from the build id.
+  // The WasmAltDataType is built by the JS engine from the build id. It's
+  // initialized in XPCJSContext::Initialize, once the startup JIT options
+  // that are part of it have been set.
   JS::SetProcessBuildIdOp(GetBuildId);
-  FetchUtil::InitWasmAltDataType();
 
   // The JS engine needs to keep the source code around in order to implement
   // Function.prototype.toSource(). It'd be nice to not have to do this for
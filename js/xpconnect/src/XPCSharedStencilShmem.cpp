@@ -0,0 +1,320 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "XPCSharedStencilShmem.h"
+#include "xpcprivate.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "mozilla/CheckedInt.h"
+#include "mozilla/Preferences.h"
+#include "mozilla/dom/RemoteType.h"
+
+// The snapshot starts with a header, followed by an index of the entries
+// sorted by key, followed by the XDR of each entry. Each XDR is aligned on
+// PayloadAlignment, which is larger than the alignment the JS engine expects
+// for decoding bytecode in place.
+namespace {
+
+constexpr uint32_t SnapshotMagic = 0x53545343;  // "STSC"
+constexpr size_t PayloadAlignment = 16;
+
+struct SnapshotHeader {
+  uint32_t mMagic;
+  uint32_t mCount;
+};
+
+struct SnapshotIndexEntry {
+  xpc::SharedStencilShmem::Key mKey;
+  uint32_t mOffset;
+  uint32_t mLength;
+};
+
+size_t AlignPayload(size_t aOffset) {
+  return (aOffset + PayloadAlignment - 1) & ~(PayloadAlignment - 1);
+}
+
+}  // namespace
+
+MOZ_DEFINE_MALLOC_SIZE_OF(SharedStencilsMallocSizeOf)
+
+// static
+mozilla::StaticRefPtr<xpc::SharedStencilShmem>
+    xpc::SharedStencilShmem::sSharedStencils;
+
+NS_IMPL_ISUPPORTS(xpc::SharedStencilShmem, nsIMemoryReporter)
+
+// static
+xpc::SharedStencilShmem& xpc::SharedStencilShmem::GetSingleton() {
+  MOZ_ASSERT(NS_IsMainThread());
+
+  if (!sSharedStencils) {
+    sSharedStencils = new SharedStencilShmem;
+  }
+
+  return *sSharedStencils;
+}
+
+// static
+bool xpc::SharedStencilShmem::IsEnabledForRemoteType(
+    const nsACString& aRemoteType) {
+  if (!mozilla::Preferences::GetBool(
+          "dom.script_loader.shared_stencils.enabled", false)) {
+    return false;
+  }
+
+  // webIsolated remote types have the form "webIsolated=<site>".
+  size_t prefixLength = FISSION_WEB_REMOTE_TYPE.Length();
+  return StringBeginsWith(aRemoteType, FISSION_WEB_REMOTE_TYPE) &&
+         aRemoteType.Length() > prefixLength + 1 &&
+         aRemoteType.CharAt(prefixLength) == '=';
+}
+
+void xpc::SharedStencilShmem::InitMemoryReporter() {
+  mozilla::RegisterWeakMemoryReporter(this);
+}
+
+// static
+void xpc::SharedStencilShmem::Shutdown() {
+  MOZ_ASSERT(NS_IsMainThread());
+  // NOTE: As for SelfHostedShmem, the memory reporter service is already
+  // shutdown at the time this call is made.
+  sSharedStencils = nullptr;
+}
+
+// static
+xpc::SharedStencilShmem::Key xpc::SharedStencilShmem::ComputeKey(
+    const nsACString& aURLSpec, bool aMutedErrors, ContentType aSourceBytes) {
+  mozilla::SHA1Sum sum;
+
+  // Prefix the URL with its length, such that the URL and the source cannot
+  // be confused with another pair.
+  uint64_t specLength = aURLSpec.Length();
+  sum.update(&specLength, sizeof(specLength));
+  sum.update(aURLSpec.BeginReading(), uint32_t(aURLSpec.Length()));
+
+  uint8_t mutedErrors = aMutedErrors ? 1 : 0;
+  sum.update(&mutedErrors, sizeof(mutedErrors));
+  sum.update(aSourceBytes.Elements(), uint32_t(aSourceBytes.Length()));
+
+  mozilla::SHA1Sum::Hash hash;
+  sum.finish(hash);
+
+  Key key;
+  std::copy(std::begin(hash), std::end(hash), key.begin());
+  return key;
+}
+
+bool xpc::SharedStencilShmem::AddFromChild(const nsACString& aRemoteType,
+                                           const Key& aKey, ContentType aXdr) {
+  MOZ_ASSERT(XRE_IsParentProcess());
+  MOZ_ASSERT(NS_IsMainThread());
+
+  if (aXdr.IsEmpty() || aXdr.Length() > MaxEntryLength ||
+      mTotalXdrLength + aXdr.Length() > MaxTotalLength) {
+    return false;
+  }
+
+  Table* table = mTables.GetOrInsertNew(aRemoteType);
+  if (table->mEntries.Length() >= MaxEntries ||
+      table->mXdrLength + aXdr.Length() > MaxTableLength) {
+    return false;
+  }
+
+  auto* begin = table->mEntries.begin();
+  auto* end = table->mEntries.end();
+  auto* pos = std::lower_bound(
+      begin, end, aKey,
+      [](const Entry& aEntry, const Key& aKey) { return aEntry.mKey < aKey; });
+  if (pos != end && pos->mKey == aKey) {
+    return false;
+  }
+
+  Entry* entry = table->mEntries.InsertElementAt(pos - begin);
+  entry->mKey = aKey;
+  entry->mXdr.AppendElements(aXdr);
+  table->mXdrLength += aXdr.Length();
+  mTotalXdrLength += aXdr.Length();
+  table->mStale = true;
+  return true;
+}
+
+// static
+bool xpc::SharedStencilShmem::BuildSnapshot(Table& aTable) {
+  MOZ_ASSERT(aTable.mStale);
+
+  size_t count = aTable.mEntries.Length();
+  size_t payloadStart =
+      AlignPayload(sizeof(SnapshotHeader) + count * sizeof(SnapshotIndexEntry));
+
+  mozilla::CheckedInt<size_t> len = payloadStart;
+  for (const Entry& entry : aTable.mEntries) {
+    len = mozilla::CheckedInt<size_t>(AlignPayload(len.value())) +
+          entry.mXdr.Length();
+    if (!len.isValid() || len.value() > UINT32_MAX) {
+      return false;
+    }
+  }
+
+  auto shm = mozilla::MakeRefPtr<mozilla::ipc::SharedMemory>();
+  if (NS_WARN_IF(!shm->CreateFreezable(len.value()))) {
+    return false;
+  }
+
+  if (NS_WARN_IF(!shm->Map(len.value()))) {
+    return false;
+  }
+
+  uint8_t* base = static_cast<uint8_t*>(shm->Memory());
+  auto* header = reinterpret_cast<SnapshotHeader*>(base);
+  header->mMagic = SnapshotMagic;
+  header->mCount = uint32_t(count);
+
+  auto* index = reinterpret_cast<SnapshotIndexEntry*>(header + 1);
+  size_t offset = payloadStart;
+  for (size_t i = 0; i < count; i++) {
+    const Entry& entry = aTable.mEntries[i];
+    offset = AlignPayload(offset);
+    index[i].mKey = entry.mKey;
+    index[i].mOffset = uint32_t(offset);
+    index[i].mLength = uint32_t(entry.mXdr.Length());
+    memcpy(base + offset, entry.mXdr.Elements(), entry.mXdr.Length());
+    offset += entry.mXdr.Length();
+  }
+  MOZ_ASSERT(offset == len.value());
+
+  RefPtr<mozilla::ipc::SharedMemory> roCopy =
+      mozilla::MakeRefPtr<mozilla::ipc::SharedMemory>();
+  if (NS_WARN_IF(!shm->ReadOnlyCopy(&*roCopy))) {
+    return false;
+  }
+
+  // The parent process does not decode the snapshot, only the read-only handle
+  // is kept to be cloned for content processes.
+  aTable.mSnapshotHandle = roCopy->TakeHandleAndUnmap();
+  aTable.mSnapshotLen = len.value();
+  aTable.mStale = false;
+  return true;
+}
+
+bool xpc::SharedStencilShmem::CloneSnapshotHandle(
+    const nsACString& aRemoteType, mozilla::ipc::SharedMemoryHandle* aHandle,
+    size_t* aLen) {
+  MOZ_ASSERT(XRE_IsParentProcess());
+  MOZ_ASSERT(NS_IsMainThread());
+
+  Table* table = mTables.Get(aRemoteType);
+  if (!table || table->mEntries.IsEmpty()) {
+    return false;
+  }
+
+  if (table->mStale && !BuildSnapshot(*table)) {
+    return false;
+  }
+
+  *aHandle = mozilla::ipc::SharedMemory::CloneHandle(table->mSnapshotHandle);
+  *aLen = table->mSnapshotLen;
+  return mozilla::ipc::SharedMemory::IsHandleValid(*aHandle);
+}
+
+bool xpc::SharedStencilShmem::InitFromChild(
+    mozilla::ipc::SharedMemoryHandle aHandle, size_t aLen) {
+  MOZ_ASSERT(!XRE_IsParentProcess());
+  MOZ_ASSERT(NS_IsMainThread());
+  MOZ_ASSERT(!mLen, "Shouldn't call this more than once");
+
+  if (aLen < sizeof(SnapshotHeader)) {
+    return false;
+  }
+
+  auto shm = mozilla::MakeRefPtr<mozilla::ipc::SharedMemory>();
+  if (NS_WARN_IF(!shm->SetHandle(std::move(aHandle),
+                                 mozilla::ipc::SharedMemory::RightsReadOnly))) {
+    return false;
+  }
+
+  if (NS_WARN_IF(!shm->Map(aLen))) {
+    return false;
+  }
+
+  const auto* header = static_cast<const SnapshotHeader*>(shm->Memory());
+  mozilla::CheckedInt<size_t> indexEnd =
+      mozilla::CheckedInt<size_t>(header->mCount) * sizeof(SnapshotIndexEntry) +
+      sizeof(SnapshotHeader);
+  if (header->mMagic != SnapshotMagic || !indexEnd.isValid() ||
+      indexEnd.value() > aLen) {
+    return false;
+  }
+
+  mMem = std::move(shm);
+  mLen = aLen;
+  return true;
+}
+
+xpc::SharedStencilShmem::ContentType xpc::SharedStencilShmem::Lookup(
+    const Key& aKey) const {
+  if (!mMem) {
+    MOZ_ASSERT(mLen == 0);
+    return ContentType();
+  }
+
+  const uint8_t* base = static_cast<const uint8_t*>(mMem->Memory());
+  const auto* header = reinterpret_cast<const SnapshotHeader*>(base);
+  const auto* begin = reinterpret_cast<const SnapshotIndexEntry*>(header + 1);
+  const auto* end = begin + header->mCount;
+  const auto* pos =
+      std::lower_bound(begin, end, aKey,
+                       [](const SnapshotIndexEntry& aEntry, const Key& aKey) {
+                         return aEntry.mKey < aKey;
+                       });
+  if (pos == end || pos->mKey != aKey) {
+    return ContentType();
+  }
+
+  // The index was checked to fit in InitFromChild, the entries are checked
+  // when they are used.
+  mozilla::CheckedInt<size_t> payloadEnd =
+      mozilla::CheckedInt<size_t>(pos->mOffset) + pos->mLength;
+  if (!payloadEnd.isValid() || payloadEnd.value() > mLen ||
+      pos->mOffset % PayloadAlignment != 0) {
+    return ContentType();
+  }
+
+  return ContentType(base + pos->mOffset, pos->mLength);
+}
+
+NS_IMETHODIMP
+xpc::SharedStencilShmem::CollectReports(nsIHandleReportCallback* aHandleReport,
+                                        nsISupports* aData, bool aAnonymize) {
+  // The parent process owns the recorded entries, and the snapshots it shares
+  // with content processes.
+  if (XRE_IsParentProcess()) {
+    size_t entries = 0;
+    size_t snapshots = 0;
+    for (const auto& table : mTables.Values()) {
+      entries += table->mEntries.ShallowSizeOfExcludingThis(
+          SharedStencilsMallocSizeOf);
+      for (const Entry& entry : table->mEntries) {
+        entries +=
+            entry.mXdr.ShallowSizeOfExcludingThis(SharedStencilsMallocSizeOf);
+      }
+      snapshots += table->mSnapshotLen;
+    }
+
+    MOZ_COLLECT_REPORT("explicit/js-non-window/shared-stencils/entries",
+                       KIND_HEAP, UNITS_BYTES, entries,
+                       "Memory used to record the encoded stencils of scripts "
+                       "shared with content processes.");
+    // This does not exactly report the amount of data mapped by the system,
+    // but the space requested when creating the handles.
+    MOZ_COLLECT_REPORT("explicit/js-non-window/shared-memory/shared-stencils",
+                       KIND_NONHEAP, UNITS_BYTES, snapshots,
+                       "Memory used by the snapshots of encoded stencils "
+                       "shared with content processes.");
+  }
+  return NS_OK;
+}
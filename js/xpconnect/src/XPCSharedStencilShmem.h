@@ -0,0 +1,163 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef xpcsharedstencilshmem_h___
+#define xpcsharedstencilshmem_h___
+
+#include <array>
+
+#include "mozilla/RefPtr.h"
+#include "mozilla/SHA1.h"
+#include "mozilla/Span.h"
+#include "mozilla/StaticPtr.h"
+#include "mozilla/UniquePtr.h"
+#include "mozilla/ipc/SharedMemory.h"
+#include "nsClassHashtable.h"
+#include "nsHashKeys.h"
+#include "nsIMemoryReporter.h"
+#include "nsString.h"
+#include "nsTArray.h"
+
+namespace xpc {
+
+// This class is a singleton which holds a read-only table of encoded stencils
+// of classic scripts, shared by the parent process with content processes.
+//
+// Content processes send the stencil XDR of the scripts they encode for the
+// bytecode cache to the parent process, which records them per remote type.
+// When a content process is launched, the parent process freezes a snapshot
+// of the table of its remote type into a read-only shared memory, and the new
+// content process maps it to decode these scripts instead of compiling them.
+//
+// Entries are never shared across remote types: the XDR comes from content
+// processes, and decoding it is only as trustworthy as the process which
+// produced it. Only webIsolated remote types take part, where the remote type
+// identifies the site (and the private browsing state), so a content process
+// can only feed processes which would load the same site.
+//
+// The snapshot is only given to processes at launch time. Processes which are
+// already running do not see entries added after they started.
+class SharedStencilShmem final : public nsIMemoryReporter {
+ public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+  NS_DECL_NSIMEMORYREPORTER
+
+  // NOTE: This type is identical to JS::TranscodeRange, but we repeat it to
+  // avoid including JS engine API in ipc code.
+  using ContentType = mozilla::Span<const uint8_t>;
+
+  static constexpr size_t KeyLength = mozilla::SHA1Sum::kHashSize;
+  using Key = std::array<uint8_t, KeyLength>;
+
+  // Limits on what a single remote type can record in the parent process, and
+  // on the total across all remote types.
+  static constexpr size_t MaxEntries = 256;
+  static constexpr size_t MaxEntryLength = 4 * 1024 * 1024;
+  static constexpr size_t MaxTableLength = 32 * 1024 * 1024;
+  static constexpr size_t MaxTotalLength = 128 * 1024 * 1024;
+
+  static SharedStencilShmem& GetSingleton();
+
+  // Whether stencils are shared between the content processes of
+  // |aRemoteType|. This is disabled unless the
+  // "dom.script_loader.shared_stencils.enabled" pref is set, and is limited to
+  // webIsolated remote types, which only host a single site. Other remote
+  // types, such as "web", mix sites, so an entry uploaded by one site could be
+  // decoded by another.
+  static bool IsEnabledForRemoteType(const nsACString& aRemoteType);
+
+  // Compute the key of a classic script from its URL, the muted errors flag
+  // of its compile options and the bytes of its source text.
+  static Key ComputeKey(const nsACString& aURLSpec, bool aMutedErrors,
+                        ContentType aSourceBytes);
+
+  // Record the stencil XDR of a script on behalf of a content process of
+  // |aRemoteType|. Returns false if the entry was rejected because the table
+  // is full, the entry is too large or the key is already recorded.
+  //
+  // This function should only be called from the main thread of the parent
+  // process.
+  bool AddFromChild(const nsACString& aRemoteType, const Key& aKey,
+                    ContentType aXdr);
+
+  // Get a read-only handle over the snapshot of the table of |aRemoteType|,
+  // rebuilding the snapshot if entries were added since the last time. The
+  // handle is cloned and owned by the caller. Returns false if there is no
+  // entry for |aRemoteType|.
+  //
+  // This function should only be called from the main thread of the parent
+  // process.
+  bool CloneSnapshotHandle(const nsACString& aRemoteType,
+                           mozilla::ipc::SharedMemoryHandle* aHandle,
+                           size_t* aLen);
+
+  // Initialize this singleton with the snapshot coming from the parent
+  // process, using a file handle which maps to the memory pages of the parent
+  // process.
+  //
+  // This function is not thread-safe and should be call at most once and from
+  // the main thread.
+  [[nodiscard]] bool InitFromChild(mozilla::ipc::SharedMemoryHandle aHandle,
+                                   size_t aLen);
+
+  // Whether this content process mapped a snapshot from the parent process.
+  bool HasSnapshot() const { return !!mMem; }
+
+  // Return a span over the read-only XDR of the script with |aKey|, or an
+  // empty span if the snapshot does not contain it. The span remains valid
+  // until Shutdown.
+  ContentType Lookup(const Key& aKey) const;
+
+  // Register this class to the memory reporter service.
+  void InitMemoryReporter();
+
+  // Unregister this class from the memory reporter service, and delete the
+  // memory associated with the shared memory. As the memory is borrowed by the
+  // JS engine, this function should be called after JS_Shutdown.
+  static void Shutdown();
+
+ private:
+  SharedStencilShmem() = default;
+  ~SharedStencilShmem() = default;
+
+  struct Entry {
+    Key mKey;
+    nsTArray<uint8_t> mXdr;
+  };
+
+  // Entries recorded by the parent process for a single remote type, sorted by
+  // key, and the last snapshot built from them.
+  struct Table {
+    nsTArray<Entry> mEntries;
+    size_t mXdrLength = 0;
+
+    // Read-only handle of the snapshot, and its length. The snapshot is stale
+    // when entries were added since it was built.
+    mozilla::ipc::SharedMemoryHandle mSnapshotHandle;
+    size_t mSnapshotLen = 0;
+    bool mStale = true;
+  };
+
+  [[nodiscard]] static bool BuildSnapshot(Table& aTable);
+
+  static mozilla::StaticRefPtr<SharedStencilShmem> sSharedStencils;
+
+  // Tables of the parent process, indexed by remote type.
+  nsClassHashtable<nsCStringHashKey, Table> mTables;
+
+  // Sum of the XDR lengths of all tables.
+  size_t mTotalXdrLength = 0;
+
+  // Snapshot mapped by a content process.
+  RefPtr<mozilla::ipc::SharedMemory> mMem;
+
+  // Length of the snapshot within the shared memory.
+  size_t mLen = 0;
+};
+
+}  // namespace xpc
+
+#endif  // !xpcsharedstencilshmem_h___
@@ -1059,6 +1059,9 @@ class MOZ_STACK_CLASS CallMethodHelper final {
 
   MOZ_ALWAYS_INLINE bool QueryInterfaceFastPath();
 
+  MOZ_ALWAYS_INLINE bool IsArithmeticGetter() const;
+  MOZ_ALWAYS_INLINE bool ArithmeticGetterFastPath();
+
   nsXPTCVariant* GetDispatchParam(uint8_t paramIndex) {
     if (paramIndex >= mJSContextIndex) {
       paramIndex += 1;
@@ -1154,6 +1157,10 @@ bool CallMethodHelper::Call() {
       mCallContext.GetJSContext(),
       uint32_t(templateFlag) | uint32_t(Flags::RELEVANT_FOR_JS));
 
+  if (IsArithmeticGetter()) {
+    return ArithmeticGetterFastPath();
+  }
+
   if (!InitializeDispatchParams()) {
     return false;
   }
@@ -1391,6 +1398,48 @@ bool CallMethodHelper::QueryInterfaceFastPath() {
   return true;
 }
 
+// Whether the method only has an arithmetic retval, as is the case for
+// attribute getters of numbers and booleans. These are called often enough
+// from chrome JS to be worth skipping the generic parameter handling.
+bool CallMethodHelper::IsArithmeticGetter() const {
+  return mMethodInfo->ParamCount() == 1 && mMethodInfo->HasRetval() &&
+         !mMethodInfo->WantsContext() && !mMethodInfo->WantsOptArgc() &&
+         mMethodInfo->Param(0).Type().IsArithmetic();
+}
+
+bool CallMethodHelper::ArithmeticGetterFastPath() {
+  MOZ_ASSERT(IsArithmeticGetter());
+
+  // Arithmetic values need neither cleanup nor tracing, so the retval can
+  // live on the stack rather than in mDispatchParams.
+  nsXPTCVariant retval;
+  retval.type = mMethodInfo->Param(0).Type();
+  xpc::InitializeValue(retval.type, &retval.val);
+  retval.SetIndirect();
+
+  mInvokeResult = NS_InvokeByIndex(mCallee, mVTableIndex, 1, &retval);
+
+  if (JS_IsExceptionPending(mCallContext)) {
+    return false;
+  }
+
+  if (NS_FAILED(mInvokeResult)) {
+    ThrowBadResult(mInvokeResult, mCallContext);
+    return false;
+  }
+
+  RootedValue v(mCallContext, NullValue());
+  nsresult err;
+  if (!XPCConvert::NativeData2JS(mCallContext, &v, &retval.val, retval.type,
+                                 nullptr, 0, &err)) {
+    ThrowBadParam(err, 0, mCallContext);
+    return false;
+  }
+
+  mCallContext.SetRetVal(v);
+  return true;
+}
+
 bool CallMethodHelper::InitializeDispatchParams() {
   const uint8_t wantsOptArgc = mMethodInfo->WantsOptArgc() ? 1 : 0;
   const uint8_t wantsJSContext = mMethodInfo->WantsContext() ? 1 : 0;
@@ -9884,6 +9884,21 @@ bool PresShell::DoReflow(nsIFrame* target, bool aInterruptible,
 
   const bool isRoot = target == mFrameConstructor->GetRootFrame();
 
+  // Name the reflow root, so that reflows which only needed to update a
+  // subtree can be told from the ones which had to start at the root.
+  nsAutoCString reflowRoot;
+  if (profiler_thread_is_being_profiled_for_markers()) {
+    if (isRoot) {
+      reflowRoot.AssignLiteral("root frame");
+    } else if (auto* element = Element::FromNodeOrNull(target->GetContent())) {
+      nsAutoString description;
+      element->Describe(description, true);
+      CopyUTF16toUTF8(description, reflowRoot);
+    }
+  }
+  AUTO_PROFILER_MARKER_TEXT("ReflowRoot", LAYOUT,
+                            MarkerInnerWindowId(innerWindowID), reflowRoot);
+
   MOZ_ASSERT(isRoot || aOverflowTracker,
              "caller must provide overflow tracker when reflowing "
              "non-root frames");
@@ -62,6 +62,11 @@ class StackArena {
 // Individual allocations cannot exceed StackBlock::MAX_USABLE_SIZE
 // bytes.
 //
+// This is not meant to back growable arrays: memory is never reused before
+// the enclosing Pop(), so each reallocation would strand the old buffer, and
+// a growing array soon exceeds the block size. Short-lived arrays should use
+// the inline storage of AutoTArray or mozilla::Vector instead.
+//
 class MOZ_RAII AutoStackArena {
  public:
   AutoStackArena() : mOwnsStackArena(false) {
@@ -1460,13 +1460,13 @@ bool nsBidiPresUtils::ChildListMayRequireBidi(nsIFrame* aFirstChild,
         }
 
         // Check whether the text frame has any RTL characters; if so, bidi
-        // resolution will be needed.
+        // resolution will be needed. CharacterData keeps the text fragment's
+        // bidi flag up to date on every change, so that we don't need to scan
+        // the text of every paragraph again here.
         dom::Text* content = frame->GetContent()->AsText();
         if (content != *aCurrContent) {
           *aCurrContent = content;
-          const nsTextFragment* txt = &content->TextFragment();
-          if (txt->Is2b() &&
-              HasRTLChars(Span(txt->Get2b(), txt->GetLength()))) {
+          if (content->TextFragment().IsBidi()) {
             return true;
           }
         }
@@ -132,16 +132,18 @@ void nsPresArena<ArenaSize, ObjectId, ObjectIdCount>::AddSizeOfExcludingThis(
   size_t mallocSize = mPool.SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
   size_t totalSizeInFreeLists = 0;
+  size_t totalSizeOfFreeEntries = 0;
   for (const FreeList* entry = mFreeLists; entry != ArrayEnd(mFreeLists);
        ++entry) {
     mallocSize += entry->SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
-    // Note that we're not measuring the size of the entries on the free
-    // list here.  The free list knows how many objects we've allocated
-    // ever (which includes any objects that may be on the FreeList's
-    // |mEntries| at this point) and we're using that to determine the
-    // total size of objects allocated with a given ID.
-    size_t totalSize = entry->mEntrySize * entry->mEntriesEverAllocated;
+    // The free list knows how many objects we've allocated ever, which
+    // includes the dead objects on the FreeList's |mEntries|, waiting to be
+    // reused.  We're using that to determine the total size of live objects
+    // allocated with a given ID, and leave the dead ones out of it.
+    size_t freeSize = entry->mEntrySize * entry->mEntries.Length();
+    size_t totalSize =
+        entry->mEntrySize * entry->mEntriesEverAllocated - freeSize;
 
     if (aKind == ArenaKind::PresShell) {
       switch (entry - mFreeLists) {
@@ -169,6 +171,16 @@ void nsPresArena<ArenaSize, ObjectId, ObjectIdCount>::AddSizeOfExcludingThis(
     }
 
     totalSizeInFreeLists += totalSize;
+    totalSizeOfFreeEntries += freeSize;
+  }
+
+  // Frames freed by rebuilding parts of the frame tree stay in the pres arena
+  // until the pres shell goes away, so report them on their own.  Display
+  // items are freed and reused on every paint, so those stay in the catch-all
+  // number.
+  if (aKind == ArenaKind::PresShell) {
+    aSizes.mLayoutPresArenaFreeEntriesSize += totalSizeOfFreeEntries;
+    totalSizeInFreeLists += totalSizeOfFreeEntries;
   }
 
   auto& field = aKind == ArenaKind::PresShell
@@ -2530,6 +2530,44 @@ void nsRefreshDriver::RunVideoAndFrameRequestCallbacks(TimeStamp aNowTime) {
 
 static StaticAutoPtr<AutoTArray<RefPtr<Task>, 8>> sPendingIdleTasks;
 
+// Reports how long each phase of a tick took, to tell which of them made a
+// tick overrun its frame.
+struct RefreshDriverTickPhasesMarker {
+  static constexpr Span<const char> MarkerTypeName() {
+    return MakeStringSpan("RefreshDriverTickPhases");
+  }
+  static void StreamJSONMarkerData(baseprofiler::SpliceableJSONWriter& aWriter,
+                                   const TimeStamp& aStart,
+                                   const TimeStamp& aEventsEnd,
+                                   const TimeStamp& aFrameCallbacksEnd,
+                                   const TimeStamp& aLayoutEnd,
+                                   const TimeStamp& aObserversEnd,
+                                   const TimeStamp& aEnd) {
+    // The durations are computed at serialization time, so that profiling
+    // ticks only costs taking the timestamps.
+    aWriter.DoubleProperty("events", (aEventsEnd - aStart).ToMilliseconds());
+    aWriter.DoubleProperty("frameCallbacks",
+                           (aFrameCallbacksEnd - aEventsEnd).ToMilliseconds());
+    aWriter.DoubleProperty("layout",
+                           (aLayoutEnd - aFrameCallbacksEnd).ToMilliseconds());
+    aWriter.DoubleProperty("observers",
+                           (aObserversEnd - aLayoutEnd).ToMilliseconds());
+    aWriter.DoubleProperty("paint", (aEnd - aObserversEnd).ToMilliseconds());
+  }
+  static MarkerSchema MarkerTypeDisplay() {
+    using MS = MarkerSchema;
+    MS schema{MS::Location::MarkerChart, MS::Location::MarkerTable};
+    schema.AddKeyLabelFormat("events", "Events", MS::Format::Milliseconds);
+    schema.AddKeyLabelFormat("frameCallbacks", "Frame callbacks",
+                             MS::Format::Milliseconds);
+    schema.AddKeyLabelFormat("layout", "Layout", MS::Format::Milliseconds);
+    schema.AddKeyLabelFormat("observers", "Observers",
+                             MS::Format::Milliseconds);
+    schema.AddKeyLabelFormat("paint", "Paint", MS::Format::Milliseconds);
+    return schema;
+  }
+};
+
 void nsRefreshDriver::DispatchIdleTaskAfterTickUnlessExists(Task* aTask) {
   if (!sPendingIdleTasks) {
     sPendingIdleTasks = new AutoTArray<RefPtr<Task>, 8>();
@@ -2693,6 +2731,11 @@ void nsRefreshDriver::Tick(VsyncId aId, TimeStamp aNowTime,
   mTickVsyncId = aId;
   mTickVsyncTime = aNowTime;
 
+  // Ends of the phases reported by RefreshDriverTickPhasesMarker, only taken
+  // when profiling.
+  const bool recordPhases = profiler_thread_is_being_profiled_for_markers();
+  TimeStamp eventsEnd, frameCallbacksEnd, layoutEnd, observersEnd;
+
   gfxPlatform::GetPlatform()->SchedulePaintIfDeviceReset();
 
   FlushForceNotifyContentfulPaintPresContext();
@@ -2759,7 +2802,13 @@ void nsRefreshDriver::Tick(VsyncId aId, TimeStamp aNowTime,
   // Step 14. For each doc of docs, run the animation frame callbacks for doc,
   // passing in the relative high resolution time given frameTimestamp and doc's
   // relevant global object as the timestamp.
+  if (recordPhases) {
+    eventsEnd = TimeStamp::Now();
+  }
   RunVideoAndFrameRequestCallbacks(aNowTime);
+  if (recordPhases) {
+    frameCallbacksEnd = TimeStamp::Now();
+  }
 
   MaybeIncreaseMeasuredTicksSinceLoading();
 
@@ -2775,6 +2824,10 @@ void nsRefreshDriver::Tick(VsyncId aId, TimeStamp aNowTime,
     return StopTimer();
   }
 
+  if (recordPhases) {
+    layoutEnd = TimeStamp::Now();
+  }
+
   // Recompute approximate frame visibility if it's necessary and enough time
   // has passed since the last time we did it.
   if (mNeedToRecomputeVisibility && !mThrottled &&
@@ -2826,6 +2879,10 @@ void nsRefreshDriver::Tick(VsyncId aId, TimeStamp aNowTime,
 
   UpdateAnimatedImages(previousRefresh, aNowTime);
 
+  if (recordPhases) {
+    observersEnd = TimeStamp::Now();
+  }
+
   bool dispatchTasksAfterTick = false;
   if (mViewManagerFlushIsPending && !mThrottled) {
     nsCString transactionId;
@@ -2884,6 +2941,15 @@ void nsRefreshDriver::Tick(VsyncId aId, TimeStamp aNowTime,
   // being stored in nsSubDocumentFrame.
   UpdateRemoteFrameEffects();
 
+  if (recordPhases) {
+    profiler_add_marker(
+        "RefreshDriverTickPhases", geckoprofiler::category::GRAPHICS,
+        {MarkerTiming::IntervalUntilNowFrom(mTickStart),
+         MarkerInnerWindowIdFromDocShell(GetDocShell(mPresContext))},
+        RefreshDriverTickPhasesMarker{}, mTickStart, eventsEnd,
+        frameCallbacksEnd, layoutEnd, observersEnd, TimeStamp::Now());
+  }
+
 #ifndef ANDROID /* bug 1142079 */
   double totalMs = (TimeStamp::Now() - mTickStart).ToMilliseconds();
   mozilla::Telemetry::Accumulate(mozilla::Telemetry::REFRESH_DRIVER_TICK,
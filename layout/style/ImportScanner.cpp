@@ -94,18 +94,25 @@ auto ImportScanner::Scan(char16_t aChar) -> State {
       MOZ_ASSERT_UNREACHABLE("How?");
       return mState;
     case State::Idle: {
-      // TODO(emilio): Maybe worth caring about html-style comments like:
-      // <style>
-      // <!--
-      //   @import url(stuff);
-      // -->
-      // </style>
       if (IsWhitespace(aChar)) {
         return mState;
       }
       if (aChar == '/') {
         return State::MaybeAtCommentStart;
       }
+      // The CDO and CDC tokens are ignored at the top level of a stylesheet,
+      // and are still commonly found wrapping the contents of <style>
+      // elements like:
+      // <style>
+      // <!--
+      //   @import url(stuff);
+      // -->
+      // </style>
+      if (aChar == '<' || aChar == '-') {
+        MOZ_ASSERT(mRuleName.IsEmpty());
+        mRuleName.Append(aChar);
+        return State::AtHTMLCommentDelimiter;
+      }
       if (aChar == '@') {
         MOZ_ASSERT(mRuleName.IsEmpty());
         return State::AtRuleName;
@@ -121,6 +128,18 @@ auto ImportScanner::Scan(char16_t aChar) -> State {
     case State::MaybeAtCommentEnd: {
       return aChar == '/' ? State::Idle : State::AtComment;
     }
+    case State::AtHTMLCommentDelimiter: {
+      mRuleName.Append(aChar);
+      if (mRuleName.EqualsLiteral("<!--") || mRuleName.EqualsLiteral("-->")) {
+        mRuleName.Truncate(0);
+        return State::Idle;
+      }
+      if (StringBeginsWith(u"<!--"_ns, mRuleName) ||
+          StringBeginsWith(u"-->"_ns, mRuleName)) {
+        return mState;
+      }
+      return State::Done;
+    }
     case State::AtRuleName: {
       if (IsAsciiAlpha(aChar)) {
         if (mRuleName.Length() > kMaxRuleNameLength - 1) {
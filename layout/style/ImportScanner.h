@@ -52,6 +52,9 @@ struct ImportScanner final {
     // We've seen a '*' while we're in a comment, but we don't now yet whether
     // '/' comes afterwards (thus ending the comment).
     MaybeAtCommentEnd,
+    // We've seen the first characters of an HTML-style comment delimiter
+    // (<!-- or -->), which are collected in mRuleName.
+    AtHTMLCommentDelimiter,
     // We're parsing the '@' rule name.
     AtRuleName,
     // We're parsing the '@' rule value.
@@ -57,6 +57,7 @@
 #include "mozilla/net/UrlClassifierFeatureFactory.h"
 #include "mozilla/AsyncEventDispatcher.h"
 #include "mozilla/ProfilerLabels.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/ServoBindings.h"
 #include "mozilla/StyleSheet.h"
 #include "mozilla/StyleSheetInlines.h"
@@ -1694,7 +1695,18 @@ Loader::Completed Loader::ParseSheet(
           GetMainThreadSerialEventTarget(), __func__,
           [loadData = aLoadData](bool aDummy) {
             MOZ_ASSERT(NS_IsMainThread());
-            loadData->get()->SheetFinishedParsingAsync();
+            SheetLoadData* data = loadData->get();
+            if (profiler_thread_is_being_profiled_for_markers() &&
+                !data->mBytesReceived.IsNull() && data->mURI) {
+              Document* doc = data->Loader().GetDocument();
+              PROFILER_MARKER_TEXT(
+                  "StyleSheetBytesToRules", LAYOUT,
+                  MarkerOptions(
+                      MarkerTiming::IntervalUntilNowFrom(data->mBytesReceived),
+                      MarkerInnerWindowId(doc ? doc->InnerWindowID() : 0)),
+                  data->mURI->GetSpecOrDefault());
+            }
+            data->SheetFinishedParsingAsync();
           },
           [] { MOZ_CRASH("rejected parse promise"); });
   return Completed::No;
@@ -263,6 +263,10 @@ class SheetLoadData final
   // coalesced into an existing load.
   TimeStamp mLoadStart;
 
+  // When the last byte of the sheet was received from the network, for the
+  // profiler marker covering its decoding and parsing.
+  TimeStamp mBytesReceived;
+
   const bool mRecordErrors;
 
   RefPtr<SubResourceNetworkMetadataHolder> mNetworkMetadata;
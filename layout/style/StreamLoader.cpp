@@ -135,6 +135,10 @@ StreamLoader::OnStopRequest(nsIRequest* aRequest, nsresult aStatus) {
     return NS_OK;
   }
   mOnStopProcessingDone = true;
+  if (mSheetLoadData->mBytesReceived.IsNull()) {
+    mSheetLoadData->mBytesReceived =
+        mOnDataFinishedTime ? mOnDataFinishedTime : TimeStamp::Now();
+  }
 
   nsresult rv = mStatus;
   // Decoded data
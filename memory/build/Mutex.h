@@ -201,7 +201,12 @@ class MOZ_CAPABILITY("mutex") MaybeMutex : public Mutex {
 
   inline void Lock() MOZ_CAPABILITY_ACQUIRE() {
     if (ShouldLock()) {
-      Mutex::Lock();
+      // Trying first costs nothing more than the fast path of Mutex::Lock()
+      // when the lock is free, and tells us when another thread held it.
+      if (!Mutex::TryLock()) {
+        Mutex::Lock();
+        mNumContended++;
+      }
     }
   }
 
@@ -222,6 +227,10 @@ class MOZ_CAPABILITY("mutex") MaybeMutex : public Mutex {
 
   bool LockIsEnabled() const { return mDoLock == MUST_LOCK; }
 
+  // The number of times Lock() found the mutex held by another thread. Only
+  // read or written with the lock held.
+  size_t NumContended() const { return mNumContended; }
+
  private:
   bool ShouldLock() {
 #ifndef XP_WIN
@@ -237,6 +246,7 @@ class MOZ_CAPABILITY("mutex") MaybeMutex : public Mutex {
   }
 
   DoLock mDoLock;
+  size_t mNumContended = 0;
 #ifdef MOZ_DEBUG
   ThreadId mThreadId;
 #  ifndef XP_WIN
@@ -4920,6 +4920,7 @@ inline void MozJemalloc::jemalloc_stats_internal(
   aStats->pages_madvised = 0;
   aStats->bookkeeping = 0;
   aStats->bin_unused = 0;
+  aStats->arena_lock_contended = 0;
 
   non_arena_mapped = 0;
 
@@ -4971,6 +4972,8 @@ inline void MozJemalloc::jemalloc_stats_internal(
       arena_fresh = arena->mNumFresh << gPageSize2Pow;
       arena_madvised = arena->mNumMAdvised << gPageSize2Pow;
 
+      aStats->arena_lock_contended += arena->mLock.NumContended();
+
       for (j = 0; j < NUM_SMALL_CLASSES; j++) {
         arena_bin_t* bin = &arena->mBins[j];
         size_t bin_unused = 0;
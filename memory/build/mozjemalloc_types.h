@@ -122,6 +122,10 @@ typedef struct {
   size_t bookkeeping;     // Committed bytes used internally by the
                           // allocator.
   size_t bin_unused;      // Bytes committed to a bin but currently unused.
+
+  // Lock statistics.
+  size_t arena_lock_contended;  // Times an arena's lock was found held by
+                                // another thread, since startup.
 } jemalloc_stats_t;
 
 typedef struct {
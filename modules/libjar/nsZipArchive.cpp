@@ -653,8 +653,18 @@ nsresult nsZipArchive::BuildFileList(PRFileDesc* aFd)
   // which is used in the parent process.
   if (XRE_IsParentProcess() && mFd->mLen > ZIPCENTRAL_SIZE &&
       xtolong(startp + centralOffset) == CENTRALSIG) {
-    // Success means optimized jar layout from bug 559961 is in effect
+    // Success means optimized jar layout from bug 559961 is in effect: the
+    // packager moved the central directory to the front, followed by the
+    // entries in the order a recorded startup read them, and stored the
+    // length of that prefix in the first four bytes. Prefetching it turns
+    // the startup loads into one sequential read.
+    //
+    // Only the I/O is done ahead of time. Inflating entries in advance would
+    // need a cache of inflated data to hand them out from, while callers
+    // already keep what they need afterwards (e.g. in the StartupCache).
     uint32_t readaheadLength = xtolong(startp);
+    LOG(("ZipHandle::BuildFileList[%p] readahead %u bytes", this,
+         readaheadLength));
     mozilla::PrefetchMemory(const_cast<uint8_t*>(startp), readaheadLength);
   } else {
     for (buf = endp - ZIPEND_SIZE; buf > startp; buf--) {
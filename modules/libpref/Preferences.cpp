@@ -42,6 +42,7 @@
 #include "mozilla/StaticPrefsAll.h"
 #include "mozilla/StaticPtr.h"
 #include "mozilla/SyncRunnable.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Try.h"
 #include "mozilla/UniquePtrExtensions.h"
 #include "mozilla/URLPreloader.h"
@@ -3797,17 +3798,29 @@ void Preferences::SerializePreferences(nsCString& aStr,
                                        bool aIsDestinationWebContentProcess) {
   MOZ_RELEASE_ASSERT(InitStaticMembers());
 
+  const TimeStamp start = TimeStamp::Now();
+  uint32_t count = 0;
+
   aStr.Truncate();
 
+  // Once EnsureSnapshot() has run, the hashtable only holds the prefs changed
+  // since then and the sanitized ones, so this is the delta sent on top of the
+  // shared snapshot to each new process.
   for (auto iter = HashTable()->iter(); !iter.done(); iter.next()) {
     Pref* pref = iter.get().get();
     if (!pref->IsTypeNone() && pref->HasAdvisablySizedValues()) {
       pref->SerializeAndAppend(aStr, aIsDestinationWebContentProcess &&
                                          ShouldSanitizePreference(pref));
+      count++;
     }
   }
 
   aStr.Append('\0');
+
+  PROFILER_MARKER_TEXT(
+      "Preferences::SerializePreferences", OTHER,
+      MarkerTiming::IntervalUntilNowFrom(start),
+      nsPrintfCString("%u prefs, %u bytes", count, aStr.Length()));
 }
 
 /* static */
@@ -3838,6 +3851,8 @@ mozilla::ipc::SharedMemoryHandle Preferences::EnsureSnapshot(size_t* aSize) {
   MOZ_ASSERT(NS_IsMainThread());
 
   if (!gSharedMap) {
+    AUTO_PROFILER_MARKER_TEXT("Preferences::EnsureSnapshot", OTHER, {},
+                              ""_ns);
     SharedPrefMapBuilder builder;
 
     nsTArray<Pref*> toRepopulate;
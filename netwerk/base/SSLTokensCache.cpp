@@ -103,6 +103,29 @@ void SSLTokensCache::TokenCacheRecord::Reset() {
   mSessionCacheInfo.mFailedCertChainBytes.reset();
 }
 
+// static
+void SSLTokensCache::AddToExpirationArray(
+    nsTArray<TokenCacheRecord*>& aExpirationArray, TokenCacheRecord* aRecord) {
+  aExpirationArray.InsertElementSorted(aRecord, ExpirationComparator());
+}
+
+// static
+void SSLTokensCache::RemoveFromExpirationArray(
+    nsTArray<TokenCacheRecord*>& aExpirationArray, TokenCacheRecord* aRecord) {
+  size_t index = aExpirationArray.IndexOfFirstElementGt(
+      aRecord, ExpirationComparator());
+  // Records with the same expiration time are before index, in no particular
+  // order.
+  while (index > 0 && aExpirationArray[index - 1]->mExpirationTime ==
+                          aRecord->mExpirationTime) {
+    --index;
+    if (aExpirationArray[index] == aRecord) {
+      aExpirationArray.RemoveElementAt(index);
+      return;
+    }
+  }
+}
+
 uint32_t SSLTokensCache::TokenCacheEntry::Size() const {
   uint32_t size = 0;
   for (const auto& rec : mRecords) {
@@ -116,11 +139,11 @@ void SSLTokensCache::TokenCacheEntry::AddRecord(
     nsTArray<TokenCacheRecord*>& aExpirationArray) {
   if (mRecords.Length() ==
       StaticPrefs::network_ssl_tokens_cache_records_per_entry()) {
-    aExpirationArray.RemoveElement(mRecords[0].get());
+    RemoveFromExpirationArray(aExpirationArray, mRecords[0].get());
     mRecords.RemoveElementAt(0);
   }
 
-  aExpirationArray.AppendElement(aRecord.get());
+  AddToExpirationArray(aExpirationArray, aRecord.get());
   for (int32_t i = mRecords.Length() - 1; i >= 0; --i) {
     if (aRecord->mExpirationTime > mRecords[i]->mExpirationTime) {
       mRecords.InsertElementAt(i + 1, std::move(aRecord));
@@ -484,7 +507,7 @@ nsresult SSLTokensCache::RemovAllLocked(const nsACString& aKey) {
 }
 
 void SSLTokensCache::OnRecordDestroyed(TokenCacheRecord* aRec) {
-  mExpirationArray.RemoveElement(aRec);
+  RemoveFromExpirationArray(mExpirationArray, aRec);
 }
 
 void SSLTokensCache::EvictIfNecessary() {
@@ -496,8 +519,6 @@ void SSLTokensCache::EvictIfNecessary() {
 
   LOG(("SSLTokensCache::EvictIfNecessary - evicting"));
 
-  mExpirationArray.Sort(ExpirationComparator());
-
   while (mCacheSize > capacity && mExpirationArray.Length() > 0) {
     DebugOnly<nsresult> rv =
         RemoveLocked(mExpirationArray[0]->mKey, mExpirationArray[0]->mId);
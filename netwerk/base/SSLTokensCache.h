@@ -113,6 +113,15 @@ class SSLTokensCache : public nsIMemoryReporter {
 
   void OnRecordDestroyed(TokenCacheRecord* aRec);
 
+  // mExpirationArray is kept sorted by expiration time, so that evicting the
+  // records expiring first does not sort all the records of the cache on every
+  // Put() once it is full, and a destroyed record is found with a binary
+  // search.
+  static void AddToExpirationArray(
+      nsTArray<TokenCacheRecord*>& aExpirationArray, TokenCacheRecord* aRecord);
+  static void RemoveFromExpirationArray(
+      nsTArray<TokenCacheRecord*>& aExpirationArray, TokenCacheRecord* aRecord);
+
   nsClassHashtable<nsCStringHashKey, TokenCacheEntry> mTokenCacheRecords;
   nsTArray<TokenCacheRecord*> mExpirationArray;
 };
@@ -69,13 +69,29 @@ function localHostOrDomainIs(host, hostdom) {
   return host == hostdom || hostdom.lastIndexOf(host + ".", 0) == 0;
 }
 
-function shExpMatch(url, pattern) {
-  pattern = pattern.replace(/\./g, "\\.");
-  pattern = pattern.replace(/\*/g, ".*");
-  pattern = pattern.replace(/\?/g, ".");
-  var newRe = new RegExp("^" + pattern + "$");
-  return newRe.test(url);
-}
+// PAC scripts call shExpMatch with the same few patterns for every request, so
+// the regular expressions built from them are kept.  The cache is dropped when
+// it grows too large, in case the patterns are built dynamically.  It is kept
+// in a closure, such that PAC scripts cannot overwrite it.
+var shExpMatch = (function () {
+  var cache = new Map();
+  var cacheMaxSize = 1000;
+
+  return function shExpMatch(url, pattern) {
+    var re = cache.get(pattern);
+    if (re === undefined) {
+      var source = pattern.replace(/\./g, "\\.");
+      source = source.replace(/\*/g, ".*");
+      source = source.replace(/\?/g, ".");
+      re = new RegExp("^" + source + "$");
+      if (cache.size >= cacheMaxSize) {
+        cache.clear();
+      }
+      cache.set(pattern, re);
+    }
+    return re.test(url);
+  };
+})();
 
 var wdays = { SUN: 0, MON: 1, TUE: 2, WED: 3, THU: 4, FRI: 5, SAT: 6 };
 var months = {
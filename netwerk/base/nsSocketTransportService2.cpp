@@ -603,6 +603,11 @@ PRIntervalTime nsSocketTransportService::PollTimeout(PRIntervalTime now) {
   return minR;
 }
 
+// Sockets are polled with PR_Poll rather than with a persistent registration
+// of their OS descriptors, such as epoll on Linux. Most sockets are layered
+// NSPR file descriptors, and PR_Poll asks each layer's poll method which
+// flags to wait for: a TLS layer may have decrypted data buffered, or need to
+// read before it can write, which the OS descriptor alone doesn't tell.
 int32_t nsSocketTransportService::Poll(TimeDuration* pollDuration,
                                        PRIntervalTime ts) {
   MOZ_ASSERT(IsOnCurrentThread());
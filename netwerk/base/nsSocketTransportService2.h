@@ -347,6 +347,11 @@ class nsSocketTransportService final : public nsPISocketTransportService,
 };
 
 extern nsSocketTransportService* gSocketTransportService;
+
+// Whether the current thread is the socket thread. There is a single socket
+// thread per process: the HTTP connection manager, the HTTP/2 and HTTP/3
+// sessions and the sockets they own all assume that they are only accessed
+// from it, and assert so with this function rather than with locks.
 bool OnSocketThread();
 
 }  // namespace net
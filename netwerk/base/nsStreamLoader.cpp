@@ -33,6 +33,12 @@ nsresult nsStreamLoader::Create(REFNSIID aIID, void** aResult) {
 NS_IMPL_ISUPPORTS(nsStreamLoader, nsIStreamLoader, nsIRequestObserver,
                   nsIStreamListener, nsIThreadRetargetableStreamListener)
 
+NS_IMETHODIMP
+nsStreamLoader::SetExpectedLength(int64_t aLength) {
+  mExpectedLength = aLength;
+  return NS_OK;
+}
+
 NS_IMETHODIMP
 nsStreamLoader::GetNumBytesRead(uint32_t* aNumBytes) {
   *aNumBytes = mBytesRead;
@@ -48,23 +54,26 @@ nsStreamLoader::GetRequest(nsIRequest** aRequest) {
 
 NS_IMETHODIMP
 nsStreamLoader::OnStartRequest(nsIRequest* request) {
+  int64_t contentLength = -1;
   nsCOMPtr<nsIChannel> chan(do_QueryInterface(request));
   if (chan) {
-    int64_t contentLength = -1;
     chan->GetContentLength(&contentLength);
-    if (contentLength >= 0) {
-      // On 64bit platforms size of uint64_t coincides with the size of size_t,
-      // so we want to compare with the minimum from size_t and int64_t.
-      if (static_cast<uint64_t>(contentLength) >
-          std::min(std::numeric_limits<size_t>::max(),
-                   static_cast<size_t>(std::numeric_limits<int64_t>::max()))) {
-        // Too big to fit into size_t, so let's bail.
-        return NS_ERROR_OUT_OF_MEMORY;
-      }
-      // preallocate buffer
-      if (!mData.initCapacity(contentLength)) {
-        return NS_ERROR_OUT_OF_MEMORY;
-      }
+  }
+  if (contentLength < 0) {
+    contentLength = mExpectedLength;
+  }
+  if (contentLength >= 0) {
+    // On 64bit platforms size of uint64_t coincides with the size of size_t,
+    // so we want to compare with the minimum from size_t and int64_t.
+    if (static_cast<uint64_t>(contentLength) >
+        std::min(std::numeric_limits<size_t>::max(),
+                 static_cast<size_t>(std::numeric_limits<int64_t>::max()))) {
+      // Too big to fit into size_t, so let's bail.
+      return NS_ERROR_OUT_OF_MEMORY;
+    }
+    // preallocate buffer
+    if (!mData.initCapacity(contentLength)) {
+      return NS_ERROR_OUT_OF_MEMORY;
     }
   }
   if (mRequestObserver) {
@@ -46,6 +46,9 @@ class nsStreamLoader final : public nsIStreamLoader {
 
   mozilla::Atomic<uint32_t, mozilla::MemoryOrdering::Relaxed> mBytesRead;
 
+  // Used to preallocate mData when the request doesn't provide a length.
+  int64_t mExpectedLength = -1;
+
   // Buffer to accumulate incoming data. We preallocate if contentSize is
   // available.
   mozilla::Vector<uint8_t, 0> mData;
@@ -210,6 +210,8 @@ CacheEntry::CacheEntry(const nsACString& aStorageID, const nsACString& aURI,
     : mURI(aURI),
       mEnhanceID(aEnhanceID),
       mStorageID(aStorageID),
+      mKeyHash(AddToHash(HashString(aStorageID), HashString(aEnhanceID),
+                         HashString(aURI))),
       mUseDisk(aUseDisk),
       mSkipSizeCheck(aSkipSizeCheck),
       mPinned(aPin),
@@ -1802,6 +1804,7 @@ void CacheEntry::BackgroundOp(uint32_t aOperations, bool aForceAsync)
 
     if (aOperations & Ops::FRECENCYUPDATE) {
       ++mUseCount;
+      mService->RecordEntryUse(this);
 
 #ifndef M_LN2
 #  define M_LN2 0.69314718055994530942
@@ -123,6 +123,7 @@ class CacheEntry final : public nsIRunnable,
   double GetFrecency() const;
   uint32_t GetExpirationTime() const;
   uint32_t UseCount() const { return mUseCount; }
+  HashNumber KeyHash() const { return mKeyHash; }
 
   bool IsRegistered() const;
   bool CanRegister() const;
@@ -331,6 +332,9 @@ class CacheEntry final : public nsIRunnable,
   nsCString const mURI;
   nsCString const mEnhanceID;
   nsCString const mStorageID;
+  // Hash of the storage ID, enhance ID and URI, the key of this entry in the
+  // frequency sketch of the service.
+  HashNumber const mKeyHash;
 
   // mUseDisk, mSkipSizeCheck, mIsDoomed are plain "bool", not "bool:1",
   // so as to avoid bitfield races with the byte containing
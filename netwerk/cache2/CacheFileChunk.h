@@ -15,6 +15,12 @@
 namespace mozilla {
 namespace net {
 
+// Chunks are stored uncompressed, chunk N of an entry always starts at
+// N * kChunkSize in the file, which is what makes random access to the data
+// (e.g. ranges, alt-data at mAltDataOffset) a plain seek.  The metadata keeps
+// a hash of each chunk's content to verify it when it is read.  Responses
+// that were compressed by the server are stored with their Content-Encoding
+// and decoded by the channel when read from the cache.
 constexpr int32_t kChunkSize = 256 * 1024;
 constexpr size_t kEmptyChunkHash = 0x1826;
 
@@ -0,0 +1,53 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "CacheFrequencySketch.h"
+
+#include <algorithm>
+
+namespace mozilla {
+namespace net {
+
+// static
+uint32_t CacheFrequencySketch::Index(HashNumber aHash, uint32_t aRow) {
+  // The high bits of the hash are the best mixed ones.
+  return AddToHash(aHash, aRow) >> (kHashNumberBits - kWidthLog2);
+}
+
+void CacheFrequencySketch::Increment(HashNumber aHash) {
+  // Conservative update, only the smallest counters are incremented.
+  uint32_t estimate = Estimate(aHash);
+  if (estimate < kMaxCount) {
+    for (uint32_t row = 0; row < kDepth; ++row) {
+      uint8_t& counter = mCounters[row][Index(aHash, row)];
+      if (counter == estimate) {
+        ++counter;
+      }
+    }
+  }
+
+  if (++mIncrements >= kSampleSize) {
+    Age();
+  }
+}
+
+uint32_t CacheFrequencySketch::Estimate(HashNumber aHash) const {
+  uint32_t estimate = kMaxCount;
+  for (uint32_t row = 0; row < kDepth; ++row) {
+    estimate = std::min<uint32_t>(estimate, mCounters[row][Index(aHash, row)]);
+  }
+  return estimate;
+}
+
+void CacheFrequencySketch::Age() {
+  for (auto& row : mCounters) {
+    for (uint8_t& counter : row) {
+      counter >>= 1;
+    }
+  }
+  mIncrements /= 2;
+}
+
+}  // namespace net
+}  // namespace mozilla
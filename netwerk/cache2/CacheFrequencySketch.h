@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef CacheFrequencySketch__h__
+#define CacheFrequencySketch__h__
+
+#include "mozilla/HashFunctions.h"
+
+namespace mozilla {
+namespace net {
+
+/**
+ * A count-min sketch estimating how many times each cache entry was used
+ * recently, as seen by TinyLFU. Unlike CacheEntry::UseCount(), the estimate
+ * survives the entry being purged from memory and opened again, which lets
+ * the memory pools tell entries used once from entries used repeatedly.
+ *
+ * Counters saturate at kMaxCount and are all halved every kSampleSize
+ * increments, so that the estimates follow the recent use of entries.
+ *
+ * Accessible only on the management thread.
+ */
+class CacheFrequencySketch final {
+ public:
+  void Increment(HashNumber aHash);
+  uint32_t Estimate(HashNumber aHash) const;
+
+ private:
+  static constexpr uint32_t kDepth = 4;
+  static constexpr uint32_t kWidthLog2 = 12;
+  static constexpr uint32_t kWidth = 1 << kWidthLog2;
+  static constexpr uint8_t kMaxCount = 15;
+  static constexpr uint32_t kSampleSize = 10 * kWidth;
+
+  static uint32_t Index(HashNumber aHash, uint32_t aRow);
+  void Age();
+
+  uint8_t mCounters[kDepth][kWidth] = {};
+  uint32_t mIncrements = 0;
+};
+
+}  // namespace net
+}  // namespace mozilla
+
+#endif
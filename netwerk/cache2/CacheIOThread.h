@@ -27,6 +27,18 @@ namespace detail {
 class NativeThreadHandle;
 }  // namespace detail
 
+// The one thread doing all the cache I/O.  CacheFileIOManager keeps its
+// handle tables, the list of handles to close when too many files are open
+// and the special files of the index unsynchronized, relying on all of them
+// being accessed on this thread only, and so does CacheIndex for its I/O
+// state.  Running the I/O on several threads would need these to be made
+// thread-safe, and every dispatch to keep the order of operations on the
+// same handle.
+//
+// Instead, long running work is split in events queued on the low priority
+// levels, which call YieldAndRerun() between units of work (e.g. for every
+// file visited while building or updating the index) so that reads and opens
+// for the page being loaded do not wait behind them.
 class CacheIOThread final : public nsIThreadObserver {
   virtual ~CacheIOThread();
 
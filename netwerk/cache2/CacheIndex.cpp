@@ -25,7 +25,12 @@
 
 #define kMinUnwrittenChanges 300
 #define kMinDumpInterval 20000  // in milliseconds
-#define kMaxBufSize 16384
+// The index is read and written in chunks of this size.  Every chunk takes a
+// round trip through the IO thread, and with hundreds of thousands of entries
+// small chunks made loading and dumping the index dominated by these round
+// trips.  The records of a chunk are parsed and serialized under sLock, so it
+// should not grow much more, to avoid blocking the main thread on sLock.
+#define kMaxBufSize (128 * 1024)
 #define kIndexVersion 0x0000000A
 #define kUpdateIndexStartDelay 50000  // in milliseconds
 #define kTelemetryReportBytesLimit (2U * 1024U * 1024U * 1024U)  // 2GB
@@ -1014,6 +1014,12 @@ void CacheStorageService::UnregisterEntry(CacheEntry* aEntry) {
   aEntry->SetRegistered(false);
 }
 
+void CacheStorageService::RecordEntryUse(CacheEntry* aEntry) {
+  MOZ_ASSERT(IsOnManagementThread());
+
+  mFrequencySketch.Increment(aEntry->KeyHash());
+}
+
 static bool AddExactEntry(CacheEntryTable* aEntries, nsACString const& aKey,
                           CacheEntry* aEntry, bool aOverwrite) {
   RefPtr<CacheEntry> existingEntry;
@@ -1453,17 +1459,29 @@ Result<size_t, nsresult> CacheStorageService::MemoryPool::PurgeByFrecency(
 
   LOG(("MemoryPool::PurgeByFrecency, len=%zu", mManagedEntries.length()));
 
-  // We want to have an array snapshot for sorting and iterating.
+  CacheFrequencySketch const& sketch =
+      CacheStorageService::Self()->mFrequencySketch;
+
+  // We want to have an array snapshot for sorting and iterating.  As in
+  // TinyLFU, the entries recently used the fewest times are purged first, even
+  // when they have been loaded again since they were last purged, so that a
+  // burst of entries used once does not push the frequently used ones out of
+  // memory.  Frecency orders the entries used as many times.
   struct mayPurgeEntry {
     RefPtr<CacheEntry> mEntry;
+    uint32_t mFrequency;
     double mFrecency;
 
-    explicit mayPurgeEntry(CacheEntry* aEntry) {
+    mayPurgeEntry(CacheEntry* aEntry, CacheFrequencySketch const& aSketch) {
       mEntry = aEntry;
+      mFrequency = aSketch.Estimate(aEntry->KeyHash());
       mFrecency = aEntry->GetFrecency();
     }
 
     bool operator<(const mayPurgeEntry& aOther) const {
+      if (mFrequency != aOther.mFrequency) {
+        return mFrequency < aOther.mFrequency;
+      }
       return mFrecency < aOther.mFrecency;
     }
   };
@@ -1480,7 +1498,7 @@ Result<size_t, nsresult> CacheStorageService::MemoryPool::PurgeByFrecency(
       // Referenced items cannot be purged and we deliberately want to not look
       // at '0' frecency entries, these are new entries and can be ignored.
       if (!entry->IsReferenced() && entry->GetFrecency() > 0.0) {
-        mayPurgeEntry copy(entry);
+        mayPurgeEntry copy(entry, sketch);
         mayPurgeSorted.AppendElement(std::move(copy));
       }
     }
@@ -1501,8 +1519,9 @@ Result<size_t, nsresult> CacheStorageService::MemoryPool::PurgeByFrecency(
 
     if (entry->Purge(CacheEntry::PURGE_WHOLE)) {
       numPurged++;
-      LOG(("  abandoned (%d), entry=%p, frecency=%1.10f",
-           CacheEntry::PURGE_WHOLE, entry.get(), entry->GetFrecency()));
+      LOG(("  abandoned (%d), entry=%p, frequency=%u, frecency=%1.10f",
+           CacheEntry::PURGE_WHOLE, entry.get(), checkPurge.mFrequency,
+           entry->GetFrecency()));
     }
 
     if (numPurged >= minprogress && CacheIOThread::YieldAndRerun()) {
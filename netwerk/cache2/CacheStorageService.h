@@ -11,6 +11,7 @@
 #include "nsINamed.h"
 #include "nsITimer.h"
 #include "nsICacheTesting.h"
+#include "CacheFrequencySketch.h"
 
 #include "nsClassHashtable.h"
 #include "nsTHashMap.h"
@@ -161,6 +162,11 @@ class CacheStorageService final : public nsICacheStorageService,
    */
   void UnregisterEntry(CacheEntry* aEntry);
 
+  /**
+   * Counts a use of the entry in the frequency sketch.
+   */
+  void RecordEntryUse(CacheEntry* aEntry);
+
   /**
    * Removes the entry from the related entry hash table, if still present.
    */
@@ -358,6 +364,10 @@ class CacheStorageService final : public nsICacheStorageService,
     MemoryPool() = delete;
   };
 
+  // Estimates how often entries of both pools were used recently, consulted
+  // to purge the entries used only once first.
+  CacheFrequencySketch mFrequencySketch;
+
   MemoryPool mDiskPool{MemoryPool::DISK};
   MemoryPool mMemoryPool{MemoryPool::MEMORY};
   TimeStamp mLastPurgeTime;
@@ -14,6 +14,7 @@
 
 #include <stdlib.h>
 #include <ctime>
+#include <algorithm>
 #include "nsHostResolver.h"
 #include "nsError.h"
 #include "nsIOService.h"
@@ -1406,7 +1407,10 @@ void nsHostResolver::PrepareRecordExpirationAddrRecord(
       ttl = rec->addr_info->TTL();
     }
     lifetime = ttl;
-    grace = 0;
+    // Keep serving the record while it is refreshed past its TTL, but not for
+    // longer than the TTL itself, so that records with short TTLs (e.g. of
+    // load balancers) are not used much longer than the server asked for.
+    grace = std::min(grace, ttl);
   }
 
   rec->SetExpiration(TimeStamp::NowLoRes(), lifetime, grace);
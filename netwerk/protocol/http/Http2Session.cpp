@@ -926,6 +926,20 @@ void Http2Session::GeneratePing(bool isAck) {
   FlushOutputQueue();
 }
 
+void Http2Session::GenerateBdpPing() {
+  MOZ_ASSERT(OnSocketThread(), "not on socket thread");
+  LOG3(("Http2Session::GenerateBdpPing %p\n", this));
+
+  char* packet = EnsureOutputBuffer(kFrameHeaderBytes + 8);
+  mOutputQueueUsed += kFrameHeaderBytes + 8;
+
+  CreateFrameHeader(packet, 8, FRAME_TYPE_PING, 0, 0);
+  NetworkEndian::writeUint64(packet + kFrameHeaderBytes, kBdpPingPayload);
+
+  LogIO(this, nullptr, "Generate BDP Ping", packet, kFrameHeaderBytes + 8);
+  // dont flush here, this write can commonly be coalesced with window updates
+}
+
 void Http2Session::GenerateSettingsAck() {
   // need to generate ack of this settings frame
   MOZ_ASSERT(OnSocketThread(), "not on socket thread");
@@ -2261,6 +2275,12 @@ nsresult Http2Session::RecvPing(Http2Session* self) {
     // We need to reset mPreviousUsed. If we don't, the next time
     // Http2Session::SendPing is called, it will have no effect.
     self->mPreviousUsed = false;
+
+    if (self->mBdpPingSentEpoch &&
+        NetworkEndian::readUint64(self->mInputFrameBuffer.get() +
+                                  kFrameHeaderBytes) == kBdpPingPayload) {
+      self->FinishBdpEstimate();
+    }
   } else {
     // reply with a ack'd ping
     self->GeneratePing(true);
@@ -3795,6 +3815,18 @@ void Http2Session::UpdateLocalStreamWindow(Http2StreamBase* stream,
       ("Http2Session::UpdateLocalStreamWindow Ack this=%p id=0x%X acksize=%d\n",
        this, stream->StreamID(), toack));
   stream->IncrementClientReceiveWindow(toack);
+
+  // Follow the growth of the session window, unless the transaction asked for
+  // its own window.
+  nsHttpTransaction* trans = stream->HttpTransaction();
+  int64_t target = stream->ClientReceiveWindowTarget();
+  if (!(trans && trans->InitialRwin()) && target < mInitialRwin) {
+    uint32_t growth = std::min<uint64_t>(mInitialRwin - target,
+                                         0x7fffffffU - toack);
+    stream->GrowClientReceiveWindow(growth);
+    toack += growth;
+  }
+
   if (toack == 0) {
     // Ensure we never send an illegal 0 window update
     return;
@@ -3862,6 +3894,58 @@ void Http2Session::UpdateLocalRwin(Http2StreamBase* stream, uint32_t bytes) {
 
   UpdateLocalStreamWindow(stream, bytes);
   UpdateLocalSessionWindow(bytes);
+  UpdateBdpEstimate(bytes);
+  FlushOutputQueue();
+}
+
+void Http2Session::UpdateBdpEstimate(uint32_t bytes) {
+  if (!bytes || mInitialRwin >= kMaxAutoTunedRwin) {
+    return;
+  }
+
+  if (mBdpPingSentEpoch) {
+    mBdpBytes += bytes;
+    return;
+  }
+
+  // Avoid flooding the server with pings, which it may treat as abuse.
+  PRIntervalTime now = PR_IntervalNow();
+  if (mLastBdpPingEpoch && (now - mLastBdpPingEpoch) <
+                                PR_MillisecondsToInterval(kBdpPingIntervalMs)) {
+    return;
+  }
+
+  mBdpPingSentEpoch = now ? now : 1;  // avoid the 0 sentinel value
+  mLastBdpPingEpoch = mBdpPingSentEpoch;
+  mBdpBytes = bytes;
+  GenerateBdpPing();
+}
+
+void Http2Session::FinishBdpEstimate() {
+  uint64_t bdp = mBdpBytes;
+  mBdpPingSentEpoch = 0;
+  mBdpBytes = 0;
+
+  // The data received during a round trip is bounded by the receive window,
+  // so grow the window when this bound is getting close.
+  if (bdp * 2 <= mInitialRwin) {
+    return;
+  }
+
+  uint32_t newRwin = std::min<uint64_t>(bdp * 2, kMaxAutoTunedRwin);
+  uint32_t bump = newRwin - mInitialRwin;
+  LOG3(("Http2Session::FinishBdpEstimate %p bdp=%" PRIu64 " rwin=%u->%u\n",
+        this, bdp, mInitialRwin, newRwin));
+  mInitialRwin = newRwin;
+  mLocalSessionWindow += bump;
+
+  // The windows of the streams grow on their next window update.
+  char* packet = EnsureOutputBuffer(kFrameHeaderBytes + 4);
+  mOutputQueueUsed += kFrameHeaderBytes + 4;
+  CreateFrameHeader(packet, 4, FRAME_TYPE_WINDOW_UPDATE, 0, 0);
+  NetworkEndian::writeUint32(packet + kFrameHeaderBytes, bump);
+
+  LogIO(this, nullptr, "Session Window Growth", packet, kFrameHeaderBytes + 4);
   FlushOutputQueue();
 }
 
@@ -188,6 +188,16 @@ class Http2Session final : public ASpdySession,
   // The default rwin is 64KB - 1 unless updated by a settings frame
   const static uint32_t kDefaultRwin = 65535;
 
+  // The receive windows grow up to this size when the bandwidth-delay product
+  // of the connection, estimated with PING frames, exceeds half of them.
+  const static uint32_t kMaxAutoTunedRwin = 64 * 1024 * 1024;
+
+  // The minimum interval between two bandwidth-delay product estimates, and
+  // the opaque data of their PING frames, distinct from the zeroed keepalive
+  // pings.
+  const static uint32_t kBdpPingIntervalMs = 500;
+  const static uint64_t kBdpPingPayload = 0x42445050524f4245;  // "BDPPROBE"
+
   // We limit frames to 2^14 bytes of length in order to preserve responsiveness
   // This is the smallest allowed value for SETTINGS_MAX_FRAME_SIZE
   const static uint32_t kMaxFrameData = 0x4000;
@@ -343,6 +353,7 @@ class Http2Session final : public ASpdySession,
   [[nodiscard]] nsresult ReadyToProcessDataFrame(enum internalStateType);
   [[nodiscard]] nsresult UncompressAndDiscard(bool);
   void GeneratePing(bool);
+  void GenerateBdpPing();
   void GenerateSettingsAck();
   void GenerateRstStream(uint32_t, uint32_t);
   void GenerateGoAway(uint32_t);
@@ -376,6 +387,8 @@ class Http2Session final : public ASpdySession,
   void UpdateLocalRwin(Http2StreamBase* stream, uint32_t bytes);
   void UpdateLocalStreamWindow(Http2StreamBase* stream, uint32_t bytes);
   void UpdateLocalSessionWindow(uint32_t bytes);
+  void UpdateBdpEstimate(uint32_t bytes);
+  void FinishBdpEstimate();
 
   void MaybeDecrementConcurrent(Http2StreamBase* stream);
   bool RoomForMoreConcurrent();
@@ -568,6 +581,12 @@ class Http2Session final : public ASpdySession,
   PRIntervalTime mPreviousPingThreshold;  // backup for the former value
   bool mPreviousUsed;                     // true when backup is used
 
+  // The bandwidth-delay product is estimated as the number of bytes of DATA
+  // received between sending a BDP ping and receiving its ack.
+  PRIntervalTime mBdpPingSentEpoch{0};
+  PRIntervalTime mLastBdpPingEpoch{0};
+  uint64_t mBdpBytes{0};
+
   // used as a temporary buffer while enumerating the stream hash during GoAway
   nsDeque<Http2StreamBase> mGoAwayStreamsToRestart;
 
@@ -133,9 +133,20 @@ class Http2StreamBase : public nsAHttpSegmentReader,
     mLocalUnacked -= delta;
   }
 
+  // Grow the window advertised to the server, which the caller announces with
+  // a window update.
+  void GrowClientReceiveWindow(uint32_t delta) {
+    mClientReceiveWindow += delta;
+  }
+
   uint64_t LocalUnAcked();
   int64_t ClientReceiveWindow() { return mClientReceiveWindow; }
 
+  // The window advertised to the server once all received bytes are acked.
+  int64_t ClientReceiveWindowTarget() {
+    return mClientReceiveWindow + int64_t(mLocalUnacked);
+  }
+
   bool BlockedOnRwin() { return mBlockedOnRwin; }
 
   uint32_t RFC7540Priority() { return mRFC7540Priority; }
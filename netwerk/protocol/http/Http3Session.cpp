@@ -400,8 +400,11 @@ nsresult Http3Session::ProcessInput(nsIUDPSocket* socket) {
        mUdpConn.get(), this, mState));
 
   if (mUseNSPRForIO) {
+    // Reuse the buffer of the previous datagram, which is at most the size of
+    // the largest one.
+    nsTArray<uint8_t> data;
     while (true) {
-      nsTArray<uint8_t> data;
+      data.ClearAndRetainStorage();
       NetAddr addr{};
       // RecvWithAddr actually does not return an error.
       nsresult rv = socket->RecvWithAddr(&addr, data);
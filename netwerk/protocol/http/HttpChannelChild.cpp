@@ -598,6 +598,9 @@ void HttpChannelChild::DoOnStartRequest(nsIRequest* aRequest) {
     return;
   }
 
+  // The content is decoded here rather than in the parent, so that the data
+  // sent over IPC, and copied on the way (see
+  // HttpChannelParent::OnDataAvailable), is the smaller encoded one.
   nsCOMPtr<nsIStreamListener> listener;
   rv = DoApplyContentConversions(mListener, getter_AddRefs(listener), nullptr);
   if (NS_FAILED(rv)) {
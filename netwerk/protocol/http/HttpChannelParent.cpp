@@ -1515,12 +1515,23 @@ HttpChannelParent::OnDataAvailable(nsIRequest* aRequest,
     onDataAvailableStart = httpChannelImpl->GetDataAvailableStartTime();
   }
 
+  // The data is copied once out of the pipe here, once into the IPC message
+  // and once out of it in the child, which then reads it in place. Sending a
+  // shared memory BigBuffer instead would only skip copies for chunks above
+  // BigBuffer::kShmemThreshold, and would map a new shared memory region for
+  // each of them.
   nsCString data;
   nsresult rv = NS_ReadInputStreamToString(aInputStream, data, aCount);
   if (NS_FAILED(rv)) {
     return rv;
   }
 
+  // Each call sends one message (or several of 128KiB, see SendDataInChunks),
+  // but the calls are already coalesced: the pumps report all the data
+  // available when they run, which for cache reads is the rest of the cache
+  // chunk, and for network reads all the segments the transaction wrote to its
+  // pipe meanwhile.  The busier this thread is, the larger the calls get.
+  //
   // Either IPC channel is closed or background channel
   // is ready to send OnTransportAndData.
   MOZ_ASSERT(mIPCClosed || mBgParent);
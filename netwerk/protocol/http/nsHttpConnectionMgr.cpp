@@ -3587,6 +3587,11 @@ void nsHttpConnectionMgr::DoSpeculativeConnectionInternal(
     return;
   }
 
+  // Every speculative connect opens at most one connection.  The limit below
+  // is on the sockets being connected at all, not a number of connections to
+  // open to this origin.  Origins found to use HTTP/2 keep their entry, and
+  // mUsingSpdy, across pruning, so RestrictConnections() stops opening more
+  // while one is being negotiated or can be multiplexed.
   uint32_t parallelSpeculativeConnectLimit =
       aTrans->ParallelSpeculativeConnectLimit()
           ? *aTrans->ParallelSpeculativeConnectLimit()
@@ -432,6 +432,14 @@ class nsHttpHandler final : public nsIHttpProtocolHandler,
                                                  int32_t port,
                                                  nsACString& hostLine);
 
+  // Maps the class of service flags and the nsISupportsPriority value (which
+  // carries the fetchpriority hint) of a request to an RFC 9218 urgency, from
+  // 0 (most urgent) to 6.  This is the one mapping used for all versions: it
+  // is sent in the Priority request header and HTTP/2 PRIORITY_UPDATE frames,
+  // and is used for the urgency of HTTP/3 streams.  HTTP/1 has no way to
+  // signal priorities, there the same inputs order the pending transaction
+  // queues of a ConnectionEntry, and the connection manager throttles
+  // throttleable transactions while others are active.
   static uint8_t UrgencyFromCoSFlags(uint32_t cos, int32_t aSupportsPriority);
 
   SpdyInformation* SpdyInfo() { return &mSpdyInfo; }
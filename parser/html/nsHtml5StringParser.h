@@ -19,6 +19,16 @@ class Document;
 }
 }  // namespace mozilla
 
+/**
+ * Parses strings (innerHTML, insertAdjacentHTML, DOMParser and the like)
+ * synchronously on the main thread.  Unlike the network parser, the tree
+ * builder does not generate tree ops here: nsHtml5OplessBuilder creates the
+ * nodes as the tokenizer goes, saving the allocation and the replay of the
+ * ops.  Since the callers need the whole fragment before they return, moving
+ * the tokenization to another thread would leave the main thread waiting for
+ * it and then applying the ops, which is more work on the main thread, not
+ * less.
+ */
 class nsHtml5StringParser : public nsParserBase {
  public:
   NS_DECL_ISUPPORTS
@@ -5,6 +5,15 @@
 #ifndef nsHtml5TokenizerLoopPolicies_h
 #define nsHtml5TokenizerLoopPolicies_h
 
+// The policies below are applied to every UTF-16 code unit read by
+// nsHtml5Tokenizer::stateLoop(). Skipping runs of uninteresting text a word
+// or a vector at a time in the data, attribute value and comment states
+// would need the states themselves to change, and nsHtml5Tokenizer.cpp is
+// generated from Tokenizer.java in the htmlparser repository, so such a fast
+// path belongs there. It would also only apply to nsHtml5FastestPolicy as
+// is: the other policies look at each code unit to count lines and columns
+// or to report transitions to the view source highlighter.
+
 /**
  * This policy does not report tokenizer transitions anywhere and does not
  * track line and column numbers. To be used for innerHTML.
@@ -555,6 +555,7 @@ nsIContent* nsHtml5TreeOperation::CreateSVGElement(
   }
 
   int32_t len = aAttributes->getLength();
+  newContent->TryReserveAttributeCount((uint32_t)len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
@@ -607,6 +608,7 @@ nsIContent* nsHtml5TreeOperation::CreateMathMLElement(
   }
 
   int32_t len = aAttributes->getLength();
+  newContent->TryReserveAttributeCount((uint32_t)len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
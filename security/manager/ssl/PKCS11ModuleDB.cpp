@@ -7,6 +7,7 @@
 #include "PKCS11ModuleDB.h"
 
 #include "CertVerifier.h"
+#include "PublicSSL.h"
 #include "ScopedNSSTypes.h"
 #include "mozilla/glean/GleanMetrics.h"
 #include "nsComponentManagerUtils.h"
@@ -66,6 +67,7 @@ PKCS11ModuleDB::DeleteModule(const nsAString& aModuleName) {
     return NS_ERROR_FAILURE;
   }
   certVerifier->ClearTrustCache();
+  mozilla::psm::ClearVerifiedServerCertChains();
 
   CollectThirdPartyPKCS11ModuleTelemetry();
 
@@ -119,6 +121,7 @@ PKCS11ModuleDB::AddModule(const nsAString& aModuleName,
     return NS_ERROR_FAILURE;
   }
   certVerifier->ClearTrustCache();
+  mozilla::psm::ClearVerifiedServerCertChains();
 
   CollectThirdPartyPKCS11ModuleTelemetry();
 
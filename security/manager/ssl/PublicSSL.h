@@ -12,6 +12,10 @@ namespace psm {
 
 void InitializeSSLServerCertVerificationThreads();
 void StopSSLServerCertVerificationThreads();
+// Forget recently verified server certificate chains. This must be called
+// whenever trust or revocation state changes, e.g. alongside
+// SharedCertVerifier::ClearTrustCache() and ClearOCSPCache().
+void ClearVerifiedServerCertChains();
 void DisableMD5();
 nsresult InitializeCipherSuite();
 
@@ -108,6 +108,9 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/Casting.h"
 #include "mozilla/RefPtr.h"
+#include "mozilla/ReverseIterator.h"
+#include "mozilla/StaticMutex.h"
+#include "mozilla/StaticPtr.h"
 #include "mozilla/StaticPrefs_security.h"
 #include "mozilla/Telemetry.h"
 #include "mozilla/UniquePtr.h"
@@ -185,6 +188,130 @@ void StopSSLServerCertVerificationThreads() {
     gCertVerificationThreadPool->Shutdown();
     NS_RELEASE(gCertVerificationThreadPool);
   }
+  ClearVerifiedServerCertChains();
+}
+
+// Successful verifications are remembered for a short while, so that the
+// connections made in parallel to a server, which all get the same
+// certificates, do not all build and check the same chain.  The inputs of the
+// verification are compared exactly.  The results are forgotten whenever the
+// TLS session cache is cleared, which also happens when the validation options
+// change.  As for a resumed TLS session, which is not verified again at all,
+// revocation information arriving after the verification is not taken into
+// account for a remembered result.
+namespace {
+
+constexpr size_t kMaxVerifiedChains = 32;
+constexpr uint64_t kVerifiedChainLifetimeSeconds = 30;
+
+nsTArray<nsTArray<uint8_t>> CloneCertChain(
+    const nsTArray<nsTArray<uint8_t>>& aCertChain) {
+  nsTArray<nsTArray<uint8_t>> clone;
+  std::transform(aCertChain.cbegin(), aCertChain.cend(),
+                 MakeBackInserter(clone),
+                 [](const auto& elementArray) { return elementArray.Clone(); });
+  return clone;
+}
+
+Maybe<nsTArray<uint8_t>> CloneMaybeBytes(
+    const Maybe<nsTArray<uint8_t>>& aBytes) {
+  return aBytes ? Some(aBytes->Clone()) : Nothing();
+}
+
+struct VerifiedChain {
+  VerifiedChain(SharedCertVerifier* aCertVerifier, const nsACString& aHostName,
+                const OriginAttributes& aOriginAttributes,
+                const nsTArray<nsTArray<uint8_t>>& aPeerCertChain,
+                const Maybe<nsTArray<uint8_t>>& aStapledOCSPResponse,
+                const Maybe<nsTArray<uint8_t>>& aSCTsFromTLSExtension,
+                uint32_t aProviderFlags, uint32_t aCertVerifierFlags,
+                Time aTime)
+      : mCertVerifier(aCertVerifier),
+        mHostName(aHostName),
+        mOriginAttributes(aOriginAttributes),
+        mPeerCertChain(CloneCertChain(aPeerCertChain)),
+        mStapledOCSPResponse(CloneMaybeBytes(aStapledOCSPResponse)),
+        mSCTsFromTLSExtension(CloneMaybeBytes(aSCTsFromTLSExtension)),
+        mProviderFlags(aProviderFlags),
+        mCertVerifierFlags(aCertVerifierFlags),
+        mTime(aTime) {}
+
+  // Whether this result can be used for the verification of aOther.
+  bool Matches(const VerifiedChain& aOther) const {
+    Time expiry(mTime);
+    if (expiry.AddSeconds(kVerifiedChainLifetimeSeconds) != Success ||
+        aOther.mTime < mTime || aOther.mTime >= expiry) {
+      return false;
+    }
+    return mCertVerifier == aOther.mCertVerifier &&
+           mHostName == aOther.mHostName &&
+           mOriginAttributes == aOther.mOriginAttributes &&
+           mProviderFlags == aOther.mProviderFlags &&
+           mCertVerifierFlags == aOther.mCertVerifierFlags &&
+           mPeerCertChain == aOther.mPeerCertChain &&
+           mStapledOCSPResponse == aOther.mStapledOCSPResponse &&
+           mSCTsFromTLSExtension == aOther.mSCTsFromTLSExtension;
+  }
+
+  // The verification inputs.
+  RefPtr<SharedCertVerifier> mCertVerifier;
+  nsCString mHostName;
+  OriginAttributes mOriginAttributes;
+  nsTArray<nsTArray<uint8_t>> mPeerCertChain;
+  Maybe<nsTArray<uint8_t>> mStapledOCSPResponse;
+  Maybe<nsTArray<uint8_t>> mSCTsFromTLSExtension;
+  uint32_t mProviderFlags;
+  uint32_t mCertVerifierFlags;
+  Time mTime;
+
+  // Its results.
+  nsTArray<nsTArray<uint8_t>> mBuiltChain;
+  uint16_t mCertificateTransparencyStatus = 0;
+  EVStatus mEVStatus = EVStatus::NotEV;
+  bool mIsBuiltCertChainRootBuiltInRoot = false;
+};
+
+StaticMutex sVerifiedChainsMutex MOZ_UNANNOTATED;
+StaticAutoPtr<nsTArray<VerifiedChain>> sVerifiedChains;
+
+// Fills the results of aChain if a matching verification was remembered.
+bool LookupVerifiedChain(VerifiedChain& aChain) {
+  StaticMutexAutoLock lock(sVerifiedChainsMutex);
+  if (!sVerifiedChains) {
+    return false;
+  }
+
+  for (const VerifiedChain& verified : Reversed(*sVerifiedChains)) {
+    if (verified.Matches(aChain)) {
+      aChain.mBuiltChain = CloneCertChain(verified.mBuiltChain);
+      aChain.mCertificateTransparencyStatus =
+          verified.mCertificateTransparencyStatus;
+      aChain.mEVStatus = verified.mEVStatus;
+      aChain.mIsBuiltCertChainRootBuiltInRoot =
+          verified.mIsBuiltCertChainRootBuiltInRoot;
+      return true;
+    }
+  }
+  return false;
+}
+
+void RememberVerifiedChain(VerifiedChain&& aChain) {
+  StaticMutexAutoLock lock(sVerifiedChainsMutex);
+  if (!sVerifiedChains) {
+    sVerifiedChains = new nsTArray<VerifiedChain>();
+  }
+
+  if (sVerifiedChains->Length() >= kMaxVerifiedChains) {
+    sVerifiedChains->RemoveElementAt(0);
+  }
+  sVerifiedChains->AppendElement(std::move(aChain));
+}
+
+}  // namespace
+
+void ClearVerifiedServerCertChains() {
+  StaticMutexAutoLock lock(sVerifiedChainsMutex);
+  sVerifiedChains = nullptr;
 }
 
 // A probe value of 1 means "no error".
@@ -770,6 +897,29 @@ SSLServerCertVerificationJob::Run() {
   bool isCertChainRootBuiltInRoot = false;
   bool madeOCSPRequests = false;
   nsTArray<nsTArray<uint8_t>> builtChainBytesArray;
+
+  // Delegated credentials are not remembered, they are rare enough.
+  VerifiedChain verifiedChain(certVerifier, mHostName, mOriginAttributes,
+                              mPeerCertChain, mStapledOCSPResponse,
+                              mSCTsFromTLSExtension, mProviderFlags,
+                              mCertVerifierFlags, mTime);
+  if (mDCInfo.isNothing() && LookupVerifiedChain(verifiedChain)) {
+    MOZ_LOG(gPIPNSSLog, LogLevel::Debug,
+            ("[%" PRIx64 "] reusing a recent verification", mAddrForLogging));
+    nsresult rv = mResultTask->Dispatch(
+        std::move(verifiedChain.mBuiltChain), std::move(mPeerCertChain),
+        verifiedChain.mCertificateTransparencyStatus, verifiedChain.mEVStatus,
+        true, 0,
+        nsITransportSecurityInfo::OverridableErrorCategory::ERROR_UNSET,
+        verifiedChain.mIsBuiltCertChainRootBuiltInRoot, mProviderFlags, false);
+    if (NS_FAILED(rv)) {
+      // We can't release this off the STS thread because some parts of it
+      // are not threadsafe. Just leak mResultTask.
+      Unused << mResultTask.forget();
+    }
+    return rv;
+  }
+
   nsTArray<uint8_t> certBytes(mPeerCertChain.ElementAt(0).Clone());
   Result result = AuthCertificate(
       *certVerifier, mPinArg, certBytes, mPeerCertChain, mHostName,
@@ -784,11 +934,22 @@ SSLServerCertVerificationJob::Run() {
         elapsed);
     Telemetry::Accumulate(Telemetry::SSL_CERT_ERROR_OVERRIDES, 1);
 
+    uint16_t certificateTransparencyStatus =
+        TransportSecurityInfo::ConvertCertificateTransparencyInfoToStatus(
+            certificateTransparencyInfo);
+    if (mDCInfo.isNothing()) {
+      verifiedChain.mBuiltChain = CloneCertChain(builtChainBytesArray);
+      verifiedChain.mCertificateTransparencyStatus =
+          certificateTransparencyStatus;
+      verifiedChain.mEVStatus = evStatus;
+      verifiedChain.mIsBuiltCertChainRootBuiltInRoot =
+          isCertChainRootBuiltInRoot;
+      RememberVerifiedChain(std::move(verifiedChain));
+    }
+
     nsresult rv = mResultTask->Dispatch(
         std::move(builtChainBytesArray), std::move(mPeerCertChain),
-        TransportSecurityInfo::ConvertCertificateTransparencyInfoToStatus(
-            certificateTransparencyInfo),
-        evStatus, true, 0,
+        certificateTransparencyStatus, evStatus, true, 0,
         nsITransportSecurityInfo::OverridableErrorCategory::ERROR_UNSET,
         isCertChainRootBuiltInRoot, mProviderFlags, madeOCSPRequests);
     if (NS_FAILED(rv)) {
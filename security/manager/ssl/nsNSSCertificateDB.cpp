@@ -8,6 +8,7 @@
 #include "CryptoTask.h"
 #include "ExtendedValidation.h"
 #include "NSSCertDBTrustDomain.h"
+#include "PublicSSL.h"
 #include "certdb.h"
 #include "mozilla/glean/GleanMetrics.h"
 #include "mozilla/Assertions.h"
@@ -204,6 +205,7 @@ SECStatus ChangeCertTrustWithPossibleAuthentication(
   }
   if (srv == SECSuccess) {
     certVerifier->ClearTrustCache();
+    mozilla::psm::ClearVerifiedServerCertChains();
     return SECSuccess;
   }
 
@@ -227,6 +229,7 @@ SECStatus ChangeCertTrustWithPossibleAuthentication(
   }
 
   certVerifier->ClearTrustCache();
+  mozilla::psm::ClearVerifiedServerCertChains();
   return SECSuccess;
 }
 
@@ -1409,5 +1412,6 @@ nsNSSCertificateDB::ClearOCSPCache() {
   RefPtr<SharedCertVerifier> certVerifier(GetDefaultCertVerifier());
   NS_ENSURE_TRUE(certVerifier, NS_ERROR_FAILURE);
   certVerifier->ClearOCSPCache();
+  mozilla::psm::ClearVerifiedServerCertChains();
   return NS_OK;
 }
@@ -1921,6 +1921,7 @@ nsNSSComponent::GetDefaultCertVerifier(SharedCertVerifier** result) {
 void nsNSSComponent::DoClearSSLExternalAndInternalSessionCache() {
   SSL_ClearSessionCache();
   mozilla::net::SSLTokensCache::Clear();
+  mozilla::psm::ClearVerifiedServerCertChains();
 }
 
 NS_IMETHODIMP
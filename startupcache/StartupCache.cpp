@@ -15,6 +15,8 @@
 #include "mozilla/ResultExtensions.h"
 #include "mozilla/scache/StartupCache.h"
 #include "mozilla/ScopeExit.h"
+#include "mozilla/StartupTimeline.h"
+#include "mozilla/StaticPtr.h"
 #include "mozilla/Try.h"
 
 #include "nsClassHashtable.h"
@@ -142,6 +144,12 @@ StartupCache* StartupCache::GetSingleton() {
 
 void StartupCache::DeleteSingleton() { StartupCache::gStartupCache = nullptr; }
 
+// The buffers handed out by GetPinnedBuffer, which are moved here when the
+// StartupCache is deleted.
+static StaticAutoPtr<nsTArray<UniqueFreePtr<char[]>>> sPinnedBuffers;
+
+void StartupCache::DeletePinnedBuffers() { sPinnedBuffers = nullptr; }
+
 nsresult StartupCache::InitSingleton() {
   nsresult rv;
   StartupCache::gStartupCache = new StartupCache();
@@ -168,7 +176,27 @@ StartupCache::StartupCache()
       mRequestedCount(0),
       mCacheEntriesBaseOffset(0) {}
 
-StartupCache::~StartupCache() { UnregisterWeakMemoryReporter(this); }
+StartupCache::~StartupCache() {
+  UnregisterWeakMemoryReporter(this);
+
+  MutexAutoLock lock(mTableLock);
+  auto keepPinnedBuffers = [](decltype(mTable)& table) {
+    for (auto iter = table.iter(); !iter.done(); iter.next()) {
+      auto& value = iter.get().value();
+      if (!value.mPinned) {
+        continue;
+      }
+      if (!sPinnedBuffers) {
+        sPinnedBuffers = new nsTArray<UniqueFreePtr<char[]>>();
+      }
+      sPinnedBuffers->AppendElement(std::move(value.mData));
+    }
+  };
+  keepPinnedBuffers(mTable);
+  for (auto& table : mOldTables) {
+    keepPinnedBuffers(table);
+  }
+}
 
 nsresult StartupCache::Init() {
   // workaround for bug 653936
@@ -234,6 +262,10 @@ nsresult StartupCache::Init() {
     auto result = LoadArchive();
     rv = result.isErr() ? result.unwrapErr() : NS_OK;
   }
+  // LoadArchive fails when the disk cache is ignored, or missing or corrupt.
+  if (NS_SUCCEEDED(rv)) {
+    StartupTimeline::RecordOnce(StartupTimeline::STARTUP_CACHE_LOADED);
+  }
 
   gFoundDiskCacheOnInit = rv != NS_ERROR_FILE_NOT_FOUND;
 
@@ -453,6 +485,20 @@ nsresult StartupCache::GetBuffer(const char* id, const char** outbuf,
   return NS_OK;
 }
 
+nsresult StartupCache::GetPinnedBuffer(const char* id, const char** outbuf,
+                                       uint32_t* length) {
+  nsresult rv = GetBuffer(id, outbuf, length);
+  if (NS_FAILED(rv)) {
+    return rv;
+  }
+
+  MutexAutoLock lock(mTableLock);
+  decltype(mTable)::Ptr p = mTable.lookup(nsDependentCString(id));
+  MOZ_ASSERT(p && p->value().mData.get() == *outbuf);
+  p->value().mPinned = true;
+  return NS_OK;
+}
+
 // Makes a copy of the buffer, client retains ownership of inbuf.
 nsresult StartupCache::PutBuffer(const char* id, UniqueFreePtr<char[]>&& inbuf,
                                  uint32_t len) MOZ_NO_THREAD_SAFETY_ANALYSIS {
@@ -92,6 +92,9 @@ struct StartupCacheEntry {
   int32_t mHeaderOffsetInFile;
   int32_t mRequestedOrder;
   bool mRequested;
+  // Whether mData was handed out by GetPinnedBuffer, and must outlive the
+  // StartupCache.
+  bool mPinned = false;
 
   MOZ_IMPLICIT StartupCacheEntry(uint32_t aOffset, uint32_t aCompressedSize,
                                  uint32_t aUncompressedSize)
@@ -159,6 +162,13 @@ class StartupCache : public nsIMemoryReporter {
   // Returns a buffer that was previously stored, caller does not take ownership
   nsresult GetBuffer(const char* id, const char** outbuf, uint32_t* length);
 
+  // Like GetBuffer, but the buffer remains valid until DeletePinnedBuffers()
+  // is called, after the JS engine is shut down, even if the StartupCache is
+  // invalidated or deleted in the meantime. This lets the JS engine reference
+  // the decoded bytecode directly from the buffer.
+  nsresult GetPinnedBuffer(const char* id, const char** outbuf,
+                           uint32_t* length);
+
   // Stores a buffer. Caller yields ownership.
   nsresult PutBuffer(const char* id, UniqueFreePtr<char[]>&& inbuf,
                      uint32_t length);
@@ -191,6 +201,7 @@ class StartupCache : public nsIMemoryReporter {
   static StartupCache* GetSingletonNoInit();
   static StartupCache* GetSingleton();
   static void DeleteSingleton();
+  static void DeletePinnedBuffers();
 
   // This measures all the heap memory used by the StartupCache, i.e. it
   // excludes the mapping.
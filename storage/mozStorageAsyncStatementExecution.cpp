@@ -18,7 +18,9 @@
 #include "mozStorageAsyncStatementExecution.h"
 
 #include "mozilla/DebugOnly.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/Telemetry.h"
+#include "nsPrintfCString.h"
 
 #ifndef MOZ_STORAGE_SORTWARNING_SQL_DUMP
 #  include "mozilla/Logging.h"
@@ -68,8 +70,14 @@ nsresult AsyncExecuteStatements::execute(
     return NS_ERROR_NOT_AVAILABLE;
   }
 
+  // Counted before dispatching so that Run() never sees it underflow.
+  aConnection->pendingAsyncExecutions++;
+
   nsresult rv = target->Dispatch(event, NS_DISPATCH_NORMAL);
-  NS_ENSURE_SUCCESS(rv, rv);
+  if (NS_FAILED(rv)) {
+    aConnection->pendingAsyncExecutions--;
+    return rv;
+  }
 
   // Return it as the pending statement object and track it.
   event.forget(_stmt);
@@ -510,6 +518,16 @@ NS_IMETHODIMP
 AsyncExecuteStatements::Run() {
   MOZ_ASSERT(mConnection->isConnectionReadyOnThisThread());
 
+  const uint32_t queuedBehind = --mConnection->pendingAsyncExecutions;
+  if (profiler_is_collecting_markers()) {
+    // mIntervalStart is still the time this was dispatched at.
+    PROFILER_MARKER_TEXT(
+        "SQLite async queue", OTHER,
+        MarkerTiming::IntervalUntilNowFrom(mIntervalStart),
+        nsPrintfCString("%s, %u statements queued behind",
+                        mConnection->getFilename().get(), queuedBehind));
+  }
+
   // Do not run if we have been canceled.
   {
     MutexAutoLock lockedScope(mMutex);
@@ -784,6 +784,7 @@ Connection::Connection(Service* aService, int aFlags,
                        const nsCString& aTelemetryFilename, bool aInterruptible,
                        bool aIgnoreLockingMode, bool aOpenNotExclusive)
     : sharedAsyncExecutionMutex("Connection::sharedAsyncExecutionMutex"),
+      pendingAsyncExecutions(0),
       sharedDBMutex("Connection::sharedDBMutex"),
       eventTargetOpenedOn(WrapNotNull(GetCurrentSerialEventTarget())),
       mIsStatementOnHelperThreadInterruptible(false),
@@ -171,6 +171,13 @@ class Connection final : public mozIStorageConnection,
    */
   Mutex sharedAsyncExecutionMutex MOZ_UNANNOTATED;
 
+  /**
+   * The number of AsyncExecuteStatements dispatched to the async execution
+   * thread which haven't started running yet.  Reported in profiler markers
+   * to tell how long statements queue behind each other.
+   */
+  Atomic<uint32_t, Relaxed> pendingAsyncExecutions;
+
   /**
    * Wraps the mutex that SQLite gives us from sqlite3_db_mutex.  This is public
    * because we already expose the sqlite3* native connection and proper
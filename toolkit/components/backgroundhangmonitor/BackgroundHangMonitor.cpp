@@ -455,10 +455,17 @@ void BackgroundHangThread::ReportHang(TimeDuration aHangTime,
         return MakeStringSpan("BHR-detected hang");
       }
       static void StreamJSONMarkerData(
-          baseprofiler::SpliceableJSONWriter& aWriter) {}
+          baseprofiler::SpliceableJSONWriter& aWriter,
+          const ProfilerString8View& aRunnableName) {
+        aWriter.StringProperty("runnable", aRunnableName);
+      }
       static MarkerSchema MarkerTypeDisplay() {
         using MS = MarkerSchema;
         MS schema{MS::Location::MarkerChart, MS::Location::MarkerTable};
+        schema.AddKeyLabelFormatSearchable("runnable", "Runnable",
+                                           MS::Format::String,
+                                           MS::Searchable::Searchable);
+        schema.SetTableLabel("{marker.name} — {marker.data.runnable}");
         return schema;
       }
     };
@@ -468,7 +475,7 @@ void BackgroundHangThread::ReportHang(TimeDuration aHangTime,
     profiler_add_marker("BHR-detected hang", geckoprofiler::category::OTHER,
                         {MarkerThreadId(mStackHelper.GetThreadId()),
                          MarkerTiming::Interval(startTime, endTime)},
-                        HangMarker{});
+                        HangMarker{}, mRunnableName);
   }
 #endif
 }
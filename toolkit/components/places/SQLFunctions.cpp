@@ -53,10 +53,14 @@ using char_type = nsACString::char_type;
  *        It will be updated by this function.
  * @param aEnd
  *        An interator pointing to past-the-end of the string.
+ * @param aMatchDiacritics
+ *        Whether or not the match is diacritic-sensitive.  If it isn't,
+ *        non-ASCII characters may match ASCII ones once their diacritics are
+ *        removed, so only ASCII characters are skipped.
  */
 static MOZ_ALWAYS_INLINE void goToNextSearchCandidate(
     const_char_iterator& aStart, const const_char_iterator& aEnd,
-    uint32_t aSearchFor) {
+    uint32_t aSearchFor, bool aMatchDiacritics) {
   // If the character we search for is ASCII, then we can scan until we find
   // it or its ASCII uppercase character, modulo the special cases
   // U+0130 LATIN CAPITAL LETTER I WITH DOT ABOVE and U+212A KELVIN SIGN
@@ -78,6 +82,15 @@ static MOZ_ALWAYS_INLINE void goToNextSearchCandidate(
     // in the loop below.  For other characters we fall back to 0xff, which
     // is not a valid UTF-8 byte.
     unsigned char target = (unsigned char)(aSearchFor | 0x20);
+
+    if (!aMatchDiacritics) {
+      while (aStart < aEnd && (unsigned char)(*aStart) < 128 &&
+             (unsigned char)(*aStart | 0x20) != target) {
+        aStart++;
+      }
+      return;
+    }
+
     unsigned char special = 0xff;
     if (target == 'i' || target == 'k') {
       special = (target == 'i' ? 0xc4 : 0xe2);
@@ -202,10 +215,9 @@ static bool findInString(const nsDependentCSubstring& aToken,
   }
 
   for (;;) {
-    if (matchDiacritics) {
-      // Scan forward to the next viable candidate (if any).
-      goToNextSearchCandidate(sourceCur, sourceEnd, tokenFirstChar);
-    }
+    // Scan forward to the next viable candidate (if any).
+    goToNextSearchCandidate(sourceCur, sourceEnd, tokenFirstChar,
+                            matchDiacritics);
     if (sourceCur == sourceEnd) {
       break;
     }
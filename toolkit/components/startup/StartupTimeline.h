@@ -9,6 +9,7 @@
   mozilla_StartupTimeline_Event(MAIN, "main")
   mozilla_StartupTimeline_Event(SELECT_PROFILE, "selectProfile")
   mozilla_StartupTimeline_Event(AFTER_PROFILE_LOCKED, "afterProfileLocked")
+  mozilla_StartupTimeline_Event(STARTUP_CACHE_LOADED, "startupCacheLoaded")
 
   // Record the beginning and end of startup crash detection to compare with
   // crash stats to know whether detection should be improved to start or end
@@ -60,14 +61,17 @@ class StartupTimeline {
   static const char* Describe(Event ev) { return sStartupTimelineDesc[ev]; }
 
 #    ifdef MOZILLA_INTERNAL_API
-  static void Record(Event ev) {
+  static void Record(Event ev) { Record(ev, TimeStamp::Now()); }
+
+  // Every recorded event is also mirrored as a profiler marker at its own
+  // timestamp, so startup profiles line up milestones with subsystem markers.
+  static void Record(Event ev, TimeStamp when) {
     PROFILER_MARKER_UNTYPED(
-        ProfilerString8View::WrapNullTerminatedString(Describe(ev)), OTHER);
-    Record(ev, TimeStamp::Now());
+        ProfilerString8View::WrapNullTerminatedString(Describe(ev)), OTHER,
+        MarkerTiming::InstantAt(when));
+    sStartupTimeline[ev] = when;
   }
 
-  static void Record(Event ev, TimeStamp when) { sStartupTimeline[ev] = when; }
-
   static void RecordOnce(Event ev, const TimeStamp& aWhen);
   static void RecordOnce(Event ev);
 #    endif
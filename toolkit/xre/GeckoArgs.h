@@ -191,6 +191,10 @@ static CommandLineArg<UniqueFileHandle> sIPCHandle{"-ipcHandle", "ipchandle"};
 static CommandLineArg<mozilla::ipc::SharedMemoryHandle> sJsInitHandle{
     "-jsInitHandle", "jsinithandle"};
 static CommandLineArg<uint64_t> sJsInitLen{"-jsInitLen", "jsinitlen"};
+static CommandLineArg<mozilla::ipc::SharedMemoryHandle> sJsStencilsHandle{
+    "-jsStencilsHandle", "jsstencilshandle"};
+static CommandLineArg<uint64_t> sJsStencilsLen{"-jsStencilsLen",
+                                               "jsstencilslen"};
 static CommandLineArg<mozilla::ipc::SharedMemoryHandle> sPrefsHandle{
     "-prefsHandle", "prefshandle"};
 static CommandLineArg<uint64_t> sPrefsLen{"-prefsLen", "prefslen"};
@@ -208,6 +208,18 @@ struct NurseryPurpleBufferEntry {
   nsCycleCollectingAutoRefCnt* mRefCnt;
 };
 
+// Recently suspected objects on the main thread are first recorded in the
+// nursery purple buffer. When it is flushed, objects which stopped being purple
+// in the meantime are dropped rather than added to the purple buffer with
+// nsPurpleBuffer::Put. The nursery is flushed into the purple buffer when it is
+// full, and before the purple buffer is visited by forget skippable or by graph
+// building.
+//
+// The nursery is not collected on its own: a cycle collection must traverse
+// everything reachable from its roots to prove that a cycle is garbage, so a
+// graph built from young roots only is as large as the part of the heap they
+// reach. Forget skippable is the cheap pass over these entries, which removes
+// those known to be alive before the cycle collector builds its graph.
 #define NURSERY_PURPLE_BUFFER_SIZE 2048
 bool gNurseryPurpleBufferEnabled = true;
 NurseryPurpleBufferEntry gNurseryPurpleBufferEntry[NURSERY_PURPLE_BUFFER_SIZE];
@@ -2841,7 +2853,13 @@ void nsCycleCollector::ForgetSkippable(SliceBudget& aBudget,
                              aAsyncSnowWhiteFreeing, mForgetSkippableCB);
 }
 
+// Graph building must run on the thread which owns the collector. Traverse
+// methods are not thread-safe even when they only read: they read refcounts
+// and member pointers which the owning thread may change between slices, and
+// JS things are traced with the JS engine's tracer, which belongs to the
+// thread of their runtime.
 MOZ_NEVER_INLINE void nsCycleCollector::MarkRoots(SliceBudget& aBudget) {
+  CheckThreadSafety();
   JS::AutoAssertNoGC nogc;
   TimeLog timeLog;
   AutoRestore<bool> ar(mScanInProgress);
@@ -110,6 +110,7 @@
 #include "js/Prefs.h"
 #include "mozilla/StaticPrefs_javascript.h"
 #include "XPCSelfHostedShmem.h"
+#include "XPCSharedStencilShmem.h"
 
 #include "gfxPlatform.h"
 
@@ -503,6 +504,7 @@ NS_InitXPCOM(nsIServiceManager** aResult, nsIFile* aBinDirectory,
   RegisterStrongMemoryReporter(new ICUReporter());
   RegisterStrongMemoryReporter(new OggReporter());
   xpc::SelfHostedShmem::GetSingleton().InitMemoryReporter();
+  xpc::SharedStencilShmem::GetSingleton().InitMemoryReporter();
 
   mozilla::Telemetry::Init();
 
@@ -760,12 +762,14 @@ nsresult ShutdownXPCOM(nsIServiceManager* aServMgr) {
   }
 
   mozilla::ScriptPreloader::DeleteCacheDataSingleton();
+  mozilla::scache::StartupCache::DeletePinnedBuffers();
 
   mozilla::dom::SharedScriptCache::DeleteSingleton();
   mozilla::SharedStyleSheetCache::DeleteSingleton();
 
   // Release shared memory which might be borrowed by the JS engine.
   xpc::SelfHostedShmem::Shutdown();
+  xpc::SharedStencilShmem::Shutdown();
 
   // After all threads have been joined and the component manager has been shut
   // down, any remaining objects that could be holding NSS resources (should)
@@ -181,6 +181,10 @@ struct AtomCache : public MruCache<AtomTableKey, nsAtom*, AtomCache> {
   }
 };
 
+// These caches hold raw pointers to atoms, which stay valid only because
+// nsAtomTable::GC(), the only thing that frees unused dynamic atoms, clears
+// them first on the same thread. Caches for other threads would need GC() to
+// synchronize with each of them, so they only read through the subtables.
 static AtomCache sRecentlyUsedSmallMainThreadAtoms;
 static AtomCache sRecentlyUsedLargeMainThreadAtoms;
 
@@ -98,9 +98,38 @@ inline void AppendUTF8toUTF16(mozilla::Span<const char> aSource,
 // windows-1252!). The function names say "ASCII" instead of "Latin1" for
 // legacy reasons.
 
+namespace mozilla::detail {
+
+// Inputs this short are widened inline: for a handful of characters, the call
+// into the Rust converter costs more than the conversion itself.
+constexpr size_t kInlineLatin1toUTF16Length = 16;
+
+[[nodiscard]] inline bool AppendShortLatin1toUTF16(
+    mozilla::Span<const char> aSource, nsAString& aDest, size_t aOldLength,
+    bool aAllowShrinking) {
+  MOZ_ASSERT(aSource.Length() <= kInlineLatin1toUTF16Length);
+  size_t newLength = aOldLength + aSource.Length();
+  auto handleOrErr = aDest.BulkWrite(newLength, aOldLength, aAllowShrinking);
+  if (MOZ_UNLIKELY(handleOrErr.isErr())) {
+    return false;
+  }
+  auto handle = handleOrErr.unwrap();
+  char16_t* dest = handle.Elements() + aOldLength;
+  for (char c : aSource) {
+    *dest++ = static_cast<unsigned char>(c);
+  }
+  handle.Finish(newLength, aAllowShrinking);
+  return true;
+}
+
+}  // namespace mozilla::detail
+
 [[nodiscard]] inline bool CopyASCIItoUTF16(mozilla::Span<const char> aSource,
                                            nsAString& aDest,
                                            const mozilla::fallible_t&) {
+  if (aSource.Length() <= mozilla::detail::kInlineLatin1toUTF16Length) {
+    return mozilla::detail::AppendShortLatin1toUTF16(aSource, aDest, 0, true);
+  }
   return nsstring_fallible_append_latin1_impl(&aDest, aSource.Elements(),
                                               aSource.Length(), 0, true);
 }
@@ -115,6 +144,12 @@ inline void CopyASCIItoUTF16(mozilla::Span<const char> aSource,
 [[nodiscard]] inline bool AppendASCIItoUTF16(mozilla::Span<const char> aSource,
                                              nsAString& aDest,
                                              const mozilla::fallible_t&) {
+  if (aSource.Length() <= mozilla::detail::kInlineLatin1toUTF16Length) {
+    // Like AppendASCII(), leave any capacity reserved for an empty string
+    // alone when there is nothing to append.
+    return aSource.IsEmpty() || mozilla::detail::AppendShortLatin1toUTF16(
+                                    aSource, aDest, aDest.Length(), false);
+  }
   return nsstring_fallible_append_latin1_impl(
       &aDest, aSource.Elements(), aSource.Length(), aDest.Length(), false);
 }
@@ -16,9 +16,12 @@
 #include "nsISupports.h"
 #include "nsCOMArray.h"
 #include "mozilla/Attributes.h"
+#include "mozilla/HashTable.h"
 #include "mozilla/Unused.h"
 
 #include "gtest/gtest.h"
+#include "gtest/BlackBox.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 #include <numeric>
 
@@ -1630,3 +1633,86 @@ TEST(Hashtables, Values)
 
   EXPECT_EQ((nsTArray<uint64_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), values);
 }
+
+// Throughput of the PLDHashTable behind nsTHashMap next to mozilla::HashMap,
+// for the operations hot maps mostly do. Keys are scrambled so that they are
+// not inserted in hash order.
+static constexpr uint32_t kBenchKeyCount = 50000;
+
+static uint32_t BenchKey(uint32_t aIndex) { return aIndex * 2654435761u; }
+
+static void FillBenchTable(nsTHashMap<nsUint32HashKey, uint32_t>& aTable) {
+  for (uint32_t i = 0; i < kBenchKeyCount; i++) {
+    aTable.InsertOrUpdate(BenchKey(i), i);
+  }
+}
+
+static void FillBenchTable(mozilla::HashMap<uint32_t, uint32_t>& aTable) {
+  for (uint32_t i = 0; i < kBenchKeyCount; i++) {
+    MOZ_RELEASE_ASSERT(aTable.put(BenchKey(i), i));
+  }
+}
+
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapInsert, [] {
+  for (int run = 0; run < 10; run++) {
+    nsTHashMap<nsUint32HashKey, uint32_t> table;
+    FillBenchTable(*mozilla::BlackBox(&table));
+  }
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapInsert, [] {
+  for (int run = 0; run < 10; run++) {
+    mozilla::HashMap<uint32_t, uint32_t> table;
+    FillBenchTable(*mozilla::BlackBox(&table));
+  }
+});
+
+// Half of the lookups hit and half miss.
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapLookup, [] {
+  nsTHashMap<nsUint32HashKey, uint32_t> table;
+  FillBenchTable(table);
+  uint32_t found = 0;
+  for (int run = 0; run < 10; run++) {
+    for (uint32_t i = 0; i < 2 * kBenchKeyCount; i++) {
+      found += mozilla::BlackBox(&table)->Contains(BenchKey(i));
+    }
+  }
+  ASSERT_EQ(found, 10 * kBenchKeyCount);
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapLookup, [] {
+  mozilla::HashMap<uint32_t, uint32_t> table;
+  FillBenchTable(table);
+  uint32_t found = 0;
+  for (int run = 0; run < 10; run++) {
+    for (uint32_t i = 0; i < 2 * kBenchKeyCount; i++) {
+      found += mozilla::BlackBox(&table)->has(BenchKey(i));
+    }
+  }
+  ASSERT_EQ(found, 10 * kBenchKeyCount);
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapIterate, [] {
+  nsTHashMap<nsUint32HashKey, uint32_t> table;
+  FillBenchTable(table);
+  uint64_t sum = 0;
+  for (int run = 0; run < 100; run++) {
+    for (const auto& entry : *mozilla::BlackBox(&table)) {
+      sum += entry.GetData();
+    }
+  }
+  ASSERT_EQ(sum, 100 * uint64_t(kBenchKeyCount) * (kBenchKeyCount - 1) / 2);
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapIterate, [] {
+  mozilla::HashMap<uint32_t, uint32_t> table;
+  FillBenchTable(table);
+  uint64_t sum = 0;
+  for (int run = 0; run < 100; run++) {
+    for (auto iter = mozilla::BlackBox(&table)->iter(); !iter.done();
+         iter.next()) {
+      sum += iter.get().value();
+    }
+  }
+  ASSERT_EQ(sum, 100 * uint64_t(kBenchKeyCount) * (kBenchKeyCount - 1) / 2);
+});
@@ -154,6 +154,9 @@ void DoPushPopSequence(Queue<uint32_t, 8>& aQueue, uint32_t& aInSerial,
     aQueue.Push(aInSerial++);
   }
   EXPECT_EQ(aQueue.Count(), initialCount + aPush);
+  for (uint32_t i = 0; i < aQueue.Count(); ++i) {
+    EXPECT_EQ(aQueue.ElementAt(i), aOutSerial + i);
+  }
   for (uint32_t i = 0; i < aPop; ++i) {
     uint32_t popped = aQueue.Pop();
     EXPECT_EQ(popped, aOutSerial++);
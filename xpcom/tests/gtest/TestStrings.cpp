@@ -1413,6 +1413,30 @@ TEST_F(Strings, append_literal_with_capacity) {
   }
 }
 
+TEST_F(Strings, short_latin1_to_utf16) {
+  // Short enough to be widened inline, with bytes above 0x7F.
+  nsAutoString s;
+  CopyASCIItoUTF16("Gr\xFC\xDF"_ns, s);
+  EXPECT_TRUE(s.Equals(u"Grüß"));
+
+  AppendASCIItoUTF16(" Gott"_ns, s);
+  EXPECT_TRUE(s.Equals(u"Grüß Gott"));
+
+  // Long enough to go through the Rust converter.
+  AppendASCIItoUTF16(" und auf Wiedersehen"_ns, s);
+  EXPECT_TRUE(s.Equals(u"Grüß Gott und auf Wiedersehen"));
+
+  // Appending nothing keeps the reserved buffer.
+  nsAutoString reserved;
+  reserved.SetCapacity(8000);
+  const char16_t* ptr = reserved.BeginReading();
+  AppendASCIItoUTF16(""_ns, reserved);
+  EXPECT_EQ(reserved.BeginReading(), ptr);
+
+  CopyASCIItoUTF16(""_ns, s);
+  EXPECT_TRUE(s.IsEmpty());
+}
+
 // The following test is intentionally not memory
 // checking-clean.
 #if !(defined(MOZ_HAVE_MEM_CHECKS) || defined(MOZ_MSAN))
@@ -13,10 +13,12 @@
 #include "nsITargetShutdownTask.h"
 #include "nsIThread.h"
 #include "nsXPCOM.h"
+#include "mozilla/Atomics.h"
 #include "mozilla/gtest/MozAssertions.h"
 #include "mozilla/Monitor.h"
 #include "mozilla/SyncRunnable.h"
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 #ifdef XP_WIN
 #  include <windef.h>
@@ -413,3 +415,33 @@ TEST(Threads, OptionsIsUiThread)
   thread->Shutdown();
 }
 #endif
+
+// Measures cross-thread dispatch throughput: several producers dispatch small
+// runnables to one busy consumer thread.
+MOZ_GTEST_BENCH(Threads, PerfDispatchManyProducers, [] {
+  constexpr int kProducers = 4;
+  constexpr int kEventsPerProducer = 25000;
+
+  nsCOMPtr<nsIThread> consumer;
+  MOZ_ALWAYS_SUCCEEDS(
+      NS_NewNamedThread("DispatchConsumer", getter_AddRefs(consumer)));
+
+  Atomic<int> remaining(kProducers * kEventsPerProducer);
+  nsCOMPtr<nsIThread> producers[kProducers];
+  for (auto& producer : producers) {
+    MOZ_ALWAYS_SUCCEEDS(NS_NewNamedThread(
+        "DispatchProducer", getter_AddRefs(producer),
+        NS_NewRunnableFunction("PerfDispatchManyProducers", [&] {
+          for (int i = 0; i < kEventsPerProducer; i++) {
+            MOZ_ALWAYS_SUCCEEDS(consumer->Dispatch(NS_NewRunnableFunction(
+                "PerfDispatchManyProducers::Event", [&] { remaining--; })));
+          }
+        })));
+  }
+
+  for (auto& producer : producers) {
+    producer->Shutdown();
+  }
+  consumer->Shutdown();
+  EXPECT_EQ(0, int(remaining));
+});
@@ -540,6 +540,24 @@ class MozPromise : public MozPromiseBase {
       aPromise->mMutex.AssertCurrentThreadOwns();
       MOZ_ASSERT(!aPromise->IsPending());
 
+      if (aPromise->mUseSynchronousTaskDispatch &&
+          mResponseTarget->IsOnCurrentThread()) {
+        // Same thread chains resolve inline, so there is no need to allocate
+        // a runnable only to run it right away.
+        PROMISE_LOG(
+            "%s Then() call made from %s [Promise=%p, ThenValue=%p] "
+            "synchronous dispatch",
+            aPromise->mValue.IsResolve() ? "Resolving" : "Rejecting",
+            mCallSite.get(), aPromise, this);
+        // Like ResolveOrRejectRunnable, keep both the ThenValue and the
+        // promise alive: the callback may drop the last reference to the
+        // promise, whose mutex our caller still holds.
+        RefPtr<ThenValueBase> kungFuDeathGrip = this;
+        RefPtr<MozPromise> promiseGrip = aPromise;
+        DoResolveOrReject(aPromise->Value());
+        return;
+      }
+
       nsCOMPtr<nsIRunnable> r = new ResolveOrRejectRunnable(this, aPromise);
       PROMISE_LOG(
           "%s Then() call made from %s [Runnable=%p, Promise=%p, ThenValue=%p] "
@@ -550,14 +568,6 @@ class MozPromise : public MozPromiseBase {
           : aPromise->mUseDirectTaskDispatch    ? "directtask"
                                                 : "normal");
 
-      if (aPromise->mUseSynchronousTaskDispatch &&
-          mResponseTarget->IsOnCurrentThread()) {
-        PROMISE_LOG("ThenValue::Dispatch running task synchronously [this=%p]",
-                    this);
-        r->Run();
-        return;
-      }
-
       if (aPromise->mUseDirectTaskDispatch &&
           mResponseTarget->IsOnCurrentThread()) {
         PROMISE_LOG(
@@ -198,6 +198,24 @@ class Queue {
     return mTail->mEvents[offset];
   }
 
+  // Returns the element aIndex positions after the first one, walking one page
+  // for every ItemsPerPage elements skipped.
+  T& ElementAt(size_t aIndex) {
+    MOZ_ASSERT(aIndex < Count());
+    if (aIndex < mHeadLength) {
+      return mHead->mEvents[(mOffsetHead + aIndex) % ItemsPerPage];
+    }
+    // Pages after the head one are filled from their start, and all but the
+    // tail are full.
+    aIndex -= mHeadLength;
+    Page* page = mHead->mNext;
+    while (aIndex >= ItemsPerPage) {
+      aIndex -= ItemsPerPage;
+      page = page->mNext;
+    }
+    return page->mEvents[aIndex];
+  }
+
   size_t Count() const {
     // It is obvious count is 0 when the queue is empty.
     if (!mHead) {
@@ -16,6 +16,7 @@
 #include "mozilla/InputTaskManager.h"
 #include "mozilla/VsyncTaskManager.h"
 #include "mozilla/IOInterposer.h"
+#include "mozilla/Logging.h"
 #include "mozilla/Perfetto.h"
 #include "mozilla/StaticPtr.h"
 #include "mozilla/SchedulerGroup.h"
@@ -27,6 +28,10 @@
 
 namespace mozilla {
 
+// Logs how busy each pool thread was over its lifetime when the pool is shut
+// down, to tell whether the pool is over- or under-sized for the workload.
+static LazyLogModule gTaskControllerLog("TaskController");
+
 StaticAutoPtr<TaskController> TaskController::sSingleton;
 
 std::atomic<uint64_t> Task::sCurrentTaskSeqNo = 0;
@@ -67,6 +72,11 @@ struct PoolThread {
   // propagation. This is -only- valid when mCurrentTask != nullptr.
   uint32_t mEffectiveTaskPriority = 0;
 
+  // Only updated while gTaskControllerLog is enabled, protected by the graph
+  // mutex.
+  TimeDuration mBusyTime;
+  uint64_t mTaskCount = 0;
+
   PoolThread(size_t aIndex, Mutex& aGraphMutex)
       : mIndex(aIndex), mThreadCV(aGraphMutex, "PoolThread::mThreadCV") {}
 };
@@ -288,6 +298,7 @@ void TaskController::InitializeThreadPool() {
   }
 
   mIdleThreadCount = mPoolThreads.size();
+  mThreadPoolStart = TimeStamp::Now();
 }
 
 /* static */
@@ -323,6 +334,24 @@ void TaskController::ShutdownThreadPoolInternal() {
   }
 
   MOZ_ASSERT(mIdleThreadCount == mPoolThreads.size());
+
+  if (mPoolThreads.empty() ||
+      !MOZ_LOG_TEST(gTaskControllerLog, LogLevel::Info)) {
+    return;
+  }
+
+  TimeDuration lifetime = TimeStamp::Now() - mThreadPoolStart;
+  MOZ_LOG(gTaskControllerLog, LogLevel::Info,
+          ("%zu pool threads, at most %zu threadable tasks queued",
+           mPoolThreads.size(), mMaxThreadableTaskCount));
+  for (auto& thread : mPoolThreads) {
+    MOZ_LOG(gTaskControllerLog, LogLevel::Info,
+            ("TaskController #%zu ran %" PRIu64 " tasks, busy %.1f%% of %.0fms",
+             thread->mIndex, thread->mTaskCount,
+             lifetime > TimeDuration() ? 100.0 * (thread->mBusyTime / lifetime)
+                                       : 0.0,
+             lifetime.ToMilliseconds()));
+  }
 }
 
 void TaskController::RunPoolThread(PoolThread* aThread) {
@@ -343,6 +372,10 @@ void TaskController::RunPoolThread(PoolThread* aThread) {
 
     Task* task = aThread->mCurrentTask;
     bool taskCompleted = false;
+    TimeStamp start;
+    if (MOZ_LOG_TEST(gTaskControllerLog, LogLevel::Info)) {
+      start = TimeStamp::Now();
+    }
 
     {
       MutexAutoUnlock unlock(mGraphMutex);
@@ -350,6 +383,11 @@ void TaskController::RunPoolThread(PoolThread* aThread) {
       taskCompleted = task->Run() == Task::TaskResult::Complete;
     }
 
+    if (!start.IsNull()) {
+      aThread->mBusyTime += TimeStamp::Now() - start;
+      aThread->mTaskCount++;
+    }
+
     task->mInProgress = false;
 
     if (!taskCompleted) {
@@ -451,6 +489,8 @@ void TaskController::AddTask(already_AddRefed<Task>&& aTask) {
       break;
     case Task::Kind::OffMainThreadOnly:
       insertion = mThreadableTasks.insert(std::move(task));
+      mMaxThreadableTaskCount =
+          std::max(mMaxThreadableTaskCount, mThreadableTasks.size());
       break;
   }
   (*insertion.first)->mIterator = insertion.first;
@@ -427,6 +427,11 @@ class TaskController {
   // Number of pool threads that are currently idle.
   size_t mIdleThreadCount = 0;
 
+  // The largest number of threadable tasks waiting at once, and when the pool
+  // threads were started, for the utilization summary logged at shutdown.
+  size_t mMaxThreadableTaskCount = 0;
+  TimeStamp mThreadPoolStart;
+
   // This ensures we keep running the main thread if we processed a task there.
   bool mMayHaveMainThreadTask = true;
   bool mShuttingDown = false;
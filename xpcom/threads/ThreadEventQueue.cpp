@@ -126,7 +126,9 @@ bool ThreadEventQueue::PutEventInternal(already_AddRefed<nsIRunnable>&& aEvent,
       mBaseQueue->PutEvent(event.take(), aPriority, lock);
     }
 
-    mEventsAvailable.Notify();
+    if (mConsumerWaiting) {
+      mEventsAvailable.Notify();
+    }
 
     // Make sure to grab the observer before dropping the lock, otherwise the
     // event that we just placed into the queue could run and eventually delete
@@ -173,7 +175,9 @@ already_AddRefed<nsIRunnable> ThreadEventQueue::GetEvent(
       }
 
       AUTO_PROFILER_LABEL("ThreadEventQueue::GetEvent::Wait", IDLE);
+      mConsumerWaiting = true;
       mEventsAvailable.Wait();
+      mConsumerWaiting = false;
     }
   }
 
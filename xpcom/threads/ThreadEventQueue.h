@@ -80,6 +80,10 @@ class ThreadEventQueue final : public SynchronizedEventQueue {
 
   Mutex mLock;
   CondVar mEventsAvailable MOZ_GUARDED_BY(mLock);
+  // Whether the consuming thread is blocked on mEventsAvailable in GetEvent.
+  // Dispatching to a busy thread then only has to push the event, which keeps
+  // the time producers hold mLock short.
+  bool mConsumerWaiting MOZ_GUARDED_BY(mLock) = false;
 
   bool mEventsAreDoomed MOZ_GUARDED_BY(mLock) = false;
   nsCOMPtr<nsIThreadObserver> mObserver MOZ_GUARDED_BY(mLock);
@@ -634,9 +634,13 @@ void TimerThread::VerifyTimerListConsistency() const {
              mTimers[lastNonCanceledTimerIndex].Value()->mTimeout ==
                  mTimers[lastNonCanceledTimerIndex].Timeout());
 
-  // Verify that mTimers is sorted and the cached timeouts are consistent.
+  // Verify that mTimers is sorted, including the canceled entries that
+  // ComputeTimerInsertionIndex() searches through, and that the cached
+  // timeouts are consistent.
   for (size_t timerIndex = lastNonCanceledTimerIndex + 1;
        timerIndex < timerCount; ++timerIndex) {
+    MOZ_ASSERT(mTimers[timerIndex].Timeout() >=
+               mTimers[timerIndex - 1].Timeout());
     if (mTimers[timerIndex].Value()) {
       MOZ_ASSERT(mTimers[timerIndex].Timeout() ==
                  mTimers[timerIndex].Value()->mTimeout);
@@ -651,16 +655,15 @@ void TimerThread::VerifyTimerListConsistency() const {
 size_t TimerThread::ComputeTimerInsertionIndex(const TimeStamp& timeout) const {
   mMonitor.AssertCurrentThreadOwns();
 
-  const size_t timerCount = mTimers.Length();
-
-  size_t firstGtIndex = 0;
-  while (firstGtIndex < timerCount &&
-         (!mTimers[firstGtIndex].Value() ||
-          mTimers[firstGtIndex].Timeout() <= timeout)) {
-    ++firstGtIndex;
-  }
-
-  return firstGtIndex;
+  // Canceled entries keep the timeout of the timer they held, so the whole
+  // list and not only its live timers is sorted, and can be binary searched.
+  // Pages with thousands of timers would otherwise scan them all on every
+  // insertion.
+  return std::upper_bound(mTimers.begin(), mTimers.end(), timeout,
+                          [](const TimeStamp& aTimeout, const Entry& aEntry) {
+                            return aTimeout < aEntry.Timeout();
+                          }) -
+         mTimers.begin();
 }
 
 TimeStamp TimerThread::ComputeWakeupTimeFromTimers() const {
@@ -1222,8 +1225,9 @@ bool TimerThread::AddTimerInternal(nsTimerImpl& aTimer) {
   // Extract the timer at the insertion point, and put the new timer in its
   // place.
   Entry extractedEntry = std::exchange(mTimers[insertionIndex], Entry{aTimer});
-  // Following entries can be pushed until we hit a canceled timer or the end.
-  for (size_t i = insertionIndex + 1; i < length; ++i) {
+  // Following entries can be pushed until we hit a canceled timer or the end,
+  // which includes the canceled entry appended above to expand the array.
+  for (size_t i = insertionIndex + 1; i < mTimers.Length(); ++i) {
     Entry& entryRef = mTimers[i];
     if (!entryRef.Value()) {
       // Canceled entry, overwrite it with the extracted entry from before.
@@ -1253,6 +1257,18 @@ bool TimerThread::RemoveTimerInternal(nsTimerImpl& aTimer) {
     return false;
   }
   AUTO_TIMERS_STATS(TimerThread_RemoveTimerInternal_in_list);
+  // The entry caches the timer's timeout, so look among the entries sharing it
+  // first.
+  for (size_t i = ComputeTimerInsertionIndex(aTimer.mTimeout); i > 0; --i) {
+    Entry& entry = mTimers[i - 1];
+    if (entry.Timeout() != aTimer.mTimeout) {
+      break;
+    }
+    if (entry.Value() == &aTimer) {
+      entry.Forget();
+      return true;
+    }
+  }
   for (auto& entry : mTimers) {
     if (entry.Value() == &aTimer) {
       entry.Forget();